@@ -0,0 +1,19 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_ZLIB FALSE)
+if(NOT EL_DISABLE_ZLIB)
+  # Search for zlib (used for reading and writing gzip-compressed MPS files)
+  find_package(ZLIB)
+  if(ZLIB_FOUND)
+    set(EL_HAVE_ZLIB TRUE)
+    message(STATUS "Found zlib")
+  else()
+    message(STATUS "Did NOT find zlib")
+  endif()
+endif()
@@ -555,11 +555,14 @@ if(EL_HAVE_MPI_LONG_LONG AND NOT EL_DISABLE_MPFR)
   endif()
 endif()
 
-if(EL_DISABLE_PARMETIS)
+if(EL_DISABLE_METIS)
+  set(EL_HAVE_METIS FALSE)
+  set(EL_HAVE_PARMETIS FALSE)
+elseif(EL_DISABLE_PARMETIS)
   include(external_projects/ElMath/METIS)
 else()
   include(external_projects/ElMath/ParMETIS)
 endif()
 if(NOT EL_HAVE_METIS)
-  message(FATAL_ERROR "METIS support is required for Elemental but existing support was not detected and downloading was prevented")
+  message(STATUS "METIS was not available, so the native multilevel graph bisection will be used")
 endif()
@@ -0,0 +1,215 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Sweep over a range of algorithmic blocksizes for each of the major blocked
+// routines on the current process grid (or sequentially), record the fastest
+// blocksize for each routine in the tuned blocksize table, and write the table
+// to a file which can later be loaded by setting the EL_BLOCKSIZE_FILE
+// environment variable (or by calling El::LoadTunedBlocksizes).
+
+template<typename F>
+double TimeRoutine
+( const std::string& routine, El::Int n, bool sequential, const El::Grid& grid )
+{
+    typedef El::Base<F> Real;
+    El::Timer timer;
+    if( sequential )
+    {
+        El::Matrix<F> A, householderScalars;
+        El::Matrix<Real> signature;
+        El::Permutation P;
+        if( routine == "Cholesky" )
+        {
+            El::HermitianUniformSpectrum( A, n, Real(1), Real(2) );
+            timer.Start();
+            El::Cholesky( El::LOWER, A );
+        }
+        else if( routine == "LU" )
+        {
+            El::Uniform( A, n, n );
+            timer.Start();
+            El::LU( A, P );
+        }
+        else if( routine == "QR" )
+        {
+            El::Uniform( A, n, n );
+            timer.Start();
+            El::QR( A, householderScalars, signature );
+        }
+        else if( routine == "HermitianTridiag" )
+        {
+            El::HermitianUniformSpectrum( A, n, Real(1), Real(2) );
+            timer.Start();
+            El::HermitianTridiag( El::LOWER, A, householderScalars );
+        }
+        else
+            El::LogicError("Unsupported sequential routine ",routine);
+        return timer.Stop();
+    }
+
+    El::DistMatrix<F> A(grid), B(grid), C(grid);
+    El::DistMatrix<F,El::MD,El::STAR> householderScalars(grid);
+    El::DistMatrix<Real,El::MD,El::STAR> signature(grid);
+    El::DistPermutation P(grid);
+    if( routine == "Cholesky" )
+        El::HermitianUniformSpectrum( A, n, Real(1), Real(2) );
+    else if( routine == "HermitianTridiag" )
+        El::HermitianUniformSpectrum( A, n, Real(1), Real(2) );
+    else if( routine == "Trsm" )
+    {
+        El::Uniform( A, n, n );
+        El::ShiftDiagonal( A, F(n) );
+        El::Uniform( B, n, n );
+    }
+    else if( routine == "Gemm" )
+    {
+        El::Uniform( A, n, n );
+        El::Uniform( B, n, n );
+        El::Zeros( C, n, n );
+    }
+    else
+        El::Uniform( A, n, n );
+
+    El::mpi::Barrier( grid.Comm() );
+    timer.Start();
+    if( routine == "Cholesky" )
+        El::Cholesky( El::LOWER, A );
+    else if( routine == "LU" )
+        El::LU( A, P );
+    else if( routine == "QR" )
+        El::QR( A, householderScalars, signature );
+    else if( routine == "HermitianTridiag" )
+        El::HermitianTridiag( El::LOWER, A, householderScalars );
+    else if( routine == "Trsm" )
+        El::Trsm
+        ( El::LEFT, El::LOWER, El::NORMAL, El::NON_UNIT, F(1), A, B );
+    else if( routine == "Gemm" )
+        El::Gemm( El::NORMAL, El::NORMAL, F(1), A, B, F(0), C );
+    else
+        El::LogicError("Unsupported routine ",routine);
+    El::mpi::Barrier( grid.Comm() );
+    return timer.Stop();
+}
+
+template<typename F>
+void TuneDatatype
+( El::Int n,
+  El::Int minBlocksize,
+  El::Int maxBlocksize,
+  El::Int blocksizeStep,
+  El::Int numRepeats,
+  bool sequential,
+  const El::Grid& grid )
+{
+    El::OutputFromRoot
+    (grid.Comm(),"Tuning blocksizes for ",El::TypeName<F>()," with n=",n);
+    El::PushIndent();
+
+    std::vector<std::string> routines;
+    routines.push_back("Cholesky");
+    routines.push_back("LU");
+    routines.push_back("QR");
+    routines.push_back("HermitianTridiag");
+    if( !sequential )
+    {
+        routines.push_back("Trsm");
+        routines.push_back("Gemm");
+    }
+    const El::Int gridHeight = ( sequential ? 0 : grid.Height() );
+    const El::Int gridWidth = ( sequential ? 0 : grid.Width() );
+
+    for( const auto& routine : routines )
+    {
+        El::Int bestBlocksize = minBlocksize;
+        double bestTime = std::numeric_limits<double>::max();
+        for( El::Int nb=minBlocksize; nb<=maxBlocksize; nb+=blocksizeStep )
+        {
+            // An explicitly pushed blocksize takes precedence over the table
+            El::PushBlocksizeStack( nb );
+            double minTime = std::numeric_limits<double>::max();
+            for( El::Int repeat=0; repeat<numRepeats; ++repeat )
+                minTime =
+                  El::Min( minTime, TimeRoutine<F>(routine,n,sequential,grid) );
+            El::PopBlocksizeStack();
+
+            // Every process must agree upon the chosen blocksize
+            minTime = El::mpi::AllReduce( minTime, El::mpi::MAX, grid.Comm() );
+            if( minTime < bestTime )
+            {
+                bestTime = minTime;
+                bestBlocksize = nb;
+            }
+        }
+        El::SetTunedBlocksize<F>
+        ( routine, bestBlocksize, gridHeight, gridWidth );
+        El::OutputFromRoot
+        (grid.Comm(),routine,": best blocksize ",bestBlocksize," (",bestTime,
+         " seconds)");
+    }
+    El::PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+    El::mpi::Comm comm = El::mpi::COMM_WORLD;
+
+    try
+    {
+        const El::Int n = El::Input("--n","problem size",2000);
+        const El::Int minBlocksize =
+          El::Input("--minBlocksize","smallest blocksize to try",32);
+        const El::Int maxBlocksize =
+          El::Input("--maxBlocksize","largest blocksize to try",256);
+        const El::Int blocksizeStep =
+          El::Input("--blocksizeStep","blocksize increment",32);
+        const El::Int numRepeats =
+          El::Input("--numRepeats","number of timings per blocksize",2);
+        const bool sequential =
+          El::Input("--sequential","tune the sequential routines?",false);
+        const bool testComplex =
+          El::Input("--testComplex","tune complex datatypes?",true);
+        const std::string filename =
+          El::Input("--filename","output file",std::string("blocksizes.txt"));
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        if( minBlocksize < 1 || blocksizeStep < 1 )
+            El::LogicError("Blocksizes and increments must be positive");
+        if( sequential && El::mpi::Size(comm) != 1 )
+            El::LogicError("Sequential tuning should be run on one process");
+
+        const El::Grid grid( comm );
+        El::ClearTunedBlocksizes();
+        TuneDatatype<float>
+        ( n, minBlocksize, maxBlocksize, blocksizeStep, numRepeats,
+          sequential, grid );
+        TuneDatatype<double>
+        ( n, minBlocksize, maxBlocksize, blocksizeStep, numRepeats,
+          sequential, grid );
+        if( testComplex )
+        {
+            TuneDatatype<El::Complex<float>>
+            ( n, minBlocksize, maxBlocksize, blocksizeStep, numRepeats,
+              sequential, grid );
+            TuneDatatype<El::Complex<double>>
+            ( n, minBlocksize, maxBlocksize, blocksizeStep, numRepeats,
+              sequential, grid );
+        }
+
+        if( El::mpi::Rank(comm) == 0 )
+            El::SaveTunedBlocksizes( filename );
+        El::OutputFromRoot(comm,"Wrote tuned blocksizes to ",filename);
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
@@ -61,6 +61,7 @@ void SparseLoadAndSolve
   bool minimize,
   bool keepNonnegativeWithZeroUpperBounds,
   bool metadataSummary,
+  bool presolve,
   bool print )
 {
     EL_DEBUG_CSE
@@ -86,6 +87,8 @@ void SparseLoadAndSolve
     El::AffineLPSolution<El::Matrix<Real>> solution;
     El::lp::affine::Ctrl<Real> ctrl;
     ctrl.mehrotraCtrl.print = true;
+    ctrl.presolve = presolve;
+    ctrl.presolveCtrl.print = true;
     El::LP( problem, solution, ctrl );
     El::Output("Solving took ",timer.Stop()," seconds");
     if( print )
@@ -121,6 +124,8 @@ int main( int argc, char* argv[] )
           El::Input("--testDense","test with dense matrices?",false);
         const bool testDouble =
           El::Input("--testDouble","test double-precision?",true);
+        const bool presolve =
+          El::Input("--presolve","presolve the sparse LPs?",false);
         const bool print = El::Input("--print","print matrices?",false);
         El::ProcessInput();
         El::PrintInputReport();
@@ -148,16 +153,16 @@ int main( int argc, char* argv[] )
             SparseLoadAndSolve<double>
             ( filename, compressed,
               minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-              print );
+              presolve, print );
 #ifdef EL_HAVE_QD
         SparseLoadAndSolve<El::DoubleDouble>
         ( filename, compressed,
           minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-          print );
+          presolve, print );
         SparseLoadAndSolve<El::QuadDouble>
         ( filename, compressed,
           minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-          print );
+          presolve, print );
 #endif
     }
     catch( std::exception& e ) { El::ReportException(e); }
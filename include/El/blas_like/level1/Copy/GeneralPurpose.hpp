@@ -18,6 +18,11 @@ void Helper
         AbstractDistMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    if( A.Grid() == B.Grid() && RedistPlanCacheSize() > 0 )
+    {
+        PlannedRedist( A, B );
+        return;
+    }
 
     // TODO: Decide whether S or T should be used as the transmission type
     //       based upon which is smaller. Transmit S by default.
@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTPLAN_HPP
+#define EL_BLAS_COPY_REDISTPLAN_HPP
+
+#include <memory>
+
+namespace El {
+namespace copy {
+
+// The parameters which determine the communication pattern of a general
+// redistribution between two matrices over the same grid
+struct RedistPlanKey
+{
+    DistWrap wrapA, wrapB;
+    DistData distA, distB;
+    Int height, width;
+    // Guard against a new grid being allocated where a freed one used to be
+    int gridHeight, gridSize, vcRank;
+    GridOrder gridOrder;
+
+    RedistPlanKey() { }
+
+    template<typename S,typename T>
+    RedistPlanKey
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+    : wrapA(A.Wrap()), wrapB(B.Wrap()), distA(A), distB(B),
+      height(A.Height()), width(A.Width()),
+      gridHeight(B.Grid().Height()), gridSize(B.Grid().Size()),
+      vcRank(B.Grid().VCRank()), gridOrder(B.Grid().Order())
+    { }
+};
+inline bool operator==( const RedistPlanKey& A, const RedistPlanKey& B )
+{ return A.wrapA      == B.wrapA &&
+         A.wrapB      == B.wrapB &&
+         A.distA      == B.distA &&
+         A.distB      == B.distB &&
+         A.height     == B.height &&
+         A.width      == B.width &&
+         A.gridHeight == B.gridHeight &&
+         A.gridSize   == B.gridSize &&
+         A.vcRank     == B.vcRank &&
+         A.gridOrder  == B.gridOrder; }
+
+// The packing maps and communication pattern of a redistribution over the
+// VC communicator of a grid. The local entries of the source matrix are
+// traversed in column-major order and are either copied directly into the
+// local matrix of the target or packed into the send buffer. Since every
+// process traverses its entries in increasing global column and then row
+// order, each process can determine the order of the entries it receives
+// without any communication, and so a plan can be built independently by
+// each process.
+struct RedistPlan
+{
+    // For each local entry of the source, its position in the send buffer,
+    // or -1 if it is copied directly into the target
+    vector<Int> packPositions;
+    // The local indices of the target for the directly copied entries
+    vector<Int> localRows, localCols;
+    // The local indices of the target for each received entry
+    vector<Int> unpackRows, unpackCols;
+
+    vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+    Int totalSend=0, totalRecv=0;
+
+    Int NumBytes() const
+    {
+        const Int numInts = packPositions.size() +
+          localRows.size() + localCols.size() +
+          unpackRows.size() + unpackCols.size();
+        const Int numCounts = sendCounts.size() + sendOffs.size() +
+          recvCounts.size() + recvOffs.size();
+        return numInts*sizeof(Int) + numCounts*sizeof(int);
+    }
+};
+
+// Return the cached plan for the given key, or a null pointer if there is
+// none, and mark the plan as the most recently used
+shared_ptr<const RedistPlan> FindRedistPlan( const RedistPlanKey& key );
+// Cache the plan, evicting the least recently used plans if necessary
+void StoreRedistPlan
+( const RedistPlanKey& key, shared_ptr<const RedistPlan> plan );
+
+template<typename S,typename T>
+shared_ptr<const RedistPlan> BuildRedistPlan
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Grid& g = B.Grid();
+    const bool BPartic = B.Participating();
+    const bool noRedundant = B.RedundantSize() == 1;
+    auto plan = std::make_shared<RedistPlan>();
+
+    // Both matrices are first redistributed to redundant rank 0
+    const int redundantRoot = 0;
+    const int vcSize = mpi::Size( g.VCComm() );
+    const int vcRank = g.VCRank();
+
+    // Form the send pattern
+    // =====================
+    plan->sendCounts.resize( vcSize, 0 );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    plan->packPositions.resize( localHeight*localWidth, -1 );
+    if( A.RedundantRank() == redundantRoot )
+    {
+        const int distBSize = mpi::Size( B.DistComm() );
+        vector<int> distBToVC(distBSize);
+        for( int distBRank=0; distBRank<distBSize; ++distBRank )
+            distBToVC[distBRank] =
+              g.CoordsToVC
+              (B.ColDist(),B.RowDist(),distBRank,B.Root(),redundantRoot);
+
+        const int colStride = B.ColStride();
+        const int rowRank = B.RowRank();
+        const int colRank = B.ColRank();
+        vector<int> ownerRows(localHeight);
+        vector<Int> localRows(localHeight);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            ownerRows[iLoc] = B.RowOwner(i);
+            localRows[iLoc] = B.LocalRow(i,ownerRows[iLoc]);
+        }
+
+        // Temporarily store the destination of each entry
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const int ownerCol = B.ColOwner(j);
+            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const int ownerRow = ownerRows[iLoc];
+                const bool isLocalRow = ( BPartic && ownerRow == colRank );
+                if( noRedundant && isLocalRow && isLocalCol )
+                {
+                    plan->localRows.push_back( localRows[iLoc] );
+                    plan->localCols.push_back( B.LocalCol(j,ownerCol) );
+                }
+                else
+                {
+                    const int owner = distBToVC[ownerRow+colStride*ownerCol];
+                    plan->packPositions[iLoc+jLoc*localHeight] = owner;
+                    ++plan->sendCounts[owner];
+                }
+            }
+        }
+        plan->totalSend = Scan( plan->sendCounts, plan->sendOffs );
+
+        // Convert the destinations into positions in the send buffer
+        auto offs = plan->sendOffs;
+        for( auto& position : plan->packPositions )
+            if( position >= 0 )
+                position = offs[position]++;
+    }
+    else
+        Scan( plan->sendCounts, plan->sendOffs );
+
+    // Form the receive pattern
+    // ========================
+    plan->recvCounts.resize( vcSize, 0 );
+    vector<int> senders;
+    if( BPartic && B.RedundantRank() == redundantRoot )
+    {
+        const int distASize = mpi::Size( A.DistComm() );
+        vector<int> distAToVC(distASize);
+        for( int distARank=0; distARank<distASize; ++distARank )
+            distAToVC[distARank] =
+              g.CoordsToVC
+              (A.ColDist(),A.RowDist(),distARank,A.Root(),redundantRoot);
+
+        const int colStride = A.ColStride();
+        const Int BLocalHeight = B.LocalHeight();
+        const Int BLocalWidth = B.LocalWidth();
+        vector<int> ownerRows(BLocalHeight);
+        for( Int iLoc=0; iLoc<BLocalHeight; ++iLoc )
+            ownerRows[iLoc] = A.RowOwner(B.GlobalRow(iLoc));
+
+        senders.resize( BLocalHeight*BLocalWidth );
+        for( Int jLoc=0; jLoc<BLocalWidth; ++jLoc )
+        {
+            const int ownerCol = A.ColOwner(B.GlobalCol(jLoc));
+            for( Int iLoc=0; iLoc<BLocalHeight; ++iLoc )
+            {
+                int sender = distAToVC[ownerRows[iLoc]+colStride*ownerCol];
+                // The sender directly copied this entry
+                if( noRedundant && sender == vcRank )
+                    sender = -1;
+                else
+                    ++plan->recvCounts[sender];
+                senders[iLoc+jLoc*BLocalHeight] = sender;
+            }
+        }
+        plan->totalRecv = Scan( plan->recvCounts, plan->recvOffs );
+
+        plan->unpackRows.resize( plan->totalRecv );
+        plan->unpackCols.resize( plan->totalRecv );
+        auto offs = plan->recvOffs;
+        for( Int jLoc=0; jLoc<BLocalWidth; ++jLoc )
+        {
+            for( Int iLoc=0; iLoc<BLocalHeight; ++iLoc )
+            {
+                const int sender = senders[iLoc+jLoc*BLocalHeight];
+                if( sender >= 0 )
+                {
+                    const int position = offs[sender]++;
+                    plan->unpackRows[position] = iLoc;
+                    plan->unpackCols[position] = jLoc;
+                }
+            }
+        }
+    }
+    else
+        Scan( plan->recvCounts, plan->recvOffs );
+
+    return plan;
+}
+
+// Redistribute A into B, which must share its grid, using a cached plan
+template<typename S,typename T>
+void PlannedRedist
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Grid& g = B.Grid();
+    if( A.Grid() != g )
+        LogicError("A and B must share the same grid");
+    B.Resize( A.Height(), A.Width() );
+    if( !g.InGrid() )
+        return;
+
+    const RedistPlanKey key( A, B );
+    auto plan = FindRedistPlan( key );
+    if( !plan )
+    {
+        plan = BuildRedistPlan( A, B );
+        StoreRedistPlan( key, plan );
+    }
+
+    // Pack the data
+    // =============
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
+    vector<S> sendBuf;
+    FastResize( sendBuf, plan->totalSend );
+    Int numLocal = 0;
+    if( A.RedundantRank() == 0 )
+    {
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int* positions = &plan->packPositions[jLoc*localHeight];
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int position = positions[iLoc];
+                if( position >= 0 )
+                {
+                    sendBuf[position] = ALoc(iLoc,jLoc);
+                }
+                else
+                {
+                    BLoc(plan->localRows[numLocal],plan->localCols[numLocal]) =
+                      Caster<S,T>::Cast(ALoc(iLoc,jLoc));
+                    ++numLocal;
+                }
+            }
+        }
+    }
+
+    // Exchange and unpack the data
+    // ============================
+    vector<S> recvBuf;
+    FastResize( recvBuf, plan->totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), plan->sendCounts.data(), plan->sendOffs.data(),
+      recvBuf.data(), plan->recvCounts.data(), plan->recvOffs.data(),
+      g.VCComm() );
+    if( B.Participating() )
+    {
+        for( Int k=0; k<plan->totalRecv; ++k )
+            BLoc(plan->unpackRows[k],plan->unpackCols[k]) =
+              Caster<S,T>::Cast(recvBuf[k]);
+        El::Broadcast( B, B.RedundantComm(), 0 );
+    }
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTPLAN_HPP
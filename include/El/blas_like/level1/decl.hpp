@@ -504,6 +504,20 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+// General redistributions between matrices over the same grid reuse the
+// packing maps and communication pattern of up to this many of the most
+// recently used (distribution, alignment, size) combinations; zero disables
+// the cache
+void SetRedistPlanCacheSize( Int numPlans );
+Int RedistPlanCacheSize();
+// Each plan stores an Int for every local entry of the source and two for
+// every local entry of the target, so, regardless of the number of plans, the
+// least recently used plans are also evicted once the cached plans of this
+// process exceed this many bytes (256 MB by default)
+void SetRedistPlanCacheBytes( Int numBytes );
+Int RedistPlanCacheBytes();
+void ClearRedistPlans();
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
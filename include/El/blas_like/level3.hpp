@@ -26,11 +26,39 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// Machine parameters for the communication model used to choose between the
+// distributed Gemm algorithms when GEMM_DEFAULT is requested. Every process
+// must use the same parameters so that they agree upon the algorithm.
+struct GemmCostParams
+{
+    // Seconds per message
+    double latency=1.e-5;
+    // Seconds per byte
+    double inverseBandwidth=1.e-9;
+    // Seconds per (real) flop of a local Gemm
+    double flopTime=1.e-10;
+    // The block size of the panel-panel dot product algorithm
+    Int dotBlocksize=2000;
+};
+void SetGemmCostParams( const GemmCostParams& params );
+const GemmCostParams& GetGemmCostParams();
+// Time ping-pongs and local Gemms on the given grid, broadcast the results
+// from its root, and return them (they are not automatically set)
+GemmCostParams MeasureGemmCostParams( const Grid& g=Grid::Default() );
+
+// The algorithm which GEMM_DEFAULT resolves to for op(A) op(B), where op(A)
+// is m x k and op(B) is k x n
+template<typename T>
+GemmAlgorithm SelectGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& g );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -182,6 +210,70 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// A reusable plan for repeatedly multiplying a fixed DistSparseMatrix (or one
+// with an identical sparsity pattern) by DistMultiVec's of a fixed width.
+// The plan owns its communication buffers, only exchanges halo entries with
+// the processes which actually require them (via nonblocking point-to-point
+// messages), and overlaps the exchange with the purely local portion of the
+// sparse multiply.
+template<typename T>
+class DistSparseMultPlan
+{
+public:
+    DistSparseMultPlan() { }
+    DistSparseMultPlan( const DistSparseMatrix<T>& A, Int width );
+
+    void Initialize( const DistSparseMatrix<T>& A, Int width );
+    // Whether or not the plan is still valid for A and the given width
+    bool Matches( const DistSparseMatrix<T>& A, Int width ) const;
+    Int Width() const EL_NO_EXCEPT { return width_; }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      T alpha,
+      const DistSparseMatrix<T>& A,
+      const DistMultiVec<T>& X,
+      T beta,
+            DistMultiVec<T>& Y );
+
+private:
+    const DistSparseMatrix<T>* A_=nullptr;
+    Int width_=0, numLocalEdges_=0;
+    // The version of the multiply metadata of A_ which the plan was built from
+    Int metaVersion_=0;
+
+    // The other processes owning the (halo) entries of X needed for a normal
+    // multiply, along with the offsets and sizes of their halo segments.
+    // In an adjoint multiply, the halo holds our updates to their rows of Y.
+    vector<int> haloProcs_, haloOffs_, haloSizes_;
+    // The other processes which require some of our rows of X in a normal
+    // multiply (the row indices are stored in boundaryInds_). In an adjoint
+    // multiply, we receive updates to these rows of Y.
+    vector<int> boundaryProcs_, boundaryOffs_, boundarySizes_;
+    vector<Int> boundaryInds_;
+
+    // The edges of each local row whose column is locally owned, followed by
+    // those requiring communication (with their offset into the halo)
+    vector<Int> localRowOffs_, localEdges_;
+    vector<Int> remoteRowOffs_, remoteEdges_, remoteHaloOffs_;
+
+    vector<T> haloVals_, boundaryVals_;
+    vector<mpi::Request<T>> haloRequests_, boundaryRequests_;
+};
+
+// Equivalent to the above Multiply, but (re)initializing and then making use
+// of the given plan
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+  T beta,
+        DistMultiVec<T>& Y,
+        DistSparseMultPlan<T>& plan );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
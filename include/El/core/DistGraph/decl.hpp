@@ -26,17 +26,22 @@ namespace El {
 struct DistGraphMultMeta
 {
     bool ready;
+    // Distinguishes each (re)initialization of the metadata so that objects
+    // derived from it, such as a DistSparseMultPlan, can detect that the
+    // sparsity pattern has since changed
+    Int version;
     // NOTE: The 'send' and 'recv' roles reverse for adjoint multiplication
     Int numRecvInds;
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
-    DistGraphMultMeta() : ready(false), numRecvInds(0) { }
+    DistGraphMultMeta() : ready(false), version(0), numRecvInds(0) { }
 
     void Clear()
     {
         ready = false;
+        version = 0;
         numRecvInds = 0;
         SwapClear( sendSizes );
         SwapClear( recvSizes );
@@ -49,6 +54,7 @@ struct DistGraphMultMeta
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
     {
         ready = meta.ready;
+        version = meta.version;
         numRecvInds = meta.numRecvInds;
         sendSizes = meta.sendSizes;
         sendOffs = meta.sendOffs;
@@ -13,6 +13,24 @@ namespace El {
 
 struct DistData;
 
+struct RemoteUpdateCtrl
+{
+    // The number of entries bucketed for a single process before they are
+    // sent with a nonblocking send
+    Int chunkSize=4096;
+
+    // The number of bucketed entries (over all destinations) which forces
+    // every nonempty bucket to be sent
+    Int maxBuffered=Int(1) << 20;
+
+    // Sum the updates of each chunk to the same entry before sending it
+    bool combineDuplicates=false;
+
+    // Send to the processes which only view the grid? This takes the place
+    // of the argument to ProcessQueues
+    bool includeViewers=true;
+};
+
 template<typename Ring>
 class AbstractDistMatrix
 {
@@ -230,6 +248,19 @@ public:
     void QueueUpdate( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
     void ProcessQueues( bool includeViewers=true );
 
+    // Streaming updates of remote entries
+    // -----------------------------------
+    // After this collective call, remote updates are bucketed by their
+    // destination as they are queued, and each full bucket is sent with a
+    // nonblocking send while the assembly continues. ProcessQueues (which
+    // must be called by the same processes) completes the exchange, and its
+    // 'includeViewers' argument is superseded by that of the control
+    // structure. When viewers are not included, the updates queued by the
+    // processes outside of the grid are discarded.
+    void BeginStreamingUpdates
+    ( const RemoteUpdateCtrl& ctrl=RemoteUpdateCtrl() );
+    bool StreamingUpdates() const EL_NO_EXCEPT;
+
     // Batch extraction of remote entries
     // ----------------------------------
     void ReservePulls( Int numPulls ) const;
@@ -333,6 +364,22 @@ protected:
     //       require separate MPI wrappers from ValueInt<Int>
     mutable vector<ValueInt<Int>> remotePulls_;
 
+    // Streaming remote updates
+    // ------------------------
+    bool streamingUpdates_=false;
+    RemoteUpdateCtrl streamCtrl_;
+    mpi::Comm streamComm_;
+    Int numStreamBuffered_=0, numStreamReceived_=0;
+    vector<vector<Entry<Ring>>> streamBuckets_;
+    vector<int> numStreamSends_;
+    vector<mpi::Request<Entry<Ring>>> streamRequests_;
+    // The chunk sent by each request (which packed types send in place), to
+    // be freed only once the request has completed
+    vector<vector<Entry<Ring>>> streamSendBufs_;
+    // Updates received by redundant rank 0 which must be broadcast to the
+    // rest of the redundant communicator before they are applied
+    vector<Entry<Ring>> streamReceived_;
+
     // Protected constructors
     // ======================
     // Create a 0 x 0 distributed matrix
@@ -349,6 +396,13 @@ private:
     // =====================================
     void ShallowSwap( type& A );
 
+    // Streaming remote updates
+    // ========================
+    int StreamOwner( Int i, Int j ) const;
+    void SendStreamBucket( int owner );
+    void ReceiveStreamUpdates();
+    void FinishStreamingUpdates();
+
     template<typename S> friend class AbstractDistMatrix;
     template<typename S> friend class ElementalMatrix;
     template<typename S> friend class BlockMatrix;
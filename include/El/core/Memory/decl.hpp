@@ -36,6 +36,50 @@ public:
     void Empty();
 };
 
+// The memory pool underlying Memory<G>
+// ====================================
+// Requests are rounded up to one of a set of size classes (with at most 25%
+// overallocation) and are served from 64-byte aligned blocks. Released blocks
+// are retained in a small per-thread cache, and then in a shared cache, rather
+// than being immediately returned to the system, so that the transient buffers
+// used within redistributions and panel updates can be recycled.
+
+struct MemoryPoolStats
+{
+    // The number of bytes currently handed out by the pool
+    size_t numBytesInUse=0;
+    // The maximum value of numBytesInUse since the last reset
+    size_t highWaterMark=0;
+    // The number of bytes held in the (shared and per-thread) caches
+    size_t numBytesCached=0;
+
+    Unsigned numAllocations=0;
+    // The number of allocations which were served from a cache
+    Unsigned numCacheHits=0;
+};
+
+// Allocate/free 'numBytes' bytes of 64-byte aligned memory
+void* PoolAllocate( size_t numBytes );
+void PoolFree( void* ptr, size_t numBytes );
+
+// If disabled, released blocks are immediately returned to the system
+void SetUseMemoryPool( bool usePool );
+bool UsingMemoryPool();
+
+// Request transparent hugepages (via madvise) for sufficiently large blocks
+void SetMemoryPoolHugePages( bool useHugePages );
+bool UsingMemoryPoolHugePages();
+
+// The maximum number of bytes to retain in the shared cache; blocks which
+// would exceed this bound are returned to the system
+void SetMemoryPoolCacheLimit( size_t numBytes );
+size_t MemoryPoolCacheLimit();
+
+MemoryPoolStats GetMemoryPoolStats();
+void ResetMemoryPoolHighWaterMark();
+// Return the shared cache (and that of the calling thread) to the system
+void EmptyMemoryPool();
+
 } // namespace El
 
 #endif // ifndef EL_MEMORY_DECL_HPP
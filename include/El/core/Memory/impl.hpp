@@ -11,16 +11,40 @@ namespace El {
 
 namespace {
 
+// Non-trivial types (e.g., BigFloat and std::complex) must be explicitly
+// constructed within (and destructed before returning) the pooled storage
 template<typename G>
 static G* New( size_t size )
 {
-    return new G[size];
+    G* ptr = static_cast<G*>( PoolAllocate( size*sizeof(G) ) );
+    if( !std::is_trivial<G>::value )
+    {
+        size_t numConstructed = 0;
+        try
+        {
+            for( ; numConstructed<size; ++numConstructed )
+                new(ptr+numConstructed) G;
+        }
+        catch( ... )
+        {
+            for( size_t i=0; i<numConstructed; ++i )
+                ptr[i].~G();
+            PoolFree( ptr, size*sizeof(G) );
+            throw;
+        }
+    }
+    return ptr;
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size )
 {
-    delete[] ptr;
+    if( ptr == nullptr )
+        return;
+    if( !std::is_trivial<G>::value )
+        for( size_t i=0; i<size; ++i )
+            ptr[i].~G();
+    PoolFree( ptr, size*sizeof(G) );
     ptr = nullptr;
 }
 
@@ -38,7 +62,7 @@ Memory<G>::Memory( size_t size )
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -56,7 +80,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +94,15 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
+            // The pool guarantees 64-byte alignment of rawBuffer_
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -110,7 +136,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// A lightweight hierarchical profiler which is available in release builds.
+// Nested regions record their inclusive and exclusive times, the number of
+// flops reported by the BLAS wrappers, and the number of bytes communicated
+// by the mpi:: wrappers. Named El::Timer's are recorded as leaves of the
+// region which was active when they were stopped. Flops reported by other
+// OpenMP threads are attributed to the region open on the master thread.
+struct ProfileCtrl
+{
+    // Whether or not Finalize() should print a merged report to std::cout
+    bool reportAtFinalize=true;
+
+    // If nonempty, Finalize() writes a Chrome trace (viewable via
+    // chrome://tracing) to this file
+    string traceFilename="";
+
+    // The maximum number of trace events stored per process
+    Int maxTraceEvents=1000000;
+
+    // In non-release builds, also open a region for each EL_DEBUG_CSE
+    bool profileCallStack=false;
+};
+
+void EnableProfiling( const ProfileCtrl& ctrl=ProfileCtrl() );
+void DisableProfiling();
+bool Profiling();
+bool ProfilingCallStack();
+const ProfileCtrl& GetProfileCtrl();
+
+// Discard all of the recorded regions, communication, and trace events
+void ClearProfile();
+
+void PushProfileRegion( const string& name );
+void PopProfileRegion();
+
+void AddProfileFlops( double flops );
+void AddProfileTime( const string& name, double seconds );
+void AddProfileComm
+( const char* op, mpi::Comm comm, double bytes, double seconds );
+
+// Print the min/avg/max over the processes in 'comm' of the statistics of
+// each region (and of each communication routine for each communicator size)
+// from the root of 'comm'
+void ReportProfile( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+
+// Write the trace events of every process in 'comm' to a Chrome trace
+void WriteProfileTrace
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+class ProfileRegion
+{
+public:
+    ProfileRegion( const string& name )
+    : active_(Profiling())
+    {
+        if( active_ )
+            PushProfileRegion( name );
+    }
+    ~ProfileRegion()
+    {
+        if( active_ )
+            PopProfileRegion();
+    }
+private:
+    bool active_;
+};
+
+#define EL_PROFILE_REGION(name) \
+  El::ProfileRegion EL_CONCAT(profileRegion,__LINE__)(name);
+
+// Time a single communication routine and record its volume, where 'count'
+// entries of type 'type' are sent by this process (or to each process when
+// 'perProcess' is true)
+class ProfileComm
+{
+public:
+    ProfileComm
+    ( const char* op, mpi::Comm comm, int count, MPI_Datatype type,
+      bool perProcess=false );
+    // The counts are summed over the processes in 'comm'
+    ProfileComm
+    ( const char* op, mpi::Comm comm, const int* counts, MPI_Datatype type );
+    ~ProfileComm();
+private:
+    bool active_;
+    const char* op_;
+    mpi::Comm comm_;
+    double bytes_;
+    Clock::time_point start_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
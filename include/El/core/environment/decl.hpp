@@ -93,6 +93,42 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For tuned, per-routine algorithmic blocksizes
+// ---------------------------------------------
+// Entries are keyed on a routine name (e.g., "Cholesky"), the datatype, and
+// the shape of the process grid, where a 0 x 0 grid denotes sequential calls
+// and serves as the fallback for grid shapes without their own entry. A
+// tuned blocksize is only used if the default blocksize has neither been
+// modified with SetBlocksize nor had a blocksize pushed on top of it;
+// otherwise, Blocksize() is returned.
+//
+// If the environment variable EL_BLOCKSIZE_FILE is set during Initialize(),
+// the table is loaded from the named file, which consists of lines of the form
+//
+//   <routine> <datatype> <grid height> <grid width> <blocksize>
+//
+// with '#' beginning a comment. Spaces within datatype names are written as
+// underscores, e.g., "long_long_int". Such a file can be generated with
+// examples/lapack_like/TuneBlocksizes.cpp.
+template<typename T>
+Int Blocksize( const string& routine, Int gridHeight=0, Int gridWidth=0 );
+template<typename T>
+void SetTunedBlocksize
+( const string& routine, Int blocksize, Int gridHeight=0, Int gridWidth=0 );
+void ClearTunedBlocksizes();
+// The file is read by the root process of 'comm' and broadcast
+void LoadTunedBlocksizes
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD, int root=0 );
+void SaveTunedBlocksizes( const string& filename );
+
+// For getting and setting the look-ahead depth of the distributed LU and
+// Cholesky factorizations. With a depth of d > 0, the trailing updates of up
+// to d factored panels may be deferred so that the redistribution of the next
+// panel overlaps with them; a depth of zero (the default) yields the
+// traditional bulk-synchronous algorithms.
+Int LookAheadDepth();
+void SetLookAheadDepth( Int depth );
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -26,7 +26,7 @@ namespace mpi {
 #define EL_HAVE_NONBLOCKING 0
 #endif
 
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#if EL_HAVE_NONBLOCKING
 #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #define EL_NONBLOCKING_COLL(name) MPI_ ## name
 #else
@@ -728,6 +728,30 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// NOTE: Types which require serialization are gathered eagerly, so that the
+//       subsequent call to Wait is trivial
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,
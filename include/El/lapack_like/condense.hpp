@@ -13,9 +13,40 @@
 
 namespace El {
 
+// The Householder reflectors produced by the bulge-chasing (second) stage of a
+// two-stage reduction of an n x n band matrix, with the given bandwidth, to
+// tridiagonal or bidiagonal form. Column r of 'householder' holds the scalar
+// of the r'th reflector followed by its vector (whose first entry is one).
+// The reflectors are enumerated sweep by sweep, and the j'th reflector of
+// sweep s acts upon rows/columns [s+1+j*bandwidth,s+(j+1)*bandwidth].
+template<typename Field>
+struct BandReflectors
+{
+    Int size=0;
+    Int bandwidth=0;
+    DistMatrix<Field,STAR,VR> householder;
+};
+
 // Bidiag
 // ======
 
+namespace BidiagApproachNS {
+enum BidiagApproach
+{
+    BIDIAG_ONE_STAGE, // Reduce directly to bidiagonal form
+    BIDIAG_TWO_STAGE  // Reduce to a band matrix and then chase bulges
+};
+}
+using namespace BidiagApproachNS;
+
+struct BidiagCtrl
+{
+    BidiagApproach approach=BIDIAG_ONE_STAGE;
+    // The bandwidth of the intermediate band matrix of the two-stage
+    // approach (zero selects the algorithmic blocksize)
+    Int bandwidth=0;
+};
+
 // Return the packed reduction to bidiagonal form
 // ----------------------------------------------
 template<typename Field>
@@ -58,7 +89,23 @@ void Explicit
 template<typename Field>
 void ExplicitCondensed( Matrix<Field>& A );
 template<typename Field>
-void ExplicitCondensed( AbstractDistMatrix<Field>& A );
+void ExplicitCondensed
+( AbstractDistMatrix<Field>& A, const BidiagCtrl& ctrl=BidiagCtrl() );
+
+// Reduce A to upper-triangular band form, B_b := Q_1^H A P_1, using Level 3
+// operations and then chase the bulges out of B_b to form the real upper
+// bidiagonal matrix B := Q_2^H B_b P_2, so that A = (Q_1 Q_2) B (P_1 P_2)^H.
+// The main diagonal and superdiagonal of A are overwritten with B, while
+// the first-stage reflectors are stored in packed form below the diagonal
+// and above the band. A must be at least as tall as it is wide.
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalarsP,
+  AbstractDistMatrix<Field>& householderScalarsQ,
+  BandReflectors<Field>& bandReflectorsP,
+  BandReflectors<Field>& bandReflectorsQ,
+  const BidiagCtrl& ctrl=BidiagCtrl() );
 
 template<typename Field>
 void ApplyQ
@@ -72,6 +119,14 @@ void ApplyQ
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
+// Apply Q = Q_1 Q_2 from the two-stage reduction
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const BandReflectors<Field>& bandReflectors,
+        AbstractDistMatrix<Field>& B );
 
 template<typename Field>
 void ApplyP
@@ -85,6 +140,14 @@ void ApplyP
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
+// Apply P = P_1 P_2 from the two-stage reduction
+template<typename Field>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const BandReflectors<Field>& bandReflectors,
+        AbstractDistMatrix<Field>& B );
 
 } // namespace bidiag
 
@@ -96,7 +159,8 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
-    HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_DEFAULT, // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_TWO_STAGE // Reduce to a band matrix and then chase bulges
 };
 }
 using namespace HermitianTridiagApproachNS;
@@ -107,6 +171,9 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+    // The bandwidth of the intermediate band matrix of the two-stage
+    // approach (zero selects the algorithmic blocksize)
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -128,6 +195,21 @@ void ExplicitCondensed
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
   const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 
+// Reduce A to Hermitian band form, A_b := Q_1^H A Q_1, using Level 3
+// operations and then chase the bulges out of A_b to form the real symmetric
+// tridiagonal matrix T := Q_2^H A_b Q_2, so that A = (Q_1 Q_2) T (Q_1 Q_2)^H.
+// The main diagonal and the off-diagonal(s) of A are overwritten with T and
+// the first-stage reflectors are stored in packed form below the band. If
+// uplo is UPPER, A is first made explicitly Hermitian so that its strictly
+// lower triangle can hold the reflectors.
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  BandReflectors<Field>& bandReflectors,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
 template<typename Field>
 void ApplyQ
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
@@ -140,6 +222,14 @@ void ApplyQ
   const AbstractDistMatrix<Field>& A,
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
+// Apply Q = Q_1 Q_2 from the two-stage reduction
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const BandReflectors<Field>& bandReflectors,
+        AbstractDistMatrix<Field>& B );
 
 } // namespace herm_tridiag
 
@@ -27,6 +27,7 @@ CReflect( const HermitianTridiagCtrl<Field>& ctrl )
     ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.order = CReflect(ctrl.order);
     ctrlC.symvCtrl = CReflect(ctrl.symvCtrl);
+    ctrlC.bandwidth = ctrl.bandwidth;
     return ctrlC;
 }
 
@@ -38,6 +39,7 @@ CReflect( const ElHermitianTridiagCtrl& ctrlC )
     ctrl.approach = CReflect(ctrlC.approach);
     ctrl.order = CReflect(ctrlC.order);
     ctrl.symvCtrl = CReflect<Field>(ctrlC.symvCtrl);
+    ctrl.bandwidth = ctrlC.bandwidth;
     return ctrl;
 }
 
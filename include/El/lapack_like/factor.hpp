@@ -236,12 +236,48 @@ void SolveAfter
 
 } // namespace ldl
 
+// Communication-avoiding (s-step) Krylov methods
+// ===============================================
+// Each block of s Krylov vectors is generated with a matrix-powers kernel
+// and orthogonalized with a constant number of global reductions (see
+// El/lapack_like/solve/SStep.hpp).
+template<typename Real>
+struct SStepCtrl
+{
+    // The number of Krylov vectors generated by each matrix-powers kernel
+    // (limited to maxIts/2 so that at least one kernel can follow the s
+    // Arnoldi steps which determine its shifts)
+    Int s=4;
+    // The number of blocks of s vectors between restarts
+    Int numBlocks=4;
+    Real relTol;
+    // The maximum total number of Krylov vectors
+    Int maxIts=100;
+    bool progress=false;
+
+    SStepCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.5));
+    }
+};
+
+// The number of matrix-powers kernels and of standard Arnoldi steps which
+// were run by an s-step Krylov method
+struct SStepInfo
+{
+    Int numBlockSteps=0;
+    Int numArnoldiSteps=0;
+};
+
 // Solve a linear system with a regularized factorization
 // ======================================================
 enum RegSolveAlg
 {
   REG_SOLVE_FGMRES,
-  REG_SOLVE_LGMRES
+  REG_SOLVE_LGMRES,
+  // s-step GMRES for distributed matrices (FGMRES is used otherwise)
+  REG_SOLVE_SSTEP_GMRES
 };
 
 template<typename Real>
@@ -253,6 +289,8 @@ struct RegSolveCtrl
     Int maxIts=4;
     Int maxRefineIts=2;
     Int restart=4;
+    // The step size of REG_SOLVE_SSTEP_GMRES
+    Int sStep=4;
     bool progress=false;
     bool time=false;
 
@@ -751,13 +789,60 @@ struct TreeData
     }
 };
 
+// The reduction tree used by explicit tall-skinny QR factorizations
+enum TSQRTree
+{
+  // The binary tree of TS, followed by a scatter of Q and a broadcast of R
+  TSQR_BINARY_TREE,
+  // The R factors of every process are gathered onto and factored by the
+  // root, which then scatters the corresponding blocks of Q along with R
+  TSQR_FLAT_TREE,
+  // Pairs of processes exchange their R factors at each stage and
+  // redundantly factor the result so that every process ends with the final
+  // R and forms its rows of Q without a scatter or broadcast
+  TSQR_BUTTERFLY_TREE
+};
+
+enum TSQRAlg
+{
+  TSQR_HOUSEHOLDER,
+  // CholeskyQR2 if the conditioning estimate is small enough and shifted
+  // CholeskyQR3 otherwise, each of which requires only a few reductions of
+  // the n x n Gramian
+  TSQR_CHOLESKY
+};
+
+template<typename Real>
+struct TSQRCtrl
+{
+    TSQRAlg alg=TSQR_HOUSEHOLDER;
+    TSQRTree tree=TSQR_BINARY_TREE;
+
+    // The largest estimated condition number for which TSQR_CHOLESKY uses
+    // CholeskyQR2 rather than shifted CholeskyQR3
+    Real maxCholeskyQR2Cond;
+
+    // Whether TSQR_CHOLESKY should fall back to Householder TSQR (rather
+    // than throwing an exception) if a Cholesky factorization breaks down
+    bool fallback=true;
+
+    TSQRCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        maxCholeskyQR2Cond = 1/(10*Sqrt(eps));
+    }
+};
+
 // Return an implicit tall-skinny QR factorization
 template<typename Field>
 TreeData<Field> TS( const AbstractDistMatrix<Field>& A );
 
 // Return an explicit tall-skinny QR factorization
 template<typename Field>
-void ExplicitTS( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void ExplicitTS
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  const TSQRCtrl<Base<Field>>& ctrl=TSQRCtrl<Base<Field>>() );
 
 namespace ts {
 
@@ -249,6 +249,8 @@ struct DistMatrixNode
 
 template<typename Field>
 struct DistFront;
+template<typename Field>
+class FrontStore;
 
 template<typename Field>
 struct Front
@@ -267,6 +269,11 @@ struct Front
     Matrix<Field> workDense;
     SparseMatrix<Field> workSparse;
 
+    // Whether LDense has been spilled to disk by a FrontStore, in which case
+    // it is empty and its dimensions are recorded here.
+    bool spilled=false;
+    Int spilledHeight=0, spilledWidth=0;
+
     // An observing pointer for the parent front (should it exist).
     Front<Field>* parent=nullptr;
 
@@ -281,11 +288,14 @@ struct Front
 
     Front( DistFront<Field>* dupNode );
 
+    // If 'store' is non-null, each front is handed to it as soon as it has
+    // been formed so that the peak memory usage is bounded.
     Front
     ( const SparseMatrix<Field>& A,
       const vector<Int>& reordering,
       const NodeInfo& rootInfo,
-      bool hermitian=true );
+      bool hermitian=true,
+      FrontStore<Field>* store=nullptr );
 
     ~Front();
 
@@ -293,7 +303,8 @@ struct Front
     ( const SparseMatrix<Field>& A,
       const vector<Int>& reordering,
       const NodeInfo& rootInfo,
-      bool hermitian=true );
+      bool hermitian=true,
+      FrontStore<Field>* store=nullptr );
     void PullUpdate
     ( const SparseMatrix<Field>& A,
       const vector<Int>& reordering,
@@ -309,11 +320,62 @@ struct Front
     const Front<Field>& operator=( const Front<Field>& front );
 
     Int Height() const;
+    // The dimensions of LDense, even if it has been spilled
+    Int DenseHeight() const;
+    Int DenseWidth() const;
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
     Int NumBottomLeftEntries() const;
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
+
+    // The inertia of the (quasi-)diagonal of the factored tree
+    InertiaType Inertia() const;
+};
+
+// Bounds the memory used by the dense factors of a tree of sequential fronts
+// by spilling them to files in a scratch directory. A front must be acquired
+// before its dense factor is accessed and released afterwards; once the
+// released fronts occupy more than (roughly) three quarters of
+// 'maxResidentBytes', the least recently released ones are packed and written
+// out asynchronously, with the remaining quarter reserved for the writes in
+// flight. Fronts which are viewed by a distributed front (via 'duplicate') are
+// never spilled. All member functions may be called concurrently.
+template<typename Field>
+class FrontStore
+{
+public:
+    FrontStore( const string& scratchDir, size_t maxResidentBytes );
+    ~FrontStore();
+
+    // Wait for any pending I/O, delete the scratch files, and forget all of
+    // the fronts. Fronts which are still spilled lose their dense factors, so
+    // this should only be called when the tree is about to be rebuilt.
+    void Clear();
+
+    // Ensure that the dense factor of the front is resident and keep it so
+    // until it is released. If 'modify' is true, the copy on disk is marked
+    // as stale.
+    void Acquire( Front<Field>& front, bool modify=false );
+    // Allow the dense factor of the front to be spilled.
+    void Release( Front<Field>& front );
+    // Start reading in a spilled front which will soon be acquired.
+    void Prefetch( const Front<Field>& front );
+
+    // Acquire or release an entire tree (acquiring a tree brings all of it
+    // back into memory regardless of the bound).
+    void AcquireTree( Front<Field>& root, bool modify=false );
+    void ReleaseTree( Front<Field>& root );
+
+    const string& ScratchDirectory() const;
+    size_t MaxResidentBytes() const;
+    size_t NumResidentBytes() const;
+    size_t NumBytesWritten() const;
+    size_t NumBytesRead() const;
+
+private:
+    struct State;
+    unique_ptr<State> state_;
 };
 
 struct FactorCommMeta
@@ -426,6 +488,10 @@ struct DistFront
     double LocalFactorGFlops( bool selInv=false ) const;
     double LocalSolveGFlops( Int numRHS=1 ) const;
 
+    // The inertia of the (quasi-)diagonal of the factored tree (this is
+    // collective over the team of the front)
+    InertiaType Inertia() const;
+
     void ComputeRecvInds( const DistNodeInfo& info ) const;
     void ComputeCommMeta
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
@@ -469,6 +535,19 @@ public:
     // with a different matrix (e.g., within an Interior Point Method).
     void ChangeNonzeroValues( const SparseMatrix<Field>& ANew );
 
+    // Write the symbolic analysis and, if the matrix has been factored, the
+    // fronts to a versioned binary file.
+    void Save( const string& filename ) const;
+    // Restore a factorization from a file written by Save() after Factor().
+    void Load( const string& filename );
+    // Restore the symbolic analysis from a file written by Save() and
+    // initialize the frontal tree with 'A', which must have the same nonzero
+    // pattern as the matrix which was originally analyzed.
+    void Load
+    ( const string& filename,
+      const SparseMatrix<Field>& A,
+            bool hermitian=true );
+
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
@@ -513,6 +592,16 @@ public:
 
     // TODO(poulson): Apply permutation?
 
+    // Bound the memory used by the dense factors of the fronts by spilling
+    // them to files in 'scratchDir' (see ldl::FrontStore). Each front is
+    // streamed back from disk when it is needed by Factor() or a solve, while
+    // MultiplyWithL() temporarily brings the entire tree back into memory.
+    void SetOutOfCore( const string& scratchDir, size_t maxResidentBytes );
+    // Bring all of the fronts back into memory and stop spilling them.
+    void SetInCore();
+    bool OutOfCore() const;
+    const ldl::FrontStore<Field>& FrontStore() const;
+
     bool Factored() const;
 
     Int NumEntries() const;
@@ -521,6 +610,10 @@ public:
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 
+    // The number of positive, negative, and zero eigenvalues of the factored
+    // Hermitian matrix (which requires a non-block factorization)
+    InertiaType Inertia() const;
+
     ldl::Front<Field>& Front();
     const ldl::Front<Field>& Front() const;
 
@@ -542,6 +635,7 @@ private:
     unique_ptr<ldl::Front<Field>> front_;
     unique_ptr<ldl::NodeInfo> info_;
     unique_ptr<ldl::Separator> separator_;
+    unique_ptr<ldl::FrontStore<Field>> store_;
 
     vector<Int> map_, inverseMap_;
 };
@@ -582,6 +676,19 @@ public:
     // with a different matrix (e.g., within an Interior Point Method).
     void ChangeNonzeroValues( const DistSparseMatrix<Field>& ANew );
 
+    // Write this process's portion of the symbolic analysis to the versioned
+    // binary file '<filename>.<rank>'. The fronts are not saved.
+    void Save( const string& filename ) const;
+    // Restore the symbolic analysis from the files written by Save() on the
+    // same number of processes and initialize the frontal tree with 'A', which
+    // must have the same nonzero pattern as the matrix which was originally
+    // analyzed.
+    void Load
+    ( const string& filename,
+      const DistSparseMatrix<Field>& A,
+            bool hermitian=true,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
     // Factor the initialized multifrontal tree.
     void Factor( LDLFrontType frontType=LDL_2D );
 
@@ -635,6 +742,16 @@ public:
 
     // TODO(poulson): Apply permutation?
 
+    // Bound the memory used by the dense factors of this process's
+    // sequential subtree by spilling them to files in 'scratchDir' (see
+    // ldl::FrontStore). The distributed fronts, and the root of the local
+    // subtree, always remain in memory.
+    void SetOutOfCore( const string& scratchDir, size_t maxResidentBytes );
+    // Bring all of the local fronts back into memory and stop spilling them.
+    void SetInCore();
+    bool OutOfCore() const;
+    const ldl::FrontStore<Field>& FrontStore() const;
+
     bool Factored() const;
 
     Int NumLocalEntries() const;
@@ -643,6 +760,10 @@ public:
     double LocalFactorGFlops( bool selInv=false ) const;
     double LocalSolveGFlops( Int numRHS=1 ) const;
 
+    // The number of positive, negative, and zero eigenvalues of the factored
+    // Hermitian matrix (which requires a non-block factorization)
+    InertiaType Inertia() const;
+
     ldl::DistFront<Field>& Front();
     const ldl::DistFront<Field>& Front() const;
 
@@ -666,6 +787,7 @@ private:
     unique_ptr<ldl::DistFront<Field>> front_;
     unique_ptr<ldl::DistNodeInfo> info_;
     unique_ptr<ldl::DistSeparator> separator_;
+    unique_ptr<ldl::FrontStore<Field>> store_;
 
     DistMap map_, inverseMap_;
 
@@ -66,6 +66,44 @@ void NaturalNestedDissection
         Int cutoff,
         bool storeFactRecvInds=false );
 
+// Serialize the result of a reordering (the "known before analysis" members of
+// the separator and node trees) into a byte buffer. Deserialization expects
+// freshly-constructed roots and recomputes the reordering map and the
+// remainder of the symbolic analysis. The distributed versions only handle
+// the portion of the trees owned by this process, and the deserialization is
+// collective over 'grid', which must have the same size as the original grid.
+void SerializeSymbolic
+( const Separator& rootSep,
+  const NodeInfo& rootInfo,
+        vector<byte>& buffer );
+void SerializeSymbolic
+( const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<byte>& buffer );
+void DeserializeSymbolic
+( const vector<byte>& buffer,
+        vector<Int>& map,
+        Separator& rootSep,
+        NodeInfo& rootInfo );
+void DeserializeSymbolic
+( const vector<byte>& buffer,
+  const Grid& grid,
+        DistMap& map,
+        DistSeparator& rootSep,
+        DistNodeInfo& rootInfo,
+        bool storeFactRecvInds=false );
+
+// (Natural)NestedDissection keeps a process-wide cache of the most recent
+// reorderings, keyed by the graph and the reordering parameters (each entry
+// keeps a copy of its graph, which is compared on every hit), so that
+// repeatedly initializing factorizations of matrices with the same
+// sparsity pattern (e.g., within Interior Point Methods) skips the graph
+// partitioning. The capacity should be the same on every process.
+void SetSymbolicCacheCapacity( Int numEntries );
+Int SymbolicCacheCapacity();
+void ClearSymbolicCache();
+Int NumSymbolicCacheHits();
+
 } // namespace ldl
 } // namespace El
 
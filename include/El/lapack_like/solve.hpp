@@ -227,6 +227,66 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// Mixed-precision
+// ===============
+// Factor a copy of A in a lower precision (float for double and double for
+// the extended-precision types) and recover the accuracy of the working
+// precision with either iterative refinement or FGMRES preconditioned with
+// the low-precision factorization.
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    // The required relative residual max norm of each right-hand side
+    Real relTol;
+    Int maxIts=30;
+
+    // Precondition FGMRES rather than performing iterative refinement
+    // (currently only for sequential matrices)
+    bool useFGMRES=false;
+    Int restart=10;
+
+    // Solve in the working precision if the tolerance was not met, e.g., due
+    // to the matrix being too ill-conditioned for the low precision
+    bool fallback=true;
+
+    bool progress=false;
+
+    MixedPrecisionCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.9));
+    }
+};
+
+// Each routine returns the number of iterations that were performed
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl=
+        MixedPrecisionCtrl<Base<Field>>() );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
@@ -250,6 +310,7 @@ void MultiShiftHessSolve
 
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
+#include <El/lapack_like/solve/SStep.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
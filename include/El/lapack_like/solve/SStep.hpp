@@ -0,0 +1,547 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_SSTEP_HPP
+#define EL_SOLVE_SSTEP_HPP
+
+// Communication-avoiding (s-step) Krylov methods. See, for example,
+//   Mark Hoemmen,
+//   "Communication-avoiding Krylov subspace methods",
+//   PhD thesis, University of California, Berkeley, 2010,
+// and
+//   Yamazaki, Tomov, and Dongarra,
+//   "Mixed-precision Cholesky QR factorization and its case studies on
+//    multicore CPU with multiple GPUs",
+//   SIAM J. Sci. Comput., Vol. 37, No. 3, pp. C307--C330, 2015.
+//
+// Rather than performing one operator application followed by several
+// global reductions per Krylov vector, each block of s vectors is generated
+// with a matrix-powers kernel using the Newton basis
+//
+//   w_0 := (Op - theta_0 I) v,  w_i := (Op - theta_i I) w_{i-1},
+//
+// where the shifts are Leja-ordered Ritz values from a short start-up phase
+// of standard Arnoldi, and is then orthogonalized against the existing
+// basis with two passes of block classical Gram-Schmidt fused with
+// CholeskyQR, each of which requires a single reduction. The corresponding
+// columns of the Arnoldi Hessenberg matrix are recovered from the
+// change-of-basis matrices.
+
+namespace El {
+
+namespace sstep {
+
+template<typename Real>
+void RitzShift( const Complex<Real>& theta, Real& shift )
+{ shift = RealPart(theta); }
+
+template<typename Real>
+void RitzShift( const Complex<Real>& theta, Complex<Real>& shift )
+{ shift = theta; }
+
+// Reorder the shifts so that each maximizes the product of its distances to
+// the previous shifts, which keeps the Newton basis well-conditioned
+template<typename Field>
+void LejaOrder( vector<Field>& shifts )
+{
+    typedef Base<Field> Real;
+    const Int numShifts = shifts.size();
+    for( Int k=0; k<numShifts; ++k )
+    {
+        Int best = k;
+        Real bestProduct = -1;
+        for( Int i=k; i<numShifts; ++i )
+        {
+            Real product = ( k == 0 ? Abs(shifts[i]) : Real(1) );
+            for( Int l=0; l<k; ++l )
+                product *= Abs(shifts[i]-shifts[l]);
+            if( product > bestProduct )
+            {
+                best = i;
+                bestProduct = product;
+            }
+        }
+        std::swap( shifts[k], shifts[best] );
+    }
+}
+
+// Form column 'numCols' of the Hessenberg matrix H by applying the operator
+// to the last of the numCols+1 orthonormal vectors stored (locally) in VLoc
+// and orthogonalizing the result with classical Gram-Schmidt applied twice.
+// False is returned if the Krylov subspace was found to be invariant, in
+// which case no new basis vector is added.
+template<typename Field,class ApplyOpType>
+bool ArnoldiStep
+( const ApplyOpType& applyOp,
+        Matrix<Field>& VLoc,
+        Matrix<Field>& H,
+        Int& numCols,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int j = numCols+1;
+    Matrix<Field> w;
+    applyOp( VLoc(ALL,IR(j-1)), w );
+
+    auto V = VLoc( ALL, IR(0,j) );
+    auto h = H( IR(0,j), IR(j-1) );
+    Matrix<Field> hCorr;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), V, w, hCorr );
+        mpi::AllReduce( hCorr.Buffer(), j, comm );
+        Gemm( NORMAL, NORMAL, Field(-1), V, hCorr, Field(1), w );
+        h += hCorr;
+    }
+    const Real localNorm = FrobeniusNorm( w );
+    const Real delta = Sqrt( mpi::AllReduce( localNorm*localNorm, comm ) );
+    if( !limits::IsFinite(delta) )
+        RuntimeError("Arnoldi step produced a non-finite number");
+    H(j,j-1) = delta;
+    ++numCols;
+    if( delta == Real(0) )
+        return false;
+
+    auto vNew = VLoc( ALL, IR(j) );
+    vNew = w;
+    vNew *= Real(1)/delta;
+    return true;
+}
+
+// Form columns numCols, ..., numCols+s-1 of the Hessenberg matrix H, and
+// the corresponding s orthonormal basis vectors, from the Newton basis with
+// the given s shifts. False is returned if CholeskyQR broke down due to the
+// Newton basis being numerically rank-deficient, in which case neither VLoc
+// nor H are modified.
+template<typename Field,class ApplyOpType>
+bool BlockStep
+( const ApplyOpType& applyOp,
+  const vector<Field>& shifts,
+        Matrix<Field>& VLoc,
+        Matrix<Field>& H,
+        Int& numCols,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int s = shifts.size();
+    const Int j = numCols+1;
+    const Int localHeight = VLoc.Height();
+
+    // Run the matrix-powers kernel
+    // ============================
+    Matrix<Field> W, y;
+    Zeros( W, localHeight, s );
+    for( Int i=0; i<s; ++i )
+    {
+        const Matrix<Field> prev
+          ( i == 0 ? VLoc(ALL,IR(j-1)) : W(ALL,IR(i-1)) );
+        applyOp( prev, y );
+        Axpy( -shifts[i], prev, y );
+        auto wi = W( ALL, IR(i) );
+        wi = y;
+    }
+
+    // Orthogonalize against the existing basis with BCGS2 + CholeskyQR2
+    // =================================================================
+    // After both passes, W_orig = V C + W R
+    auto V = VLoc( ALL, IR(0,j) );
+    Matrix<Field> C, R, G;
+    Zeros( C, j, s );
+    Identity( R, s, s );
+    const Real minRatio = Sqrt(limits::Epsilon<Real>());
+    for( Int pass=0; pass<2; ++pass )
+    {
+        // G := [V, W]^H W in a single reduction
+        Zeros( G, j+s, s );
+        auto GT = G( IR(0,j), ALL );
+        auto GB = G( IR(j,j+s), ALL );
+        Gemm( ADJOINT, NORMAL, Field(1), V, W, Field(0), GT );
+        Gemm( ADJOINT, NORMAL, Field(1), W, W, Field(0), GB );
+        mpi::AllReduce( G.Buffer(), (j+s)*s, comm );
+
+        // The Gram matrix of (I - V V^H) W is W^H W - (V^H W)^H (V^H W)
+        Gemm( ADJOINT, NORMAL, Field(-1), GT, GT, Field(1), GB );
+        try { Cholesky( UPPER, GB ); }
+        catch( NonHPDMatrixException& ) { return false; }
+        MakeTrapezoidal( UPPER, GB );
+        Real minDiag = Abs(GB(0,0)), maxDiag = Abs(GB(0,0));
+        for( Int i=1; i<s; ++i )
+        {
+            minDiag = Min( minDiag, Abs(GB(i,i)) );
+            maxDiag = Max( maxDiag, Abs(GB(i,i)) );
+        }
+        if( !limits::IsFinite(maxDiag) || minDiag <= minRatio*maxDiag )
+            return false;
+
+        // W := (W - V GT) inv(GB)
+        Gemm( NORMAL, NORMAL, Field(-1), V, GT, Field(1), W );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), GB, W );
+
+        // C := C + GT R, R := GB R
+        Gemm( NORMAL, NORMAL, Field(1), GT, R, Field(1), C );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), GB, R );
+    }
+
+    // Recover the new columns of the Hessenberg matrix
+    // ================================================
+    // With RB = [e_{j-1}, C; 0, R], the Newton basis satisfies
+    //
+    //   [v_{j-1}, W_orig] = [V, W] RB,
+    //   Op [v_{j-1}, W_orig(:,0:s-1)] = [v_{j-1}, W_orig] TB,
+    //
+    // where TB is the (s+1) x s bidiagonal matrix with the shifts on its
+    // diagonal and ones on its subdiagonal. Since the first s columns of RB
+    // are [X; Y; 0], with Y upper-triangular and s x s, and
+    // Op V(:,0:j-1) = V H(0:j,0:j-1), the new columns are
+    //
+    //   (RB TB - [H(0:j,0:j-1) X; 0]) inv(Y).
+    Matrix<Field> RB, TB, HNew;
+    Zeros( RB, j+s, s+1 );
+    RB(j-1,0) = 1;
+    auto RBTR = RB( IR(0,j), IR(1,s+1) );
+    auto RBBR = RB( IR(j,j+s), IR(1,s+1) );
+    RBTR = C;
+    RBBR = R;
+    Zeros( TB, s+1, s );
+    for( Int i=0; i<s; ++i )
+    {
+        TB(i,i) = shifts[i];
+        TB(i+1,i) = 1;
+    }
+    Gemm( NORMAL, NORMAL, Field(1), RB, TB, HNew );
+    if( j > 1 )
+    {
+        auto HNewT = HNew( IR(0,j), ALL );
+        Gemm
+        ( NORMAL, NORMAL,
+          Field(-1), H(IR(0,j),IR(0,j-1)), RB(IR(0,j-1),IR(0,s)),
+          Field(1), HNewT );
+    }
+    Matrix<Field> Y( RB(IR(j-1,j+s-1),IR(0,s)) );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), Y, HNew );
+
+    auto HBlock = H( IR(0,j+s), IR(j-1,j+s-1) );
+    HBlock = HNew;
+    auto VNew = VLoc( ALL, IR(j,j+s) );
+    VNew = W;
+    numCols += s;
+    return true;
+}
+
+// Extend an Arnoldi decomposition with numCols columns by up to 'numSteps'
+// columns, using a block step when shifts are available and falling back to
+// standard Arnoldi steps otherwise. Once at least s columns exist, the
+// shifts are set from the Ritz values of the leading s x s block of H
+// (unless they were already available, e.g., from a previous restart).
+// False is returned if an invariant subspace was found.
+template<typename Field,class ApplyOpType>
+bool Extend
+( const ApplyOpType& applyOp,
+        Int s,
+        Int numSteps,
+        vector<Field>& shifts,
+        Matrix<Field>& VLoc,
+        Matrix<Field>& H,
+        Int& numCols,
+        mpi::Comm comm,
+        SStepInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( Int(shifts.size()) == s && numSteps == s &&
+        BlockStep( applyOp, shifts, VLoc, H, numCols, comm ) )
+    {
+        ++info.numBlockSteps;
+        return true;
+    }
+
+    for( Int step=0; step<numSteps; ++step )
+    {
+        ++info.numArnoldiSteps;
+        if( !ArnoldiStep( applyOp, VLoc, H, numCols, comm ) )
+            return false;
+    }
+
+    if( shifts.empty() && numCols >= s )
+    {
+        // NOTE: HTL must be a copy since HessenbergSchur overwrites it
+        Matrix<Field> HTL;
+        Copy( H(IR(0,s),IR(0,s)), HTL );
+        Matrix<Complex<Real>> ritzValues;
+        HessenbergSchur( HTL, ritzValues );
+        shifts.resize( s );
+        for( Int i=0; i<s; ++i )
+            RitzShift( ritzValues(i), shifts[i] );
+        LejaOrder( shifts );
+    }
+    return true;
+}
+
+// Solve A x = b, with b overwritten by x, using either restarted s-step
+// GMRES (if 'minimizeResidual' is true) or its Galerkin counterpart, which,
+// for Hermitian positive-definite A inv(M), is mathematically equivalent to
+// restarted conjugate gradients. Unlike FGMRES, the preconditioner is
+// assumed to be fixed. The Newton basis shifts are reused if they are
+// provided (e.g., from a previous right-hand side).
+template<typename Field,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& b,
+  const SStepCtrl<Base<Field>>& ctrl,
+        bool minimizeResidual,
+        vector<Field>& shifts,
+        SStepInfo& info )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    if( ctrl.s < 1 || ctrl.numBlocks < 1 )
+        LogicError("The step size and number of blocks must be positive");
+    const Int n = b.Height();
+    const Grid& grid = b.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    // The shifts are computed from the first s standard Arnoldi steps, so
+    // the step size is limited to half of the iteration budget in order for
+    // at least one matrix-powers kernel to be able to run
+    const Int s = Min( ctrl.s, Max(ctrl.maxIts/2,Int(1)) );
+    const Int maxBasis = Min( ctrl.s*ctrl.numBlocks, n );
+    const string name = ( minimizeResidual ? "s-step GMRES" : "s-step CG" );
+
+    DistMultiVec<Field> x(grid), w(grid), q(grid), Aq(grid);
+    Zeros( x, n, 1 );
+    Zeros( q, n, 1 );
+    Zeros( Aq, n, 1 );
+    w = b;
+    const Real origResidNorm = Nrm2( w );
+    if( ctrl.progress && commRank == 0 )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+    const Int localHeight = w.LocalHeight();
+
+    // y := A inv(M) x, acting on the local portions of x and y
+    auto applyOp =
+      [&]( const Matrix<Field>& xLoc, Matrix<Field>& yLoc )
+      {
+          q.Matrix() = xLoc;
+          precond( q );
+          applyA( Field(1), q, Field(0), Aq );
+          yLoc = Aq.LockedMatrix();
+      };
+
+    // H is the Hessenberg matrix of the Arnoldi decomposition, while HRot is
+    // its upper-triangular form after the Givens rotations have been applied
+    Int iter=0;
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, HRot, t, VLoc, y, u;
+    while( true )
+    {
+        // NOTE: w = b - A x already
+        const Real beta = Nrm2( w );
+        Zeros( VLoc, localHeight, maxBasis+1 );
+        Zeros( H, maxBasis+1, maxBasis );
+        Zeros( HRot, maxBasis+1, maxBasis );
+        Zeros( cs, maxBasis, 1 );
+        Zeros( sn, maxBasis, 1 );
+        Zeros( t, maxBasis+1, 1 );
+        t(0) = beta;
+        auto v0Loc = VLoc( ALL, IR(0) );
+        v0Loc = w.LockedMatrix();
+        v0Loc *= Real(1)/beta;
+
+        // Run one cycle of s-step Arnoldi
+        // ===============================
+        Int numCols = 0;
+        while( numCols < maxBasis && iter < ctrl.maxIts )
+        {
+            const Int oldNumCols = numCols;
+            const Int numSteps = Min( s, maxBasis-numCols );
+            const bool invariant = !Extend
+              ( applyOp, s, numSteps, shifts, VLoc, H, numCols, comm, info );
+            iter += numCols - oldNumCols;
+
+            // Apply the Givens rotations to the new columns
+            // ---------------------------------------------
+            auto HRotNew = HRot( ALL, IR(oldNumCols,numCols) );
+            HRotNew = H( ALL, IR(oldNumCols,numCols) );
+            for( Int k=oldNumCols; k<numCols; ++k )
+            {
+                for( Int i=0; i<k; ++i )
+                {
+                    const Real& c = cs(i);
+                    const Field& sigma = sn(i);
+                    const Field eta_i_k = HRot(i,k);
+                    const Field eta_ip1_k = HRot(i+1,k);
+                    HRot(i,  k) =  c*eta_i_k + sigma*eta_ip1_k;
+                    HRot(i+1,k) = -Conj(sigma)*eta_i_k + c*eta_ip1_k;
+                }
+                Real c;
+                Field sigma;
+                const Field rho = Givens( HRot(k,k), HRot(k+1,k), c, sigma );
+                if( !limits::IsFinite(c) ||
+                    !limits::IsFinite(RealPart(rho)) ||
+                    !limits::IsFinite(ImagPart(rho)) )
+                    RuntimeError
+                    ("Givens rotation produced a non-finite number");
+                HRot(k,k) = rho;
+                HRot(k+1,k) = 0;
+                cs(k) = c;
+                sn(k) = sigma;
+                const Field tau_k = t(k);
+                const Field tau_kp1 = t(k+1);
+                t(k)   =  c*tau_k + sigma*tau_kp1;
+                t(k+1) = -Conj(sigma)*tau_k + c*tau_kp1;
+            }
+
+            // The Galerkin residual norm is the minimal residual norm
+            // divided by the cosine of the last rotation
+            Real estResidNorm = Abs(t(numCols));
+            if( !minimizeResidual )
+                estResidNorm /= cs(numCols-1);
+            if( ctrl.progress && commRank == 0 )
+                Output
+                (name," iteration ",iter," has estimated relative residual ",
+                 estResidNorm/origResidNorm);
+            if( invariant || estResidNorm <= ctrl.relTol*origResidNorm )
+                break;
+        }
+
+        // Update the solution
+        // ===================
+        if( minimizeResidual )
+        {
+            y = t( IR(0,numCols), ALL );
+            Trsv
+            ( UPPER, NORMAL, NON_UNIT, HRot(IR(0,numCols),IR(0,numCols)), y );
+        }
+        else
+        {
+            Zeros( y, numCols, 1 );
+            y(0) = beta;
+            Matrix<Field> HSquare( H(IR(0,numCols),IR(0,numCols)) );
+            LinearSolve( HSquare, y );
+        }
+        Gemm( NORMAL, NORMAL, Field(1), VLoc(ALL,IR(0,numCols)), y, u );
+        q.Matrix() = u;
+        precond( q );
+        x += q;
+
+        // w := b - A x
+        // ============
+        w = b;
+        applyA( Field(-1), x, Field(1), w );
+        const Real residNorm = Nrm2( w );
+        const Real relResidNorm = residNorm/origResidNorm;
+        if( ctrl.progress && commRank == 0 )
+            Output
+            (name," restart after ",iter," iterations has relResidNorm=",
+             relResidNorm);
+        if( relResidNorm <= ctrl.relTol )
+            break;
+        if( iter >= ctrl.maxIts )
+            RuntimeError(name," did not converge");
+    }
+    b = x;
+    return iter;
+}
+
+// Solve each column of A X = B independently, with B overwritten by X, and
+// return the maximum number of iterations used for any of the columns. Since
+// the operator is the same for every column, so are the Newton basis shifts.
+template<typename Field,class ApplyAType,class PrecondType>
+Int Multiple
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const SStepCtrl<Base<Field>>& ctrl,
+        bool minimizeResidual,
+        SStepInfo& info )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int height = B.Height();
+    const Int width = B.Width();
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    vector<Field> shifts;
+    for( Int j=0; j<width; ++j )
+    {
+        auto& BLoc = B.Matrix();
+        auto& uLoc = u.Matrix();
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its =
+          Single( applyA, precond, u, ctrl, minimizeResidual, shifts, info );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace sstep
+
+// Returns the maximum number of iterations (Krylov vectors) used for any
+// of the right-hand sides
+template<typename Field,class ApplyAType,class PrecondType>
+Int SStepGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const SStepCtrl<Base<Field>>& ctrl,
+        SStepInfo& info )
+{
+    EL_DEBUG_CSE
+    return sstep::Multiple( applyA, precond, B, ctrl, true, info );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int SStepGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const SStepCtrl<Base<Field>>& ctrl=SStepCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    SStepInfo info;
+    return SStepGMRES( applyA, precond, B, ctrl, info );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int SStepCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const SStepCtrl<Base<Field>>& ctrl,
+        SStepInfo& info )
+{
+    EL_DEBUG_CSE
+    return sstep::Multiple( applyA, precond, B, ctrl, false, info );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int SStepCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+  const SStepCtrl<Base<Field>>& ctrl=SStepCtrl<Base<Field>>() )
+{
+    EL_DEBUG_CSE
+    SStepInfo info;
+    return SStepCG( applyA, precond, B, ctrl, info );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_SSTEP_HPP
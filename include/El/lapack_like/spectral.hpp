@@ -460,6 +460,61 @@ HermitianEig
         AbstractDistMatrix<Field>& Q,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Compute the eigenpairs of a sparse Hermitian matrix within an interval
+// -----------------------------------------------------------------------
+// The interval is partitioned into slices whose eigenvalue counts are
+// determined from the inertias of sparse LDL^H factorizations of shifted
+// copies of A (Sylvester's law of inertia). The slices are then distributed
+// over subcommunicators, which each run shift-and-invert Lanczos (with
+// explicit locking and restarts) about the center of each of their slices
+// until the number of eigenvalues found in each slice matches its count.
+template<typename Real>
+struct SpectrumSliceCtrl
+{
+    // The number of subcommunicators to split the communicator of A into
+    // (if zero, each process forms its own subcommunicator)
+    Int numSubcomms=0;
+    // Slices are bisected until they contain at most this many eigenvalues
+    Int maxSliceSize=100;
+    // The number of Lanczos vectors beyond twice the number of eigenvalues
+    // which remain to be found in a slice
+    Int extraBasisSize=20;
+    Int maxRestarts=10;
+    // The relative tolerance on the residuals of the shift-and-invert
+    // Ritz values
+    Real tol;
+    LDLFrontType frontType=LDL_INTRAPIV_2D;
+    BisectCtrl bisectCtrl;
+    bool progress=false;
+
+    SpectrumSliceCtrl() : tol(Pow(limits::Epsilon<Real>(),Real(0.7))) { }
+};
+
+// Compute the eigenvalues in [lowerBound,upperBound). If either endpoint is
+// numerically an eigenvalue, it is perturbed into the interior of the
+// interval by a small multiple of
+// sqrt(eps) max(|lowerBound|,|upperBound|,upperBound-lowerBound), so that
+// eigenvalues that close to lowerBound may be omitted.
+template<typename Field>
+void HermitianEig
+( const DistSparseMatrix<Field>& A,
+  const Base<Field>& lowerBound,
+  const Base<Field>& upperBound,
+        Matrix<Base<Field>>& w,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl=
+        SpectrumSliceCtrl<Base<Field>>() );
+
+// Compute the eigenpairs in [lowerBound,upperBound)
+template<typename Field>
+void HermitianEig
+( const DistSparseMatrix<Field>& A,
+  const Base<Field>& lowerBound,
+  const Base<Field>& upperBound,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl=
+        SpectrumSliceCtrl<Base<Field>>() );
+
 namespace herm_eig {
 
 template<typename Real,
@@ -1237,6 +1292,10 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // The two-stage reduction is only used in the distributed case when
+    // A is at least as tall as it is wide
+    BidiagCtrl bidiagCtrl;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
@@ -1348,12 +1407,15 @@ SVDInfo SVD
 
 namespace svd {
 
+// Unless the default (binary-tree Householder) TSQR is requested, the small
+// SVD of R is redundantly computed by every process
 template<typename Field>
 SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& U,
         AbstractDistMatrix<Base<Field>>& s,
-        AbstractDistMatrix<Field>& V );
+        AbstractDistMatrix<Field>& V,
+  const qr::TSQRCtrl<Base<Field>>& ctrl=qr::TSQRCtrl<Base<Field>>() );
 
 } // namespace svd
 
@@ -1473,6 +1535,15 @@ void Lanczos
         AbstractDistMatrix<Base<Field>>& T,
         Int basisSize=20 );
 
+// A communication-avoiding variant which generates the Lanczos vectors in
+// blocks of ctrl.s using s-step Arnoldi (see El/lapack_like/solve/SStep.hpp)
+template<typename Field>
+void SStepLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& T,
+        Int basisSize=20,
+  const SStepCtrl<Base<Field>>& ctrl=SStepCtrl<Base<Field>>() );
+
 template<typename Field>
 Base<Field> LanczosDecomp
 ( const SparseMatrix<Field>& A,
@@ -13,6 +13,19 @@ namespace El {
 
 // Graph reordering
 // ================
+namespace BisectMethodNS {
+enum BisectMethod {
+  // Use (Par)METIS if it is available, otherwise the native bisection
+  BISECT_DEFAULT,
+  BISECT_METIS,
+  // A built-in multilevel bisection (heavy-edge matching coarsening, greedy
+  // graph-growing initial partitions, Fiduccia-Mattheyses refinement, and a
+  // minimum vertex cover of the cut edges)
+  BISECT_NATIVE
+};
+}
+using namespace BisectMethodNS;
+
 struct BisectCtrl
 {
     bool sequential;
@@ -20,13 +33,18 @@ struct BisectCtrl
     Int numSeqSeps;
     Int cutoff;
     bool storeFactRecvInds;
+    BisectMethod method;
 
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), method(BISECT_DEFAULT)
     { }
 };
 
+// Whether Bisect will use the native multilevel bisection for a sequential
+// or a distributed graph
+bool NativeBisection( const BisectCtrl& ctrl, bool distributed=false );
+
 Int Bisect
 ( const Graph& graph,
         Graph& leftChild,
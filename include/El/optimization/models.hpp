@@ -35,6 +35,7 @@ struct ADMMCtrl {
   bool usePinv=false;
   Real pinvTol=0;
   bool progress=true;
+  ADMMPenaltyCtrl<Real> penaltyCtrl;
 };
 
 } // namespace bp
@@ -387,6 +388,7 @@ struct ADMMCtrl {
   Real relTol=Real(1e-4);
   bool inv=true;
   bool progress=true;
+  ADMMPenaltyCtrl<Real> penaltyCtrl;
 };
 
 } // namespace bpdn
@@ -483,17 +485,22 @@ struct RPCACtrl
     Real beta=Real(1);
     Real rho=Real(6);
     Real tol=Real(1e-5);
+
+    // Residual balancing of beta within the ADMM (the ALM instead grows beta
+    // geometrically by a factor of rho)
+    ADMMPenaltyCtrl<Real> penaltyCtrl;
 };
 
+// Returns the number of iterations
 template<typename Field>
-void RPCA
+Int RPCA
 ( const Matrix<Field>& M,
         Matrix<Field>& L,
         Matrix<Field>& S,
   const RPCACtrl<Base<Field>>& ctrl=RPCACtrl<Base<Field>>() );
 
 template<typename Field>
-void RPCA
+Int RPCA
 ( const AbstractDistMatrix<Field>& M,
         AbstractDistMatrix<Field>& L,
         AbstractDistMatrix<Field>& S,
@@ -510,6 +517,7 @@ struct SparseInvCovCtrl
     Real absTol=Real(1e-6);
     Real relTol=Real(1e-4);
     bool progress=true;
+    ADMMPenaltyCtrl<Real> penaltyCtrl;
 };
 
 template<typename Field>
@@ -23,6 +23,26 @@ using namespace LPApproachNS;
 
 namespace lp {
 
+// Control structure for the presolve which is optionally applied to sparse
+// LPs before they are handed to an Interior Point Method. The supported
+// reductions are the removal of empty, singleton, forcing, dominated, and
+// duplicate rows; the removal of empty, fixed, and (implied) free singleton
+// columns; the elimination of doubleton equations; and, for the affine form,
+// the removal of implied bounds. A postsolve maps the primal and dual
+// solutions of the reduced problem back to the original problem.
+template<typename Real>
+struct PresolveCtrl
+{
+    // The relative tolerance used for comparing bounds, activities, and the
+    // ratios of the entries of duplicate rows
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    // The maximum number of sweeps over the reductions
+    Int maxPasses=10;
+
+    bool print=false;
+};
+
 namespace direct {
 
 // Attempt to solve a pair of Linear Programs in "direct" conic form:
@@ -43,10 +63,33 @@ struct Ctrl
     ADMMCtrl<Real> admmCtrl;
     MehrotraCtrl<Real> mehrotraCtrl;
 
+    // Presolve sparse problems before running the Interior Point Method?
+    // User-initialized primal and dual variables are ignored if so.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
+
     Ctrl( bool isSparse )
     { mehrotraCtrl.system = ( isSparse ? AUGMENTED_KKT : NORMAL_KKT ); }
 };
 
+// Alternating Direction Method of Multipliers
+// -------------------------------------------
+// Returns the number of iterations
+template<typename Real>
+Int ADMM
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& z,
+  const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
+template<typename Real>
+Int ADMM
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+  const AbstractDistMatrix<Real>& c,
+        AbstractDistMatrix<Real>& z,
+  const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
+
 } // namespace direct
 
 namespace affine {
@@ -67,6 +110,11 @@ struct Ctrl
 {
     LPApproach approach=LP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Presolve sparse problems before running the Interior Point Method?
+    // User-initialized primal and dual variables are ignored if so.
+    bool presolve=false;
+    PresolveCtrl<Real> presolveCtrl;
 };
 
 } // namespace affine
@@ -303,6 +351,82 @@ void LP
         DistMultiVec<Real>& z,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 
+namespace lp {
+namespace direct {
+
+// A persistent Mehrotra solver for sequences of related sparse LPs in direct
+// conic form (e.g., within branch-and-bound or model predictive control).
+// The symbolic analysis of the KKT system is kept for as long as the
+// sparsity pattern of 'A' and the KKT formulation remain unchanged, and,
+// when 'warmStart' is true, each solve after the first starts from the
+// (centrality-corrected) contents of 'solution'.
+template<typename Real>
+class SparseMehrotraSolver
+{
+public:
+    MehrotraCtrl<Real> ctrl;
+    bool warmStart=true;
+
+    SparseMehrotraSolver();
+    SparseMehrotraSolver( const MehrotraCtrl<Real>& ctrl );
+
+    void Solve
+    ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+            DirectLPSolution<Matrix<Real>>& solution );
+
+    // Discard the symbolic analysis and the warm start
+    void Reset();
+
+    Int NumSolves() const;
+    Int NumAnalyses() const;
+
+    // The statistics for each iteration of the most recent solve
+    const vector<IPMIterationInfo<Real>>& Iterations() const;
+
+private:
+    SparseKKTAnalysis<Real> analysis_;
+    KKTSystem system_=FULL_KKT;
+    Int height_=0, width_=0;
+    vector<Int> sources_, targets_;
+    Int numSolves_=0;
+    vector<IPMIterationInfo<Real>> iterations_;
+};
+
+template<typename Real>
+class DistSparseMehrotraSolver
+{
+public:
+    MehrotraCtrl<Real> ctrl;
+    bool warmStart=true;
+
+    DistSparseMehrotraSolver();
+    DistSparseMehrotraSolver( const MehrotraCtrl<Real>& ctrl );
+
+    void Solve
+    ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+            DirectLPSolution<DistMultiVec<Real>>& solution );
+
+    // Discard the symbolic analysis and the warm start
+    void Reset();
+
+    Int NumSolves() const;
+    Int NumAnalyses() const;
+
+    // The statistics for each iteration of the most recent solve
+    const vector<IPMIterationInfo<Real>>& Iterations() const;
+
+private:
+    DistSparseKKTAnalysis<Real> analysis_;
+    KKTSystem system_=FULL_KKT;
+    Int height_=0, width_=0;
+    vector<Int> sources_, targets_;
+    Int numSolves_=0;
+    vector<IPMIterationInfo<Real>> iterations_;
+};
+
+} // namespace direct
+} // namespace lp
+
 // Affine conic form
 // -----------------
 template<typename MatrixType,typename VectorType>
@@ -592,6 +716,15 @@ void ReadMPS
   bool keepNonnegativeWithZeroUpperBound=true,
   bool metadataSummary=false );
 
+// Load an affine conic form LP stored in the CPLEX LP format. The integrality
+// of any 'Generals' or 'Binaries' variables is dropped.
+template<class MatrixType,class VectorType>
+void ReadCPLEXLP
+( AffineLPProblem<MatrixType,VectorType>& problem,
+  const string& filename,
+  bool compressed=false,
+  bool metadataSummary=false );
+
 // Write out an LP in the MPS format.
 template<class MatrixType,class VectorType>
 void WriteMPS
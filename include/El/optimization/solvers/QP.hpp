@@ -45,6 +45,86 @@ struct Ctrl
     Ctrl() { mehrotraCtrl.system = AUGMENTED_KKT; }
 };
 
+// A persistent Mehrotra solver for sequences of related sparse QPs in direct
+// conic form (see lp::direct::SparseMehrotraSolver). The symbolic analysis of
+// the KKT system is kept for as long as the sparsity patterns of 'Q' and 'A'
+// and the KKT formulation remain unchanged, and, when 'warmStart' is true,
+// each solve after the first starts from the (centrality-corrected) contents
+// of 'x', 'y', and 'z'.
+template<typename Real>
+class SparseMehrotraSolver
+{
+public:
+    MehrotraCtrl<Real> ctrl;
+    bool warmStart=true;
+
+    SparseMehrotraSolver();
+    SparseMehrotraSolver( const MehrotraCtrl<Real>& ctrl );
+
+    void Solve
+    ( const SparseMatrix<Real>& Q,
+      const SparseMatrix<Real>& A,
+      const Matrix<Real>& b,
+      const Matrix<Real>& c,
+            Matrix<Real>& x,
+            Matrix<Real>& y,
+            Matrix<Real>& z );
+
+    // Discard the symbolic analysis and the warm start
+    void Reset();
+
+    Int NumSolves() const;
+    Int NumAnalyses() const;
+
+    // The statistics for each iteration of the most recent solve
+    const vector<IPMIterationInfo<Real>>& Iterations() const;
+
+private:
+    SparseKKTAnalysis<Real> analysis_;
+    KKTSystem system_=FULL_KKT;
+    Int height_=0, width_=0;
+    vector<Int> QSources_, QTargets_, ASources_, ATargets_;
+    Int numSolves_=0;
+    vector<IPMIterationInfo<Real>> iterations_;
+};
+
+template<typename Real>
+class DistSparseMehrotraSolver
+{
+public:
+    MehrotraCtrl<Real> ctrl;
+    bool warmStart=true;
+
+    DistSparseMehrotraSolver();
+    DistSparseMehrotraSolver( const MehrotraCtrl<Real>& ctrl );
+
+    void Solve
+    ( const DistSparseMatrix<Real>& Q,
+      const DistSparseMatrix<Real>& A,
+      const DistMultiVec<Real>& b,
+      const DistMultiVec<Real>& c,
+            DistMultiVec<Real>& x,
+            DistMultiVec<Real>& y,
+            DistMultiVec<Real>& z );
+
+    // Discard the symbolic analysis and the warm start
+    void Reset();
+
+    Int NumSolves() const;
+    Int NumAnalyses() const;
+
+    // The statistics for each iteration of the most recent solve
+    const vector<IPMIterationInfo<Real>>& Iterations() const;
+
+private:
+    DistSparseKKTAnalysis<Real> analysis_;
+    KKTSystem system_=FULL_KKT;
+    Int height_=0, width_=0;
+    vector<Int> QSources_, QTargets_, ASources_, ATargets_;
+    Int numSolves_=0;
+    vector<IPMIterationInfo<Real>> iterations_;
+};
+
 } // namespace direct
 
 namespace affine {
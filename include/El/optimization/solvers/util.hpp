@@ -73,9 +73,29 @@ struct MehrotraCtrl
     KKTSystem system=FULL_KKT;
 
     // Use Mehrotra's second-order corrector?
-    // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // The maximum number of Gondzio's multiple centrality correctors to apply
+    // after the combined predictor-corrector direction has been computed.
+    // Each corrector only requires an additional solve with the existing
+    // factorization of the KKT system and targets the point reached by
+    // steps which are 'gondzioStepIncrease' longer, with the complementarity
+    // products of the trial point moved into the interval
+    //
+    //   [gondzioMinRatio sigma mu, gondzioMaxRatio sigma mu].
+    //
+    // A corrector is only accepted (and the next one attempted) if it
+    // lengthens the smaller of the two steps by at least
+    // 'gondzioAcceptRatio*gondzioStepIncrease'. Zero disables the correctors.
+    //
+    // NOTE: The correctors are currently only supported for positive-orthant
+    //       cones (i.e., by the LP and QP solvers).
+    Int maxGondzioCorrectors=0;
+    Real gondzioStepIncrease=Real(0.1);
+    Real gondzioAcceptRatio=Real(0.1);
+    Real gondzioMinRatio=Real(0.1);
+    Real gondzioMaxRatio=Real(10);
+
     // For determining the ratio of the amount to balance the affine and 
     // correction updates. The other common option is 'MehrotraCentrality'.
     function<Real(Real,Real,Real,Real)>
@@ -84,6 +104,19 @@ struct MehrotraCtrl
     // Use a simple shift for forcing cone membership during initialization?
     bool standardInitShift=true;
 
+    // When the primal and dual variables are both user-initialized (e.g.,
+    // with the solution of a closely related problem), the negative entries
+    // are clipped and each complementarity product x_i z_i is moved into the
+    // interval [beta mu, mu / beta], where 'beta' is the following parameter
+    // and 'mu' is the average complementarity product, floored at
+    // 'warmStartMinBarrier'. A value of zero disables the correction.
+    //
+    // The floor is deliberately loose: restarting from a nearly complementary
+    // point of a perturbed problem leaves the iterates badly off-center, and
+    // in practice this costs more iterations than a cold start.
+    Real warmStartCentrality=Real(0.1);
+    Real warmStartMinBarrier=Real(0.1);
+
     // If the maximum ratio between the primary and dual variables exceeds this
     // value, the barrier parameter is kept at its previous value to attempt to
     // increase the centrality.
@@ -161,11 +194,106 @@ struct MehrotraCtrl
     // replace the default, (muAff/mu)^3
 };
 
+// Statistics for a single iteration of an Interior Point Method
+template<typename Real>
+struct IPMIterationInfo
+{
+    Real barrier=0;
+    Real relError=0;
+    Real primalStep=0;
+    Real dualStep=0;
+
+    // The number of seconds spent forming, analyzing, factoring, and solving
+    // with the KKT system, as well as the total for the iteration.
+    double formTime=0;
+    double analysisTime=0;
+    double factorTime=0;
+    double solveTime=0;
+    double totalTime=0;
+};
+
+// The symbolic analyses of the sparse KKT systems formed by the direct-form
+// LP and QP Mehrotra Interior Point Methods. They only depend upon the
+// sparsity patterns of 'Q' and 'A' and can therefore be reused across problems
+// which only differ in the values of 'Q', 'A', 'b', and 'c'.
+template<typename Real>
+struct SparseKKTAnalysis
+{
+    bool analyzed=false;
+    SparseLDLFactorization<Real> factorization;
+
+    // The augmented system used for forming the initial point; this is only
+    // distinct from the above when the IPM does not use AUGMENTED_KKT.
+    bool initAnalyzed=false;
+    SparseLDLFactorization<Real> initFactorization;
+
+    Int numAnalyses=0;
+};
+
+template<typename Real>
+struct DistSparseKKTAnalysis
+{
+    bool analyzed=false;
+    DistSparseLDLFactorization<Real> factorization;
+
+    bool initAnalyzed=false;
+    DistSparseLDLFactorization<Real> initFactorization;
+
+    // The communication metadata for sparse matrix-vector products with the
+    // (unregularized and regularized) KKT matrices
+    bool haveMultMeta=false;
+    DistGraphMultMeta multMetaOrig, multMeta;
+
+    Int numAnalyses=0;
+};
+
 // Alternating Direction Method of Multipliers
 // ===========================================
+
+// Residual balancing of the ADMM penalty parameter, rho, following
+// He, Yang, and Wang (2000) and Sec. 3.4.1 of Boyd et al.'s "Distributed
+// Optimization and Statistical Learning via the Alternating Direction Method
+// of Multipliers": whenever the primal residual norm exceeds the dual residual
+// norm by more than a factor of 'ratio', rho is multiplied by 'scaling', and
+// whenever the dual residual norm is the larger by the same factor, rho is
+// divided by 'scaling'. Since the scaled dual variable is u = y / rho, it is
+// rescaled along with rho, and any cached factorization involving rho must be
+// recomputed.
+//
+// The adaptation is frozen after 'maxAdaptIter' iterations so that the usual
+// fixed-penalty convergence theory applies to the remaining iterations. It is
+// disabled by default so that the iterates of existing callers are unchanged.
+template<typename Real>
+struct ADMMPenaltyCtrl
+{
+    bool adapt=false;
+    Real ratio=Real(10);
+    Real scaling=Real(2);
+    Int maxAdaptIter=100;
+};
+
+// Return the factor by which rho should be multiplied (one if unchanged).
+template<typename Real>
+inline Real ADMMPenaltyScaling
+( Real primalResidNorm,
+  Real dualResidNorm,
+  Int numIter,
+  const ADMMPenaltyCtrl<Real>& ctrl )
+{
+    if( !ctrl.adapt || numIter >= ctrl.maxAdaptIter )
+        return Real(1);
+    if( primalResidNorm > ctrl.ratio*dualResidNorm )
+        return ctrl.scaling;
+    else if( dualResidNorm > ctrl.ratio*primalResidNorm )
+        return Real(1)/ctrl.scaling;
+    else
+        return Real(1);
+}
+
 template<typename Real>
 struct ADMMCtrl
 {
+    // The initial penalty parameter
     Real rho=Real(1);
     Real alpha=Real(1.2);
     Int maxIter=500;
@@ -174,6 +302,7 @@ struct ADMMCtrl
     Real relTol=Real(1e-4);
     bool inv=true;
     bool print=true;
+    ADMMPenaltyCtrl<Real> penaltyCtrl;
 };
 
 } // namespace El
@@ -116,6 +116,73 @@ void PushPairInto
   const DistMultiVec<Real>& w,
   Real wMaxNormLimit );
 
+// Center a warm start
+// ===================
+// Clip the negative entries of 's' and 'z' and then move each product
+// s_i z_i into the interval [beta mu, mu / beta] by modifying the smaller
+// (resp. larger) of the two entries when the product is too small (resp. too
+// large).
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CenterPair
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real mu,
+  Real beta );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CenterPair
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real mu,
+  Real beta );
+
+// Form the residual of a multiple centrality corrector
+// =====================================================
+// Given the trial complementarity products
+//
+//   v := (s + alphaPri ds) o (z + alphaDual dz),
+//
+// overwrite 'r' with 'v - t', where 't' is the projection of 'v' onto
+// [lowerBound,upperBound]; the entries of 'r' are additionally bounded above
+// by 'upperBound' so that large products are not aggressively decreased.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityResidual
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        Matrix<Real>& r );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityResidual
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& ds,
+  const AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        AbstractDistMatrix<Real>& r );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityResidual
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        DistMultiVec<Real>& r );
+
 } // namespace pos_orth
 } // namespace El
 
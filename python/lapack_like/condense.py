@@ -134,8 +134,9 @@ def ApplyPAfterBidiag(side,orient,A,t,B):
 
 # Reduction of a Hermitian matrix to real symmetric tridiagonal form
 # ==================================================================
-(HERMITIAN_TRIDIAG_NORMAL,HERMITIAN_TRIDIAG_SQUARE,HERMITIAN_TRIDIAG_DEFAULT)= \
-(0,1,2)
+(HERMITIAN_TRIDIAG_NORMAL,HERMITIAN_TRIDIAG_SQUARE,HERMITIAN_TRIDIAG_DEFAULT,
+ HERMITIAN_TRIDIAG_TWO_STAGE)= \
+(0,1,2,3)
 
 # TODO: Reenable TridiagCtrl
 
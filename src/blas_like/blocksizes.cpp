@@ -8,12 +8,33 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
+#include <map>
 #include <stack>
+#include <tuple>
 
 namespace {
 using namespace El;
 
 std::stack<Int> blocksizeStack;
+// Whether the default blocksize was overridden via SetBlocksize
+bool blocksizeWasSet = false;
+
+// (routine, datatype, grid height, grid width) -> blocksize
+typedef std::tuple<string,string,Int,Int> TunedBlocksizeKey;
+std::map<TunedBlocksizeKey,Int> tunedBlocksizes;
+
+// Datatype names such as "long long int" contain spaces, which would break
+// the whitespace-delimited blocksize files, so they are stored with
+// underscores instead (e.g., "long_long_int").
+string TunedTypeName( string typeName )
+{
+    for( auto& character : typeName )
+        if( character == ' ' )
+            character = '_';
+    return typeName;
+}
+
+Int lookAheadDepth = 0;
 
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
@@ -50,6 +71,8 @@ void SetBlocksize( Int blocksize )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
     ::blocksizeStack.top() = blocksize;
+    if( ::blocksizeStack.size() == 1 )
+        ::blocksizeWasSet = true;
 }
 
 void PushBlocksizeStack( Int blocksize )
@@ -68,6 +91,122 @@ void EmptyBlocksizeStack()
 {
     while( ! ::blocksizeStack.empty() )
         ::blocksizeStack.pop();
+    ::blocksizeWasSet = false;
+}
+
+Int LookAheadDepth() { return ::lookAheadDepth; }
+
+void SetLookAheadDepth( Int depth )
+{
+    if( depth < 0 )
+        LogicError("Look-ahead depth must be non-negative");
+    ::lookAheadDepth = depth;
+}
+
+Int TunedBlocksize
+( const string& routine, const string& typeName,
+  Int gridHeight, Int gridWidth )
+{
+    // Explicitly set or pushed blocksizes take precedence
+    if( ::blocksizeWasSet || ::blocksizeStack.size() > 1 ||
+        ::tunedBlocksizes.empty() )
+        return Blocksize();
+    const string tunedTypeName = ::TunedTypeName( typeName );
+    auto it = ::tunedBlocksizes.find
+      ( TunedBlocksizeKey(routine,tunedTypeName,gridHeight,gridWidth) );
+    if( it == ::tunedBlocksizes.end() )
+        it = ::tunedBlocksizes.find
+          ( TunedBlocksizeKey(routine,tunedTypeName,0,0) );
+    if( it == ::tunedBlocksizes.end() )
+        return Blocksize();
+    return it->second;
+}
+
+template<typename T>
+Int Blocksize( const string& routine, Int gridHeight, Int gridWidth )
+{ return TunedBlocksize( routine, TypeName<T>(), gridHeight, gridWidth ); }
+
+template<typename T>
+void SetTunedBlocksize
+( const string& routine, Int blocksize, Int gridHeight, Int gridWidth )
+{
+    EL_DEBUG_ONLY(
+      if( blocksize <= 0 )
+          LogicError("Tuned blocksizes must be positive");
+    )
+    ::tunedBlocksizes[TunedBlocksizeKey
+      (routine,::TunedTypeName(TypeName<T>()),gridHeight,gridWidth)] =
+      blocksize;
+}
+
+void ClearTunedBlocksizes()
+{ ::tunedBlocksizes.clear(); }
+
+void LoadTunedBlocksizes( const string& filename, mpi::Comm comm, int root )
+{
+    EL_DEBUG_CSE
+    // Read the file on the root and broadcast its contents
+    string contents;
+    int numChars = 0;
+    if( mpi::Rank(comm) == root )
+    {
+        std::ifstream file( filename.c_str() );
+        if( !file.is_open() )
+        {
+            numChars = -1;
+        }
+        else
+        {
+            std::stringstream stream;
+            stream << file.rdbuf();
+            contents = stream.str();
+            numChars = contents.size();
+        }
+    }
+    mpi::Broadcast( numChars, root, comm );
+    if( numChars < 0 )
+        RuntimeError("Could not open blocksize file ",filename);
+    contents.resize( numChars );
+    mpi::Broadcast
+    ( reinterpret_cast<byte*>(&contents[0]), numChars, root, comm );
+
+    std::istringstream stream( contents );
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( stream, line ) )
+    {
+        ++lineNumber;
+        const auto commentPos = line.find('#');
+        if( commentPos != string::npos )
+            line.erase( commentPos );
+        std::istringstream lineStream( line );
+        string routine, typeName;
+        if( !(lineStream >> routine) )
+            continue;
+        Int gridHeight, gridWidth, blocksize;
+        if( !(lineStream >> typeName >> gridHeight >> gridWidth >> blocksize)
+            || blocksize <= 0 )
+            RuntimeError
+            ("Invalid entry on line ",lineNumber," of ",filename);
+        ::tunedBlocksizes[TunedBlocksizeKey
+          (routine,::TunedTypeName(typeName),gridHeight,gridWidth)] =
+          blocksize;
+    }
+}
+
+void SaveTunedBlocksizes( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# routine datatype gridHeight gridWidth blocksize\n";
+    for( const auto& entry : ::tunedBlocksizes )
+        file << std::get<0>(entry.first) << " "
+             << std::get<1>(entry.first) << " "
+             << std::get<2>(entry.first) << " "
+             << std::get<3>(entry.first) << " "
+             << entry.second << "\n";
 }
 
 template<typename T>
@@ -95,6 +234,10 @@ Int LocalTrr2kBlocksize()
 { return LocalTrr2kBlocksizeHelper<T>::value; }
 
 #define PROTO(T) \
+  template Int Blocksize<T> \
+  ( const string& routine, Int gridHeight, Int gridWidth ); \
+  template void SetTunedBlocksize<T> \
+  ( const string& routine, Int blocksize, Int gridHeight, Int gridWidth ); \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
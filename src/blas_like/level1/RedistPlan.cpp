@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <list>
+
+namespace {
+
+// The cached plans, ordered from the most to the least recently used
+std::list<std::pair<El::copy::RedistPlanKey,
+                    El::shared_ptr<const El::copy::RedistPlan>>> redistPlans;
+El::Int maxRedistPlans = 32;
+El::Int maxRedistPlanBytes = El::Int(1) << 28;
+El::Int numRedistPlanBytes = 0;
+
+void TrimRedistPlans()
+{
+    while( El::Int(redistPlans.size()) > maxRedistPlans ||
+           numRedistPlanBytes > maxRedistPlanBytes )
+    {
+        numRedistPlanBytes -= redistPlans.back().second->NumBytes();
+        redistPlans.pop_back();
+    }
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetRedistPlanCacheSize( Int numPlans )
+{
+    if( numPlans < 0 )
+        LogicError("The number of cached plans must be non-negative");
+    ::maxRedistPlans = numPlans;
+    TrimRedistPlans();
+}
+
+Int RedistPlanCacheSize() { return ::maxRedistPlans; }
+
+void SetRedistPlanCacheBytes( Int numBytes )
+{
+    if( numBytes < 0 )
+        LogicError("The number of cached bytes must be non-negative");
+    ::maxRedistPlanBytes = numBytes;
+    TrimRedistPlans();
+}
+
+Int RedistPlanCacheBytes() { return ::maxRedistPlanBytes; }
+
+void ClearRedistPlans()
+{
+    ::redistPlans.clear();
+    ::numRedistPlanBytes = 0;
+}
+
+namespace copy {
+
+shared_ptr<const RedistPlan> FindRedistPlan( const RedistPlanKey& key )
+{
+    for( auto it=::redistPlans.begin(); it!=::redistPlans.end(); ++it )
+    {
+        if( it->first == key )
+        {
+            ::redistPlans.splice( ::redistPlans.begin(), ::redistPlans, it );
+            return ::redistPlans.front().second;
+        }
+    }
+    return shared_ptr<const RedistPlan>();
+}
+
+void StoreRedistPlan
+( const RedistPlanKey& key, shared_ptr<const RedistPlan> plan )
+{
+    ::redistPlans.emplace_front( key, plan );
+    ::numRedistPlanBytes += plan->NumBytes();
+    TrimRedistPlans();
+}
+
+} // namespace copy
+} // namespace El
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Gemm/Model.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -16,6 +17,89 @@
 
 namespace El {
 
+namespace {
+
+GemmCostParams gemmCostParams;
+
+// The average time of a ping-pong of the given number of bytes between the
+// first two processes of the communicator
+double PingPongTime( Int numBytes, Int numRepeats, mpi::Comm comm )
+{
+    const int rank = mpi::Rank( comm );
+    vector<byte> buffer( Max(numBytes,Int(1)) );
+    mpi::Barrier( comm );
+    const double startTime = mpi::Time();
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+    {
+        if( rank == 0 )
+        {
+            mpi::Send( buffer.data(), numBytes, 1, comm );
+            mpi::Recv( buffer.data(), numBytes, 1, comm );
+        }
+        else if( rank == 1 )
+        {
+            mpi::Recv( buffer.data(), numBytes, 0, comm );
+            mpi::Send( buffer.data(), numBytes, 0, comm );
+        }
+    }
+    return (mpi::Time()-startTime) / numRepeats;
+}
+
+} // anonymous namespace
+
+void SetGemmCostParams( const GemmCostParams& params )
+{
+    EL_DEBUG_CSE
+    if( params.dotBlocksize <= 0 )
+        LogicError("The dot-product blocksize must be positive");
+    gemmCostParams = params;
+}
+
+const GemmCostParams& GetGemmCostParams() { return gemmCostParams; }
+
+GemmCostParams MeasureGemmCostParams( const Grid& g )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = g.Comm();
+    GemmCostParams params = gemmCostParams;
+    double measurements[3] = { params.latency, params.inverseBandwidth,
+                               params.flopTime };
+    if( mpi::Size(comm) > 1 )
+    {
+        const Int numRepeats = 20;
+        const Int largeSize = 1 << 22;
+        const double smallTime = PingPongTime( 1, numRepeats, comm );
+        const double largeTime = PingPongTime( largeSize, numRepeats, comm );
+        measurements[0] = smallTime / 2;
+        measurements[1] = Max(largeTime-smallTime,0.) / (2*largeSize);
+    }
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int n = 256;
+        Matrix<double> A(n,n), B(n,n), C(n,n);
+        Fill( A, 1. );
+        Fill( B, 1. );
+        Timer timer;
+        timer.Start();
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        measurements[2] = timer.Stop() / (2.*n*n*n);
+    }
+    mpi::Broadcast( measurements, 3, 0, comm );
+    params.latency = measurements[0];
+    params.inverseBandwidth = measurements[1];
+    params.flopTime = measurements[2];
+    return params;
+}
+
+template<typename T>
+GemmAlgorithm SelectGemmAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& g )
+{
+    EL_DEBUG_CSE
+    return gemm::SelectAlgorithm<T>( orientA, orientB, m, n, k, g );
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -95,13 +179,11 @@ void Gemm
   GemmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm")
     C *= beta;
     if( orientA == NORMAL && orientB == NORMAL )
     {
-        if( alg == GEMM_CANNON )
-            gemm::Cannon_NN( alpha, A, B, C );
-        else 
-            gemm::SUMMA_NN( alpha, A, B, C, alg );
+        gemm::SUMMA_NN( alpha, A, B, C, alg );
     }
     else if( orientA == NORMAL )
     {
@@ -288,7 +370,10 @@ void LocalGemm
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-                   AbstractDistMatrix<T>& C );
+                   AbstractDistMatrix<T>& C ); \
+  template GemmAlgorithm SelectGemmAlgorithm<T> \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, const Grid& g );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// A simple alpha-beta-gamma model of the distributed Gemm algorithms:
+// a message of w bytes costs latency + w*inverseBandwidth, and allgathers and
+// reduce-scatters over q processes are assumed to take log2(q) messages and
+// to move (q-1)/q of the total data through each process.
+
+inline double CollectiveCost
+( const GemmCostParams& params, double numBytes, Int commSize )
+{
+    if( commSize <= 1 )
+        return 0;
+    return params.latency*Log2(double(commSize)) +
+           params.inverseBandwidth*numBytes*(commSize-1)/commSize;
+}
+
+// A redistribution in which each process sends and receives roughly
+// 'numBytes' bytes
+inline double RedistCost
+( const GemmCostParams& params, double numBytes, Int commSize )
+{
+    if( commSize <= 1 )
+        return 0;
+    return params.latency*Log2(double(commSize)) +
+           params.inverseBandwidth*numBytes;
+}
+
+// The number of layers to use for the 2.5D algorithm, which must divide the
+// number of processes and should be at most the cube root of it (beyond
+// which the replication no longer reduces the communication volume).
+// Returns 1 if no replication is expected to pay off.
+template<typename T>
+Int NumLayers25D( Int m, Int n, Int k, const Grid& g );
+
+template<typename T>
+double ModeledCost25D( Int m, Int n, Int k, const Grid& g, Int numLayers )
+{
+    EL_DEBUG_CSE
+    const auto& params = GetGemmCostParams();
+    const Int p = g.Size();
+    const Int layerSize = p / numLayers;
+    const Int r = Grid::DefaultHeight( layerSize );
+    const Int s = layerSize / r;
+    const double w = sizeof(T);
+    const Int bsize = Blocksize<T>("Gemm",r,s);
+    const double kLayer = double(k) / numLayers;
+
+    // Constructing the layer grids requires several communicator splits each
+    double cost = 8*numLayers*params.latency*Log2(double(p));
+    // Scatter the slices of A and B to the layers
+    cost += RedistCost( params, w*(double(m)*k+double(k)*n)/p, p );
+    // Stationary-C SUMMA within each layer
+    const double numSteps = Ceil( kLayer/bsize );
+    cost += numSteps*(CollectiveCost( params, w*m*bsize/r, s ) +
+                      CollectiveCost( params, w*n*bsize/s, r ));
+    // Sum the contributions over the layers and return the result
+    cost += params.latency*Log2(double(numLayers)) +
+            params.inverseBandwidth*w*m*n/layerSize;
+    cost += RedistCost( params, w*double(m)*n/layerSize, p );
+    return cost;
+}
+
+template<typename T>
+Int NumLayers25D( Int m, Int n, Int k, const Grid& g )
+{
+    EL_DEBUG_CSE
+    const Int p = g.Size();
+    // Every process viewing the grid must own a portion of it
+    if( p < 8 || mpi::Size(g.ViewingComm()) != p )
+        return 1;
+    Int bestNumLayers = 1;
+    double bestCost = std::numeric_limits<double>::max();
+    for( Int numLayers=2; numLayers*numLayers*numLayers<=p; ++numLayers )
+    {
+        if( p % numLayers != 0 )
+            continue;
+        const double cost = ModeledCost25D<T>( m, n, k, g, numLayers );
+        if( cost < bestCost )
+        {
+            bestCost = cost;
+            bestNumLayers = numLayers;
+        }
+    }
+    return bestNumLayers;
+}
+
+// Modeled communication time, in seconds, of a distributed Gemm forming an
+// m x n matrix from a summation of length k. The local flops are the same for
+// every algorithm and so are omitted.
+template<typename T>
+double ModeledCost
+( GemmAlgorithm alg, Int m, Int n, Int k, const Grid& g )
+{
+    EL_DEBUG_CSE
+    const auto& params = GetGemmCostParams();
+    const Int r = g.Height();
+    const Int s = g.Width();
+    const Int p = g.Size();
+    const double w = sizeof(T);
+    const Int bsize = Blocksize<T>("Gemm",r,s);
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+    {
+        // Redistribute and allgather panels of B and reduce-scatter panels of
+        // the product over the process rows
+        const double numSteps = Ceil( double(n)/bsize );
+        return numSteps*(2*CollectiveCost( params, w*k*bsize/s, r ) +
+                         CollectiveCost( params, w*m*bsize/r, s ));
+    }
+    case GEMM_SUMMA_B:
+    {
+        const double numSteps = Ceil( double(m)/bsize );
+        return numSteps*(2*CollectiveCost( params, w*k*bsize/r, s ) +
+                         CollectiveCost( params, w*n*bsize/s, r ));
+    }
+    case GEMM_SUMMA_C:
+    {
+        // Allgather a panel of A within process rows and of B within columns
+        const double numSteps = Ceil( double(k)/bsize );
+        return numSteps*(CollectiveCost( params, w*m*bsize/r, s ) +
+                         CollectiveCost( params, w*n*bsize/s, r ));
+    }
+    case GEMM_SUMMA_DOT:
+    {
+        // Redistribute A and B into 1D distributions, then reduce-scatter each
+        // block of the product over the entire grid
+        const Int dotBsize = params.dotBlocksize;
+        const double numBlocks =
+          Ceil(double(m)/dotBsize)*Ceil(double(n)/dotBsize);
+        return RedistCost( params, w*(double(m)*k+double(k)*n)/p, p ) +
+               numBlocks*params.latency*Log2(double(p)) +
+               params.inverseBandwidth*w*m*n*(p-1)/p;
+    }
+    case GEMM_CANNON:
+    {
+        // sqrt(p)+1 circular shifts of the local blocks of A and B
+        const double blockBytes = w*(double(m)*k+double(k)*n)/p;
+        return (r+1)*(2*params.latency+params.inverseBandwidth*blockBytes);
+    }
+    case GEMM_SUMMA_25D:
+        return ModeledCost25D<T>( m, n, k, g, NumLayers25D<T>(m,n,k,g) );
+    default:
+        LogicError("Unsupported Gemm option");
+        return 0;
+    }
+}
+
+template<typename T>
+GemmAlgorithm SelectAlgorithm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, const Grid& g )
+{
+    EL_DEBUG_CSE
+    vector<GemmAlgorithm> algs;
+    algs.push_back( GEMM_SUMMA_C );
+    algs.push_back( GEMM_SUMMA_A );
+    algs.push_back( GEMM_SUMMA_B );
+    algs.push_back( GEMM_SUMMA_DOT );
+    if( orientA == NORMAL && orientB == NORMAL )
+    {
+        // Cannon's algorithm is only implemented for square grids where
+        // sqrt(p) evenly divides the summation dimension
+        if( g.Height() == g.Width() && g.Height() > 1 && k % g.Height() == 0 )
+            algs.push_back( GEMM_CANNON );
+        if( NumLayers25D<T>( m, n, k, g ) > 1 )
+            algs.push_back( GEMM_SUMMA_25D );
+    }
+
+    // Ties are broken in favor of the earlier (simpler) algorithms
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestCost = std::numeric_limits<double>::max();
+    for( auto alg : algs )
+    {
+        const double cost = ModeledCost<T>( alg, m, n, k, g );
+        if( cost < bestCost )
+        {
+            bestCost = cost;
+            bestAlg = alg;
+        }
+    }
+    return bestAlg;
+}
+
+} // namespace gemm
+} // namespace El
@@ -98,7 +98,8 @@ void SUMMA_NNA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -143,7 +144,8 @@ void SUMMA_NNB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -185,7 +187,8 @@ void SUMMA_NNC
 {
     EL_DEBUG_CSE
     const Int sumDim = APre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -269,6 +272,117 @@ void SUMMA_NNDot
     }
 }
 
+// Communication-avoiding ("2.5D") Normal Normal Gemm
+//
+// The processes are split into 'numLayers' layers of consecutive ranks, each
+// of which forms its own grid and is handed a slice of the summation
+// dimension. Each layer forms its contribution with a stationary-C SUMMA, and
+// the contributions are then summed across the layers.
+//
+template<typename T>
+void SUMMA_NN25D
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  Int numLayers )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int p = g.Size();
+    if( numLayers <= 1 )
+    {
+        SUMMA_NNC( alpha, APre, BPre, CPre );
+        return;
+    }
+    if( p % numLayers != 0 )
+        LogicError("Number of layers must divide the number of processes");
+    if( mpi::Size(g.ViewingComm()) != p )
+        LogicError("2.5D Gemm requires every viewing process to own the grid");
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int sumDim = A.Width();
+
+    // Form a grid for each layer
+    const Int layerSize = p / numLayers;
+    const Int layerRank = g.OwningRank() % layerSize;
+    const Int layer = g.OwningRank() / layerSize;
+    mpi::Comm viewingComm = g.ViewingComm();
+    mpi::Group owningGroup = g.OwningGroup();
+    vector<mpi::Group> layerGroups(numLayers);
+    vector<unique_ptr<Grid>> layerGrids(numLayers);
+    vector<int> layerRanks(layerSize);
+    for( Int l=0; l<numLayers; ++l )
+    {
+        for( Int t=0; t<layerSize; ++t )
+            layerRanks[t] = l*layerSize + t;
+        mpi::Incl
+        ( owningGroup, layerSize, layerRanks.data(), layerGroups[l] );
+        layerGrids[l].reset
+        ( new Grid
+          ( viewingComm, layerGroups[l], Grid::DefaultHeight(layerSize) ) );
+    }
+
+    // Hand each layer its slice of A and B (every process takes part in each
+    // redistribution, though only the members of layer l receive data)
+    const Grid& layerGrid = *layerGrids[layer];
+    DistMatrix<T> ALayer(layerGrid), BLayer(layerGrid), CLayer(layerGrid);
+    for( Int l=0; l<numLayers; ++l )
+    {
+        const Range<Int> sliceInd( (l*sumDim)/numLayers,
+                                   ((l+1)*sumDim)/numLayers );
+        DistMatrix<T> AOther(*layerGrids[l]), BOther(*layerGrids[l]);
+        auto& ASlice = ( l == layer ? ALayer : AOther );
+        auto& BSlice = ( l == layer ? BLayer : BOther );
+        ASlice = A( ALL, sliceInd );
+        BSlice = B( sliceInd, ALL );
+    }
+
+    // C_l[MC,MR] := alpha A_l[MC,MR] B_l[MC,MR] within each layer
+    CLayer.Resize( m, n );
+    Zero( CLayer );
+    SUMMA_NNC( alpha, ALayer, BLayer, CLayer );
+
+    // Since each layer grid has the same shape and the same alignments,
+    // the processes with the same rank in each layer own the same entries
+    mpi::Comm depthComm;
+    mpi::Split( g.OwningComm(), layerRank, layer, depthComm );
+    const Int localHeight = CLayer.LocalHeight();
+    const Int localWidth = CLayer.LocalWidth();
+    if( localHeight*localWidth > 0 )
+    {
+        Matrix<T> CLayerSum;
+        if( CLayer.LDim() == localHeight )
+            View( CLayerSum, CLayer.Matrix() );
+        else
+            CLayerSum = CLayer.Matrix();
+        mpi::Reduce
+        ( CLayerSum.Buffer(), localHeight*localWidth, 0, depthComm );
+        if( layer == 0 && CLayer.LDim() != localHeight )
+            CLayer.Matrix() = CLayerSum;
+    }
+    mpi::Free( depthComm );
+
+    // C[MC,MR] += the summed contributions, which live on the first layer
+    DistMatrix<T> CFirstOther(*layerGrids[0]), CSum(g);
+    if( layer != 0 )
+        CFirstOther.Resize( m, n );
+    auto& CFirst = ( layer == 0 ? CLayer : CFirstOther );
+    CSum.AlignWith( C );
+    CSum = CFirst;
+    Axpy( T(1), CSum, C );
+
+    for( Int l=0; l<numLayers; ++l )
+        mpi::Free( layerGroups[l] );
+}
+
 template<typename T>
 void SUMMA_NN
 ( T alpha,
@@ -293,28 +407,21 @@ void SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = GetGemmCostParams().dotBlocksize;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( NORMAL, NORMAL, m, n, sumDim, A.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NNDot( alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NNB( alpha, A, B, C );    
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NNA( alpha, A, B, C );
-        else
-            SUMMA_NNC( alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_CANNON:    Cannon_NN( alpha, A, B, C ); break;
+    case GEMM_SUMMA_25D:
+        SUMMA_NN25D
+        ( alpha, A, B, C, NumLayers25D<T>(m,n,sumDim,A.Grid()) );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -21,7 +21,8 @@ void SUMMA_NTA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
     const bool conjugate = ( orientB == ADJOINT );
 
@@ -65,7 +66,8 @@ void SUMMA_NTB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -111,7 +113,8 @@ void SUMMA_NTC
 {
     EL_DEBUG_CSE
     const Int sumDim = APre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
     const bool conjugate = ( orientB == ADJOINT );
 
@@ -227,28 +230,18 @@ void SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = GetGemmCostParams().dotBlocksize;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( NORMAL, orientB, m, n, sumDim, A.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NTB( orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NTA( orientB, alpha, A, B, C );
-        else
-            SUMMA_NTC( orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
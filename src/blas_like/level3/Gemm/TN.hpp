@@ -21,7 +21,8 @@ void SUMMA_TNA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -67,7 +68,8 @@ void SUMMA_TNB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
     const bool conjugate = ( orientA == ADJOINT );
 
@@ -110,7 +112,8 @@ void SUMMA_TNC
 {
     EL_DEBUG_CSE
     const Int sumDim = BPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -222,28 +225,18 @@ void SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = GetGemmCostParams().dotBlocksize;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( orientA, NORMAL, m, n, sumDim, A.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TNDot( orientA, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TNB( orientA, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TNA( orientA, alpha, A, B, C );
-        else
-            SUMMA_TNC( orientA, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_TNDot( orientA, alpha, A, B, C, blockSizeDot );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
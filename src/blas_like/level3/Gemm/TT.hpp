@@ -22,7 +22,8 @@ void SUMMA_TTA
 {
     EL_DEBUG_CSE
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -70,7 +71,8 @@ void SUMMA_TTB
 {
     EL_DEBUG_CSE
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
     const bool conjugateA = ( orientA == ADJOINT ); 
 
@@ -121,7 +123,8 @@ void SUMMA_TTC
 {
     EL_DEBUG_CSE
     const Int sumDim = APre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<T>("Gemm",CPre.Grid().Height(),CPre.Grid().Width());
     const Grid& g = APre.Grid();
     const bool conjugateB = ( orientB == ADJOINT );
 
@@ -239,24 +242,12 @@ void SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const Int blockSizeDot = GetGemmCostParams().dotBlocksize;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( orientA, orientB, m, n, sumDim, A.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TTB( orientA, orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TTA( orientA, orientB, alpha, A, B, C );
-        else
-            SUMMA_TTC( orientA, orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:
         SUMMA_TTA( orientA, orientB, alpha, A, B, C );
         break;
@@ -267,7 +258,7 @@ void SUMMA_TT
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_DOT:
-        SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
+        SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
         break;
     default: LogicError("Unsupported Gemm option");
     }
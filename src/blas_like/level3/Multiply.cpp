@@ -14,6 +14,165 @@
 namespace El {
 
 namespace {
+
+// The number of right-hand sides processed simultaneously within each row
+const Int csrBlockWidth = 4;
+
+// The row-major (InterX/InterY) and column-major variants below all map to
+// a generic kernel which accesses X(i,k) as X[i*XRowStride+k*XColStride]
+// (and similarly for Y). 'value' returns the nonzero value of an edge, which
+// is identically one for the pattern-only (Graph) variants.
+template<typename T>
+struct CSRValues
+{
+    const T* values;
+    T operator()( Int e ) const { return values[e]; }
+};
+
+template<typename T>
+struct CSRPattern
+{
+    T operator()( Int ) const { return T(1); }
+};
+
+template<typename T,class ValueFunc>
+void MultiplyCSRNormal
+( Int m, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const ValueFunc& value,
+  const T* X, Int XRowStride, Int XColStride,
+  T beta,
+        T* Y, Int YRowStride, Int YColStride )
+{
+    EL_PARALLEL_FOR
+    for( Int i=0; i<m; ++i )
+    {
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int kStart=0; kStart<numRHS; kStart+=csrBlockWidth )
+        {
+            const Int kSize = Min(csrBlockWidth,numRHS-kStart);
+            const T* XBlock = &X[kStart*XColStride];
+            T sums[csrBlockWidth];
+            for( Int k=0; k<kSize; ++k )
+                sums[k] = 0;
+            for( Int e=eStart; e<eStop; ++e )
+            {
+                const T v = value(e);
+                const T* XRow = &XBlock[colIndices[e]*XRowStride];
+                for( Int k=0; k<kSize; ++k )
+                    sums[k] += v*XRow[k*XColStride];
+            }
+            T* YRow = &Y[i*YRowStride+kStart*YColStride];
+            for( Int k=0; k<kSize; ++k )
+                YRow[k*YColStride] = alpha*sums[k] + beta*YRow[k*YColStride];
+        }
+    }
+}
+
+template<typename T,class ValueFunc>
+void ScatterCSRAdjoint
+( bool conjugate,
+  Int iStart, Int iStop, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const ValueFunc& value,
+  const T* X, Int XRowStride, Int XColStride,
+        T* Y, Int YRowStride, Int YColStride )
+{
+    for( Int i=iStart; i<iStop; ++i )
+    {
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        const T* XRow = &X[i*XRowStride];
+        for( Int e=eStart; e<eStop; ++e )
+        {
+            const T coef = alpha*( conjugate ? Conj(value(e)) : value(e) );
+            T* YRow = &Y[colIndices[e]*YRowStride];
+            for( Int k=0; k<numRHS; ++k )
+                YRow[k*YColStride] += coef*XRow[k*XColStride];
+        }
+    }
+}
+
+template<typename T,class ValueFunc>
+void MultiplyCSRAdjoint
+( bool conjugate,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const ValueFunc& value,
+  const T* X, Int XRowStride, Int XColStride,
+  T beta,
+        T* Y, Int YRowStride, Int YColStride )
+{
+    EL_PARALLEL_FOR_COLLAPSE2
+    for( Int j=0; j<n; ++j )
+        for( Int k=0; k<numRHS; ++k )
+            Y[j*YRowStride+k*YColStride] *= beta;
+
+#ifdef EL_HYBRID
+    // Avoid atomics by having each thread scatter its block of rows into a
+    // private copy of Y which are then summed
+    const Int numThreads = omp_get_max_threads();
+    if( numThreads > 1 && m > 0 )
+    {
+        vector<T> YThreads( numThreads*n*numRHS, T(0) );
+        #pragma omp parallel
+        {
+            const Int thread = omp_get_thread_num();
+            const Int chunk = (m + numThreads - 1) / numThreads;
+            const Int iStart = Min(chunk*thread,m);
+            const Int iStop = Min(chunk*(thread+1),m);
+            ScatterCSRAdjoint
+            ( conjugate, iStart, iStop, numRHS, alpha,
+              rowOffsets, colIndices, value,
+              X, XRowStride, XColStride,
+              &YThreads[thread*n*numRHS], numRHS, 1 );
+        }
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+            for( Int thread=0; thread<numThreads; ++thread )
+                for( Int k=0; k<numRHS; ++k )
+                    Y[j*YRowStride+k*YColStride] +=
+                      YThreads[thread*n*numRHS+j*numRHS+k];
+        return;
+    }
+#endif
+    ScatterCSRAdjoint
+    ( conjugate, 0, m, numRHS, alpha,
+      rowOffsets, colIndices, value,
+      X, XRowStride, XColStride,
+      Y, YRowStride, YColStride );
+}
+
+template<typename T,class ValueFunc>
+void MultiplyCSRGeneric
+( Orientation orientation,
+  Int m, Int n, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const ValueFunc& value,
+  const T* X, Int XRowStride, Int XColStride,
+  T beta,
+        T* Y, Int YRowStride, Int YColStride )
+{
+    if( orientation == NORMAL )
+        MultiplyCSRNormal
+        ( m, numRHS, alpha, rowOffsets, colIndices, value,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+    else
+        MultiplyCSRAdjoint
+        ( orientation == ADJOINT, m, n, numRHS,
+          alpha, rowOffsets, colIndices, value,
+          X, XRowStride, XColStride, beta, Y, YRowStride, YColStride );
+}
+
 /**
  * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
  */
@@ -29,31 +188,9 @@ void MultiplyCSR
         T*   y )
 {
     EL_DEBUG_CSE
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
-            }
-	}
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, CSRPattern<T>(),
+      x, 1, 1, beta, y, 1, 1 );
 }
 
 template<typename T,typename=DisableIf<IsBlasScalar<T>>>
@@ -69,44 +206,9 @@ void MultiplyCSR
         T*   y )
 {
     EL_DEBUG_CSE
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, CSRValues<T>{values},
+      x, 1, 1, beta, y, 1, 1 );
 }
 
 template<typename T,typename=EnableIf<IsBlasScalar<T>>,typename=void>
@@ -130,44 +232,9 @@ void MultiplyCSR
     ( orientation, m, n, alpha, matDescrA,
       values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
 #else
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];
-            }
-        }
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, CSRValues<T>{values},
+      x, 1, 1, beta, y, 1, 1 );
 #endif
 }
 
@@ -191,57 +258,10 @@ void MultiplyCSR
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];
-                }
-            }
-        }
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, CSRValues<T>{values},
+      X, 1, ldX, beta, Y, 1, ldY );
 }
 
 template<typename T>
@@ -256,49 +276,13 @@ void MultiplyCSR
         T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        for( Int k=0; k<numRHS; ++k )
-	{
-            for( Int j=0; j<n; ++j )
-	    {
-                Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
-            }
-        }
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, CSRPattern<T>(),
+      X, 1, ldX, beta, Y, 1, ldY );
 }
 
+// X is stored with its rows interleaved, i.e., X(i,k) = X[i*numRHS+k]
 template<typename T>
 void MultiplyCSRInterX
 ( Orientation orientation,
@@ -319,59 +303,13 @@ void MultiplyCSRInterX
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, CSRValues<T>{values},
+      X, numRHS, 1, beta, Y, 1, ldY );
 }
 
+// Y is stored with its rows interleaved, i.e., Y(i,k) = Y[i*numRHS+k]
 template<typename T>
 void MultiplyCSRInterY
 ( Orientation orientation,
@@ -392,130 +330,10 @@ void MultiplyCSRInterY
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];
-                }
-            }
-        }
-    }
-}
-
-template<typename T>
-void MultiplyCSRInter
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
-  T alpha,
-  const Int* rowOffsets,
-  const Int* colIndices,
-  const T*   values,
-  const T*   X,
-  T beta,
-        T*   Y )
-{
-    EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-    }
+    MultiplyCSRGeneric
+    ( orientation, m, n, numRHS,
+      alpha, rowOffsets, colIndices, CSRValues<T>{values},
+      X, 1, ldX, beta, Y, numRHS, 1 );
 }
 
 } // anonymous namespace
@@ -577,18 +395,12 @@ void Multiply
           !mpi::Congruent( X.Grid().Comm(), Y.Grid().Comm() ) )
           LogicError("Communicators did not match");
     )
-
-    const bool time = false;
+    EL_PROFILE_REGION("Multiply [DistSparseMatrix]")
 
     const Grid& grid = A.Grid();
     const int commSize = grid.Size();
-    const int commRank = grid.Rank();
     // TODO(poulson): Use sequential implementation if commSize = 1?
 
-    Timer totalTimer, timer;
-    if( time && commRank == 0 )
-        totalTimer.Start();
-
     // Y := beta Y
     Y *= beta;
 
@@ -637,8 +449,7 @@ void Multiply
           recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
 
         // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
+        EL_PROFILE_REGION("MultiplyCSRInterX")
         MultiplyCSRInterX
         ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
           alpha, A.LockedOffsetBuffer(),
@@ -646,8 +457,7 @@ void Multiply
                  A.LockedValueBuffer(),
                  recvVals.data(),
           T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+        AddProfileFlops( 2.*A.NumLocalEntries()*b );
     }
     else
     {
@@ -657,18 +467,18 @@ void Multiply
             LogicError("The height of A must match the height of X");
 
         // Form and pack the updates to Y
-        if( time && commRank == 0 )
-            timer.Start();
         vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
+        {
+            EL_PROFILE_REGION("MultiplyCSRInterY")
+            MultiplyCSRInterY
+            ( orientation, A.LocalHeight(), meta.numRecvInds, b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(),
+                     A.LockedValueBuffer(),
+                     X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
+              T(1),  sendVals.data() );
+            AddProfileFlops( 2.*A.NumLocalEntries()*b );
+        }
 
         // Inject the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
@@ -690,8 +500,287 @@ void Multiply
                 YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
         }
     }
-    if( time && commRank == 0 )
-        Output("Multiply total time: ",totalTimer.Stop());
+}
+
+template<typename T>
+DistSparseMultPlan<T>::DistSparseMultPlan
+( const DistSparseMatrix<T>& A, Int width )
+{ Initialize( A, width ); }
+
+template<typename T>
+void DistSparseMultPlan<T>::Initialize
+( const DistSparseMatrix<T>& A, Int width )
+{
+    EL_DEBUG_CSE
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const int commSize = A.Grid().Size();
+    const int commRank = A.Grid().Rank();
+
+    A_ = &A;
+    width_ = width;
+    numLocalEdges_ = A.NumLocalEntries();
+    metaVersion_ = meta.version;
+
+    haloProcs_.clear();
+    haloOffs_.clear();
+    haloSizes_.clear();
+    boundaryProcs_.clear();
+    boundaryOffs_.clear();
+    boundarySizes_.clear();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( meta.recvSizes[q] > 0 )
+        {
+            haloProcs_.push_back( q );
+            haloOffs_.push_back( meta.recvOffs[q] );
+            haloSizes_.push_back( meta.recvSizes[q] );
+        }
+        if( meta.sendSizes[q] > 0 )
+        {
+            boundaryProcs_.push_back( q );
+            boundaryOffs_.push_back( meta.sendOffs[q] );
+            boundarySizes_.push_back( meta.sendSizes[q] );
+        }
+    }
+    boundaryInds_ = meta.sendInds;
+
+    // Split the edges of each row based upon whether their column is local
+    const Int ownHaloBeg = meta.recvOffs[commRank];
+    const Int ownHaloEnd = ownHaloBeg + meta.recvSizes[commRank];
+    const Int localHeight = A.LocalHeight();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    localRowOffs_.resize( localHeight+1 );
+    remoteRowOffs_.resize( localHeight+1 );
+    localEdges_.clear();
+    remoteEdges_.clear();
+    remoteHaloOffs_.clear();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        localRowOffs_[iLoc] = localEdges_.size();
+        remoteRowOffs_[iLoc] = remoteEdges_.size();
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            const Int haloOff = meta.colOffs[e];
+            if( haloOff >= ownHaloBeg && haloOff < ownHaloEnd )
+            {
+                localEdges_.push_back( e );
+            }
+            else
+            {
+                remoteEdges_.push_back( e );
+                remoteHaloOffs_.push_back( haloOff );
+            }
+        }
+    }
+    localRowOffs_[localHeight] = localEdges_.size();
+    remoteRowOffs_[localHeight] = remoteEdges_.size();
+
+    haloVals_.resize( meta.numRecvInds*width );
+    boundaryVals_.resize( boundaryInds_.size()*width );
+    haloRequests_.resize( haloProcs_.size() );
+    boundaryRequests_.resize( boundaryProcs_.size() );
+}
+
+template<typename T>
+bool DistSparseMultPlan<T>::Matches
+( const DistSparseMatrix<T>& A, Int width ) const
+{
+    const auto& meta = A.LockedDistGraph().multMeta;
+    return A_ == &A && width_ == width &&
+           numLocalEdges_ == A.NumLocalEntries() &&
+           meta.ready && meta.version == metaVersion_;
+}
+
+template<typename T>
+void DistSparseMultPlan<T>::Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( X.Width() != Y.Width() )
+          LogicError("X and Y must have the same width");
+      if( X.Width() != width_ )
+          LogicError("The plan was built for a different width");
+      if( !mpi::Congruent( A.Grid().Comm(), X.Grid().Comm() ) ||
+          !mpi::Congruent( X.Grid().Comm(), Y.Grid().Comm() ) )
+          LogicError("Communicators did not match");
+    )
+    mpi::Comm comm = A.Grid().Comm();
+    const Int b = width_;
+    const Int localHeight = A.LocalHeight();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    const T* XBuf = X.LockedMatrix().LockedBuffer();
+    const Int ldX = X.LockedMatrix().LDim();
+    T* YBuf = Y.Matrix().Buffer();
+    const Int ldY = Y.Matrix().LDim();
+    const Int numHaloProcs = haloProcs_.size();
+    const Int numBoundaryProcs = boundaryProcs_.size();
+
+    // Y := beta Y
+    Y *= beta;
+
+    if( orientation == NORMAL )
+    {
+        if( A.Height() != Y.Height() )
+            LogicError("A and Y must have the same height");
+        if( A.Width() != X.Height() )
+            LogicError("The width of A must match the height of X");
+        const Int firstLocalRowX = X.FirstLocalRow();
+
+        // Post the receives for the halo entries of X
+        for( Int k=0; k<numHaloProcs; ++k )
+            mpi::IRecv
+            ( &haloVals_[haloOffs_[k]*b], haloSizes_[k]*b, haloProcs_[k], comm,
+              haloRequests_[k] );
+
+        // Pack and send our boundary entries of X
+        for( Int k=0; k<numBoundaryProcs; ++k )
+        {
+            const Int sBeg = boundaryOffs_[k];
+            const Int sEnd = sBeg + boundarySizes_[k];
+            for( Int s=sBeg; s<sEnd; ++s )
+            {
+                const Int iLoc = boundaryInds_[s] - firstLocalRowX;
+                for( Int t=0; t<b; ++t )
+                    boundaryVals_[s*b+t] = XBuf[iLoc+t*ldX];
+            }
+            mpi::ISend
+            ( &boundaryVals_[sBeg*b], boundarySizes_[k]*b, boundaryProcs_[k],
+              comm, boundaryRequests_[k] );
+        }
+
+        // Overlap the communication with the purely local multiply
+        EL_PARALLEL_FOR
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int idxBeg = localRowOffs_[iLoc];
+            const Int idxEnd = localRowOffs_[iLoc+1];
+            for( Int t=0; t<b; ++t )
+            {
+                T sum = 0;
+                for( Int idx=idxBeg; idx<idxEnd; ++idx )
+                {
+                    const Int e = localEdges_[idx];
+                    const Int jLoc = targetBuf[e] - firstLocalRowX;
+                    sum += valueBuf[e]*XBuf[jLoc+t*ldX];
+                }
+                YBuf[iLoc+t*ldY] += alpha*sum;
+            }
+        }
+
+        // Finish with the contributions from the halo
+        mpi::WaitAll( numHaloProcs, haloRequests_.data() );
+        EL_PARALLEL_FOR
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int idxBeg = remoteRowOffs_[iLoc];
+            const Int idxEnd = remoteRowOffs_[iLoc+1];
+            for( Int t=0; t<b; ++t )
+            {
+                T sum = 0;
+                for( Int idx=idxBeg; idx<idxEnd; ++idx )
+                {
+                    const Int e = remoteEdges_[idx];
+                    sum += valueBuf[e]*haloVals_[remoteHaloOffs_[idx]*b+t];
+                }
+                YBuf[iLoc+t*ldY] += alpha*sum;
+            }
+        }
+        mpi::WaitAll( numBoundaryProcs, boundaryRequests_.data() );
+    }
+    else
+    {
+        if( A.Width() != Y.Height() )
+            LogicError("The width of A must match the height of Y");
+        if( A.Height() != X.Height() )
+            LogicError("The height of A must match the height of X");
+        const bool conjugate = ( orientation == ADJOINT );
+        const Int firstLocalRowY = Y.FirstLocalRow();
+
+        // Post the receives for the updates to our boundary rows of Y
+        for( Int k=0; k<numBoundaryProcs; ++k )
+            mpi::IRecv
+            ( &boundaryVals_[boundaryOffs_[k]*b], boundarySizes_[k]*b,
+              boundaryProcs_[k], comm, boundaryRequests_[k] );
+
+        // Form and send the updates to the halo rows of Y
+        for( T& value : haloVals_ )
+            value = 0;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int idxBeg = remoteRowOffs_[iLoc];
+            const Int idxEnd = remoteRowOffs_[iLoc+1];
+            for( Int idx=idxBeg; idx<idxEnd; ++idx )
+            {
+                const Int e = remoteEdges_[idx];
+                const T coef =
+                  alpha*( conjugate ? Conj(valueBuf[e]) : valueBuf[e] );
+                T* haloRow = &haloVals_[remoteHaloOffs_[idx]*b];
+                for( Int t=0; t<b; ++t )
+                    haloRow[t] += coef*XBuf[iLoc+t*ldX];
+            }
+        }
+        for( Int k=0; k<numHaloProcs; ++k )
+            mpi::ISend
+            ( &haloVals_[haloOffs_[k]*b], haloSizes_[k]*b, haloProcs_[k], comm,
+              haloRequests_[k] );
+
+        // Overlap the communication with the purely local updates
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int idxBeg = localRowOffs_[iLoc];
+            const Int idxEnd = localRowOffs_[iLoc+1];
+            for( Int idx=idxBeg; idx<idxEnd; ++idx )
+            {
+                const Int e = localEdges_[idx];
+                const Int jLoc = targetBuf[e] - firstLocalRowY;
+                const T coef =
+                  alpha*( conjugate ? Conj(valueBuf[e]) : valueBuf[e] );
+                for( Int t=0; t<b; ++t )
+                    YBuf[jLoc+t*ldY] += coef*XBuf[iLoc+t*ldX];
+            }
+        }
+
+        // Accumulate the received updates onto Y
+        mpi::WaitAll( numBoundaryProcs, boundaryRequests_.data() );
+        for( Int k=0; k<numBoundaryProcs; ++k )
+        {
+            const Int sBeg = boundaryOffs_[k];
+            const Int sEnd = sBeg + boundarySizes_[k];
+            for( Int s=sBeg; s<sEnd; ++s )
+            {
+                const Int iLoc = boundaryInds_[s] - firstLocalRowY;
+                for( Int t=0; t<b; ++t )
+                    YBuf[iLoc+t*ldY] += boundaryVals_[s*b+t];
+            }
+        }
+        mpi::WaitAll( numHaloProcs, haloRequests_.data() );
+    }
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+        T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y,
+        DistSparseMultPlan<T>& plan )
+{
+    EL_DEBUG_CSE
+    if( !plan.Matches( A, X.Width() ) )
+        plan.Initialize( A, X.Width() );
+    plan.Multiply( orientation, alpha, A, X, beta, Y );
 }
 
 #define PROTO(T) \
@@ -715,7 +804,16 @@ void Multiply
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistMultiVec<T>& X, \
+            T beta, \
+            DistMultiVec<T>& Y, \
+            DistSparseMultPlan<T>& plan ); \
+    template class DistSparseMultPlan<T>;
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
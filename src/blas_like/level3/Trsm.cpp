@@ -76,6 +76,7 @@ void Trsm
   bool checkIfSingular, TrsmAlgorithm alg )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Trsm")
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
@@ -24,7 +24,8 @@ void LLNLarge
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -79,7 +80,8 @@ void LLNMedium
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -137,7 +139,8 @@ void LLNSmall
           LogicError("L and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",X.Grid().Height(),X.Grid().Width());
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
@@ -31,7 +31,8 @@ void LLTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -94,7 +95,8 @@ void LLTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -164,7 +166,8 @@ void LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",X.Grid().Height(),X.Grid().Width());
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
@@ -217,7 +220,8 @@ void LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",X.Grid().Height(),X.Grid().Width());
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
@@ -23,7 +23,8 @@ void LUNLarge
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -78,7 +79,8 @@ void LUNMedium
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -141,7 +143,8 @@ void LUNSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",X.Grid().Height(),X.Grid().Width());
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
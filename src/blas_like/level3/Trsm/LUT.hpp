@@ -31,7 +31,8 @@ void LUTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -93,7 +94,8 @@ void LUTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -162,7 +164,8 @@ void LUTSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",X.Grid().Height(),X.Grid().Width());
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
@@ -25,7 +25,8 @@ void RLN
 {
     EL_DEBUG_CSE
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize =
+      Blocksize<F>("Trsm",XPre.Grid().Height(),XPre.Grid().Width());
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
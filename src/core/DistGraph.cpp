@@ -21,6 +21,13 @@
 */
 #include <El-lite.hpp>
 
+namespace {
+
+// The version assigned to the most recently initialized multiply metadata
+El::Int lastMultMetaVersion = 0;
+
+} // anonymous namespace
+
 namespace El {
 
 // Constructors and destructors
@@ -735,6 +742,7 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       comm );
 
     meta.numRecvInds = numRecvInds;
+    meta.version = ++::lastMultMetaVersion;
     meta.ready = true;
 
     return meta;
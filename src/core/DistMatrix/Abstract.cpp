@@ -570,6 +570,25 @@ EL_NO_RELEASE_EXCEPT
     //       different results after ProcessQueues()
     if( RedundantSize() == 1 && IsLocal(entry.i,entry.j) )
         UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    else if( streamingUpdates_ )
+    {
+        // Processes outside of a stream over the VC communicator have no
+        // buckets
+        if( streamBuckets_.empty() )
+            return;
+        const int owner = StreamOwner( entry.i, entry.j );
+        streamBuckets_[owner].push_back( entry );
+        ++numStreamBuffered_;
+        if( Int(streamBuckets_[owner].size()) >= streamCtrl_.chunkSize )
+            SendStreamBucket( owner );
+        if( numStreamBuffered_ >= streamCtrl_.maxBuffered )
+        {
+            const int commSize = streamBuckets_.size();
+            for( int q=0; q<commSize; ++q )
+                if( !streamBuckets_[q].empty() )
+                    SendStreamBucket( q );
+        }
+    }
     else
         remoteUpdates.push_back( entry );
 }
@@ -583,6 +602,11 @@ template<typename T>
 void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
 {
     EL_DEBUG_CSE
+    if( streamingUpdates_ )
+    {
+        FinishStreamingUpdates();
+        return;
+    }
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
@@ -650,6 +674,47 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
         UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
 }
 
+template<typename T>
+void AbstractDistMatrix<T>::BeginStreamingUpdates
+( const RemoteUpdateCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( streamingUpdates_ )
+        LogicError("The updates of this matrix are already being streamed");
+    if( ctrl.chunkSize < 1 )
+        LogicError("The chunk size must be positive");
+    streamCtrl_ = ctrl;
+    streamingUpdates_ = true;
+    if( !ctrl.includeViewers && !Participating() )
+    {
+        // Still enter the stream so that ProcessQueues does not fall back to
+        // a batched exchange which the participating processes never join
+        SwapClear( remoteUpdates );
+        return;
+    }
+
+    // Queued updates from before the stream are sent along with it
+    vector<Entry<T>> queuedUpdates;
+    queuedUpdates.swap( remoteUpdates );
+
+    const auto& grid = Grid();
+    mpi::Dup
+    ( ctrl.includeViewers ? grid.ViewingComm() : grid.VCComm(),
+      streamComm_ );
+    const int commSize = mpi::Size( streamComm_ );
+    streamBuckets_.resize( commSize );
+    numStreamSends_.assign( commSize, 0 );
+    numStreamBuffered_ = 0;
+    numStreamReceived_ = 0;
+
+    for( const auto& entry : queuedUpdates )
+        QueueUpdate( entry );
+}
+
+template<typename T>
+bool AbstractDistMatrix<T>::StreamingUpdates() const EL_NO_EXCEPT
+{ return streamingUpdates_; }
+
 template<typename T>
 void AbstractDistMatrix<T>::ReservePulls( Int numPulls ) const
 {
@@ -958,6 +1023,164 @@ AbstractDistMatrix<T>::AssertSameSize( Int height, Int width ) const
 // Private section
 // ###############
 
+// Streaming remote updates
+// ========================
+
+namespace {
+
+// Distinguishes the chunks of streamed updates from any other traffic on the
+// duplicated communicator
+const int streamTag = 31;
+
+} // anonymous namespace
+
+template<typename T>
+int AbstractDistMatrix<T>::StreamOwner( Int i, Int j ) const
+{
+    // We will first push to redundant rank 0
+    const int redundantRoot = 0;
+    const auto& grid = Grid();
+    const int distOwner = Owner(i,j);
+    const int vcOwner =
+      grid.CoordsToVC(ColDist(),RowDist(),distOwner,redundantRoot);
+    return ( streamCtrl_.includeViewers ? grid.VCToViewing(vcOwner) : vcOwner );
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::SendStreamBucket( int owner )
+{
+    EL_DEBUG_CSE
+    auto& bucket = streamBuckets_[owner];
+    numStreamBuffered_ -= bucket.size();
+    if( streamCtrl_.combineDuplicates )
+    {
+        auto compareEntries =
+          []( const Entry<T>& a, const Entry<T>& b )
+          { return a.i < b.i || (a.i == b.i && a.j < b.j); };
+        std::sort( bucket.begin(), bucket.end(), compareEntries );
+        const Int bucketSize = bucket.size();
+        Int lastUnique = 0;
+        for( Int k=1; k<bucketSize; ++k )
+        {
+            if( bucket[k].i != bucket[lastUnique].i ||
+                bucket[k].j != bucket[lastUnique].j )
+                bucket[++lastUnique] = bucket[k];
+            else
+                bucket[lastUnique].value += bucket[k].value;
+        }
+        bucket.resize( lastUnique+1 );
+    }
+
+    // Packed entries are sent directly from the chunk, so it is moved out of
+    // the bucket and kept alive until its request completes
+    streamSendBufs_.emplace_back();
+    streamSendBufs_.back().swap( bucket );
+    const auto& chunk = streamSendBufs_.back();
+    streamRequests_.emplace_back();
+    mpi::TaggedISend
+    ( chunk.data(), chunk.size(), owner, streamTag, streamComm_,
+      streamRequests_.back() );
+    ++numStreamSends_[owner];
+
+    // Release the completed sends and drain any chunks that have arrived.
+    // NOTE: A vector which is move-assigned to itself is left empty, which
+    //       would free the chunk of a pending send.
+    Int numSendsLeft = 0;
+    const Int numRequests = streamRequests_.size();
+    for( Int k=0; k<numRequests; ++k )
+    {
+        if( !mpi::Test( streamRequests_[k] ) )
+        {
+            if( numSendsLeft != k )
+            {
+                streamRequests_[numSendsLeft] = std::move(streamRequests_[k]);
+                streamSendBufs_[numSendsLeft] = std::move(streamSendBufs_[k]);
+            }
+            ++numSendsLeft;
+        }
+    }
+    streamRequests_.resize( numSendsLeft );
+    streamSendBufs_.resize( numSendsLeft );
+    ReceiveStreamUpdates();
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::ReceiveStreamUpdates()
+{
+    EL_DEBUG_CSE
+    mpi::Status status;
+    vector<Entry<T>> chunk;
+    while( mpi::IProbe( mpi::ANY_SOURCE, streamTag, streamComm_, status ) )
+    {
+        const int count = mpi::GetCount<Entry<T>>( status );
+        chunk.resize( count );
+        mpi::TaggedRecv
+        ( chunk.data(), count, status.MPI_SOURCE, streamTag, streamComm_ );
+        if( RedundantSize() == 1 )
+        {
+            for( const auto& entry : chunk )
+                UpdateLocal
+                ( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+        }
+        else
+            streamReceived_.insert
+            ( streamReceived_.end(), chunk.begin(), chunk.end() );
+        ++numStreamReceived_;
+    }
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::FinishStreamingUpdates()
+{
+    EL_DEBUG_CSE
+    if( !streamCtrl_.includeViewers && !Participating() )
+    {
+        streamingUpdates_ = false;
+        return;
+    }
+    const int commSize = streamBuckets_.size();
+    for( int q=0; q<commSize; ++q )
+        if( !streamBuckets_[q].empty() )
+            SendStreamBucket( q );
+
+    // Each process learns how many chunks it must still receive
+    vector<int> numStreamRecvs( commSize );
+    mpi::AllToAll
+    ( numStreamSends_.data(), 1, numStreamRecvs.data(), 1, streamComm_ );
+    Int numExpected = 0;
+    for( int q=0; q<commSize; ++q )
+        numExpected += numStreamRecvs[q];
+
+    while( numStreamReceived_ < numExpected )
+        ReceiveStreamUpdates();
+    if( !streamRequests_.empty() )
+        mpi::WaitAll( streamRequests_.size(), streamRequests_.data() );
+
+    if( RedundantSize() > 1 )
+    {
+        // Redundant rank 0 received every update and now shares them
+        const int redundantRoot = 0;
+        Int recvBufSize = streamReceived_.size();
+        mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
+        streamReceived_.resize( recvBufSize );
+        mpi::Broadcast
+        ( streamReceived_.data(), recvBufSize, redundantRoot,
+          RedundantComm() );
+        for( const auto& entry : streamReceived_ )
+            UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+    }
+
+    mpi::Free( streamComm_ );
+    SwapClear( streamBuckets_ );
+    SwapClear( numStreamSends_ );
+    SwapClear( streamRequests_ );
+    SwapClear( streamSendBufs_ );
+    SwapClear( streamReceived_ );
+    numStreamBuffered_ = 0;
+    numStreamReceived_ = 0;
+    streamingUpdates_ = false;
+}
+
 // Exchange metadata with another matrix
 // =====================================
 
@@ -0,0 +1,282 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <mutex>
+
+#ifdef _WIN32
+# include <malloc.h>
+#else
+# include <sys/mman.h>
+#endif
+
+namespace El {
+
+namespace {
+
+const size_t poolAlignment = 64;
+const size_t hugePageSize = size_t(1) << 21;
+
+// Size classes are the multiples of 64 bytes up to 256, followed by the four
+// classes 2^p (1+q/4), q=1,...,4, between each pair of consecutive powers of
+// two, so that at most 25% of any block is wasted.
+const Int numSizeClasses = 4 + 4*(8*sizeof(size_t)-8);
+
+// Blocks of up to this size are cached by each thread without locking
+const size_t maxThreadCachedBlockSize = size_t(1) << 18;
+const Int maxThreadCachedBlocksPerClass = 8;
+
+bool usePool = true;
+bool useHugePages = false;
+size_t sharedCacheLimit = std::numeric_limits<size_t>::max();
+
+std::atomic<size_t> numBytesInUse(0);
+std::atomic<size_t> highWaterMark(0);
+std::atomic<size_t> numBytesCached(0);
+std::atomic<Unsigned> numAllocations(0);
+std::atomic<Unsigned> numCacheHits(0);
+
+std::mutex sharedCacheMutex;
+
+vector<void*>& SharedCache( Int sizeClass )
+{
+    // Intentionally leaked so that Memory objects with static storage duration
+    // may still be safely destroyed at exit
+    static vector<vector<void*>>* cache =
+      new vector<vector<void*>>(numSizeClasses);
+    return (*cache)[sizeClass];
+}
+
+size_t SizeClass( size_t numBytes, Int& sizeClass )
+{
+    if( numBytes <= 256 )
+    {
+        sizeClass = ( numBytes <= poolAlignment ? 0 :
+                      Int((numBytes-1)/poolAlignment) );
+        return (sizeClass+1)*poolAlignment;
+    }
+    // Find p such that 2^p < numBytes <= 2^(p+1)
+    Int p = 8;
+    while( (numBytes-1) >> (p+1) )
+        ++p;
+    const size_t step = size_t(1) << (p-2);
+    const size_t numSteps = (numBytes+step-1) / step;
+    sizeClass = 4 + 4*(p-8) + Int(numSteps-5);
+    return numSteps*step;
+}
+
+void* SystemAllocate( size_t blockSize )
+{
+    const bool huge = useHugePages && blockSize >= hugePageSize;
+    const size_t alignment = ( huge ? hugePageSize : poolAlignment );
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc( blockSize, alignment );
+#else
+    if( posix_memalign( &ptr, alignment, blockSize ) != 0 )
+        ptr = nullptr;
+#endif
+    if( ptr == nullptr )
+        throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+    if( huge )
+        madvise( ptr, blockSize, MADV_HUGEPAGE );
+#endif
+    return ptr;
+}
+
+void SystemFree( void* ptr )
+{
+#ifdef _WIN32
+    _aligned_free( ptr );
+#else
+    free( ptr );
+#endif
+}
+
+void ReleaseBlocks( vector<void*>& blocks, size_t blockSize )
+{
+    for( void* ptr : blocks )
+        SystemFree( ptr );
+    numBytesCached -= blocks.size()*blockSize;
+    blocks.clear();
+}
+
+// Memory objects with static or thread storage duration can be destroyed
+// after the cache of their thread, in which case we fall back to the shared
+// cache
+thread_local bool threadCacheDestroyed = false;
+
+struct ThreadCache
+{
+    vector<vector<void*>> blocks;
+
+    ThreadCache() : blocks(numSizeClasses) { }
+
+    // Hand the cached blocks back to the shared cache upon thread exit
+    ~ThreadCache()
+    {
+        std::lock_guard<std::mutex> guard(sharedCacheMutex);
+        for( Int sizeClass=0; sizeClass<numSizeClasses; ++sizeClass )
+        {
+            auto& shared = SharedCache(sizeClass);
+            shared.insert
+            ( shared.end(), blocks[sizeClass].begin(), blocks[sizeClass].end() );
+        }
+        threadCacheDestroyed = true;
+    }
+};
+
+ThreadCache* LocalCache()
+{
+    if( threadCacheDestroyed )
+        return nullptr;
+    static thread_local ThreadCache cache;
+    return &cache;
+}
+
+void UpdateHighWaterMark( size_t inUse )
+{
+    size_t oldMark = highWaterMark.load();
+    while( inUse > oldMark &&
+           !highWaterMark.compare_exchange_weak( oldMark, inUse ) ) { }
+}
+
+} // anonymous namespace
+
+void* PoolAllocate( size_t numBytes )
+{
+    Int sizeClass;
+    const size_t blockSize =
+      SizeClass( std::max(numBytes,size_t(1)), sizeClass );
+    ++numAllocations;
+
+    void* ptr = nullptr;
+    if( usePool )
+    {
+        ThreadCache* localCache = LocalCache();
+        if( localCache != nullptr && blockSize <= maxThreadCachedBlockSize )
+        {
+            auto& local = localCache->blocks[sizeClass];
+            if( !local.empty() )
+            {
+                ptr = local.back();
+                local.pop_back();
+            }
+        }
+        if( ptr == nullptr )
+        {
+            std::lock_guard<std::mutex> guard(sharedCacheMutex);
+            auto& shared = SharedCache(sizeClass);
+            if( !shared.empty() )
+            {
+                ptr = shared.back();
+                shared.pop_back();
+            }
+        }
+        if( ptr != nullptr )
+        {
+            numBytesCached -= blockSize;
+            ++numCacheHits;
+        }
+    }
+    if( ptr == nullptr )
+        ptr = SystemAllocate( blockSize );
+
+    UpdateHighWaterMark( numBytesInUse += blockSize );
+    return ptr;
+}
+
+void PoolFree( void* ptr, size_t numBytes )
+{
+    if( ptr == nullptr )
+        return;
+    Int sizeClass;
+    const size_t blockSize =
+      SizeClass( std::max(numBytes,size_t(1)), sizeClass );
+    numBytesInUse -= blockSize;
+
+    if( !usePool )
+    {
+        SystemFree( ptr );
+        return;
+    }
+    ThreadCache* localCache = LocalCache();
+    if( localCache != nullptr && blockSize <= maxThreadCachedBlockSize )
+    {
+        auto& local = localCache->blocks[sizeClass];
+        if( Int(local.size()) < maxThreadCachedBlocksPerClass )
+        {
+            local.push_back( ptr );
+            numBytesCached += blockSize;
+            return;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> guard(sharedCacheMutex);
+        if( numBytesCached.load() + blockSize <= sharedCacheLimit )
+        {
+            SharedCache(sizeClass).push_back( ptr );
+            numBytesCached += blockSize;
+            return;
+        }
+    }
+    SystemFree( ptr );
+}
+
+void SetUseMemoryPool( bool usePoolNew )
+{
+    if( !usePoolNew )
+        EmptyMemoryPool();
+    usePool = usePoolNew;
+}
+bool UsingMemoryPool() { return usePool; }
+
+void SetMemoryPoolHugePages( bool useHugePagesNew )
+{ useHugePages = useHugePagesNew; }
+bool UsingMemoryPoolHugePages() { return useHugePages; }
+
+void SetMemoryPoolCacheLimit( size_t numBytes )
+{ sharedCacheLimit = numBytes; }
+size_t MemoryPoolCacheLimit() { return sharedCacheLimit; }
+
+MemoryPoolStats GetMemoryPoolStats()
+{
+    MemoryPoolStats stats;
+    stats.numBytesInUse = numBytesInUse.load();
+    stats.highWaterMark = highWaterMark.load();
+    stats.numBytesCached = numBytesCached.load();
+    stats.numAllocations = numAllocations.load();
+    stats.numCacheHits = numCacheHits.load();
+    return stats;
+}
+
+void ResetMemoryPoolHighWaterMark()
+{ highWaterMark = numBytesInUse.load(); }
+
+void EmptyMemoryPool()
+{
+    ThreadCache* localCache = LocalCache();
+    std::lock_guard<std::mutex> guard(sharedCacheMutex);
+    for( Int sizeClass=0; sizeClass<numSizeClasses; ++sizeClass )
+    {
+        // Invert SizeClass to recover the block size of this class
+        size_t blockSize;
+        if( sizeClass < 4 )
+            blockSize = (sizeClass+1)*poolAlignment;
+        else
+            blockSize = (size_t(1) << ((sizeClass-4)/4+6))*(5+(sizeClass-4)%4);
+        if( localCache != nullptr )
+            ReleaseBlocks( localCache->blocks[sizeClass], blockSize );
+        ReleaseBlocks( SharedCache(sizeClass), blockSize );
+    }
+}
+
+} // namespace El
@@ -0,0 +1,475 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+namespace {
+
+using El::Int;
+using El::string;
+
+struct ProfileNode
+{
+    string name;
+    Int parent=-1;
+    // Timers are leaves whose time is not subtracted from their parent
+    bool isTimer=false;
+    std::map<string,Int> children;
+
+    Int calls=0;
+    double inclusiveTime=0, childTime=0, flops=0, bytes=0;
+};
+
+struct ProfileFrame
+{
+    Int node;
+    El::Clock::time_point start;
+};
+
+struct CommStats
+{
+    Int calls=0;
+    double bytes=0, time=0;
+};
+
+struct TraceEvent
+{
+    Int node;
+    double begin, duration;
+};
+
+bool profiling = false;
+// Set while the profile is being reported so that its own communication
+// is not recorded
+bool suspended = false;
+El::ProfileCtrl profileCtrl;
+
+El::Clock::time_point profileEpoch;
+std::vector<ProfileNode> profileNodes;
+std::vector<ProfileFrame> profileStack;
+std::map<std::pair<string,int>,CommStats> commStats;
+std::vector<TraceEvent> traceEvents;
+
+#ifdef EL_HYBRID
+// Flops reported by the other OpenMP threads are accumulated in per-thread
+// (cache-line padded) counters and attributed to the region which is active
+// on the master thread whenever that thread next pushes or pops a region or
+// reports the profile
+struct ThreadFlops
+{
+    double flops=0;
+    char padding[64-sizeof(double)];
+};
+std::vector<ThreadFlops> threadFlops;
+std::vector<double> attributedFlops;
+#endif
+
+inline bool OnMasterThread()
+{
+#ifdef EL_HYBRID
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+inline double Seconds( El::Clock::time_point begin, El::Clock::time_point end )
+{
+    return El::duration_cast<El::duration<double>>(end-begin).count();
+}
+
+void ResetProfile()
+{
+    profileNodes.clear();
+    profileStack.clear();
+    commStats.clear();
+    traceEvents.clear();
+
+    ProfileNode root;
+    root.name = "[root]";
+    profileNodes.push_back( root );
+    profileEpoch = El::Clock::now();
+    profileStack.push_back( ProfileFrame{0,profileEpoch} );
+#ifdef EL_HYBRID
+    const int numThreads = omp_get_max_threads();
+    threadFlops.assign( numThreads, ThreadFlops() );
+    attributedFlops.assign( numThreads, 0. );
+#endif
+}
+
+// Attribute the flops reported by the other threads since the last call to
+// the region which is currently active on the master thread
+void GatherThreadFlops()
+{
+#ifdef EL_HYBRID
+    double flops = 0;
+    for( size_t t=0; t<threadFlops.size(); ++t )
+    {
+        double total;
+        #pragma omp atomic read
+        total = threadFlops[t].flops;
+        flops += total - attributedFlops[t];
+        attributedFlops[t] = total;
+    }
+    profileNodes[profileStack.back().node].flops += flops;
+#endif
+}
+
+Int ChildNode( Int parent, const string& name, bool isTimer )
+{
+    auto it = profileNodes[parent].children.find( name );
+    if( it != profileNodes[parent].children.end() )
+        return it->second;
+
+    const Int node = profileNodes.size();
+    ProfileNode child;
+    child.name = name;
+    child.parent = parent;
+    child.isTimer = isTimer;
+    profileNodes.push_back( child );
+    profileNodes[parent].children[name] = node;
+    return node;
+}
+
+string NodePath( Int node )
+{
+    string path = profileNodes[node].name;
+    for( Int p=profileNodes[node].parent; p>0; p=profileNodes[p].parent )
+        path = profileNodes[p].name + "/" + path;
+    return path;
+}
+
+// Gather the concatenation of the strings of each process to the root
+std::vector<string> GatherStrings( const string& local, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    const int commRank = El::mpi::Rank( comm );
+    const int localSize = local.size();
+    std::vector<int> sizes( commSize ), offsets( commSize );
+    El::mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<El::byte> recvBuf( El::Max(totalSize,1) );
+    El::mpi::Gather
+    ( reinterpret_cast<const El::byte*>(local.data()), localSize,
+      recvBuf.data(), sizes.data(), offsets.data(), 0, comm );
+
+    std::vector<string> strings;
+    if( commRank == 0 )
+    {
+        strings.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+            strings[q].assign
+            ( reinterpret_cast<const char*>(&recvBuf[offsets[q]]), sizes[q] );
+    }
+    return strings;
+}
+
+struct MergedStats
+{
+    Int numProcs=0;
+    double calls=0, flops=0, bytes=0;
+    double minTime=0, sumTime=0, maxTime=0;
+    double sumExclusive=0;
+
+    void Add( double procCalls, double time, double exclusive,
+              double procFlops, double procBytes )
+    {
+        minTime = ( numProcs == 0 ? time : El::Min(minTime,time) );
+        maxTime = El::Max(maxTime,time);
+        sumTime += time;
+        sumExclusive += exclusive;
+        calls += procCalls;
+        flops += procFlops;
+        bytes += procBytes;
+        ++numProcs;
+    }
+};
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableProfiling( const ProfileCtrl& ctrl )
+{
+    ::profileCtrl = ctrl;
+    if( ::profileNodes.empty() )
+        ResetProfile();
+    ::profiling = true;
+}
+
+void DisableProfiling() { ::profiling = false; }
+
+bool Profiling() { return ::profiling && !::suspended; }
+
+bool ProfilingCallStack()
+{ return Profiling() && ::profileCtrl.profileCallStack; }
+
+const ProfileCtrl& GetProfileCtrl() { return ::profileCtrl; }
+
+void ClearProfile() { ResetProfile(); }
+
+void PushProfileRegion( const string& name )
+{
+    if( !Profiling() || !OnMasterThread() )
+        return;
+    GatherThreadFlops();
+    const Int node = ChildNode( ::profileStack.back().node, name, false );
+    ::profileStack.push_back( ProfileFrame{node,Clock::now()} );
+}
+
+void PopProfileRegion()
+{
+    // Regions which were opened before profiling was disabled are still
+    // closed so that the stack remains consistent
+    if( ::profileStack.size() <= 1 || !OnMasterThread() )
+        return;
+    GatherThreadFlops();
+    const auto frame = ::profileStack.back();
+    ::profileStack.pop_back();
+    const auto end = Clock::now();
+    const double time = Seconds( frame.start, end );
+
+    auto& node = ::profileNodes[frame.node];
+    ++node.calls;
+    node.inclusiveTime += time;
+    ::profileNodes[node.parent].childTime += time;
+
+    if( !::profileCtrl.traceFilename.empty() &&
+        Int(::traceEvents.size()) < ::profileCtrl.maxTraceEvents )
+        ::traceEvents.push_back
+        ( TraceEvent{frame.node,Seconds(::profileEpoch,frame.start),time} );
+}
+
+void AddProfileFlops( double flops )
+{
+    if( !Profiling() )
+        return;
+#ifdef EL_HYBRID
+    if( !OnMasterThread() )
+    {
+        // Threads beyond the initial maximum share counters
+        const int thread = omp_get_thread_num();
+        auto& counter = ::threadFlops[thread % ::threadFlops.size()];
+        #pragma omp atomic
+        counter.flops += flops;
+        return;
+    }
+#endif
+    ::profileNodes[::profileStack.back().node].flops += flops;
+}
+
+void AddProfileTime( const string& name, double seconds )
+{
+    if( !Profiling() || !OnMasterThread() )
+        return;
+    const Int node = ChildNode( ::profileStack.back().node, name, true );
+    ++::profileNodes[node].calls;
+    ::profileNodes[node].inclusiveTime += seconds;
+}
+
+void AddProfileComm
+( const char* op, mpi::Comm comm, double bytes, double seconds )
+{
+    if( !Profiling() || !OnMasterThread() )
+        return;
+    ::profileNodes[::profileStack.back().node].bytes += bytes;
+    auto& stats = ::commStats[std::make_pair(string(op),mpi::Size(comm))];
+    ++stats.calls;
+    stats.bytes += bytes;
+    stats.time += seconds;
+}
+
+ProfileComm::ProfileComm
+( const char* op, mpi::Comm comm, int count, MPI_Datatype type,
+  bool perProcess )
+: active_(Profiling()), op_(op), comm_(comm), bytes_(0)
+{
+    if( !active_ )
+        return;
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+    bytes_ = double(count)*typeSize;
+    if( perProcess )
+        bytes_ *= mpi::Size( comm );
+    start_ = Clock::now();
+}
+
+ProfileComm::ProfileComm
+( const char* op, mpi::Comm comm, const int* counts, MPI_Datatype type )
+: active_(Profiling()), op_(op), comm_(comm), bytes_(0)
+{
+    if( !active_ )
+        return;
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+    const int commSize = mpi::Size( comm );
+    double count = 0;
+    for( int q=0; q<commSize; ++q )
+        count += counts[q];
+    bytes_ = count*typeSize;
+    start_ = Clock::now();
+}
+
+ProfileComm::~ProfileComm()
+{
+    if( active_ )
+        AddProfileComm( op_, comm_, bytes_, Seconds(start_,Clock::now()) );
+}
+
+void ReportProfile( mpi::Comm comm, ostream& os )
+{
+    EL_DEBUG_CSE
+    if( ::profileNodes.empty() )
+        return;
+    GatherThreadFlops();
+    const bool wasSuspended = ::suspended;
+    ::suspended = true;
+
+    // Serialize the local statistics of each region and communication
+    // routine with one tab-separated line each
+    ostringstream local;
+    local.precision( 17 );
+    for( size_t node=1; node<::profileNodes.size(); ++node )
+    {
+        const auto& n = ::profileNodes[node];
+        const double exclusive =
+          ( n.isTimer ? n.inclusiveTime : n.inclusiveTime-n.childTime );
+        local << "R\t" << NodePath(node) << (n.isTimer ? " [timer]" : "")
+              << "\t" << n.calls << "\t" << n.inclusiveTime
+              << "\t" << exclusive << "\t" << n.flops << "\t" << n.bytes
+              << "\n";
+    }
+    for( const auto& entry : ::commStats )
+        local << "C\t" << entry.first.first << "[" << entry.first.second
+              << "]\t" << entry.second.calls << "\t" << entry.second.time
+              << "\t" << entry.second.time << "\t0\t" << entry.second.bytes
+              << "\n";
+    auto strings = GatherStrings( local.str(), comm );
+    ::suspended = wasSuspended;
+    if( mpi::Rank(comm) != 0 )
+        return;
+
+    // Merge the statistics while preserving the first-seen order, which
+    // visits parents before their children
+    std::vector<string> regionOrder, commOrder;
+    std::map<string,MergedStats> regionStats, mergedComm;
+    for( const auto& procString : strings )
+    {
+        std::istringstream is( procString );
+        string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream lineStream( line );
+            string kind, key, field;
+            std::getline( lineStream, kind, '\t' );
+            std::getline( lineStream, key, '\t' );
+            double values[5];
+            for( Int j=0; j<5; ++j )
+            {
+                std::getline( lineStream, field, '\t' );
+                values[j] = std::stod( field );
+            }
+            auto& order = ( kind == "R" ? regionOrder : commOrder );
+            auto& stats = ( kind == "R" ? regionStats : mergedComm );
+            if( !stats.count(key) )
+                order.push_back( key );
+            stats[key].Add
+            ( values[0], values[1], values[2], values[3], values[4] );
+        }
+    }
+
+    const int commSize = strings.size();
+    auto average = [&]( double value ) { return value / commSize; };
+    ostringstream msg;
+    msg << "Profile over " << commSize << " processes "
+        << "(times in seconds; imbalance is max/avg)\n";
+    msg << std::left << std::setw(48) << "region" << std::right
+        << std::setw(10) << "calls" << std::setw(11) << "min"
+        << std::setw(11) << "avg" << std::setw(11) << "max"
+        << std::setw(11) << "excl avg" << std::setw(8) << "imbal"
+        << std::setw(10) << "GFlop/s" << std::setw(11) << "MB avg" << "\n";
+    auto printRow = [&]( const string& label, const MergedStats& stats )
+    {
+        // Processes which never entered the region contribute zero time
+        const double minTime =
+          ( stats.numProcs < commSize ? 0. : stats.minTime );
+        const double avgTime = average(stats.sumTime);
+        msg << std::left << std::setw(48) << label << std::right
+            << std::setw(10) << Int(stats.calls/stats.numProcs)
+            << std::setw(11) << minTime
+            << std::setw(11) << avgTime
+            << std::setw(11) << stats.maxTime
+            << std::setw(11) << average(stats.sumExclusive)
+            << std::setw(8)
+            << ( avgTime > 0 ? stats.maxTime/avgTime : 1. )
+            << std::setw(10)
+            << ( stats.maxTime > 0 ? stats.flops/stats.maxTime/1.e9 : 0. )
+            << std::setw(11) << average(stats.bytes)/1.e6 << "\n";
+    };
+    msg.precision( 3 );
+    for( const auto& key : regionOrder )
+    {
+        // Indent by the depth of the region and only print its own name
+        const Int depth = std::count( key.begin(), key.end(), '/' );
+        const auto pos = key.rfind( '/' );
+        const string name = ( pos == string::npos ? key : key.substr(pos+1) );
+        printRow( string(2*depth,' ')+name, regionStats[key] );
+    }
+    if( !commOrder.empty() )
+    {
+        msg << "\nCommunication by routine[communicator size]\n";
+        for( const auto& key : commOrder )
+            printRow( key, mergedComm[key] );
+    }
+    os << msg.str();
+    os.flush();
+}
+
+void WriteProfileTrace( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const bool wasSuspended = ::suspended;
+    ::suspended = true;
+    const int commRank = mpi::Rank( comm );
+    ostringstream local;
+    local.precision( 12 );
+    for( const auto& event : ::traceEvents )
+    {
+        string name = NodePath( event.node );
+        for( auto& c : name )
+            if( c == '"' || c == '\\' )
+                c = '\'';
+        local << ",\n{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":"
+              << commRank << ",\"tid\":0,\"ts\":" << 1.e6*event.begin
+              << ",\"dur\":" << 1.e6*event.duration << "}";
+    }
+    auto strings = GatherStrings( local.str(), comm );
+    ::suspended = wasSuspended;
+    if( commRank != 0 )
+        return;
+
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\","
+         << "\"pid\":0,\"args\":{\"name\":\"rank 0\"}}";
+    for( const auto& procString : strings )
+        file << procString;
+    file << "\n]}\n";
+}
+
+} // namespace El
@@ -29,6 +29,8 @@ double Timer::Stop()
     lastPartialTime_ = Partial();
     running_ = false;
     totalTime_ += lastPartialTime_;
+    if( Profiling() && name_ != "[blank]" )
+        AddProfileTime( name_, lastPartialTime_ );
     return lastPartialTime_;
 }
 
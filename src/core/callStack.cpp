@@ -14,6 +14,8 @@ namespace {
 // Debugging
 EL_DEBUG_ONLY(
   std::stack<std::string> callStack;
+  // Whether each entry of the call stack also opened a profile region
+  std::stack<bool> profiledStack;
   bool tracingEnabled = false;
 )
 
@@ -49,6 +51,10 @@ EL_DEBUG_ONLY(
           return;
       }
       ::callStack.push(s); 
+      const bool profiled = ProfilingCallStack();
+      ::profiledStack.push(profiled);
+      if( profiled )
+          PushProfileRegion( s );
       if( ::tracingEnabled )
       {
           const int stackSize = ::callStack.size();
@@ -72,6 +78,9 @@ EL_DEBUG_ONLY(
       if( ::callStack.empty() )
           LogicError("Attempted to pop an empty call stack");
       ::callStack.pop(); 
+      if( ::profiledStack.top() )
+          PopProfileRegion();
+      ::profiledStack.pop();
   }
 
   void DumpCallStack( ostream& os )
@@ -83,6 +92,8 @@ EL_DEBUG_ONLY(
               << "\n";
           ::callStack.pop();
       }
+      while( ! ::profiledStack.empty() )
+          ::profiledStack.pop();
       os << msg.str();
       os.flush();
   }
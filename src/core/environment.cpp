@@ -182,6 +182,12 @@ void Initialize( int& argc, char**& argv )
     EmptyBlocksizeStack();
     PushBlocksizeStack( 128 );
 
+    // Load any tuned per-routine blocksizes
+    ClearTunedBlocksizes();
+    const char* blocksizeFile = std::getenv("EL_BLOCKSIZE_FILE");
+    if( blocksizeFile != nullptr )
+        LoadTunedBlocksizes( blocksizeFile );
+
     // Build the default grid
     Grid::InitializeDefault();
     Grid::InitializeTrivial();
@@ -211,6 +217,16 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        if( Profiling() && !mpi::Finalized() )
+        {
+            const auto& profileCtrl = GetProfileCtrl();
+            if( profileCtrl.reportAtFinalize )
+                ReportProfile();
+            if( !profileCtrl.traceFilename.empty() )
+                WriteProfileTrace( profileCtrl.traceFilename );
+            DisableProfiling();
+        }
+
         delete ::args;
         ::args = 0;
 
@@ -228,12 +244,16 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        ClearTunedBlocksizes();
 
 #ifdef EL_HAVE_QD
         FinalizeQD();
 #endif
 
         FinalizeRandom();
+
+        // Return any cached buffers to the system
+        EmptyMemoryPool();
     }
 
     EL_DEBUG_ONLY( CloseLog() )
@@ -32,6 +32,7 @@ using El::dcomplex;
 #include "./blas/Trsv.hpp"
 
 // Level 3
+#include "./blas/Blocked.hpp"
 #include "./blas/Gemm.hpp"
 #include "./blas/Symm.hpp"
 #include "./blas/Syrk.hpp"
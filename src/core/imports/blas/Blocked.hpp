@@ -0,0 +1,328 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Packed, cache-blocked Gemm for the scalar types which are not supported by
+// the external BLAS. Following the usual GotoBLAS/BLIS structure, a KC x NC
+// block of op(B) is packed into NR-wide micro-panels, an MC x KC block of
+// alpha op(A) is packed into MR-tall micro-panels, and each MR x NR tile of C
+// is then updated by a micro-kernel which streams through the two packed
+// micro-panels. The tiles of each packed block are distributed over the
+// OpenMP threads.
+
+namespace El {
+namespace blas {
+namespace blocked {
+
+// The dimension below which the triangular Level 3 routines switch to their
+// unblocked implementations
+const BlasInt TriangularLeafSize = 64;
+
+// The default micro-kernel simply accumulates each tile in the working
+// precision. Temporaries are avoided since constructing a BigInt/BigFloat
+// involves a memory allocation.
+template<typename T>
+struct GenericKernel
+{
+    typedef T Packed;
+    static const BlasInt MR=4, NR=4, KC=128, MC=64, NC=512;
+    // The number of packed entries used to store each scalar
+    static const BlasInt entrySize=1;
+
+    static void Store
+    ( Packed* panel, BlasInt width, BlasInt l, BlasInt i, const T& value )
+    { panel[i+l*width] = value; }
+
+    static void Apply
+    ( BlasInt kc, const Packed* APanel, const Packed* BPanel,
+      T* C, BlasInt CLDim, BlasInt mr, BlasInt nr )
+    {
+        T AB[MR*NR], delta;
+        for( BlasInt s=0; s<MR*NR; ++s )
+            AB[s] = 0;
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            const Packed* a = &APanel[l*MR];
+            const Packed* b = &BPanel[l*NR];
+            for( BlasInt j=0; j<NR; ++j )
+            {
+                for( BlasInt i=0; i<MR; ++i )
+                {
+                    delta = a[i];
+                    delta *= b[j];
+                    AB[i+j*MR] += delta;
+                }
+            }
+        }
+        for( BlasInt j=0; j<nr; ++j )
+            for( BlasInt i=0; i<mr; ++i )
+                C[i+j*CLDim] += AB[i+j*MR];
+    }
+};
+
+template<typename T>
+struct GemmKernel
+{ typedef GenericKernel<T> type; };
+
+#ifdef EL_HAVE_QD
+// Error-free transformations of double-precision arithmetic, which are
+// written so that the compiler can vectorize loops over them
+inline void QuickTwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    e = b - (s-a);
+}
+
+inline void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double bVirtual = s - a;
+    e = (a-(s-bVirtual)) + (b-bVirtual);
+}
+
+inline void TwoProd( double a, double b, double& p, double& e )
+{
+    p = a*b;
+#ifdef FP_FAST_FMA
+    e = std::fma( a, b, -p );
+#else
+    // Dekker's splitting (without the rescaling that QD performs for inputs
+    // larger than 2^996, which would prevent vectorization)
+    const double splitter = 134217729.; // 2^27+1
+    double t = splitter*a;
+    const double aHi = t - (t-a);
+    const double aLo = a - aHi;
+    t = splitter*b;
+    const double bHi = t - (t-b);
+    const double bLo = b - bHi;
+    e = ((aHi*bHi-p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+}
+
+// The micro-panels of double-double matrices are packed with the leading and
+// trailing components stored separately so that the micro-kernel can update
+// an entire column of a tile with SIMD instructions
+struct DoubleDoubleKernel
+{
+    typedef double Packed;
+    static const BlasInt MR=4, NR=4, KC=256, MC=96, NC=1024;
+    static const BlasInt entrySize=2;
+
+    static void Store
+    ( Packed* panel, BlasInt width, BlasInt l, BlasInt i,
+      const DoubleDouble& value )
+    {
+        panel[i+(2*l  )*width] = value.x[0];
+        panel[i+(2*l+1)*width] = value.x[1];
+    }
+
+    static void Apply
+    ( BlasInt kc, const Packed* APanel, const Packed* BPanel,
+      DoubleDouble* C, BlasInt CLDim, BlasInt mr, BlasInt nr )
+    {
+        double ABHi[MR*NR], ABLo[MR*NR];
+        for( BlasInt s=0; s<MR*NR; ++s )
+        {
+            ABHi[s] = 0;
+            ABLo[s] = 0;
+        }
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            const double* aHi = &APanel[2*l*MR];
+            const double* aLo = &aHi[MR];
+            const double* bHi = &BPanel[2*l*NR];
+            const double* bLo = &bHi[NR];
+            for( BlasInt j=0; j<NR; ++j )
+            {
+                double* abHi = &ABHi[j*MR];
+                double* abLo = &ABLo[j*MR];
+                EL_SIMD
+                for( BlasInt i=0; i<MR; ++i )
+                {
+                    // Form the double-double product a(i) b(j)
+                    double p, e;
+                    TwoProd( aHi[i], bHi[j], p, e );
+                    e += aHi[i]*bLo[j] + aLo[i]*bHi[j];
+                    QuickTwoSum( p, e, p, e );
+
+                    // Accurately add the product into the accumulator
+                    double s1, s2, t1, t2;
+                    TwoSum( abHi[i], p, s1, s2 );
+                    TwoSum( abLo[i], e, t1, t2 );
+                    s2 += t1;
+                    QuickTwoSum( s1, s2, s1, s2 );
+                    s2 += t2;
+                    QuickTwoSum( s1, s2, abHi[i], abLo[i] );
+                }
+            }
+        }
+        for( BlasInt j=0; j<nr; ++j )
+            for( BlasInt i=0; i<mr; ++i )
+                C[i+j*CLDim] += dd_real( ABHi[i+j*MR], ABLo[i+j*MR] );
+    }
+};
+
+template<>
+struct GemmKernel<DoubleDouble>
+{ typedef DoubleDoubleKernel type; };
+#endif // ifdef EL_HAVE_QD
+
+// Pack alpha op(A), where op(A) is mc x kc, into MR-tall micro-panels,
+// padding the last micro-panel with zeros
+template<class Kernel,typename T>
+void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  typename Kernel::Packed* packedA )
+{
+    const BlasInt MR = Kernel::MR;
+    const BlasInt panelSize = MR*kc*Kernel::entrySize;
+    const BlasInt numPanels = (mc+MR-1) / MR;
+    const bool normal = ( std::toupper(transA) == 'N' );
+    const bool conjugate = ( std::toupper(transA) == 'C' );
+    const bool scale = ( alpha != T(1) );
+    EL_PARALLEL_FOR
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        typename Kernel::Packed* panel = &packedA[p*panelSize];
+        const BlasInt iOff = p*MR;
+        const BlasInt mr = Min(MR,mc-iOff);
+        T value;
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+            {
+                const T& alpha_il =
+                  ( normal ? A[(iOff+i)+l*ALDim] : A[l+(iOff+i)*ALDim] );
+                if( conjugate )
+                    Conj( alpha_il, value );
+                else
+                    value = alpha_il;
+                if( scale )
+                    value *= alpha;
+                Kernel::Store( panel, MR, l, i, value );
+            }
+            value = 0;
+            for( BlasInt i=mr; i<MR; ++i )
+                Kernel::Store( panel, MR, l, i, value );
+        }
+    }
+}
+
+// Pack op(B), which is kc x nc, into NR-wide micro-panels, padding the last
+// micro-panel with zeros
+template<class Kernel,typename T>
+void PackB
+( char transB, BlasInt kc, BlasInt nc,
+  const T* B, BlasInt BLDim,
+  typename Kernel::Packed* packedB )
+{
+    const BlasInt NR = Kernel::NR;
+    const BlasInt panelSize = NR*kc*Kernel::entrySize;
+    const BlasInt numPanels = (nc+NR-1) / NR;
+    const bool normal = ( std::toupper(transB) == 'N' );
+    const bool conjugate = ( std::toupper(transB) == 'C' );
+    EL_PARALLEL_FOR
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        typename Kernel::Packed* panel = &packedB[p*panelSize];
+        const BlasInt jOff = p*NR;
+        const BlasInt nr = Min(NR,nc-jOff);
+        T value;
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                const T& beta_lj =
+                  ( normal ? B[l+(jOff+j)*BLDim] : B[(jOff+j)+l*BLDim] );
+                if( conjugate )
+                    Conj( beta_lj, value );
+                else
+                    value = beta_lj;
+                Kernel::Store( panel, NR, l, j, value );
+            }
+            value = 0;
+            for( BlasInt j=nr; j<NR; ++j )
+                Kernel::Store( panel, NR, l, j, value );
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    typedef typename GemmKernel<T>::type Kernel;
+    typedef typename Kernel::Packed Packed;
+    const BlasInt MR = Kernel::MR;
+    const BlasInt NR = Kernel::NR;
+    const BlasInt KC = Kernel::KC;
+    const BlasInt MC = Kernel::MC;
+    const BlasInt NC = Kernel::NC;
+    const BlasInt entrySize = Kernel::entrySize;
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt maxKC = Min(KC,k);
+    const BlasInt maxMC = Min(MC,m);
+    const BlasInt maxNC = Min(NC,n);
+    vector<Packed> packedA( ((maxMC+MR-1)/MR)*MR*maxKC*entrySize ),
+                   packedB( ((maxNC+NR-1)/NR)*NR*maxKC*entrySize );
+
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        const BlasInt numColPanels = (nc+NR-1) / NR;
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            const T* BBlock =
+              ( normalB ? &B[pc+jc*BLDim] : &B[jc+pc*BLDim] );
+            PackB<Kernel>( transB, kc, nc, BBlock, BLDim, packedB.data() );
+
+            for( BlasInt ic=0; ic<m; ic+=MC )
+            {
+                const BlasInt mc = Min(MC,m-ic);
+                const BlasInt numRowPanels = (mc+MR-1) / MR;
+                const T* ABlock =
+                  ( normalA ? &A[ic+pc*ALDim] : &A[pc+ic*ALDim] );
+                PackA<Kernel>
+                ( transA, mc, kc, alpha, ABlock, ALDim, packedA.data() );
+
+                const BlasInt numTiles = numRowPanels*numColPanels;
+                EL_PARALLEL_FOR
+                for( BlasInt t=0; t<numTiles; ++t )
+                {
+                    const BlasInt ir = t % numRowPanels;
+                    const BlasInt jr = t / numRowPanels;
+                    const BlasInt iOff = ic + ir*MR;
+                    const BlasInt jOff = jc + jr*NR;
+                    Kernel::Apply
+                    ( kc,
+                      &packedA[ir*MR*kc*entrySize],
+                      &packedB[jr*NR*kc*entrySize],
+                      &C[iOff+jOff*CLDim], CLDim,
+                      Min(MR,m-iOff), Min(NR,n-jOff) );
+                }
+            }
+        }
+    }
+}
+
+} // namespace blocked
+} // namespace blas
+} // namespace El
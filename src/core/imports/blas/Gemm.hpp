@@ -78,187 +78,9 @@ void Gemm
                 C[i+j*CLDim] *= beta;
     }
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
-    {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
-            }
-        }
-    }
-    else if( std::toupper(transA) == 'N' )
-    {
-        if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-    }
-    else if( std::toupper(transB) == 'N' )
-    {
-        if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
-    else
-    {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );       
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
+    if( alpha != T(0) )
+        blocked::Gemm
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
 }
 template void Gemm
 ( char transA, char transB,
@@ -385,6 +207,7 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    AddProfileFlops( 2*double(m)*n*k );
     EL_BLAS(sgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -428,6 +251,7 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    AddProfileFlops( 2*double(m)*n*k );
     EL_BLAS(dgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -468,6 +292,7 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    AddProfileFlops( 8*double(m)*n*k );
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -508,6 +333,7 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    AddProfileFlops( 8*double(m)*n*k );
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
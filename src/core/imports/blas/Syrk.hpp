@@ -54,6 +54,8 @@ void EL_BLAS(zsyrk)
 namespace El {
 namespace blas {
 
+namespace unblocked {
+
 template<typename T>
 void Herk
 ( char uplo, char trans,
@@ -63,24 +65,26 @@ void Herk
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+
+    // As in the reference BLAS, only the referenced triangle of C is scaled,
+    // which keeps the unblocked and blocked algorithms consistent.
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == Base<T>(0) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] = 0;
     }
     else if( beta != Base<T>(1) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] *= beta;
     }
 
-    const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
     T gamma, delta;
     if( normal )
     {
@@ -163,6 +167,48 @@ void Herk
         }
     }
 }
+
+} // namespace unblocked
+
+// Update the diagonal blocks with the unblocked algorithm and the
+// off-diagonal blocks with the blocked Gemm
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = blocked::TriangularLeafSize;
+    if( n <= nb )
+    {
+        unblocked::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const char transA = ( normal ? 'N' : 'C' );
+    const char transB = ( normal ? 'C' : 'N' );
+    const T alphaT( alpha ), betaT( beta );
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min(nb,n-j);
+        // Rows [iBeg,iEnd) of the j'th block column lie off of the diagonal
+        const BlasInt iBeg = ( lower ? j+jb : 0 );
+        const BlasInt iEnd = ( lower ? n : j );
+        const T* A1 = ( normal ? &A[j] : &A[j*ALDim] );
+        const T* A2 = ( normal ? &A[iBeg] : &A[iBeg*ALDim] );
+        unblocked::Herk
+        ( uplo, trans, jb, k, alpha, A1, ALDim, beta, &C[j+j*CLDim], CLDim );
+        if( iEnd > iBeg )
+            Gemm
+            ( transA, transB, iEnd-iBeg, jb, k,
+              alphaT, A2, ALDim, A1, ALDim, betaT, &C[iBeg+j*CLDim], CLDim );
+    }
+}
 template void Herk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -249,6 +295,7 @@ void Herk
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    AddProfileFlops( double(n)*n*k );
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -262,6 +309,7 @@ void Herk
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    AddProfileFlops( double(n)*n*k );
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -274,6 +322,7 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    AddProfileFlops( 4*double(n)*n*k );
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,10 +335,13 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    AddProfileFlops( 4*double(n)*n*k );
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
+namespace unblocked {
+
 template<typename T>
 void Syrk
 ( char uplo, char trans,
@@ -299,24 +351,26 @@ void Syrk
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+
+    // As in the reference BLAS, only the referenced triangle of C is scaled,
+    // which keeps the unblocked and blocked algorithms consistent.
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == T(0) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] = 0;
     }
     else if( beta != T(1) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] *= beta;
     }
 
-    const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
     T gamma, delta;
     if( normal )
     {
@@ -399,6 +453,48 @@ void Syrk
         }
     }
 }
+
+} // namespace unblocked
+
+// Update the diagonal blocks with the unblocked algorithm and the
+// off-diagonal blocks with the blocked Gemm
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt nb = blocked::TriangularLeafSize;
+    if( n <= nb )
+    {
+        unblocked::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const char transA = ( normal ? 'N' : 'T' );
+    const char transB = ( normal ? 'T' : 'N' );
+    const T alphaT( alpha ), betaT( beta );
+    for( BlasInt j=0; j<n; j+=nb )
+    {
+        const BlasInt jb = Min(nb,n-j);
+        // Rows [iBeg,iEnd) of the j'th block column lie off of the diagonal
+        const BlasInt iBeg = ( lower ? j+jb : 0 );
+        const BlasInt iEnd = ( lower ? n : j );
+        const T* A1 = ( normal ? &A[j] : &A[j*ALDim] );
+        const T* A2 = ( normal ? &A[iBeg] : &A[iBeg*ALDim] );
+        unblocked::Syrk
+        ( uplo, trans, jb, k, alpha, A1, ALDim, beta, &C[j+j*CLDim], CLDim );
+        if( iEnd > iBeg )
+            Gemm
+            ( transA, transB, iEnd-iBeg, jb, k,
+              alphaT, A2, ALDim, A1, ALDim, betaT, &C[iBeg+j*CLDim], CLDim );
+    }
+}
 template void Syrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -483,6 +579,7 @@ void Syrk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    AddProfileFlops( double(n)*n*k );
     EL_BLAS(ssyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -494,6 +591,7 @@ void Syrk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    AddProfileFlops( double(n)*n*k );
     EL_BLAS(dsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -505,6 +603,7 @@ void Syrk
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    AddProfileFlops( 4*double(n)*n*k );
     EL_BLAS(csyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -516,6 +615,7 @@ void Syrk
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    AddProfileFlops( 4*double(n)*n*k );
     EL_BLAS(zsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -37,6 +37,8 @@ void EL_BLAS(ztrmm)
 namespace El {
 namespace blas {
 
+namespace unblocked {
+
 template<typename T>
 void Trmm
 ( char side, char uplo, char trans, char unit,
@@ -53,10 +55,6 @@ void Trmm
         for( BlasInt i=0; i<m; ++i )
             B[i+j*BLDim] *= alpha;
 
-    // TODO: Legitimate blocked implementations...it seems offensive to
-    //       repeatedly stream all of the triangular matrix through memory
-    //       for each row/column of B
-
     if( onLeft )
     {
         for( BlasInt j=0; j<n; ++j )
@@ -78,6 +76,92 @@ void Trmm
         }
     }
 }
+
+} // namespace unblocked
+
+// Recursively split the triangular matrix in half so that all but
+// O(n^2 TriangularLeafSize) of the work is performed by the blocked Gemm
+template<typename T>
+void Trmm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt size = ( onLeft ? m : n );
+    if( size <= blocked::TriangularLeafSize )
+    {
+        unblocked::Trmm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Partition A = [A11, A12; A21, A22] and determine where the off-diagonal
+    // blocks of op(A) are stored. Each half of B is updated with the
+    // off-diagonal block before it is overwritten by its own triangular
+    // product.
+    const BlasInt s1 = size/2;
+    const BlasInt s2 = size-s1;
+    const bool transposed = ( std::toupper(trans) != 'N' );
+    const bool lowerOp = ( (std::toupper(uplo) == 'L') != transposed );
+    const char gemmTrans = ( transposed ? trans : 'N' );
+    const T* A11 = A;
+    const T* A22 = &A[s1+s1*ALDim];
+    const T* opA21 = ( transposed ? &A[s1*ALDim] : &A[s1] );
+    const T* opA12 = ( transposed ? &A[s1] : &A[s1*ALDim] );
+    if( onLeft )
+    {
+        T* B1 = B;
+        T* B2 = &B[s1];
+        if( lowerOp )
+        {
+            Trmm
+            ( side, uplo, trans, unit, s2, n, alpha, A22, ALDim, B2, BLDim );
+            blocked::Gemm
+            ( gemmTrans, 'N', s2, n, s1,
+              alpha, opA21, ALDim, B1, BLDim, B2, BLDim );
+            Trmm
+            ( side, uplo, trans, unit, s1, n, alpha, A11, ALDim, B1, BLDim );
+        }
+        else
+        {
+            Trmm
+            ( side, uplo, trans, unit, s1, n, alpha, A11, ALDim, B1, BLDim );
+            blocked::Gemm
+            ( gemmTrans, 'N', s1, n, s2,
+              alpha, opA12, ALDim, B2, BLDim, B1, BLDim );
+            Trmm
+            ( side, uplo, trans, unit, s2, n, alpha, A22, ALDim, B2, BLDim );
+        }
+    }
+    else
+    {
+        T* B1 = B;
+        T* B2 = &B[s1*BLDim];
+        if( lowerOp )
+        {
+            Trmm
+            ( side, uplo, trans, unit, m, s1, alpha, A11, ALDim, B1, BLDim );
+            blocked::Gemm
+            ( 'N', gemmTrans, m, s1, s2,
+              alpha, B2, BLDim, opA21, ALDim, B1, BLDim );
+            Trmm
+            ( side, uplo, trans, unit, m, s2, alpha, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            Trmm
+            ( side, uplo, trans, unit, m, s2, alpha, A22, ALDim, B2, BLDim );
+            blocked::Gemm
+            ( 'N', gemmTrans, m, s2, s1,
+              alpha, B1, BLDim, opA12, ALDim, B2, BLDim );
+            Trmm
+            ( side, uplo, trans, unit, m, s1, alpha, A11, ALDim, B1, BLDim );
+        }
+    }
+}
 template void Trmm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
@@ -152,6 +236,7 @@ void Trmm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    AddProfileFlops( double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(strmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -163,6 +248,7 @@ void Trmm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    AddProfileFlops( double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(dtrmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -173,6 +259,7 @@ void Trmm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    AddProfileFlops( 4*double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(ctrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -183,6 +270,7 @@ void Trmm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    AddProfileFlops( 4*double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(ztrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -37,6 +37,8 @@ void EL_BLAS(ztrsm)
 namespace El {
 namespace blas {
 
+namespace unblocked {
+
 template<typename F>
 void Trsm
 ( char side, char uplo, char trans, char unit,
@@ -293,6 +295,96 @@ void Trsm
         }
     }
 }
+
+} // namespace unblocked
+
+// Recursively split the triangular matrix in half so that all but
+// O(n^2 TriangularLeafSize) of the work is performed by the blocked Gemm
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt size = ( onLeft ? m : n );
+    if( size <= blocked::TriangularLeafSize )
+    {
+        unblocked::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    if( alpha != F(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+
+    // Partition A = [A11, A12; A21, A22] and determine where the off-diagonal
+    // blocks of op(A) are stored
+    const BlasInt s1 = size/2;
+    const BlasInt s2 = size-s1;
+    const bool transposed = ( std::toupper(trans) != 'N' );
+    const bool lowerOp = ( (std::toupper(uplo) == 'L') != transposed );
+    const char gemmTrans = ( transposed ? trans : 'N' );
+    const F* A11 = A;
+    const F* A22 = &A[s1+s1*ALDim];
+    const F* opA21 = ( transposed ? &A[s1*ALDim] : &A[s1] );
+    const F* opA12 = ( transposed ? &A[s1] : &A[s1*ALDim] );
+    const F one(1), negOne(-1);
+    if( onLeft )
+    {
+        F* B1 = B;
+        F* B2 = &B[s1];
+        if( lowerOp )
+        {
+            Trsm
+            ( side, uplo, trans, unit, s1, n, one, A11, ALDim, B1, BLDim );
+            blocked::Gemm
+            ( gemmTrans, 'N', s2, n, s1,
+              negOne, opA21, ALDim, B1, BLDim, B2, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, s2, n, one, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            Trsm
+            ( side, uplo, trans, unit, s2, n, one, A22, ALDim, B2, BLDim );
+            blocked::Gemm
+            ( gemmTrans, 'N', s1, n, s2,
+              negOne, opA12, ALDim, B2, BLDim, B1, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, s1, n, one, A11, ALDim, B1, BLDim );
+        }
+    }
+    else
+    {
+        F* B1 = B;
+        F* B2 = &B[s1*BLDim];
+        if( lowerOp )
+        {
+            Trsm
+            ( side, uplo, trans, unit, m, s2, one, A22, ALDim, B2, BLDim );
+            blocked::Gemm
+            ( 'N', gemmTrans, m, s1, s2,
+              negOne, B2, BLDim, opA21, ALDim, B1, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, m, s1, one, A11, ALDim, B1, BLDim );
+        }
+        else
+        {
+            Trsm
+            ( side, uplo, trans, unit, m, s1, one, A11, ALDim, B1, BLDim );
+            blocked::Gemm
+            ( 'N', gemmTrans, m, s2, s1,
+              negOne, B1, BLDim, opA12, ALDim, B2, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, m, s2, one, A22, ALDim, B2, BLDim );
+        }
+    }
+}
 #ifdef EL_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
@@ -356,6 +448,7 @@ void Trsm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    AddProfileFlops( double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -368,6 +461,7 @@ void Trsm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    AddProfileFlops( double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -379,6 +473,7 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    AddProfileFlops( 4*double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,6 +485,7 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    AddProfileFlops( 4*double(m)*n*( std::toupper(side) == 'L' ? m : n ) );
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
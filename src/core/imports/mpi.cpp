@@ -398,6 +398,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Barrier", comm, 0, MPI_BYTE );
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -552,6 +553,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Send", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -565,11 +567,13 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Send", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Send
       ( const_cast<Complex<Real>*>(buf), 2*count, TypeMap<Real>(), to,
         tag, comm.comm ) );
 #else
+    ProfileComm profile( "Send", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Send
       ( const_cast<Complex<Real>*>(buf), count,
@@ -585,6 +589,7 @@ void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
     EL_DEBUG_CSE
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
+    ProfileComm profile( "Send", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
 }
@@ -609,6 +614,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Isend", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -623,11 +629,13 @@ void TaggedISend
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Isend", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Complex<Real>*>(buf), 2*count,
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
+    ProfileComm profile( "Isend", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Isend
       ( const_cast<Complex<Real>*>(buf), count,
@@ -644,6 +652,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Serialize( count, buf, request.buffer );
+    ProfileComm profile( "Isend", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Isend
       ( request.buffer.data(), count, TypeMap<T>(), to, tag, comm.comm,
@@ -674,6 +683,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Irsend", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -688,11 +698,13 @@ void TaggedIRSend
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Irsend", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Irsend
       ( const_cast<Complex<Real>*>(buf), 2*count,
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
+    ProfileComm profile( "Irsend", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Irsend
       ( const_cast<Complex<Real>*>(buf), count,
@@ -710,6 +722,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Serialize( count, buf, request.buffer );
+    ProfileComm profile( "Irsend", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Irsend
       ( request.buffer.data(), count, TypeMap<T>(), to,
@@ -739,6 +752,7 @@ void TaggedISSend
   Request<Real>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Issend", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -753,11 +767,13 @@ void TaggedISSend
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Issend", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Complex<Real>*>(buf), 2*count,
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
+    ProfileComm profile( "Issend", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Issend
       ( const_cast<Complex<Real>*>(buf), count,
@@ -774,6 +790,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Serialize( count, buf, request.buffer );
+    ProfileComm profile( "Issend", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Issend
       ( request.buffer.data(), count, TypeMap<T>(), to,
@@ -797,6 +814,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
+    ProfileComm profile( "Recv", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 }
@@ -809,9 +827,11 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Recv", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 #else
+    ProfileComm profile( "Recv", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Recv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm, &status ) );
@@ -827,6 +847,7 @@ void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
+    ProfileComm profile( "Recv", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Recv
       ( packedBuf.data(), count, TypeMap<T>(), from, tag,
@@ -856,6 +877,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Irecv", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
@@ -870,11 +892,13 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Irecv", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Irecv
       ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
         &request.backend ) );
 #else
+    ProfileComm profile( "Irecv", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
@@ -894,6 +918,7 @@ EL_NO_RELEASE_EXCEPT
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
+    ProfileComm profile( "Irecv", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Irecv
       ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
@@ -924,6 +949,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
+    ProfileComm profile( "Sendrecv", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Sendrecv
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), to,   stag,
@@ -941,12 +967,14 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Sendrecv", comm, 2*sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(), to,   stag,
         rbuf,                             2*rc, TypeMap<Real>(), from, rtag,
         comm.comm, &status ) );
 #else
+    ProfileComm profile( "Sendrecv", comm, sc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Sendrecv
       ( const_cast<Complex<Real>*>(sbuf),
@@ -968,6 +996,7 @@ void TaggedSendRecv
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
     ReserveSerialized( rc, rbuf, packedRecv );
+    ProfileComm profile( "Sendrecv", comm, sc, TypeMap<T>() );
     SafeMpi
     ( MPI_Sendrecv
       ( packedSend.data(), sc, TypeMap<T>(), to,   stag,
@@ -1005,6 +1034,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
+    ProfileComm profile( "Sendrecv_replace", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Sendrecv_replace
       ( buf, count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
@@ -1021,11 +1051,14 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Sendrecv_replace", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Sendrecv_replace
       ( buf, 2*count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
         &status ) );
 #else
+    ProfileComm profile
+    ( "Sendrecv_replace", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Sendrecv_replace
       ( buf, count, TypeMap<Complex<Real>>(),
@@ -1045,6 +1078,7 @@ EL_NO_RELEASE_EXCEPT
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
     Status status;
+    ProfileComm profile( "Sendrecv_replace", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Sendrecv_replace
       ( packedBuf.data(), count, TypeMap<T>(), to, stag, from, rtag,
@@ -1065,6 +1099,7 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
+    ProfileComm profile( "Bcast", comm, count, TypeMap<Real>() );
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
@@ -1077,8 +1112,10 @@ EL_NO_RELEASE_EXCEPT
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Bcast", comm, 2*count, TypeMap<Real>() );
     SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
+    ProfileComm profile( "Bcast", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
 }
@@ -1094,6 +1131,7 @@ EL_NO_RELEASE_EXCEPT
         return;
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
+    ProfileComm profile( "Bcast", comm, count, TypeMap<T>() );
     SafeMpi(
       MPI_Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
     );
@@ -1111,6 +1149,7 @@ void IBroadcast
 {
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    ProfileComm profile( "Ibcast", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Ibcast
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
@@ -1128,10 +1167,12 @@ void IBroadcast
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Ibcast", comm, 2*count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Ibcast
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
+    ProfileComm profile( "Ibcast", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Ibcast
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
@@ -1154,6 +1195,7 @@ void IBroadcast
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
+    ProfileComm profile( "Ibcast", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Ibcast
       ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
@@ -1175,6 +1217,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Gather", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1190,12 +1233,14 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Gather", comm, 2*sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         root, comm.comm ) );
 #else
+    ProfileComm profile( "Gather", comm, sc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Gather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
@@ -1222,6 +1267,7 @@ EL_NO_RELEASE_EXCEPT
 
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Gather", comm, sc, TypeMap<T>() );
     SafeMpi
     ( MPI_Gather
       ( packedSend.data(), sc, TypeMap<T>(),
@@ -1240,6 +1286,7 @@ void IGather
 {
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    ProfileComm profile( "Igather", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Igather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1261,12 +1308,14 @@ void IGather
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Igather", comm, 2*sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Igather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         root, comm.comm, &request.backend ) );
 #else
+    ProfileComm profile( "Igather", comm, sc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Igather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
@@ -1297,6 +1346,7 @@ void IGather
         request.unpackedRecvBuf = rbuf;
         ReserveSerialized( rc*commSize, rbuf, request.buffer );
     }
+    ProfileComm profile( "Igather", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Igather
       ( request.buffer.data(), sc, TypeMap<Real>(),
@@ -1316,6 +1366,7 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Gatherv", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1352,12 +1403,14 @@ EL_NO_RELEASE_EXCEPT
             rdsDouble[i] = 2*rds[i];
         }
     }
+    ProfileComm profile( "Gatherv", comm, 2*sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, rcsDouble.data(), rdsDouble.data(), TypeMap<Real>(),
         root, comm.comm ) );
 #else
+    ProfileComm profile( "Gatherv", comm, sc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Complex<Real>*>(sbuf),
@@ -1393,6 +1446,7 @@ EL_NO_RELEASE_EXCEPT
 
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Gatherv", comm, sc, TypeMap<T>() );
     SafeMpi
     ( MPI_Gatherv
       ( packedSend.data(),
@@ -1417,6 +1471,8 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
+    ProfileComm profile
+    ( "Allgather", comm, sizeof(Real)*sc, MPI_UNSIGNED_CHAR );
     SafeMpi
     ( MPI_Allgather
       ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
@@ -1425,6 +1481,7 @@ EL_NO_RELEASE_EXCEPT
         sizeof(Real)*rc, MPI_UNSIGNED_CHAR,
         comm.comm ) );
 #else
+    ProfileComm profile( "Allgather", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Allgather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1441,6 +1498,8 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
+    ProfileComm profile
+    ( "Allgather", comm, 2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR );
     SafeMpi
     ( MPI_Allgather
       ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
@@ -1450,12 +1509,14 @@ EL_NO_RELEASE_EXCEPT
         comm.comm ) );
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Allgather", comm, 2*sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Allgather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(),
         comm.comm ) );
  #else
+    ProfileComm profile( "Allgather", comm, sc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Allgather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
@@ -1481,6 +1542,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( sc, sbuf, packedSend );
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Allgather", comm, sc, TypeMap<T>() );
     SafeMpi
     ( MPI_Allgather
       ( packedSend.data(), sc, TypeMap<T>(),
@@ -1488,6 +1550,65 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request.backend = MPI_REQUEST_NULL;
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
@@ -1504,6 +1625,8 @@ EL_NO_RELEASE_EXCEPT
         byteRcs[i] = sizeof(Real)*rcs[i];
         byteRds[i] = sizeof(Real)*rds[i];
     }
+    ProfileComm profile
+    ( "Allgatherv", comm, sizeof(Real)*sc, MPI_UNSIGNED_CHAR );
     SafeMpi
     ( MPI_Allgatherv
       ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
@@ -1512,6 +1635,7 @@ EL_NO_RELEASE_EXCEPT
         byteRcs.data(), byteRds.data(), MPI_UNSIGNED_CHAR,
         comm.comm ) );
 #else
+    ProfileComm profile( "Allgatherv", comm, sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Allgatherv
       ( const_cast<Real*>(sbuf),
@@ -1541,6 +1665,8 @@ EL_NO_RELEASE_EXCEPT
         byteRcs[i] = 2*sizeof(Real)*rcs[i];
         byteRds[i] = 2*sizeof(Real)*rds[i];
     }
+    ProfileComm profile
+    ( "Allgatherv", comm, 2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR );
     SafeMpi
     ( MPI_Allgatherv
       ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
@@ -1557,11 +1683,13 @@ EL_NO_RELEASE_EXCEPT
         realRcs[i] = 2*rcs[i];
         realRds[i] = 2*rds[i];
     }
+    ProfileComm profile( "Allgatherv", comm, 2*sc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, realRcs.data(), realRds.data(), TypeMap<Real>(), comm.comm ) );
  #else
+    ProfileComm profile( "Allgatherv", comm, sc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Allgatherv
       ( const_cast<Complex<Real>*>(sbuf),
@@ -1592,6 +1720,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( sc, sbuf, packedSend );
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Allgatherv", comm, sc, TypeMap<T>() );
     SafeMpi
     ( MPI_Allgatherv
       ( packedSend.data(),
@@ -1613,6 +1742,7 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Scatter", comm, rc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1628,12 +1758,14 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Scatter", comm, 2*rc, TypeMap<Real>() );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), root,
         comm.comm ) );
 #else
+    ProfileComm profile( "Scatter", comm, rc, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
@@ -1660,6 +1792,7 @@ EL_NO_RELEASE_EXCEPT
         Serialize( totalSend, sbuf, packedSend );
 
     ReserveSerialized( rc, rbuf, packedRecv );
+    ProfileComm profile( "Scatter", comm, rc, TypeMap<T>() );
     SafeMpi
     ( MPI_Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
@@ -1676,6 +1809,7 @@ EL_NO_RELEASE_EXCEPT
     const int commRank = Rank( comm );
     if( commRank == root )
     {
+        ProfileComm profile( "Scatter", comm, rc, TypeMap<Real>() );
         SafeMpi
         ( MPI_Scatter
           ( buf,          sc, TypeMap<Real>(),
@@ -1683,6 +1817,7 @@ EL_NO_RELEASE_EXCEPT
     }
     else
     {
+        ProfileComm profile( "Scatter", comm, rc, TypeMap<Real>() );
         SafeMpi
         ( MPI_Scatter
           ( 0,   sc, TypeMap<Real>(),
@@ -1700,11 +1835,13 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
+        ProfileComm profile( "Scatter", comm, 2*rc, TypeMap<Real>() );
         SafeMpi
         ( MPI_Scatter
           ( buf,          2*sc, TypeMap<Real>(),
             MPI_IN_PLACE, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
+        ProfileComm profile( "Scatter", comm, rc, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Scatter
           ( buf,          sc, TypeMap<Complex<Real>>(),
@@ -1714,11 +1851,13 @@ EL_NO_RELEASE_EXCEPT
     else
     {
 #ifdef EL_AVOID_COMPLEX_MPI
+        ProfileComm profile( "Scatter", comm, 2*rc, TypeMap<Real>() );
         SafeMpi
         ( MPI_Scatter
           ( 0,   2*sc, TypeMap<Real>(),
             buf, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
+        ProfileComm profile( "Scatter", comm, rc, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Scatter
           ( 0,   sc, TypeMap<Complex<Real>>(),
@@ -1745,6 +1884,7 @@ EL_NO_RELEASE_EXCEPT
         Serialize( totalSend, buf, packedSend );
 
     ReserveSerialized( rc, buf, packedRecv );
+    ProfileComm profile( "Scatter", comm, rc, TypeMap<T>() );
     SafeMpi
     ( MPI_Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
@@ -1760,6 +1900,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Alltoall", comm, sc, TypeMap<Real>(), true );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1775,6 +1916,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    ProfileComm profile( "Alltoall", comm, 2*sc, TypeMap<Real>(), true );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
@@ -1782,6 +1924,7 @@ EL_NO_RELEASE_EXCEPT
         rbuf,
         2*rc, TypeMap<Real>(), comm.comm ) );
 #else
+    ProfileComm profile( "Alltoall", comm, sc, TypeMap<Complex<Real>>(), true );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
@@ -1807,6 +1950,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedSend, packedRecv;
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Alltoall", comm, sc, TypeMap<T>(), true );
     SafeMpi
     ( MPI_Alltoall
       ( packedSend.data(), sc, TypeMap<T>(),
@@ -1822,6 +1966,7 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    ProfileComm profile( "Alltoallv", comm, scs, TypeMap<Real>() );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1855,12 +2000,15 @@ EL_NO_RELEASE_EXCEPT
         rcsDoubled[i] = 2*rcs[i];
         rdsDoubled[i] = 2*rds[i];
     }
+    ProfileComm profile
+    ( "Alltoallv", comm, scsDoubled.data(), TypeMap<Real>() );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
               scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
         rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
 #else
+    ProfileComm profile( "Alltoallv", comm, scs, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
@@ -1891,6 +2039,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedSend, packedRecv;
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Alltoallv", comm, scs, TypeMap<T>() );
     SafeMpi
     ( MPI_Alltoallv
       ( packedSend.data(),
@@ -1932,6 +2081,7 @@ EL_NO_RELEASE_EXCEPT
         return;
 
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile( "Reduce", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Reduce
       ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
@@ -1953,6 +2103,7 @@ EL_NO_RELEASE_EXCEPT
     if( op == SUM )
     {
         MPI_Op opC = NativeOp<Real>( op );
+        ProfileComm profile( "Reduce", comm, 2*count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Reduce
           ( const_cast<Complex<Real>*>(sbuf),
@@ -1962,6 +2113,7 @@ EL_NO_RELEASE_EXCEPT
     else
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
+        ProfileComm profile( "Reduce", comm, count, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Reduce
           ( const_cast<Complex<Real>*>(sbuf),
@@ -1969,6 +2121,7 @@ EL_NO_RELEASE_EXCEPT
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ProfileComm profile( "Reduce", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Reduce
       ( const_cast<Complex<Real>*>(sbuf),
@@ -1995,6 +2148,7 @@ EL_NO_RELEASE_EXCEPT
 
     if( commRank == root )
         ReserveSerialized( count, rbuf, packedRecv );
+    ProfileComm profile( "Reduce", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
@@ -2040,15 +2194,19 @@ EL_NO_RELEASE_EXCEPT
     const int commRank = Rank( comm );
     if( commRank == root )
     {
+        ProfileComm profile( "Reduce", comm, count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Reduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, root,
             comm.comm ) );
     }
     else
+    {
+        ProfileComm profile( "Reduce", comm, count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Reduce
           ( buf, 0, count, TypeMap<Real>(), opC, root, comm.comm ) );
+    }
 }
 
 template<typename Real,
@@ -2068,46 +2226,62 @@ EL_NO_RELEASE_EXCEPT
             MPI_Op opC = NativeOp<Real>( op );
             if( commRank == root )
             {
+                ProfileComm profile( "Reduce", comm, 2*count, TypeMap<Real>() );
                 SafeMpi
                 ( MPI_Reduce
                   ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC,
                     root, comm.comm ) );
             }
             else
+            {
+                ProfileComm profile( "Reduce", comm, 2*count, TypeMap<Real>() );
                 SafeMpi
                 ( MPI_Reduce
                   ( buf, 0, 2*count, TypeMap<Real>(), opC, root, comm.comm ) );
+            }
         }
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
             if( commRank == root )
             {
+                ProfileComm profile
+                ( "Reduce", comm, count, TypeMap<Complex<Real>>() );
                 SafeMpi
                 ( MPI_Reduce
                   ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
                     root, comm.comm ) );
             }
             else
+            {
+                ProfileComm profile
+                ( "Reduce", comm, count, TypeMap<Complex<Real>>() );
                 SafeMpi
                 ( MPI_Reduce
                   ( buf, 0, count, TypeMap<Complex<Real>>(), opC,
                     root, comm.comm ) );
+            }
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
         if( commRank == root )
         {
+            ProfileComm profile
+            ( "Reduce", comm, count, TypeMap<Complex<Real>>() );
             SafeMpi
             ( MPI_Reduce
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
                 root, comm.comm ) );
         }
         else
+        {
+            ProfileComm profile
+            ( "Reduce", comm, count, TypeMap<Complex<Real>>() );
             SafeMpi
             ( MPI_Reduce
               ( buf, 0, count, TypeMap<Complex<Real>>(), opC, root,
                 comm.comm ) );
+        }
 #endif
     }
 }
@@ -2132,6 +2306,7 @@ EL_NO_RELEASE_EXCEPT
 
     if( commRank == root )
         ReserveSerialized( count, buf, packedRecv );
+    ProfileComm profile( "Reduce", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
@@ -2154,6 +2329,7 @@ EL_NO_RELEASE_EXCEPT
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
+        ProfileComm profile( "Allreduce", comm, count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Allreduce
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
@@ -2174,6 +2350,7 @@ EL_NO_RELEASE_EXCEPT
         if( op == SUM )
         {
             MPI_Op opC = NativeOp<Real>( op );
+            ProfileComm profile( "Allreduce", comm, 2*count, TypeMap<Real>() );
             SafeMpi
             ( MPI_Allreduce
                 ( const_cast<Complex<Real>*>(sbuf),
@@ -2182,6 +2359,8 @@ EL_NO_RELEASE_EXCEPT
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
+            ProfileComm profile
+            ( "Allreduce", comm, count, TypeMap<Complex<Real>>() );
             SafeMpi
             ( MPI_Allreduce
               ( const_cast<Complex<Real>*>(sbuf),
@@ -2189,6 +2368,8 @@ EL_NO_RELEASE_EXCEPT
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
+        ProfileComm profile
+        ( "Allreduce", comm, count, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Allreduce
           ( const_cast<Complex<Real>*>(sbuf),
@@ -2213,6 +2394,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, sbuf, packedSend );
 
     ReserveSerialized( count, rbuf, packedRecv );
+    ProfileComm profile( "Allreduce", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
@@ -2245,6 +2427,7 @@ EL_NO_RELEASE_EXCEPT
         return;
 
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile( "Allreduce", comm, count, TypeMap<Real>() );
     SafeMpi
     ( MPI_Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
@@ -2263,6 +2446,7 @@ EL_NO_RELEASE_EXCEPT
     if( op == SUM )
     {
         MPI_Op opC = NativeOp<Real>( op );
+        ProfileComm profile( "Allreduce", comm, 2*count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Allreduce
           ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
@@ -2270,6 +2454,8 @@ EL_NO_RELEASE_EXCEPT
     else
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
+        ProfileComm profile
+        ( "Allreduce", comm, count, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Allreduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
@@ -2277,6 +2463,7 @@ EL_NO_RELEASE_EXCEPT
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ProfileComm profile( "Allreduce", comm, count, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
@@ -2299,6 +2486,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedSend );
 
     ReserveSerialized( count, buf, packedRecv );
+    ProfileComm profile( "Allreduce", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
@@ -2326,6 +2514,8 @@ EL_NO_RELEASE_EXCEPT
     MemCopy( rbuf, &sbuf[commRank*rc], rc );
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile
+    ( "Reduce_scatter_block", comm, rc, TypeMap<Real>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm ) );
@@ -2354,11 +2544,15 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile
+    ( "Reduce_scatter_block", comm, 2*rc, TypeMap<Real>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ProfileComm profile
+    ( "Reduce_scatter_block", comm, rc, TypeMap<Complex<Real>>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
@@ -2391,6 +2585,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Reduce_scatter_block", comm, rc, TypeMap<T>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
@@ -2435,6 +2630,8 @@ EL_NO_RELEASE_EXCEPT
         MemCopy( buf, &buf[commRank*rc], rc );
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile
+    ( "Reduce_scatter_block", comm, rc, TypeMap<Real>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Real>(), opC, comm.comm ) );
@@ -2463,11 +2660,15 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
 # ifdef EL_AVOID_COMPLEX_MPI
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile
+    ( "Reduce_scatter_block", comm, 2*rc, TypeMap<Real>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ProfileComm profile
+    ( "Reduce_scatter_block", comm, rc, TypeMap<Complex<Real>>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
@@ -2500,6 +2701,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, buf, packedSend );
 
     ReserveSerialized( totalRecv, buf, packedRecv );
+    ProfileComm profile( "Reduce_scatter_block", comm, rc, TypeMap<T>(), true );
     SafeMpi
     ( MPI_Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
@@ -2525,6 +2727,7 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     MPI_Op opC = NativeOp<Real>( op );
+    ProfileComm profile( "Reduce_scatter", comm, rcs, TypeMap<Real>() );
     SafeMpi
     ( MPI_Reduce_scatter
       ( const_cast<Real*>(sbuf),
@@ -2548,6 +2751,8 @@ EL_NO_RELEASE_EXCEPT
         vector<int> rcsDoubled(p);
         for( int i=0; i<p; ++i )
             rcsDoubled[i] = 2*rcs[i];
+        ProfileComm profile
+        ( "Reduce_scatter", comm, rcsDoubled.data(), TypeMap<Real>() );
         SafeMpi
         ( MPI_Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
@@ -2556,6 +2761,8 @@ EL_NO_RELEASE_EXCEPT
     else
     {
         MPI_Op opC = NativeOp<Complex<Real>>( op );
+        ProfileComm profile
+        ( "Reduce_scatter", comm, rcs, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
@@ -2564,6 +2771,8 @@ EL_NO_RELEASE_EXCEPT
     }
 #else
     MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ProfileComm profile
+    ( "Reduce_scatter", comm, rcs, TypeMap<Complex<Real>>() );
     SafeMpi
     ( MPI_Reduce_scatter
       ( const_cast<Complex<Real>*>(sbuf),
@@ -2591,6 +2800,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedSend, packedRecv;
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    ProfileComm profile( "Reduce_scatter", comm, rcs, TypeMap<T>() );
     SafeMpi
     ( MPI_Reduce_scatter
       ( packedSend.data(), packedRecv.data(), const_cast<int*>(rcs),
@@ -2629,6 +2839,7 @@ EL_NO_RELEASE_EXCEPT
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
+        ProfileComm profile( "Scan", comm, count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Scan
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
@@ -2650,6 +2861,7 @@ EL_NO_RELEASE_EXCEPT
         if( op == SUM )
         {
             MPI_Op opC = NativeOp<Real>( op );
+            ProfileComm profile( "Scan", comm, 2*count, TypeMap<Real>() );
             SafeMpi
             ( MPI_Scan
               ( const_cast<Complex<Real>*>(sbuf),
@@ -2658,6 +2870,8 @@ EL_NO_RELEASE_EXCEPT
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
+            ProfileComm profile
+            ( "Scan", comm, count, TypeMap<Complex<Real>>() );
             SafeMpi
             ( MPI_Scan
               ( const_cast<Complex<Real>*>(sbuf),
@@ -2665,6 +2879,7 @@ EL_NO_RELEASE_EXCEPT
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
+        ProfileComm profile( "Scan", comm, count, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Scan
           ( const_cast<Complex<Real>*>(sbuf),
@@ -2687,6 +2902,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedSend, packedRecv;
     Serialize( count, sbuf, packedSend );
     ReserveSerialized( count, rbuf, packedRecv );
+    ProfileComm profile( "Scan", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
@@ -2726,6 +2942,7 @@ EL_NO_RELEASE_EXCEPT
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
+        ProfileComm profile( "Scan", comm, count, TypeMap<Real>() );
         SafeMpi
         ( MPI_Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
@@ -2744,6 +2961,7 @@ EL_NO_RELEASE_EXCEPT
         if( op == SUM )
         {
             MPI_Op opC = NativeOp<Real>( op );
+            ProfileComm profile( "Scan", comm, 2*count, TypeMap<Real>() );
             SafeMpi
             ( MPI_Scan
               ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
@@ -2751,6 +2969,8 @@ EL_NO_RELEASE_EXCEPT
         else
         {
             MPI_Op opC = NativeOp<Complex<Real>>( op );
+            ProfileComm profile
+            ( "Scan", comm, count, TypeMap<Complex<Real>>() );
             SafeMpi
             ( MPI_Scan
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
@@ -2758,6 +2978,7 @@ EL_NO_RELEASE_EXCEPT
         }
 #else
         MPI_Op opC = NativeOp<Complex<Real>>( op );
+        ProfileComm profile( "Scan", comm, count, TypeMap<Complex<Real>>() );
         SafeMpi
         ( MPI_Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
@@ -2780,6 +3001,7 @@ EL_NO_RELEASE_EXCEPT
     std::vector<byte> packedSend, packedRecv;
     Serialize( count, buf, packedSend );
     ReserveSerialized( count, buf, packedRecv );
+    ProfileComm profile( "Scan", comm, count, TypeMap<T>() );
     SafeMpi
     ( MPI_Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
@@ -2940,6 +3162,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
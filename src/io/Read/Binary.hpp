@@ -40,9 +40,84 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+namespace binary {
+
+// Collectively read the local entries of an element-wise distributed matrix
+// with MPI-IO, where each process describes the entries it owns within the
+// column-major data through a strided file view so that the file system sees
+// a single collective access
 template<typename T>
 inline void
-Binary( AbstractDistMatrix<T>& A, const string filename )
+ReadElemental( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().ViewingComm();
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+          MPI_INFO_NULL, &file ) != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    Int dims[2];
+    MPI_File_read_at_all
+    ( file, 0, dims, 2*sizeof(Int), MPI_BYTE, MPI_STATUS_IGNORE );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    MPI_Offset numBytes;
+    MPI_File_get_size( file, &numBytes );
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = height*width*sizeof(T);
+    const Int numBytesExp = metaBytes + dataBytes;
+    if( Int(numBytes) != numBytesExp )
+    {
+        MPI_File_close( &file );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+
+    A.Resize( height, width );
+    const bool owner = A.Participating() && A.CrossRank() == A.Root();
+    const Int localHeight = ( owner ? A.LocalHeight() : 0 );
+    const Int localWidth = ( owner ? A.LocalWidth() : 0 );
+    const Int colShift = ( owner ? A.ColShift() : 0 );
+    const Int rowShift = ( owner ? A.RowShift() : 0 );
+
+    MPI_Datatype entryType, colType, fileType, memType;
+    MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType );
+    MPI_Type_vector( localHeight, 1, A.ColStride(), entryType, &colType );
+    MPI_Type_create_hvector
+    ( localWidth, 1, MPI_Aint(A.RowStride())*height*sizeof(T), colType,
+      &fileType );
+    MPI_Type_vector
+    ( localWidth, localHeight, Max(A.LDim(),localHeight), entryType,
+      &memType );
+    MPI_Type_commit( &entryType );
+    MPI_Type_commit( &fileType );
+    MPI_Type_commit( &memType );
+
+    const MPI_Offset displacement =
+      metaBytes + (colShift+rowShift*height)*sizeof(T);
+    MPI_File_set_view
+    ( file, displacement, entryType, fileType, const_cast<char*>("native"),
+      MPI_INFO_NULL );
+    const int count = ( localHeight*localWidth == 0 ? 0 : 1 );
+    const int error =
+      MPI_File_read_all( file, A.Buffer(), count, memType, MPI_STATUS_IGNORE );
+
+    MPI_Type_free( &memType );
+    MPI_Type_free( &fileType );
+    MPI_Type_free( &colType );
+    MPI_Type_free( &entryType );
+    MPI_File_close( &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not read the entries of ",filename);
+}
+
+// Read each local entry (or column) of a matrix with an arbitrary
+// distribution from its position in the file
+template<typename T>
+inline void
+ReadGeneral( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
     std::ifstream file( filename.c_str(), std::ios::binary );
@@ -102,6 +177,20 @@ Binary( AbstractDistMatrix<T>& A, const string filename )
     }
 }
 
+} // namespace binary
+
+// The strided file views only describe element-wise distributions
+template<typename T>
+inline void
+Binary( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    if( A.Wrap() == ELEMENT )
+        binary::ReadElemental( A, filename );
+    else
+        binary::ReadGeneral( A, filename );
+}
+
 } // namespace read
 } // namespace El
 
@@ -12,6 +12,137 @@
 namespace El {
 namespace read {
 
+// Locale-independent parsing of the whitespace-separated fields of a
+// coordinate-format line. Each routine advances 'p' past the field and
+// returns false if no field could be parsed before 'end'.
+inline bool SkipBlanks( const char*& p, const char* end )
+{
+    while( p != end && (*p == ' ' || *p == '\t' || *p == '\r') )
+        ++p;
+    return p != end;
+}
+
+inline bool ParseIndex( const char*& p, const char* end, Int& value )
+{
+    if( !SkipBlanks( p, end ) || *p < '0' || *p > '9' )
+        return false;
+    Int result = 0;
+    for( ; p != end && *p >= '0' && *p <= '9'; ++p )
+        result = 10*result + (*p-'0');
+    value = result;
+    return true;
+}
+
+template<typename Real>
+bool ParseReal( const char*& p, const char* end, Real& value )
+{
+    // Fall back to the stream operators so that extended-precision types
+    // retain all of the digits in the file
+    if( !SkipBlanks( p, end ) )
+        return false;
+    const char* tokenEnd = p;
+    while( tokenEnd != end && !std::isspace(*tokenEnd) )
+        ++tokenEnd;
+    std::istringstream tokenStream( string(p,tokenEnd) );
+    if( !(tokenStream >> value) )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+// NOTE: The buffers passed to the following routines must be null-terminated
+inline bool ParseReal( const char*& p, const char* end, double& value )
+{
+    if( !SkipBlanks( p, end ) )
+        return false;
+    char* tokenEnd;
+    value = std::strtod( p, &tokenEnd );
+    if( tokenEnd == p || tokenEnd > end )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+inline bool ParseReal( const char*& p, const char* end, float& value )
+{
+    double doubleValue;
+    if( !ParseReal( p, end, doubleValue ) )
+        return false;
+    value = float(doubleValue);
+    return true;
+}
+
+inline bool ParseReal( const char*& p, const char* end, Int& value )
+{
+    if( !SkipBlanks( p, end ) )
+        return false;
+    char* tokenEnd;
+    value = Int(std::strtoll( p, &tokenEnd, 10 ));
+    if( tokenEnd == p || tokenEnd > end )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+// Read the lines of [dataBegin,fileEnd) whose first byte lies within the
+// 'rank'-th of 'numParts' equal byte ranges. Since a range boundary will
+// usually split a line, the byte before the range is inspected to decide
+// whether the first partial line belongs to the previous range, and the last
+// line is completed by reading past the end of the range. The buffer is
+// null-terminated and the index of its first owned byte is returned.
+inline Int ReadLineRange
+( std::ifstream& file,
+  std::streamoff dataBegin,
+  std::streamoff fileEnd,
+  int rank,
+  int numParts,
+  vector<char>& buffer )
+{
+    EL_DEBUG_CSE
+    const std::streamoff numBytes = fileEnd - dataBegin;
+    const std::streamoff lo = dataBegin + (numBytes*rank)/numParts;
+    const std::streamoff hi = dataBegin + (numBytes*(rank+1))/numParts;
+    const std::streamoff readBegin = ( rank == 0 ? lo : lo-1 );
+    buffer.resize( hi-readBegin );
+    file.seekg( readBegin );
+    file.read( buffer.data(), hi-readBegin );
+    if( !file )
+        RuntimeError("Could not read bytes [",readBegin,",",hi,")");
+
+    Int begin = 0;
+    if( rank != 0 )
+    {
+        auto newline = std::find( buffer.begin(), buffer.end(), '\n' );
+        begin = ( newline - buffer.begin() ) + 1;
+    }
+    if( begin >= Int(buffer.size()) )
+    {
+        // No line begins within this range
+        buffer.assign( 1, '\0' );
+        return 0;
+    }
+
+    const std::streamoff chunkSize = 4096;
+    std::streamoff pos = hi;
+    while( pos < fileEnd && buffer.back() != '\n' )
+    {
+        const std::streamoff count = Min(chunkSize,fileEnd-pos);
+        const Int oldSize = buffer.size();
+        buffer.resize( oldSize+count );
+        file.seekg( pos );
+        file.read( &buffer[oldSize], count );
+        if( !file )
+            RuntimeError("Could not read bytes [",pos,",",pos+count,")");
+        auto newline =
+          std::find( buffer.begin()+oldSize, buffer.end(), '\n' );
+        if( newline != buffer.end() )
+            buffer.resize( (newline-buffer.begin())+1 );
+        pos += count;
+    }
+    buffer.push_back( '\0' );
+    return begin;
+}
+
 template<typename T>
 void MatrixMarket( Matrix<T>& A, const string filename )
 {
@@ -403,6 +534,26 @@ void MatrixMarket( SparseMatrix<T>& A, const string filename )
     }
 }
 
+// Since only the processes which failed to parse their lines know of the
+// failure, the error of the lowest such rank is shared before throwing so that
+// no process is left waiting within a subsequent collective
+inline void AgreeOnParseError( const string& error, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int errorRank =
+      mpi::AllReduce
+      ( error.empty() ? commSize : mpi::Rank(comm), mpi::MIN, comm );
+    if( errorRank == commSize )
+        return;
+    Int errorSize = error.size();
+    mpi::Broadcast( errorSize, errorRank, comm );
+    vector<byte> message( error.begin(), error.end() );
+    message.resize( errorSize );
+    mpi::Broadcast( message.data(), errorSize, errorRank, comm );
+    RuntimeError( string(message.begin(),message.end()) );
+}
+
 template<typename T>
 void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
 {
@@ -476,13 +627,13 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
     while( file.peek() == '%' )
         std::getline( file, line );
 
-    int m, n;
+    Int m, n;
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
 
     // Read in the matrix dimensions and number of nonzeros
     // ====================================================
-    int numNonzero;
+    Int numNonzero;
     if( isMatrix )
     {
         std::stringstream lineStream( line );
@@ -507,60 +658,101 @@ void MatrixMarket( DistSparseMatrix<T>& A, const string filename )
     // ========================
     Zeros( A, m, n );
 
-    // Fill in the local nonzero entries by passively calling QueueUpdate
-    // ==================================================================
-    int i, j;
-    Real realPart, imagPart;
-    T value;
-    const int commSize = A.Grid().Size();
-    A.Reserve( numNonzero/commSize ); // Assume an even nonzero distribution
-    bool passive = true;
-    for( Int k=0; k<numNonzero; ++k )
+    // Each process parses the lines beginning in its share of the bytes
+    // ================================================================
+    const std::streamoff dataBegin = file.tellg();
+    const std::streamoff fileEnd = FileSize( file );
+    const Grid& grid = A.Grid();
+    vector<Entry<T>> entries;
+    string error;
+    try
     {
-        if( !std::getline( file, line ) )
-            RuntimeError("Could not get nonzero ",k);
-        std::stringstream lineStream( line );
-        if( !(lineStream >> i) )
-            RuntimeError("Could not extract row coordinate of nonzero ",k);
-        --i; // convert from Fortran to C indexing
-        if( isMatrix )
+        vector<char> buffer;
+        const Int begin =
+          ReadLineRange
+          ( file, dataBegin, fileEnd, grid.Rank(), grid.Size(), buffer );
+        file.close();
+
+        // Assume an even nonzero distribution
+        entries.reserve( numNonzero/grid.Size()+1 );
+        const char* p = buffer.data() + begin;
+        const char* bufferEnd = buffer.data() + (buffer.size()-1);
+        Real realPart, imagPart;
+        T value;
+        while( p < bufferEnd )
         {
-            if( !(lineStream >> j) )
+            const char* lineEnd = std::find( p, bufferEnd, '\n' );
+            const char* q = p;
+            p = ( lineEnd == bufferEnd ? bufferEnd : lineEnd+1 );
+            if( !SkipBlanks( q, lineEnd ) || *q == '%' )
+                continue;
+
+            Int i, j=1;
+            if( !ParseIndex( q, lineEnd, i ) )
+                RuntimeError("Could not extract row coordinate from ",
+                             string(q,lineEnd));
+            if( isMatrix && !ParseIndex( q, lineEnd, j ) )
+                RuntimeError("Could not extract col coordinate from ",
+                             string(q,lineEnd));
+            if( i < 1 || i > m || j < 1 || j > n )
                 RuntimeError
-                ("Could not extract col coordinate of nonzero ",k);
-            --j;
-        }
-        else
-            j = 0;
+                ("Entry (",i,",",j,") lies outside of the ",m," x ",n,
+                 " matrix");
+            --i; --j; // convert from Fortran to C indexing
 
-        if( isPattern )
-        {
-            A.QueueUpdate( i, j, T(1), passive );
-        }
-        else
-        {
-            if( isComplex )
+            if( isPattern )
             {
-                if( !(lineStream >> realPart) )
+                value = T(1);
+            }
+            else if( isComplex )
+            {
+                if( !ParseReal( q, lineEnd, realPart ) )
                     RuntimeError
                     ("Could not extract real part of entry (",i,",",j,")");
-                if( !(lineStream >> imagPart) )
+                if( !ParseReal( q, lineEnd, imagPart ) )
                     RuntimeError
                     ("Could not extract imag part of entry (",i,",",j,")");
                 SetRealPart( value, realPart );
                 SetImagPart( value, imagPart );
-                A.QueueUpdate( i, j, value, passive );
             }
             else
             {
-                if( !(lineStream >> realPart) )
+                if( !ParseReal( q, lineEnd, realPart ) )
                     RuntimeError
                     ("Could not extract real entry (",i,",",j,")");
-                A.QueueUpdate( i, j, T(realPart), passive );
+                value = T(realPart);
             }
+            entries.push_back( Entry<T>{i,j,value} );
         }
     }
-    A.ProcessLocalQueues();
+    catch( std::exception& e )
+    {
+        error = e.what();
+        if( !error.empty() && error.back() == '\n' )
+            error.pop_back();
+        if( error.empty() )
+            error = "Could not parse " + filename;
+    }
+    AgreeOnParseError( error, grid.Comm() );
+
+    const Int numParsed = mpi::AllReduce( Int(entries.size()), grid.Comm() );
+    if( numParsed != numNonzero )
+        RuntimeError
+        ("Expected ",numNonzero," nonzeros but found ",numParsed);
+
+    // Shuffle the entries to their owners in a single exchange
+    // ========================================================
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    Int numLocal = 0;
+    for( const auto& entry : entries )
+        if( entry.i >= firstLocalRow && entry.i < firstLocalRow+localHeight )
+            ++numLocal;
+    A.Reserve( numLocal, entries.size()-numLocal );
+    for( const auto& entry : entries )
+        A.QueueUpdate( entry );
+    SwapClear( entries );
+    A.ProcessQueues();
 
     if( isSymmetric )
     {
@@ -49,7 +49,11 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY )
+    {
+        write::Binary( A, basename );
+    }
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -35,6 +35,84 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Collectively write the entries of A with MPI-IO; only one member of each
+// set of redundant copies contributes its local entries. Since the strided
+// file views only describe element-wise distributions, other matrices are
+// gathered to a single process and written sequentially.
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    if( A.Wrap() != ELEMENT )
+    {
+        DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
+        if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+            Binary( A_CIRC_CIRC.LockedMatrix(), basename );
+        return;
+    }
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    MPI_File file;
+    if( MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()),
+          MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file )
+        != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int metaBytes = 2*sizeof(Int);
+    const Int dataBytes = height*width*sizeof(T);
+    MPI_File_set_size( file, metaBytes+dataBytes );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { height, width };
+        MPI_File_write_at
+        ( file, 0, const_cast<Int*>(dims), 2*sizeof(Int), MPI_BYTE,
+          MPI_STATUS_IGNORE );
+    }
+
+    const bool owner = A.Participating() && A.CrossRank() == A.Root() &&
+                       A.RedundantRank() == 0;
+    const Int localHeight = ( owner ? A.LocalHeight() : 0 );
+    const Int localWidth = ( owner ? A.LocalWidth() : 0 );
+    const Int colShift = ( owner ? A.ColShift() : 0 );
+    const Int rowShift = ( owner ? A.RowShift() : 0 );
+
+    MPI_Datatype entryType, colType, fileType, memType;
+    MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType );
+    MPI_Type_vector( localHeight, 1, A.ColStride(), entryType, &colType );
+    MPI_Type_create_hvector
+    ( localWidth, 1, MPI_Aint(A.RowStride())*height*sizeof(T), colType,
+      &fileType );
+    MPI_Type_vector
+    ( localWidth, localHeight, Max(A.LDim(),localHeight), entryType,
+      &memType );
+    MPI_Type_commit( &entryType );
+    MPI_Type_commit( &fileType );
+    MPI_Type_commit( &memType );
+
+    const MPI_Offset displacement =
+      metaBytes + (colShift+rowShift*height)*sizeof(T);
+    MPI_File_set_view
+    ( file, displacement, entryType, fileType, const_cast<char*>("native"),
+      MPI_INFO_NULL );
+    const int count = ( localHeight*localWidth == 0 ? 0 : 1 );
+    const int error =
+      MPI_File_write_all
+      ( file, const_cast<T*>(A.LockedBuffer()), count, memType,
+        MPI_STATUS_IGNORE );
+
+    MPI_Type_free( &memType );
+    MPI_Type_free( &fileType );
+    MPI_Type_free( &colType );
+    MPI_Type_free( &entryType );
+    MPI_File_close( &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not write the entries of ",filename);
+}
+
 } // namespace write
 } // namespace El
 
@@ -19,6 +19,7 @@ ElError ElHermitianTridiagCtrlDefault_s( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_s( &ctrl->symvCtrl );
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
@@ -26,6 +27,7 @@ ElError ElHermitianTridiagCtrlDefault_d( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_d( &ctrl->symvCtrl );
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
@@ -33,6 +35,7 @@ ElError ElHermitianTridiagCtrlDefault_c( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_c( &ctrl->symvCtrl );
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
@@ -40,6 +43,7 @@ ElError ElHermitianTridiagCtrlDefault_z( ElHermitianTridiagCtrl* ctrl )
     ctrl->approach = EL_HERMITIAN_TRIDIAG_DEFAULT;
     ctrl->order = EL_ROW_MAJOR;
     ElSymvCtrlDefault_z( &ctrl->symvCtrl );
+    ctrl->bandwidth = 0;
     return EL_SUCCESS;
 }
 
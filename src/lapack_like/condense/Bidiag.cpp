@@ -11,6 +11,7 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -147,12 +148,20 @@ void ExplicitCondensed( Matrix<F>& A )
 }
 
 template<typename F> 
-void ExplicitCondensed( AbstractDistMatrix<F>& A )
+void ExplicitCondensed( AbstractDistMatrix<F>& A, const BidiagCtrl& ctrl )
 {
     EL_DEBUG_CSE
     DistMatrix<F,STAR,STAR> householderScalarsP(A.Grid()),
       householderScalarsQ(A.Grid());
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( ctrl.approach == BIDIAG_TWO_STAGE && A.Height() >= A.Width() )
+    {
+        // P_2 and Q_2 are not needed, so their reflectors are never stored
+        TwoStageHelper<F>
+        ( A, householderScalarsP, householderScalarsQ, nullptr, nullptr,
+          ctrl );
+    }
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     if( A.Height() >= A.Width() )
     {
         MakeTrapezoidal( UPPER, A );    
@@ -185,7 +194,15 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
     AbstractDistMatrix<F>& P, \
     AbstractDistMatrix<F>& Q ); \
   template void bidiag::ExplicitCondensed( Matrix<F>& A ); \
-  template void bidiag::ExplicitCondensed( AbstractDistMatrix<F>& A ); \
+  template void bidiag::ExplicitCondensed \
+  ( AbstractDistMatrix<F>& A, const BidiagCtrl& ctrl ); \
+  template void bidiag::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalarsP, \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    BandReflectors<F>& bandReflectorsP, \
+    BandReflectors<F>& bandReflectorsQ, \
+    const BidiagCtrl& ctrl ); \
   template void bidiag::ApplyQ \
   ( LeftOrRight side, Orientation orientation, \
     const Matrix<F>& A, \
@@ -205,6 +222,18 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   ( LeftOrRight side, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const BandReflectors<F>& bandReflectors, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ApplyP \
+  ( LeftOrRight side, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const BandReflectors<F>& bandReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
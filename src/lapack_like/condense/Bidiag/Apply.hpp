@@ -9,6 +9,8 @@
 #ifndef EL_BIDIAG_APPLY_HPP
 #define EL_BIDIAG_APPLY_HPP
 
+#include "../BulgeChase.hpp"
+
 namespace El {
 namespace bidiag {
 
@@ -84,6 +86,56 @@ void ApplyP
       A, householderScalars, B );
 }
 
+// Q = Q_1 Q_2, where Q_2 only acts upon the first n rows
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BandReflectors<F>& bandReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool applyQ2First = ( normal == onLeft );
+    if( applyQ2First )
+        bulge::ApplyBandReflectors( side, orientation, bandReflectors, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, 0,
+      A, householderScalars, B );
+    if( !applyQ2First )
+        bulge::ApplyBandReflectors( side, orientation, bandReflectors, B );
+}
+
+// P = P_1 P_2, where the first-stage reflectors start on the b'th
+// superdiagonal
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BandReflectors<F>& bandReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
+    const Int offset = bandReflectors.bandwidth;
+    const bool applyP2First = ( normal == onLeft );
+    if( applyP2First )
+        bulge::ApplyBandReflectors( side, orientation, bandReflectors, B );
+    ApplyPackedReflectors
+    ( side, UPPER, HORIZONTAL, direction, conjugation, offset,
+      A, householderScalars, B );
+    if( !applyP2First )
+        bulge::ApplyBandReflectors( side, orientation, bandReflectors, B );
+}
+
 } // namespace bidiag
 } // namespace El
 
@@ -0,0 +1,264 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+#include "../BulgeChase.hpp"
+
+namespace El {
+namespace bidiag {
+
+// Reduce the m x n matrix A, with m >= n, to upper-triangular band form with
+// bandwidth b by alternating between QR decompositions of panels of b columns
+// and LQ decompositions of panels of b rows, each of which is applied to the
+// trailing matrix with Level 3 operations
+template<typename F>
+void UpperBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalarsP,
+  DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  Int b )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    householderScalarsQ.Resize( n, 1 );
+    householderScalarsP.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,MD,STAR> panelScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    DistMatrix<F,STAR,STAR> panelScalars_STAR_STAR(g);
+
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        const Range<Int> ind1(k,k+nb), ind2(k+nb,n);
+
+        // Annihilate below the diagonal of the column panel
+        auto ACol = A( IR(k,m), ind1 );
+        auto ARight = A( IR(k,m), ind2 );
+        QR( ACol, panelScalars, signature );
+        auto RCol = ACol( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RCol );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          ACol, panelScalars, ARight );
+        panelScalars_STAR_STAR = panelScalars;
+        for( Int j=0; j<nb; ++j )
+            householderScalarsQ.SetLocal
+            ( k+j, 0, panelScalars_STAR_STAR.GetLocal(j,0) );
+        if( k+nb == n )
+            break;
+
+        // Annihilate to the right of the b'th superdiagonal of the row panel
+        auto ARow = A( ind1, ind2 );
+        auto ABottom = A( IR(k+nb,m), ind2 );
+        const Int numReflectors = Min(nb,n-k-nb);
+        LQ( ARow, panelScalars, signature );
+        auto LRow = ARow( ALL, IR(0,numReflectors) );
+        DiagonalScaleTrapezoid( RIGHT, LOWER, NORMAL, signature, LRow );
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, UNCONJUGATED, 0,
+          ARow, panelScalars, ABottom );
+        panelScalars_STAR_STAR = panelScalars;
+        for( Int j=0; j<numReflectors; ++j )
+            householderScalarsP.SetLocal
+            ( k+j, 0, panelScalars_STAR_STAR.GetLocal(j,0) );
+    }
+}
+
+// Chase the bulges out of the upper band matrix stored in 'band', where
+// band(2b+i-k,k) holds A(i,k) so that there is room for b subdiagonals and
+// 2b superdiagonals of fill. If 'householderP' and 'householderQ' are
+// non-null, they are filled with the reflectors applied from the right and
+// left, respectively.
+template<typename F>
+void ChaseUpperBand
+( Int b, Matrix<F>& band,
+  DistMatrix<F,STAR,VR>* householderP,
+  DistMatrix<F,STAR,VR>* householderQ )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    const Int ku = 2*b;
+    const Int bandLDim = band.LDim();
+    const Int numDiags = band.Height();
+    const auto sweepOffsets = bulge::SweepOffsets( n, b );
+    F* bandBuf = band.Buffer();
+
+    // Step (s,j) annihilates row r to the right of its first entry in the
+    // columns W_j, which creates a bulge below the diagonal of A(W_j,W_j),
+    // and then annihilates the first column of that bulge, which creates a
+    // bulge in A(W_j,W_{j+1}). The rows [r,st+len) and columns [st,c1) of A
+    // that it touches are copied into a dense workspace.
+    auto task = [&]( Int s, Int j, F* work )
+    {
+        const Int st = s+1 + j*b;
+        const Int len = Min(b,n-st);
+        const Int r = ( j==0 ? s : st-b );
+        const Int c1 = Min(st+len+b,n);
+        const Int m = st+len-r;
+        const Int w = c1-st;
+        const Int off = st-r;
+        F* W = work;
+        F* v = &work[m*w];
+        F* applyWork = &v[b];
+
+        for( Int q=0; q<w; ++q )
+        {
+            const Int k = st+q;
+            for( Int a=0; a<m; ++a )
+            {
+                const Int d = ku+(r+a)-k;
+                W[a+q*m] =
+                  ( d >= 0 && d < numDiags ? bandBuf[d+k*bandLDim] : F(0) );
+            }
+        }
+
+        // Annihilate all but the first entry of A(r,W_j) from the right
+        for( Int q=0; q<len; ++q )
+            v[q] = Conj(W[q*m]);
+        const F tauP = lapack::Reflector( len, v[0], &v[1], 1 );
+        const F betaP = v[0];
+        v[0] = F(1);
+        lapack::ApplyReflector
+        ( false, m, len, v, 1, Conj(tauP), W, m, applyWork );
+        W[0] = betaP;
+        for( Int q=1; q<len; ++q )
+            W[q*m] = F(0);
+        if( householderP != nullptr )
+            bulge::StoreReflector
+            ( sweepOffsets[s]+j, len, tauP, v, *householderP );
+
+        // Annihilate all but the first entry of A(W_j,st) from the left
+        for( Int a=0; a<len; ++a )
+            v[a] = W[off+a];
+        const F tauQ = lapack::Reflector( len, v[0], &v[1], 1 );
+        const F betaQ = v[0];
+        v[0] = F(1);
+        lapack::ApplyReflector
+        ( true, len, w-1, v, 1, tauQ, &W[off+m], m, applyWork );
+        W[off] = betaQ;
+        for( Int a=1; a<len; ++a )
+            W[off+a] = F(0);
+        if( householderQ != nullptr )
+            bulge::StoreReflector
+            ( sweepOffsets[s]+j, len, tauQ, v, *householderQ );
+
+        for( Int q=0; q<w; ++q )
+        {
+            const Int k = st+q;
+            for( Int a=0; a<m; ++a )
+            {
+                const Int d = ku+(r+a)-k;
+                if( d >= 0 && d < numDiags )
+                    bandBuf[d+k*bandLDim] = W[a+q*m];
+            }
+        }
+    };
+
+    const Int workSize = 4*b*b + 3*b;
+    bulge::Wavefront<F>( n, b, workSize, task );
+}
+
+// Reduce A to upper band form and then chase the bulges out of the band.
+// The reflectors of the chase are only kept if the band reflectors are
+// non-null.
+template<typename F>
+void TwoStageHelper
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPPre,
+  AbstractDistMatrix<F>& householderScalarsQPre,
+  BandReflectors<F>* bandReflectorsP,
+  BandReflectors<F>* bandReflectorsQ,
+  const BidiagCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsPProx( householderScalarsPPre ),
+      householderScalarsQProx( householderScalarsQPre );
+    auto& A = AProx.Get();
+    auto& householderScalarsP = householderScalarsPProx.Get();
+    auto& householderScalarsQ = householderScalarsQProx.Get();
+    if( A.Height() < A.Width() )
+        LogicError("The two-stage reduction requires A to be at least as tall",
+                   " as it is wide");
+
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    const Int b =
+      ( ctrl.bandwidth > 0 ? ctrl.bandwidth :
+        Max(Blocksize<F>("BidiagBand",g.Height(),g.Width()),Int(1)) );
+
+    // Reduce to band form with Level 3 operations
+    UpperBand( A, householderScalarsP, householderScalarsQ, b );
+
+    // Give every process a copy of the band, with room for the bulges
+    const Int ku = 2*b;
+    Matrix<F> band;
+    Zeros( band, 3*b+1, n );
+    DistMatrix<F,STAR,STAR> diag(g);
+    for( Int d=0; d<=Min(b,n-1); ++d )
+    {
+        GetDiagonal( A, diag, d );
+        for( Int i=0; i<n-d; ++i )
+            band(ku-d,i+d) = diag.GetLocal(i,0);
+    }
+
+    // Chase the bulges
+    DistMatrix<F,STAR,VR> *householderP=nullptr, *householderQ=nullptr;
+    if( bandReflectorsP != nullptr && bandReflectorsQ != nullptr )
+    {
+        const auto sweepOffsets = bulge::SweepOffsets( n, b );
+        bandReflectorsP->size = bandReflectorsQ->size = n;
+        bandReflectorsP->bandwidth = bandReflectorsQ->bandwidth = b;
+        householderP = &bandReflectorsP->householder;
+        householderQ = &bandReflectorsQ->householder;
+        householderP->SetGrid( g );
+        householderQ->SetGrid( g );
+        householderP->Resize( b+1, sweepOffsets.back() );
+        householderQ->Resize( b+1, sweepOffsets.back() );
+    }
+    ChaseUpperBand( b, band, householderP, householderQ );
+
+    // Overwrite the band of A with the real upper bidiagonal matrix
+    DistMatrix<F,STAR,STAR> d(g), e(g);
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    for( Int k=0; k<n; ++k )
+        d.SetLocal( k, 0, RealPart(band(ku,k)) );
+    for( Int k=0; k<n-1; ++k )
+        e.SetLocal( k, 0, RealPart(band(ku-1,k+1)) );
+    SetDiagonal( A, d );
+    SetDiagonal( A, e, 1 );
+    for( Int k=2; k<=Min(b,n-1); ++k )
+        FillDiagonal( A, F(0), k );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalarsP,
+  AbstractDistMatrix<F>& householderScalarsQ,
+  BandReflectors<F>& bandReflectorsP,
+  BandReflectors<F>& bandReflectorsQ,
+  const BidiagCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    TwoStageHelper
+    ( A, householderScalarsP, householderScalarsQ,
+      &bandReflectorsP, &bandReflectorsQ, ctrl );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
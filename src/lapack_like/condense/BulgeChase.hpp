@@ -0,0 +1,203 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CONDENSE_BULGECHASE_HPP
+#define EL_CONDENSE_BULGECHASE_HPP
+
+#include <algorithm>
+
+// Utilities shared by the second (bulge-chasing) stages of the two-stage
+// reductions to tridiagonal and bidiagonal form. Sweep s of the chase over an
+// n x n band matrix with bandwidth b annihilates the entries of row/column s
+// outside of the condensed form and then chases the resulting bulge down the
+// band, with step j acting upon the window [s+1+j*b,min(s+(j+1)*b,n-1)].
+
+namespace El {
+namespace bulge {
+
+inline Int NumSteps( Int n, Int b, Int s )
+{ return ( s < n-1 ? (n-2-s)/b+1 : 0 ); }
+
+// The index of the first reflector of each sweep, followed by the total
+// number of reflectors
+inline vector<Int> SweepOffsets( Int n, Int b )
+{
+    const Int numSweeps = Max(n-1,0);
+    vector<Int> offsets( numSweeps+1 );
+    offsets[0] = 0;
+    for( Int s=0; s<numSweeps; ++s )
+        offsets[s+1] = offsets[s] + NumSteps( n, b, s );
+    return offsets;
+}
+
+// Run task(s,j,work) for every step of the chase. Step (s,j) depends upon
+// steps (s,j-1) and (s-1,j+1), which lie on earlier wavefronts of constant
+// j+3s, and the steps of a single wavefront touch disjoint portions of the
+// band, so each wavefront is processed in parallel. Each thread is given
+// 'workSize' entries of workspace.
+template<typename F,typename Task>
+void Wavefront( Int n, Int b, Int workSize, Task task )
+{
+    EL_DEBUG_CSE
+    if( n <= 1 )
+        return;
+    const Int numSweeps = n-1;
+    const Int maxSteps = NumSteps( n, b, 0 );
+    const Int numWaves = 3*(numSweeps-1) + maxSteps;
+#ifdef EL_HYBRID
+    #pragma omp parallel
+#endif
+    {
+        vector<F> work( workSize );
+        for( Int wave=0; wave<numWaves; ++wave )
+        {
+            const Int sBeg = Max(wave-maxSteps+3,Int(0)) / 3;
+            const Int sEnd = Min(wave/3,numSweeps-1);
+#ifdef EL_HYBRID
+            #pragma omp for schedule(static)
+#endif
+            for( Int s=sBeg; s<=sEnd; ++s )
+            {
+                const Int j = wave - 3*s;
+                if( j < NumSteps( n, b, s ) )
+                    task( s, j, work.data() );
+            }
+        }
+    }
+}
+
+// Store a reflector (if it is locally owned) into the r'th column of the
+// [* ,VR] matrix of reflectors
+template<typename F>
+void StoreReflector
+( Int r, Int length, const F& tau, const F* v,
+  DistMatrix<F,STAR,VR>& householder )
+{
+    if( !householder.IsLocalCol(r) )
+        return;
+    const Int height = householder.Height();
+    F* h = householder.Buffer( 0, householder.LocalCol(r) );
+    h[0] = tau;
+    for( Int i=0; i<length; ++i )
+        h[i+1] = v[i];
+    for( Int i=length+1; i<height; ++i )
+        h[i] = F(0);
+}
+
+// Apply reflectors r0,...,r0+H.Width()-1 (stored in the columns of H) to the
+// local rows (on the right) or columns (on the left) of B, processing them in
+// blocks so that each block only has to be traversed once per chunk
+template<typename F>
+void ApplyLocal
+( bool onLeft, bool backward, bool conjugate,
+  Int n, Int b, const vector<Int>& sweepOffsets, Int r0,
+  const Matrix<F>& H, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int numLocal = H.Width();
+    vector<Int> starts( numLocal );
+    Int s = std::upper_bound( sweepOffsets.begin(), sweepOffsets.end(), r0 ) -
+            sweepOffsets.begin() - 1;
+    for( Int t=0; t<numLocal; ++t )
+    {
+        const Int r = r0 + t;
+        while( r >= sweepOffsets[s+1] )
+            ++s;
+        starts[t] = s+1 + (r-sweepOffsets[s])*b;
+    }
+
+    const Int blockSize = 64;
+    const Int length = ( onLeft ? B.Width() : B.Height() );
+    const Int numBlocks = (length+blockSize-1) / blockSize;
+    const Int BLDim = B.LDim();
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int beg = block*blockSize;
+        const Int blockLength = Min(blockSize,length-beg);
+        vector<F> work( blockLength );
+        for( Int step=0; step<numLocal; ++step )
+        {
+            const Int t = ( backward ? numLocal-1-step : step );
+            const F tau = ( conjugate ? Conj(H(0,t)) : H(0,t) );
+            if( tau == F(0) )
+                continue;
+            const Int st = starts[t];
+            const Int len = Min(b,n-st);
+            const F* v = H.LockedBuffer(1,t);
+            if( onLeft )
+                lapack::ApplyReflector
+                ( true, len, blockLength, v, 1, tau,
+                  B.Buffer(st,beg), BLDim, work.data() );
+            else
+                lapack::ApplyReflector
+                ( false, blockLength, len, v, 1, tau,
+                  B.Buffer(beg,st), BLDim, work.data() );
+        }
+    }
+}
+
+// Overwrite B with Q_2 B, Q_2^H B, B Q_2, or B Q_2^H, where
+// Q_2 = H_0^H H_1^H ... H_{R-1}^H is the product of the (adjoints of the)
+// bulge-chasing reflectors in the order in which they were generated.
+// Only the first n rows (or columns) of B are modified.
+template<typename F>
+void ApplyBandReflectors
+( LeftOrRight side, Orientation orientation,
+  const BandReflectors<F>& reflectors,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    const Int n = reflectors.size;
+    const Int b = reflectors.bandwidth;
+    const Int numReflectors = reflectors.householder.Width();
+    const bool onLeft = ( side == LEFT );
+    const bool normal = ( orientation == NORMAL );
+    EL_DEBUG_ONLY(
+      if( (onLeft ? BPre.Height() : BPre.Width()) < n )
+          LogicError("B is too small for the band reflectors");
+    )
+    if( numReflectors == 0 )
+        return;
+    const bool backward = ( normal == onLeft );
+    const auto sweepOffsets = SweepOffsets( n, b );
+
+    // Gather roughly n reflectors at a time
+    const Int chunkSize = Max(n,Int(1));
+    const Int numChunks = (numReflectors+chunkSize-1) / chunkSize;
+    auto applyChunks = [&]( Matrix<F>& BLoc )
+    {
+        DistMatrix<F,STAR,STAR> H( BPre.Grid() );
+        for( Int c=0; c<numChunks; ++c )
+        {
+            const Int chunk = ( backward ? numChunks-1-c : c );
+            const Int r0 = chunk*chunkSize;
+            const Int r1 = Min(r0+chunkSize,numReflectors);
+            H = reflectors.householder( ALL, IR(r0,r1) );
+            ApplyLocal
+            ( onLeft, backward, normal, n, b, sweepOffsets, r0,
+              H.LockedMatrix(), BLoc );
+        }
+    };
+
+    if( onLeft )
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( BPre );
+        applyChunks( BProx.Get().Matrix() );
+    }
+    else
+    {
+        DistMatrixReadWriteProxy<F,F,VC,STAR> BProx( BPre );
+        applyChunks( BProx.Get().Matrix() );
+    }
+}
+
+} // namespace bulge
+} // namespace El
+
+#endif // ifndef EL_CONDENSE_BULGECHASE_HPP
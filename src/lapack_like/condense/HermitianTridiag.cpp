@@ -45,6 +45,7 @@ void Ger2Sub
 #include "./HermitianTridiag/LowerBlockedSquare.hpp"
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
@@ -77,7 +78,14 @@ void HermitianTridiag
     auto& householderScalars = householderScalarsProx.Get();
 
     const Grid& grid = A.Grid();
-    if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
+    if( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        // The packed reflectors cannot represent Q_2
+        LogicError
+        ("The two-stage approach requires herm_tridiag::TwoStage so that "
+         "the band reflectors are kept");
+    }
+    else if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
         if( uplo == LOWER )
@@ -180,6 +188,14 @@ void ExplicitCondensed
 {
     EL_DEBUG_CSE
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+    if( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        // Q_2 is not needed, so its reflectors are never stored
+        TwoStageHelper<F>( uplo, A, householderScalars, nullptr, ctrl );
+        MakeTrapezoidal( LOWER, A, 1 );
+        MakeTrapezoidal( UPPER, A, -1 );
+        return;
+    }
     HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
@@ -205,6 +221,12 @@ void ExplicitCondensed
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
     const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    BandReflectors<F>& bandReflectors, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ApplyQ \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
@@ -218,6 +240,14 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const BandReflectors<F>& bandReflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
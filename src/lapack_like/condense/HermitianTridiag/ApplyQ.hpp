@@ -9,6 +9,8 @@
 #ifndef EL_HERMITIANTRIDIAG_APPLYQ_HPP
 #define EL_HERMITIANTRIDIAG_APPLYQ_HPP
 
+#include "../BulgeChase.hpp"
+
 namespace El {
 namespace herm_tridiag {
 
@@ -55,6 +57,35 @@ void ApplyQ
       A, householderScalars, B );
 }
 
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const BandReflectors<F>& bandReflectors,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    // The first-stage reflectors are always stored below the band
+    const Int offset = -bandReflectors.bandwidth;
+
+    // Q = Q_1 Q_2, so Q_2 is applied first when forming Q B or B Q^H
+    const bool applyQ2First = ( normal == onLeft );
+    if( applyQ2First )
+        bulge::ApplyBandReflectors( side, orientation, bandReflectors, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, offset,
+      A, householderScalars, B );
+    if( !applyQ2First )
+        bulge::ApplyBandReflectors( side, orientation, bandReflectors, B );
+}
+
 } // namespace herm_tridiag
 } // namespace El
 
@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+#include "../BulgeChase.hpp"
+
+namespace El {
+namespace herm_tridiag {
+
+// Reduce the lower triangle of A to Hermitian band form with bandwidth b.
+// Each panel of b columns is factored with a QR decomposition and the
+// trailing matrix is then updated with the Hermitian rank-2k update
+//
+//   A22 := A22 - V W^H - W V^H,   W := Y - (1/2) V (X V^H Y),  Y := A22 V X^H,
+//
+// where Q^H = I - V X V^H is the UT-transform representation of the panel's
+// reflectors.
+template<typename F>
+void LowerBand
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,MD,STAR> panelScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    DistMatrix<F> V(g), Y(g);
+    DistMatrix<F,VC,STAR> V_VC_STAR(g), Y_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> panelScalars_STAR_STAR(g), S_STAR_STAR(g),
+      M_STAR_STAR(g);
+
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        const Range<Int> panelInd(k,k+nb), trailInd(k+b,n);
+
+        auto APan = A( trailInd, panelInd );
+        auto A22 = A( trailInd, trailInd );
+
+        // Factor the panel and absorb the signature into R so that only the
+        // reflectors need to be applied
+        QR( APan, panelScalars, signature );
+        auto RPan = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RPan );
+        panelScalars_STAR_STAR = panelScalars;
+        for( Int j=0; j<nb; ++j )
+            householderScalars.SetLocal
+            ( k+j, 0, panelScalars_STAR_STAR.GetLocal(j,0) );
+
+        // Form the explicit Householder vectors and the triangular matrix S
+        // such that Q^H = I - V inv(S) V^H
+        V = APan;
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        V_VC_STAR = V;
+        Zeros( S_STAR_STAR, nb, nb );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), V_VC_STAR.LockedMatrix(),
+          Base<F>(0), S_STAR_STAR.Matrix() );
+        El::AllReduce( S_STAR_STAR, V_VC_STAR.ColComm() );
+        for( Int j=0; j<nb; ++j )
+            S_STAR_STAR.SetLocal
+            ( j, j, F(1)/panelScalars_STAR_STAR.GetLocal(j,0) );
+
+        // Y := A22 V inv(S)^H
+        Y.AlignWith( A22 );
+        Zeros( Y, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), Y );
+        Y_VC_STAR.AlignWith( V_VC_STAR );
+        Y_VC_STAR = Y;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), S_STAR_STAR, Y_VC_STAR );
+
+        // M := inv(S) V^H Y
+        Zeros( M_STAR_STAR, nb, nb );
+        LocalGemm( ADJOINT, NORMAL, F(1), V_VC_STAR, Y_VC_STAR, M_STAR_STAR );
+        El::AllReduce( M_STAR_STAR, V_VC_STAR.ColComm() );
+        Trsm
+        ( LEFT, LOWER, NORMAL, NON_UNIT,
+          F(1), S_STAR_STAR.LockedMatrix(), M_STAR_STAR.Matrix() );
+
+        // W := Y - (1/2) V M, stored in Y
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1)/F(2), V_VC_STAR, M_STAR_STAR,
+          F(1), Y_VC_STAR );
+
+        // A22 := A22 - V W^H - W V^H
+        Her2k( LOWER, NORMAL, F(-1), V_VC_STAR, Y_VC_STAR, Base<F>(1), A22 );
+    }
+}
+
+// Chase the bulges out of the lower Hermitian band matrix stored in 'band',
+// where band(d,k) holds A(k+d,k) and there is room for the fill of up to 2b-1
+// subdiagonals. If 'householder' is non-null, it is filled with the
+// reflectors of the chase.
+template<typename F>
+void ChaseLowerBand
+( Int b, Matrix<F>& band, DistMatrix<F,STAR,VR>* householder )
+{
+    EL_DEBUG_CSE
+    const Int n = band.Width();
+    const Int bandLDim = band.LDim();
+    const Int numDiags = band.Height();
+    const auto sweepOffsets = bulge::SweepOffsets( n, b );
+    F* bandBuf = band.Buffer();
+
+    // Step (s,j) applies its reflector to the window W_j from both sides.
+    // The rows [st,r1) and columns [c,st+len) of A that it touches are copied
+    // into a dense workspace, with the strictly upper triangle recovered from
+    // the lower triangle.
+    auto task = [&]( Int s, Int j, F* work )
+    {
+        const Int st = s+1 + j*b;
+        const Int len = Min(b,n-st);
+        const Int c = ( j==0 ? s : st-b );
+        const Int r1 = Min(st+len+b,n);
+        const Int m = r1-st;
+        const Int w = st+len-c;
+        const Int off = st-c;
+        F* W = work;
+        F* v = &work[m*w];
+        F* applyWork = &v[b];
+
+        for( Int q=0; q<w; ++q )
+        {
+            const Int k = c+q;
+            for( Int a=0; a<m; ++a )
+            {
+                const Int i = st+a;
+                if( i >= k )
+                    W[a+q*m] =
+                      ( i-k < numDiags ? bandBuf[(i-k)+k*bandLDim] : F(0) );
+                else
+                    W[a+q*m] = Conj(bandBuf[(k-i)+i*bandLDim]);
+            }
+        }
+
+        // Annihilate all but the first entry of A(W_j,c) and apply the
+        // reflector from the left to the rest of the block row
+        for( Int a=0; a<len; ++a )
+            v[a] = W[a];
+        const F tau = lapack::Reflector( len, v[0], &v[1], 1 );
+        W[0] = v[0];
+        for( Int a=1; a<len; ++a )
+            W[a] = F(0);
+        v[0] = F(1);
+        lapack::ApplyReflector
+        ( true, len, w-1, v, 1, tau, &W[m], m, applyWork );
+
+        // Apply the adjoint of the reflector from the right to the block
+        // column, which creates the bulge in A(W_{j+1},W_j)
+        lapack::ApplyReflector
+        ( false, m, len, v, 1, Conj(tau), &W[off*m], m, applyWork );
+
+        for( Int q=0; q<w; ++q )
+        {
+            const Int k = c+q;
+            for( Int a=Max(k-st,Int(0)); a<m; ++a )
+            {
+                const Int i = st+a;
+                if( i-k < numDiags )
+                    bandBuf[(i-k)+k*bandLDim] = W[a+q*m];
+            }
+        }
+
+        if( householder != nullptr )
+            bulge::StoreReflector
+            ( sweepOffsets[s]+j, len, tau, v, *householder );
+    };
+
+    const Int workSize = 4*b*b + 3*b;
+    bulge::Wavefront<F>( n, b, workSize, task );
+}
+
+// Reduce A to Hermitian band form and then chase the bulges out of the band.
+// The reflectors of the chase are only kept if 'bandReflectors' is non-null.
+template<typename F>
+void TwoStageHelper
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  BandReflectors<F>* bandReflectors,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    const Int b =
+      ( ctrl.bandwidth > 0 ? ctrl.bandwidth :
+        Max(Blocksize<F>("HermitianTridiagBand",g.Height(),g.Width()),
+            Int(1)) );
+
+    // Reduce to band form with Level 3 operations
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    LowerBand( A, householderScalars, b );
+
+    // Give every process a copy of the band, with room for the bulges
+    const Int numDiags = Min(2*b,n);
+    Matrix<F> band;
+    Zeros( band, numDiags, n );
+    DistMatrix<F,STAR,STAR> diag(g);
+    for( Int d=0; d<=Min(b,n-1); ++d )
+    {
+        GetDiagonal( A, diag, -d );
+        for( Int k=0; k<n-d; ++k )
+            band(d,k) = diag.GetLocal(k,0);
+    }
+
+    // Chase the bulges
+    DistMatrix<F,STAR,VR>* householder = nullptr;
+    if( bandReflectors != nullptr )
+    {
+        const auto sweepOffsets = bulge::SweepOffsets( n, b );
+        bandReflectors->size = n;
+        bandReflectors->bandwidth = b;
+        householder = &bandReflectors->householder;
+        householder->SetGrid( g );
+        householder->Resize( b+1, sweepOffsets.back() );
+    }
+    ChaseLowerBand( b, band, householder );
+
+    // Overwrite the band of A with the real symmetric tridiagonal matrix
+    DistMatrix<F,STAR,STAR> d(g), e(g);
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    for( Int k=0; k<n; ++k )
+        d.SetLocal( k, 0, RealPart(band(0,k)) );
+    for( Int k=0; k<n-1; ++k )
+        e.SetLocal( k, 0, RealPart(band(1,k)) );
+    SetDiagonal( A, d );
+    SetDiagonal( A, e, -1 );
+    if( uplo == UPPER )
+        SetDiagonal( A, e, 1 );
+    for( Int k=2; k<=Min(b,n-1); ++k )
+        FillDiagonal( A, F(0), -k );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  BandReflectors<F>& bandReflectors,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    TwoStageHelper( uplo, A, householderScalars, &bandReflectors, ctrl );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -97,7 +97,7 @@ void UpperBlocked
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
     
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("HermitianTridiag",g.Height(),g.Width());
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -10,6 +10,9 @@
 
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
+#include "./PanelGather.hpp"
+#include "./Cholesky/LowerLookAhead.hpp"
+#include "./Cholesky/UpperLookAhead.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
 #include "./Cholesky/ReverseUpperVariant3.hpp"
 #include "./Cholesky/PivotedLowerVariant3.hpp"
@@ -96,10 +99,18 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky")
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
     }
+    else if( LookAheadDepth() > 0 )
+    {
+        if( uplo == LOWER )
+            cholesky::LowerLookAhead( A, LookAheadDepth() );
+        else
+            cholesky::UpperLookAhead( A, LookAheadDepth() );
+    }
     else
     {
         if( uplo == LOWER )
@@ -114,6 +125,7 @@ void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky")
     if( uplo == LOWER )
         cholesky::PivotedLowerVariant3Blocked( A, p );
     else
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_LOWER_LOOKAHEAD_HPP
+#define EL_CHOLESKY_LOWER_LOOKAHEAD_HPP
+
+#include <deque>
+
+namespace El {
+namespace cholesky {
+
+// A factored panel, L21 = A(k+nb:n,k:k+nb), whose trailing update,
+//
+//   tril(A(k+nb:n,k+nb:n)) -= tril(L21 L21^H),
+//
+// has only been applied to the columns in [k+nb,updatedEnd)
+template<typename F>
+struct LowerLookAheadPanel
+{
+    Int end;
+    Int updatedEnd;
+    DistMatrix<F,MC,STAR> A21_MC_STAR;
+    DistMatrix<F,MR,STAR> A21_MR_STAR;
+
+    LowerLookAheadPanel( const Grid& g )
+    : A21_MC_STAR(g), A21_MR_STAR(g)
+    { }
+};
+
+// Apply the deferred update to the block column A(j:n,j:jEnd)
+template<typename F>
+void LowerLookAheadUpdate
+( const LowerLookAheadPanel<F>& panel,
+  DistMatrix<F>& A,
+  Int j, Int jEnd )
+{
+    EL_DEBUG_CSE
+    if( j >= jEnd )
+        return;
+    const Int n = A.Height();
+    const Int off = panel.end;
+    auto L1_MC_STAR = panel.A21_MC_STAR( IR(j,jEnd)-off, ALL );
+    auto L1_MR_STAR = panel.A21_MR_STAR( IR(j,jEnd)-off, ALL );
+    auto L2_MC_STAR = panel.A21_MC_STAR( IR(jEnd,n)-off, ALL );
+    auto A11 = A( IR(j,jEnd), IR(j,jEnd) );
+    auto A21 = A( IR(jEnd,n), IR(j,jEnd) );
+    LocalTrrk
+    ( LOWER, ADJOINT, F(-1), L1_MC_STAR, L1_MR_STAR, F(1), A11 );
+    LocalGemm( NORMAL, ADJOINT, F(-1), L2_MC_STAR, L1_MR_STAR, F(1), A21 );
+}
+
+// A right-looking variant where the trailing updates of up to 'depth'
+// factored panels are deferred. The next block column is brought up to date
+// first so that it may be factored while the [MC,* ] and [MR,* ] copies of
+// its L21 are gathered, which is overlapped with the (blocked) application of
+// the oldest deferred updates.
+template<typename F>
+void LowerLookAhead( AbstractDistMatrix<F>& APre, Int depth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+      if( depth < 1 )
+          LogicError("Look-ahead depth must be positive");
+    )
+    typedef LowerLookAheadPanel<F> Panel;
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+
+    std::deque<unique_ptr<Panel>> pending;
+    PanelGather<F> gatherMC, gatherMR;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize<F>("Cholesky",grid.Height(),grid.Width());
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        Cholesky( LOWER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21_VC_STAR;
+
+        unique_ptr<Panel> panel( new Panel(grid) );
+        panel->end = panel->updatedEnd = k+nb;
+        panel->A21_MC_STAR.AlignWith( A22 );
+        panel->A21_MR_STAR.AlignWith( A22 );
+        gatherMC.StartPartialColAllGather( A21_VC_STAR, panel->A21_MC_STAR );
+        gatherMR.StartPartialColAllGather( A21_VR_STAR, panel->A21_MR_STAR );
+
+        // Overlap the gathers with the oldest deferred updates
+        while( Int(pending.size()) > depth-1 )
+        {
+            const Panel& old = *pending.front();
+            for( Int j=old.updatedEnd; j<n; j+=bsize )
+            {
+                LowerLookAheadUpdate( old, A, j, Min(j+bsize,n) );
+                gatherMC.Progress();
+                gatherMR.Progress();
+            }
+            pending.pop_front();
+        }
+        gatherMC.Finish();
+        gatherMR.Finish();
+
+        A21 = panel->A21_MC_STAR;
+        pending.push_back( std::move(panel) );
+
+        // Bring the next block column up to date
+        const Int kNext = k+nb;
+        const Int nbNext = Min(bsize,n-kNext);
+        for( auto& old : pending )
+        {
+            if( old->updatedEnd < kNext+nbNext )
+            {
+                LowerLookAheadUpdate( *old, A, old->updatedEnd, kNext+nbNext );
+                old->updatedEnd = kNext+nbNext;
+            }
+        }
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_LOWER_LOOKAHEAD_HPP
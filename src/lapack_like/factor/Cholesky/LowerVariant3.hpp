@@ -49,7 +49,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -87,7 +87,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",grid.Height(),grid.Width());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
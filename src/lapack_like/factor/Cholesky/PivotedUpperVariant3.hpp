@@ -269,7 +269,7 @@ void PivotedUpperVariant3Blocked( Matrix<F>& A, Permutation& P )
     P.ReserveSwaps( n );
 
     Matrix<F> XB1, YB1;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -308,7 +308,7 @@ void PivotedUpperVariant3Blocked
     const Grid& grid = A.Grid();
     DistMatrix<F,MC,STAR> XB1(grid);
     DistMatrix<F,MR,STAR> YB1(grid);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",grid.Height(),grid.Width());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
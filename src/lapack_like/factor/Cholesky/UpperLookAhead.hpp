@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_UPPER_LOOKAHEAD_HPP
+#define EL_CHOLESKY_UPPER_LOOKAHEAD_HPP
+
+#include <deque>
+
+namespace El {
+namespace cholesky {
+
+// A factored panel, U12 = A(k:k+nb,k+nb:n), whose trailing update,
+//
+//   triu(A(k+nb:n,k+nb:n)) -= triu(U12^H U12),
+//
+// has only been applied to the rows in [k+nb,updatedEnd)
+template<typename F>
+struct UpperLookAheadPanel
+{
+    Int end;
+    Int updatedEnd;
+    DistMatrix<F,STAR,MC> A12_STAR_MC;
+    DistMatrix<F,STAR,MR> A12_STAR_MR;
+
+    UpperLookAheadPanel( const Grid& g )
+    : A12_STAR_MC(g), A12_STAR_MR(g)
+    { }
+};
+
+// Apply the deferred update to the block row A(i:iEnd,i:n)
+template<typename F>
+void UpperLookAheadUpdate
+( const UpperLookAheadPanel<F>& panel,
+  DistMatrix<F>& A,
+  Int i, Int iEnd )
+{
+    EL_DEBUG_CSE
+    if( i >= iEnd )
+        return;
+    const Int n = A.Height();
+    const Int off = panel.end;
+    auto U1_STAR_MC = panel.A12_STAR_MC( ALL, IR(i,iEnd)-off );
+    auto U1_STAR_MR = panel.A12_STAR_MR( ALL, IR(i,iEnd)-off );
+    auto U2_STAR_MR = panel.A12_STAR_MR( ALL, IR(iEnd,n)-off );
+    auto A11 = A( IR(i,iEnd), IR(i,iEnd) );
+    auto A12 = A( IR(i,iEnd), IR(iEnd,n) );
+    LocalTrrk
+    ( UPPER, ADJOINT, F(-1), U1_STAR_MC, U1_STAR_MR, F(1), A11 );
+    LocalGemm( ADJOINT, NORMAL, F(-1), U1_STAR_MC, U2_STAR_MR, F(1), A12 );
+}
+
+// The transpose of LowerLookAhead: the next block row is brought up to date
+// first so that it may be factored while the [* ,MC] and [* ,MR] copies of
+// its U12 are gathered, which is overlapped with the (blocked) application of
+// the oldest deferred updates.
+template<typename F>
+void UpperLookAhead( AbstractDistMatrix<F>& APre, Int depth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+      if( depth < 1 )
+          LogicError("Look-ahead depth must be positive");
+    )
+    typedef UpperLookAheadPanel<F> Panel;
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(grid);
+
+    std::deque<unique_ptr<Panel>> pending;
+    PanelGather<F> gatherMC, gatherMR;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize<F>("Cholesky",grid.Height(),grid.Width());
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        Cholesky( UPPER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_VC.AlignWith( A22 );
+        A12_STAR_VC = A12_STAR_VR;
+
+        unique_ptr<Panel> panel( new Panel(grid) );
+        panel->end = panel->updatedEnd = k+nb;
+        panel->A12_STAR_MC.AlignWith( A22 );
+        panel->A12_STAR_MR.AlignWith( A22 );
+        gatherMC.StartPartialRowAllGather( A12_STAR_VC, panel->A12_STAR_MC );
+        gatherMR.StartPartialRowAllGather( A12_STAR_VR, panel->A12_STAR_MR );
+
+        // Overlap the gathers with the oldest deferred updates
+        while( Int(pending.size()) > depth-1 )
+        {
+            const Panel& old = *pending.front();
+            for( Int i=old.updatedEnd; i<n; i+=bsize )
+            {
+                UpperLookAheadUpdate( old, A, i, Min(i+bsize,n) );
+                gatherMC.Progress();
+                gatherMR.Progress();
+            }
+            pending.pop_front();
+        }
+        gatherMC.Finish();
+        gatherMR.Finish();
+
+        A12 = panel->A12_STAR_MR;
+        pending.push_back( std::move(panel) );
+
+        // Bring the next block row up to date
+        const Int kNext = k+nb;
+        const Int nbNext = Min(bsize,n-kNext);
+        for( auto& old : pending )
+        {
+            if( old->updatedEnd < kNext+nbNext )
+            {
+                UpperLookAheadUpdate( *old, A, old->updatedEnd, kNext+nbNext );
+                old->updatedEnd = kNext+nbNext;
+            }
+        }
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_UPPER_LOOKAHEAD_HPP
@@ -0,0 +1,214 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_PACK_HPP
+#define EL_LDL_PACK_HPP
+
+#include <fstream>
+
+namespace El {
+namespace ldl {
+
+// Routines for appending the symbolic and numeric data of a sparse-direct
+// factorization onto a byte buffer and for reading it back. The data is stored
+// in the native representation of the machine and is therefore only portable
+// between machines which agree upon it (the file headers record enough
+// information to detect the most likely mismatches).
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void PackValue( const T& value, vector<byte>& buffer )
+{
+    const size_t oldSize = buffer.size();
+    buffer.resize( oldSize+sizeof(T) );
+    MemCopy
+    ( &buffer[oldSize], reinterpret_cast<const byte*>(&value), sizeof(T) );
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void PackValues( const vector<T>& values, vector<byte>& buffer )
+{
+    const Int numValues = values.size();
+    PackValue( numValues, buffer );
+    const size_t oldSize = buffer.size();
+    buffer.resize( oldSize+numValues*sizeof(T) );
+    if( numValues > 0 )
+        MemCopy
+        ( &buffer[oldSize], reinterpret_cast<const byte*>(values.data()),
+          numValues*sizeof(T) );
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+T UnpackValue( const vector<byte>& buffer, size_t& pos )
+{
+    if( pos+sizeof(T) > buffer.size() )
+        RuntimeError("Unexpected end of packed data");
+    T value;
+    MemCopy( reinterpret_cast<byte*>(&value), &buffer[pos], sizeof(T) );
+    pos += sizeof(T);
+    return value;
+}
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void UnpackValues( const vector<byte>& buffer, size_t& pos, vector<T>& values )
+{
+    const Int numValues = UnpackValue<Int>( buffer, pos );
+    if( numValues < 0 || pos+numValues*sizeof(T) > buffer.size() )
+        RuntimeError("Unexpected end of packed data");
+    values.resize( numValues );
+    if( numValues > 0 )
+        MemCopy
+        ( reinterpret_cast<byte*>(values.data()), &buffer[pos],
+          numValues*sizeof(T) );
+    pos += numValues*sizeof(T);
+}
+
+// Scalars which are not packed (e.g., BigFloat) are serialized into a
+// separate, length-prefixed block
+template<typename Field,typename=EnableIf<IsPacked<Base<Field>>>>
+void PackFields( Int n, const Field* x, vector<byte>& buffer )
+{
+    const size_t oldSize = buffer.size();
+    buffer.resize( oldSize+n*sizeof(Field) );
+    if( n > 0 )
+        MemCopy
+        ( &buffer[oldSize], reinterpret_cast<const byte*>(x), n*sizeof(Field) );
+}
+
+template<typename Field,typename=DisableIf<IsPacked<Base<Field>>>,
+         typename=void>
+void PackFields( Int n, const Field* x, vector<byte>& buffer )
+{
+    vector<byte> serialized;
+    Serialize( n, x, serialized );
+    PackValues( serialized, buffer );
+}
+
+template<typename Field,typename=EnableIf<IsPacked<Base<Field>>>>
+void UnpackFields
+( Int n, const vector<byte>& buffer, size_t& pos, Field* x )
+{
+    if( pos+n*sizeof(Field) > buffer.size() )
+        RuntimeError("Unexpected end of packed data");
+    if( n > 0 )
+        MemCopy
+        ( reinterpret_cast<byte*>(x), &buffer[pos], n*sizeof(Field) );
+    pos += n*sizeof(Field);
+}
+
+template<typename Field,typename=DisableIf<IsPacked<Base<Field>>>,
+         typename=void>
+void UnpackFields
+( Int n, const vector<byte>& buffer, size_t& pos, Field* x )
+{
+    vector<byte> serialized;
+    UnpackValues( buffer, pos, serialized );
+    Deserialize( n, serialized, x );
+}
+
+template<typename Field>
+void PackMatrix( const Matrix<Field>& A, vector<byte>& buffer )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    PackValue( height, buffer );
+    PackValue( width, buffer );
+    if( A.LDim() == height || width <= 1 )
+    {
+        PackFields( height*width, A.LockedBuffer(), buffer );
+    }
+    else
+    {
+        vector<Field> contiguous( height*width );
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                contiguous[i+j*height] = A(i,j);
+        PackFields( height*width, contiguous.data(), buffer );
+    }
+}
+
+template<typename Field>
+void UnpackMatrix( const vector<byte>& buffer, size_t& pos, Matrix<Field>& A )
+{
+    const Int height = UnpackValue<Int>( buffer, pos );
+    const Int width = UnpackValue<Int>( buffer, pos );
+    if( height < 0 || width < 0 )
+        RuntimeError("Invalid packed matrix dimensions");
+    A.Resize( height, width, Max(height,Int(1)) );
+    UnpackFields( height*width, buffer, pos, A.Buffer() );
+}
+
+// Files are written as a sequence of length-prefixed blocks so that they may
+// be read back one block at a time
+
+inline void WriteBlock( std::ofstream& file, const vector<byte>& buffer )
+{
+    const Int numBytes = buffer.size();
+    file.write( reinterpret_cast<const char*>(&numBytes), sizeof(Int) );
+    file.write( reinterpret_cast<const char*>(buffer.data()), numBytes );
+    if( !file.good() )
+        RuntimeError("Could not write to file");
+}
+
+inline void ReadBlock( std::ifstream& file, vector<byte>& buffer )
+{
+    Int numBytes;
+    file.read( reinterpret_cast<char*>(&numBytes), sizeof(Int) );
+    if( !file.good() || numBytes < 0 )
+        RuntimeError("Unexpected end of file");
+    buffer.resize( numBytes );
+    file.read( reinterpret_cast<char*>(buffer.data()), numBytes );
+    if( !file.good() )
+        RuntimeError("Unexpected end of file");
+}
+
+// Every file begins with a block of the following form, which allows for
+// detecting mismatches in the format version, integer size, or scalar type
+// before any of the data is interpreted
+
+inline void PackHeader
+( const string& magic, Int version, const string& typeName,
+  vector<byte>& buffer )
+{
+    PackValues( vector<byte>(magic.begin(),magic.end()), buffer );
+    PackValue( version, buffer );
+    PackValue( Int(sizeof(Int)), buffer );
+    PackValues( vector<byte>(typeName.begin(),typeName.end()), buffer );
+}
+
+inline void UnpackHeader
+( const string& magic, Int version, const string& typeName,
+  const vector<byte>& buffer, size_t& pos )
+{
+    // Check the integer size before interpreting any length prefixes
+    if( buffer.size() < sizeof(Int)+magic.size() ||
+        UnpackValue<Int>( buffer, pos ) != Int(magic.size()) ||
+        string( reinterpret_cast<const char*>(&buffer[pos]),
+                magic.size() ) != magic )
+        RuntimeError
+        ("Not a ",magic," file or written with a different integer size");
+    pos += magic.size();
+    const Int fileVersion = UnpackValue<Int>( buffer, pos );
+    if( fileVersion != version )
+        RuntimeError
+        ("Unsupported ",magic," version ",fileVersion,
+         " (expected ",version,")");
+    const Int intSize = UnpackValue<Int>( buffer, pos );
+    if( intSize != Int(sizeof(Int)) )
+        RuntimeError("File was written with ",intSize,"-byte integers");
+    vector<byte> fileTypeBytes;
+    UnpackValues( buffer, pos, fileTypeBytes );
+    const string fileTypeName( fileTypeBytes.begin(), fileTypeBytes.end() );
+    if( fileTypeName != typeName )
+        RuntimeError
+        ("File was written for ",fileTypeName," rather than ",typeName);
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_PACK_HPP
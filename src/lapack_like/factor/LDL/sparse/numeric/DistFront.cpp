@@ -1360,6 +1360,65 @@ void DistFront<Field>::ComputeCommMeta
         ComputeRecvInds( info );
 }
 
+template<typename Field>
+InertiaType DistFront<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( !isHermitian )
+        LogicError("Inertia is only defined for Hermitian factorizations");
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    function<void(const DistFront<Field>&)> count =
+      [&]( const DistFront<Field>& front )
+      {
+        if( front.duplicate != nullptr )
+        {
+            const InertiaType leafInertia = front.duplicate->Inertia();
+            inertia.numPositive += leafInertia.numPositive;
+            inertia.numNegative += leafInertia.numNegative;
+            inertia.numZero += leafInertia.numZero;
+            return;
+        }
+        count( *front.child );
+        if( Unfactored(front.type) )
+            LogicError("Matrix has not yet been factored");
+        if( BlockFactorization(front.type) )
+            LogicError("Inertia requires an explicit (quasi-)diagonal");
+
+        // Every member of the front's team forms the front's inertia, but
+        // only the root of the team contributes it
+        const Grid& grid = front.diag.Grid();
+        DistMatrix<Field,STAR,STAR> diag_STAR_STAR( front.diag );
+        Matrix<Real> d;
+        Matrix<Field> dSub;
+        RealPart( diag_STAR_STAR.LockedMatrix(), d );
+        if( PivotedFactorization(front.type) )
+        {
+            DistMatrix<Field,STAR,STAR> subdiag_STAR_STAR( front.subdiag );
+            dSub = subdiag_STAR_STAR.LockedMatrix();
+        }
+        else
+            Zeros( dSub, Max(d.Height()-1,0), 1 );
+        if( grid.Rank() == 0 )
+        {
+            const InertiaType frontInertia = ldl::Inertia( d, dSub );
+            inertia.numPositive += frontInertia.numPositive;
+            inertia.numNegative += frontInertia.numNegative;
+            inertia.numZero += frontInertia.numZero;
+        }
+      };
+    count( *this );
+
+    Int counts[3] =
+      { inertia.numPositive, inertia.numNegative, inertia.numZero };
+    mpi::AllReduce( counts, 3, diag.Grid().Comm() );
+    inertia.numPositive = counts[0];
+    inertia.numNegative = counts[1];
+    inertia.numZero = counts[2];
+    return inertia;
+}
+
 #define PROTO(Field) template struct DistFront<Field>;
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -13,6 +13,7 @@
 #include "./LowerSolve/Backward.hpp"
 #include "./LowerMultiply/Forward.hpp"
 #include "./LowerMultiply/Backward.hpp"
+#include "../Pack.hpp"
 
 namespace El {
 
@@ -43,6 +44,38 @@ void DiagonalScale
   const DistFront<Field>& front,
         DistMatrixNode<Field>& B );
 
+// The root of this process's sequential subtree
+template<typename Field>
+Front<Field>& LocalRoot( const DistFront<Field>& front )
+{
+    const DistFront<Field>* node = &front;
+    while( node->child != nullptr )
+        node = node->child.get();
+    return *node->duplicate;
+}
+
+// Hand a freshly-formed local subtree over to the store (if it exists)
+template<typename Field>
+void ReleaseLocalFronts( FrontStore<Field>* store, DistFront<Field>& front )
+{
+    if( store == nullptr )
+        return;
+    // Forget about the fronts which were just replaced
+    store->Clear();
+    store->ReleaseTree( LocalRoot(front) );
+}
+
+// The format of the files written by DistSparseLDLFactorization::Save
+const string distSaveMagic = "ElDistSparseLDL";
+const Int distSaveVersion = 1;
+
+inline string ProcessFilename( const string& filename, mpi::Comm comm )
+{
+    std::ostringstream os;
+    os << filename << "." << mpi::Rank(comm);
+    return os.str();
+}
+
 } // namespace ldl
 
 template<typename Field>
@@ -63,6 +96,7 @@ void DistSparseLDLFactorization<Field>::Initialize
     InvertMap( map_, inverseMap_ );
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    ldl::ReleaseLocalFronts( store_.get(), *front_ );
 
     initialized_ = true;
     factored_ = false;
@@ -85,6 +119,7 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
     InvertMap( map_, inverseMap_ );
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    ldl::ReleaseLocalFronts( store_.get(), *front_ );
 
     initialized_ = true;
     factored_ = false;
@@ -108,6 +143,7 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
     InvertMap( map_, inverseMap_ );
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    ldl::ReleaseLocalFronts( store_.get(), *front_ );
 
     initialized_ = true;
     factored_ = false;
@@ -128,7 +164,8 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), store_.get() );
     factored_ = true;
 
     // Convert the fronts from the initial factorization to the requested form
@@ -160,7 +197,72 @@ void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
     }
     front_->Pull
     ( ANew, map_, *separator_, *info_,
-      mappedSources_, mappedTargets_, columnOffsets_ );
+      mappedSources_, mappedTargets_, columnOffsets_,
+      front_->isHermitian );
+    ldl::ReleaseLocalFronts( store_.get(), *front_ );
+    factored_ = false;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Save( const string& filename ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Save()'");
+    const string processFilename =
+      ldl::ProcessFilename( filename, info_->Grid().Comm() );
+    std::ofstream file( processFilename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",processFilename," for writing");
+
+    vector<byte> buffer;
+    ldl::PackHeader
+    ( ldl::distSaveMagic, ldl::distSaveVersion, TypeName<Field>(), buffer );
+    ldl::WriteBlock( file, buffer );
+
+    ldl::SerializeSymbolic( *separator_, *info_, buffer );
+    ldl::WriteBlock( file, buffer );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Load
+( const string& filename,
+  const DistSparseMatrix<Field>& A,
+        bool hermitian,
+  const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const string processFilename =
+      ldl::ProcessFilename( filename, grid.Comm() );
+    std::ifstream file( processFilename.c_str(), std::ios::binary );
+    // Avoid a deadlock in the collective deserialization if only some of the
+    // files are missing
+    const int opened = file.is_open();
+    if( !mpi::AllReduce( opened, mpi::MIN, grid.Comm() ) )
+        RuntimeError("Could not open all of the files ",filename,".<rank>");
+
+    vector<byte> buffer;
+    ldl::ReadBlock( file, buffer );
+    size_t pos = 0;
+    ldl::UnpackHeader
+    ( ldl::distSaveMagic, ldl::distSaveVersion, TypeName<Field>(),
+      buffer, pos );
+
+    ldl::ReadBlock( file, buffer );
+    info_.reset( new ldl::DistNodeInfo(grid) );
+    separator_.reset( new ldl::DistSeparator );
+    ldl::DeserializeSymbolic
+    ( buffer, grid, map_, *separator_, *info_, bisectCtrl.storeFactRecvInds );
+    if( map_.NumSources() != A.Height() )
+        LogicError("Saved analysis was for a different matrix size");
+    InvertMap( map_, inverseMap_ );
+    front_.reset
+    ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    ldl::ReleaseLocalFronts( store_.get(), *front_ );
+    formedPullMetadata_ = false;
+
+    initialized_ = true;
     factored_ = false;
 }
 
@@ -352,9 +454,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -365,9 +468,10 @@ void DistSparseLDLFactorization<Field>::SolveAgainstL
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
     if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+        ldl::LowerForwardSolve( *info_, *front_, B, store_.get() );
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+        ldl::LowerBackwardSolve
+        ( *info_, *front_, B, orientation==ADJOINT, store_.get() );
 }
 
 template<typename Field>
@@ -398,10 +502,14 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( store_ != nullptr )
+        store_->AcquireTree( ldl::LocalRoot(*front_) );
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
         ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    if( store_ != nullptr )
+        store_->ReleaseTree( ldl::LocalRoot(*front_) );
 }
 
 template<typename Field>
@@ -411,10 +519,14 @@ void DistSparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( store_ != nullptr )
+        store_->AcquireTree( ldl::LocalRoot(*front_) );
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
         ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    if( store_ != nullptr )
+        store_->ReleaseTree( ldl::LocalRoot(*front_) );
 }
 
 template<typename Field>
@@ -527,6 +639,42 @@ void DistSparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetOutOfCore
+( const string& scratchDir, size_t maxResidentBytes )
+{
+    EL_DEBUG_CSE
+    SetInCore();
+    store_.reset( new ldl::FrontStore<Field>(scratchDir,maxResidentBytes) );
+    if( initialized_ )
+        store_->ReleaseTree( ldl::LocalRoot(*front_) );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetInCore()
+{
+    EL_DEBUG_CSE
+    if( store_ == nullptr )
+        return;
+    if( initialized_ )
+        store_->AcquireTree( ldl::LocalRoot(*front_) );
+    store_.reset();
+}
+
+template<typename Field>
+bool DistSparseLDLFactorization<Field>::OutOfCore() const
+{ return store_ != nullptr; }
+
+template<typename Field>
+const ldl::FrontStore<Field>&
+DistSparseLDLFactorization<Field>::FrontStore() const
+{
+    EL_DEBUG_CSE
+    if( store_ == nullptr )
+        LogicError("Out-of-core mode has not been enabled");
+    return *store_;
+}
+
 template<typename Field>
 bool DistSparseLDLFactorization<Field>::Factored() const
 { return factored_; }
@@ -578,6 +726,15 @@ double DistSparseLDLFactorization<Field>::LocalSolveGFlops( Int numRHS ) const
     return front_->LocalSolveGFlops( numRHS );
 }
 
+template<typename Field>
+InertiaType DistSparseLDLFactorization<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must factor before calling 'Inertia()'");
+    return front_->Inertia();
+}
+
 template<typename Field>
 ldl::DistFront<Field>& DistSparseLDLFactorization<Field>::Front()
 {
@@ -49,10 +49,11 @@ Front<Field>::Front
 ( const SparseMatrix<Field>& A,
   const vector<Int>& reordering,
   const NodeInfo& info,
-  bool conjugate )
+  bool conjugate,
+  FrontStore<Field>* store )
 {
     EL_DEBUG_CSE
-    Pull( A, reordering, info, conjugate );
+    Pull( A, reordering, info, conjugate, store );
 }
 
 template<typename Field>
@@ -63,7 +64,8 @@ void Front<Field>::Pull
 ( const SparseMatrix<Field>& A,
   const vector<Int>& reordering,
   const NodeInfo& rootInfo,
-  bool conjugate )
+  bool conjugate,
+  FrontStore<Field>* store )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -72,6 +74,10 @@ void Front<Field>::Pull
     )
     type = SYMM_2D;
     isHermitian = conjugate;
+    // The existing fronts are about to be replaced
+    if( store != nullptr )
+        store->Clear();
+    spilled = false;
 
     // Invert the reordering
     const Int n = reordering.size();
@@ -202,6 +208,8 @@ void Front<Field>::Pull
                 }
             }
         }
+        if( store != nullptr )
+            store->Release( front );
       };
     pull( rootInfo, *this );
 }
@@ -243,6 +251,10 @@ void Front<Field>::PullUpdate
         {
             LogicError("Sparse leaves not yet handled in Front::PullUpdate");
         }
+        else if( front.spilled )
+        {
+            LogicError("Spilled fronts not yet handled in Front::PullUpdate");
+        }
         else
         {
             for( Int t=0; t<node.size; ++t )
@@ -306,7 +318,7 @@ void Front<Field>::Push
       {
           for( const auto& child : front.children )
               countLower( *child );
-          const Int nodeSize = front.LDense.Width();
+          const Int nodeSize = front.DenseWidth();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
       };
@@ -321,6 +333,8 @@ void Front<Field>::Push
         for( Int c=0; c<numChildren; ++c )
             push( *node.children[c], *front.children[c] );
 
+        if( front.spilled )
+            LogicError("Cannot push a front which has been spilled to disk");
         const Int lowerSize = node.lowerStruct.size();
         if( front.sparseLeaf )
         {
@@ -420,7 +434,7 @@ void Front<Field>::Unpack
       {
           for( const auto& child : front.children )
               countLower( *child );
-          const Int nodeSize = front.LDense.Width();
+          const Int nodeSize = front.DenseWidth();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
       };
@@ -438,6 +452,8 @@ void Front<Field>::Unpack
             PopIndent();
         }
 
+        if( front.spilled )
+            LogicError("Cannot push a front which has been spilled to disk");
         const Int lowerSize = node.lowerStruct.size();
         if( front.sparseLeaf )
         {
@@ -523,6 +539,8 @@ template<typename Field>
 const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
 {
     EL_DEBUG_CSE
+    if( front.spilled )
+        LogicError("Cannot copy a front which has been spilled to disk");
     isHermitian = front.isHermitian;
     sparseLeaf = front.sparseLeaf;
     type = front.type;
@@ -550,7 +568,15 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
 
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{ return sparseLeaf ? DenseHeight()+DenseWidth() : DenseHeight(); }
+
+template<typename Field>
+Int Front<Field>::DenseHeight() const
+{ return spilled ? spilledHeight : LDense.Height(); }
+
+template<typename Field>
+Int Front<Field>::DenseWidth() const
+{ return spilled ? spilledWidth : LDense.Width(); }
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -579,12 +605,12 @@ Int Front<Field>::NumEntries() const
             }
 
             // Count the connectivity
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
         }
         else
         {
             // Add in L
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -620,7 +646,7 @@ Int Front<Field>::NumTopLeftEntries() const
         }
         else
         {
-            const Int n = front.LDense.Width();
+            const Int n = front.DenseWidth();
             numEntries += n*n;
         }
       };
@@ -638,8 +664,8 @@ Int Front<Field>::NumBottomLeftEntries() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
+        const Int m = front.DenseHeight();
+        const Int n = front.DenseWidth();
         if( front.sparseLeaf )
         {
             numEntries += m*n;
@@ -663,8 +689,8 @@ double Front<Field>::FactorGFlops() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight();
+        const double n = front.DenseWidth();
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
@@ -704,8 +730,8 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight();
+        const double n = front.DenseWidth();
         double realFrontFlops = 0;
         if( front.sparseLeaf )
         {
@@ -726,6 +752,41 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
     return gflops;
 }
 
+template<typename Field>
+InertiaType Front<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( !isHermitian )
+        LogicError("Inertia is only defined for Hermitian factorizations");
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    function<void(const Front<Field>&)> count =
+      [&]( const Front<Field>& front )
+      {
+        for( const auto& child : front.children )
+            count( *child );
+        if( Unfactored(front.type) )
+            LogicError("Matrix has not yet been factored");
+        if( BlockFactorization(front.type) )
+            LogicError("Inertia requires an explicit (quasi-)diagonal");
+
+        Matrix<Real> d;
+        Matrix<Field> dSub;
+        RealPart( front.diag, d );
+        if( PivotedFactorization(front.type) )
+            dSub = front.subdiag;
+        else
+            Zeros( dSub, Max(d.Height()-1,0), 1 );
+        const InertiaType frontInertia = ldl::Inertia( d, dSub );
+        inertia.numPositive += frontInertia.numPositive;
+        inertia.numNegative += frontInertia.numNegative;
+        inertia.numZero += frontInertia.numZero;
+      };
+    count( *this );
+    return inertia;
+}
+
 #define PROTO(Field) template struct Front<Field>;
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,426 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Distinguishes the files of the stores within a single process
+std::atomic<Int> numStoresCreated(0);
+
+template<typename Field,typename=EnableIf<IsPacked<Field>>>
+void PackDense( const Matrix<Field>& L, vector<byte>& packed )
+{
+    const Int height = L.Height();
+    const Int width = L.Width();
+    packed.resize( height*width*sizeof(Field) );
+    Field* packedBuf = reinterpret_cast<Field*>(packed.data());
+    for( Int j=0; j<width; ++j )
+        MemCopy( &packedBuf[j*height], L.LockedBuffer(0,j), height );
+}
+
+template<typename Field,typename=DisableIf<IsPacked<Field>>,typename=void>
+void PackDense( const Matrix<Field>& L, vector<byte>& packed )
+{
+    const Int height = L.Height();
+    const Int width = L.Width();
+    vector<Field> contiguous( height*width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            contiguous[i+j*height] = L(i,j);
+    Serialize( height*width, contiguous.data(), packed );
+}
+
+template<typename Field,typename=EnableIf<IsPacked<Field>>>
+void UnpackDense( const vector<byte>& packed, Matrix<Field>& L )
+{
+    const Int height = L.Height();
+    const Int width = L.Width();
+    if( packed.size() != size_t(height*width)*sizeof(Field) )
+        RuntimeError("Spilled front had an unexpected size");
+    const Field* packedBuf = reinterpret_cast<const Field*>(packed.data());
+    for( Int j=0; j<width; ++j )
+        MemCopy( L.Buffer(0,j), &packedBuf[j*height], height );
+}
+
+template<typename Field,typename=DisableIf<IsPacked<Field>>,typename=void>
+void UnpackDense( const vector<byte>& packed, Matrix<Field>& L )
+{
+    const Int height = L.Height();
+    const Int width = L.Width();
+    vector<Field> contiguous( height*width );
+    Deserialize( height*width, packed, contiguous.data() );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            L(i,j) = contiguous[i+j*height];
+}
+
+// These are run asynchronously and so do not touch the call stack
+void WriteFile( const string& filename, const vector<byte>& packed )
+{
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename," for writing");
+    file.write( reinterpret_cast<const char*>(packed.data()), packed.size() );
+    if( !file.good() )
+        RuntimeError("Could not write ",packed.size()," bytes to ",filename);
+}
+
+void ReadFile( const string& filename, size_t numBytes, vector<byte>& packed )
+{
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename," for reading");
+    packed.resize( numBytes );
+    file.read( reinterpret_cast<char*>(packed.data()), numBytes );
+    if( !file.good() )
+        RuntimeError("Could not read ",numBytes," bytes from ",filename);
+}
+
+} // anonymous namespace
+
+template<typename Field>
+struct FrontStore<Field>::State
+{
+    string scratchDir;
+    string filePrefix;
+    size_t maxResidentBytes;
+    Int numFiles=0;
+
+    struct Record
+    {
+        string filename;
+        // The number of bytes of LDense (if resident) and of its packed form
+        size_t numResidentBytes=0, numPackedBytes=0;
+        // Whether the front is currently held by a caller of Acquire
+        bool acquired=false;
+        // Whether the file contains an up-to-date copy of LDense
+        bool onDisk=false;
+        // The packed data of a write or prefetch which has not yet been
+        // retired, along with the asynchronous operation
+        shared_ptr<vector<byte>> buffer;
+        std::shared_future<void> io;
+        bool prefetching=false;
+        // The position in the queue of released, resident fronts
+        bool queued=false;
+        typename std::list<Front<Field>*>::iterator position;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<const Front<Field>*,Record> records;
+    // The released, resident fronts in the order in which they were released
+    std::list<Front<Field>*> queue;
+    // The records with writes in flight, from oldest to newest
+    std::deque<Record*> writes;
+
+    size_t numResidentBytes=0, numInFlightBytes=0;
+    size_t numBytesWritten=0, numBytesRead=0;
+
+    // Wait for any write or prefetch of the record and release its buffer
+    // (unless it holds prefetched data which is still wanted)
+    void Finish( Record& record, bool keepPrefetch=false )
+    {
+        if( !record.buffer )
+            return;
+        record.io.get();
+        if( keepPrefetch && record.prefetching )
+            return;
+        if( !record.prefetching )
+        {
+            for( auto it=writes.begin(); it!=writes.end(); ++it )
+            {
+                if( *it == &record )
+                {
+                    writes.erase( it );
+                    break;
+                }
+            }
+        }
+        numInFlightBytes -= record.buffer->size();
+        record.buffer.reset();
+        record.prefetching = false;
+    }
+
+    // Release the buffers of the writes which have already completed
+    void RetireWrites()
+    {
+        while( !writes.empty() )
+        {
+            Record& record = *writes.front();
+            if( record.io.wait_for(std::chrono::seconds(0)) !=
+                std::future_status::ready )
+                break;
+            Finish( record );
+        }
+    }
+
+    void Spill( Front<Field>& front, Record& record )
+    {
+        // The file might still be in the process of being written
+        Finish( record );
+        if( !record.onDisk )
+        {
+            record.buffer = std::make_shared<vector<byte>>();
+            PackDense( front.LDense, *record.buffer );
+            record.numPackedBytes = record.buffer->size();
+            auto buffer = record.buffer;
+            const string filename = record.filename;
+            record.io =
+              std::async
+              ( std::launch::async,
+                [buffer,filename]() { WriteFile( filename, *buffer ); } );
+            writes.push_back( &record );
+            numInFlightBytes += record.numPackedBytes;
+            numBytesWritten += record.numPackedBytes;
+            record.onDisk = true;
+        }
+        front.spilledHeight = front.LDense.Height();
+        front.spilledWidth = front.LDense.Width();
+        front.LDense.Empty();
+        front.spilled = true;
+        numResidentBytes -= record.numResidentBytes;
+        record.numResidentBytes = 0;
+        queue.erase( record.position );
+        record.queued = false;
+    }
+
+    void Load( Front<Field>& front, Record& record )
+    {
+        Finish( record, true );
+        vector<byte> packed;
+        if( record.buffer )
+        {
+            // Use the prefetched data
+            packed.swap( *record.buffer );
+            numInFlightBytes -= record.numPackedBytes;
+            record.buffer.reset();
+            record.prefetching = false;
+        }
+        else
+            ReadFile( record.filename, record.numPackedBytes, packed );
+        numBytesRead += record.numPackedBytes;
+
+        front.LDense.Resize( front.spilledHeight, front.spilledWidth );
+        UnpackDense( packed, front.LDense );
+        front.spilled = false;
+        record.numResidentBytes =
+          size_t(front.LDense.Height()*front.LDense.Width())*sizeof(Field);
+        numResidentBytes += record.numResidentBytes;
+    }
+
+    // Spill the least recently released fronts until they fit within three
+    // quarters of the bound, then wait for writes until those in flight fit
+    // within the remaining quarter
+    void Evict()
+    {
+        RetireWrites();
+        const size_t maxInFlightBytes = maxResidentBytes / 4;
+        const size_t maxQueuedBytes = maxResidentBytes - maxInFlightBytes;
+        while( numResidentBytes > maxQueuedBytes && !queue.empty() )
+        {
+            Front<Field>* front = queue.front();
+            Spill( *front, records[front] );
+        }
+        while( numInFlightBytes > maxInFlightBytes && !writes.empty() )
+            Finish( *writes.front() );
+    }
+
+    void RemoveFiles()
+    {
+        for( auto& entry : records )
+        {
+            Finish( entry.second );
+            if( entry.second.numPackedBytes > 0 )
+                std::remove( entry.second.filename.c_str() );
+        }
+        records.clear();
+        queue.clear();
+        writes.clear();
+        numResidentBytes = 0;
+        numInFlightBytes = 0;
+    }
+};
+
+template<typename Field>
+FrontStore<Field>::FrontStore
+( const string& scratchDir, size_t maxResidentBytes )
+: state_(new State)
+{
+    EL_DEBUG_CSE
+    state_->scratchDir = scratchDir;
+    state_->maxResidentBytes = maxResidentBytes;
+    std::ostringstream prefix;
+    prefix << scratchDir << "/el_front_" << mpi::Rank(mpi::COMM_WORLD) << "_"
+      << numStoresCreated++ << "_";
+    state_->filePrefix = prefix.str();
+}
+
+template<typename Field>
+FrontStore<Field>::~FrontStore()
+{
+    // Errors from pending writes cannot be reported from a destructor
+    try { Clear(); }
+    catch( ... ) { }
+}
+
+template<typename Field>
+void FrontStore<Field>::Clear()
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    state_->RemoveFiles();
+}
+
+template<typename Field>
+void FrontStore<Field>::Acquire( Front<Field>& front, bool modify )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    auto it = state_->records.find( &front );
+    if( it == state_->records.end() )
+        return;
+    auto& record = it->second;
+    if( front.spilled )
+        state_->Load( front, record );
+    else if( record.queued )
+    {
+        state_->queue.erase( record.position );
+        record.queued = false;
+    }
+    record.acquired = true;
+    if( modify )
+        record.onDisk = false;
+    state_->Evict();
+}
+
+template<typename Field>
+void FrontStore<Field>::Release( Front<Field>& front )
+{
+    EL_DEBUG_CSE
+    // The distributed front views this front's data
+    if( front.duplicate != nullptr || front.spilled )
+        return;
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    auto it = state_->records.find( &front );
+    if( it == state_->records.end() )
+    {
+        std::ostringstream filename;
+        filename << state_->filePrefix << state_->numFiles++ << ".bin";
+        it = state_->records.emplace( &front, typename State::Record() ).first;
+        it->second.filename = filename.str();
+    }
+    auto& record = it->second;
+    if( record.queued )
+        return;
+
+    state_->numResidentBytes -= record.numResidentBytes;
+    record.numResidentBytes =
+      size_t(front.LDense.Height()*front.LDense.Width())*sizeof(Field);
+    state_->numResidentBytes += record.numResidentBytes;
+    record.acquired = false;
+    record.queued = true;
+    record.position = state_->queue.insert( state_->queue.end(), &front );
+    state_->Evict();
+}
+
+template<typename Field>
+void FrontStore<Field>::Prefetch( const Front<Field>& front )
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    auto it = state_->records.find( &front );
+    if( it == state_->records.end() || !front.spilled )
+        return;
+    auto& record = it->second;
+    if( record.buffer )
+        return;
+    // Prefetches are only issued if they fit within the bound
+    const size_t numBytes = record.numPackedBytes;
+    if( state_->numResidentBytes+state_->numInFlightBytes+numBytes >
+        state_->maxResidentBytes )
+        return;
+    record.buffer = std::make_shared<vector<byte>>();
+    record.prefetching = true;
+    auto buffer = record.buffer;
+    const string filename = record.filename;
+    record.io =
+      std::async
+      ( std::launch::async,
+        [buffer,filename,numBytes]()
+        { ReadFile( filename, numBytes, *buffer ); } );
+    state_->numInFlightBytes += numBytes;
+}
+
+template<typename Field>
+void FrontStore<Field>::AcquireTree( Front<Field>& root, bool modify )
+{
+    EL_DEBUG_CSE
+    for( auto& child : root.children )
+        AcquireTree( *child, modify );
+    Acquire( root, modify );
+}
+
+template<typename Field>
+void FrontStore<Field>::ReleaseTree( Front<Field>& root )
+{
+    EL_DEBUG_CSE
+    for( auto& child : root.children )
+        ReleaseTree( *child );
+    Release( root );
+}
+
+template<typename Field>
+const string& FrontStore<Field>::ScratchDirectory() const
+{ return state_->scratchDir; }
+
+template<typename Field>
+size_t FrontStore<Field>::MaxResidentBytes() const
+{ return state_->maxResidentBytes; }
+
+template<typename Field>
+size_t FrontStore<Field>::NumResidentBytes() const
+{
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    return state_->numResidentBytes;
+}
+
+template<typename Field>
+size_t FrontStore<Field>::NumBytesWritten() const
+{
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    return state_->numBytesWritten;
+}
+
+template<typename Field>
+size_t FrontStore<Field>::NumBytesRead() const
+{
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    return state_->numBytesRead;
+}
+
+#define PROTO(Field) template class FrontStore<Field>;
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
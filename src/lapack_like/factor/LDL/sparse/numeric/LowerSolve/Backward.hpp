@@ -21,15 +21,17 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_BACKWARD_HPP
 
 #include "./FrontBackward.hpp"
+#include "../Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
+// If 'recurse' is false, the children are left to be processed by the caller
 template<typename F> 
-inline void LowerBackwardSolve
+inline void LowerBackwardSolveNode
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X, bool conjugate )
+        MatrixNode<F>& X, bool conjugate, bool recurse=true )
 {
     EL_DEBUG_CSE
 
@@ -78,21 +80,84 @@ inline void LowerBackwardSolve
     else if( haveDupMatParent )
         dupMat->work.Empty();
 
-    for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+    if( recurse )
+        for( Int c=0; c<numChildren; ++c )
+            LowerBackwardSolveNode
+            ( *info.children[c], *front.children[c], *X.children[c],
+              conjugate );
+}
+
+template<typename F> 
+inline void LowerBackwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const int numThreads = NumTreeThreads();
+    if( numThreads == 1 || info.children.empty() )
+    {
+        LowerBackwardSolveNode( info, front, X, conjugate );
+        return;
+    }
+
+    TreeSchedule schedule( info, numThreads );
+    vector<const Front<F>*> fronts;
+    vector<MatrixNode<F>*> XNodes;
+    PostOrder<const Front<F>>( front, fronts );
+    PostOrder<MatrixNode<F>>( X, XNodes );
+    TopDownSweep
+    ( schedule,
+      [&]( Int i )
+      {
+          LowerBackwardSolveNode
+          ( *schedule.nodes[i], *fronts[i], *XNodes[i], conjugate, false );
+      } );
+}
+
+// Stream each front in from 'store' just before it is needed
+template<typename F> 
+inline void LowerBackwardSolve
+( const NodeInfo& info, 
+        Front<F>& front,
+        MatrixNode<F>& X, bool conjugate,
+        FrontStore<F>& store )
+{
+    EL_DEBUG_CSE
+    TreeSchedule schedule( info, NumTreeThreads() );
+    vector<Front<F>*> fronts;
+    vector<MatrixNode<F>*> XNodes;
+    PostOrder<Front<F>>( front, fronts );
+    PostOrder<MatrixNode<F>>( X, XNodes );
+    TopDownSweep
+    ( schedule,
+      [&]( Int i )
+      {
+          store.Acquire( *fronts[i] );
+          if( i > 0 )
+              store.Prefetch( *fronts[i-1] );
+          LowerBackwardSolveNode
+          ( *schedule.nodes[i], *fronts[i], *XNodes[i], conjugate, false );
+          store.Release( *fronts[i] );
+      } );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate )
+  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate,
+  FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
-        LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        if( store != nullptr )
+            LowerBackwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate,
+              *store );
+        else
+            LowerBackwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
         return;
     }
 
@@ -183,20 +248,27 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, store );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X, bool conjugate )
+        DistMatrixNode<F>& X, bool conjugate,
+        FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
-        LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        if( store != nullptr )
+            LowerBackwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate,
+              *store );
+        else
+            LowerBackwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
         return;
     }
 
@@ -291,7 +363,8 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, store );
 }
 
 } // namespace ldl
@@ -21,22 +21,26 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FORWARD_HPP
 
 #include "./FrontForward.hpp"
+#include "../Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
+// If 'recurse' is false, the children must have already been processed
 template<typename F> 
-void LowerForwardSolve
+void LowerForwardSolveNode
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+  bool recurse=true )
 {
     EL_DEBUG_CSE
 
     const Int numChildren = info.children.size();
-    for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    if( recurse )
+        for( Int c=0; c<numChildren; ++c )
+            LowerForwardSolveNode
+            ( *info.children[c], *front.children[c], *X.children[c] );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -74,11 +78,68 @@ void LowerForwardSolve
     X.matrix = WT;
 }
 
+template<typename F> 
+void LowerForwardSolve
+( const NodeInfo& info, 
+  const Front<F>& front,
+        MatrixNode<F>& X )
+{
+    EL_DEBUG_CSE
+    const int numThreads = NumTreeThreads();
+    if( numThreads == 1 || info.children.empty() )
+    {
+        LowerForwardSolveNode( info, front, X );
+        return;
+    }
+
+    TreeSchedule schedule( info, numThreads );
+    vector<const Front<F>*> fronts;
+    vector<MatrixNode<F>*> XNodes;
+    PostOrder<const Front<F>>( front, fronts );
+    PostOrder<MatrixNode<F>>( X, XNodes );
+    BottomUpSweep
+    ( schedule,
+      [&]( Int i )
+      {
+          LowerForwardSolveNode
+          ( *schedule.nodes[i], *fronts[i], *XNodes[i], false );
+      } );
+}
+
+// Stream each front in from 'store' just before it is needed
+template<typename F> 
+void LowerForwardSolve
+( const NodeInfo& info, 
+        Front<F>& front,
+        MatrixNode<F>& X,
+        FrontStore<F>& store )
+{
+    EL_DEBUG_CSE
+    TreeSchedule schedule( info, NumTreeThreads() );
+    vector<Front<F>*> fronts;
+    vector<MatrixNode<F>*> XNodes;
+    PostOrder<Front<F>>( front, fronts );
+    PostOrder<MatrixNode<F>>( X, XNodes );
+    const Int numNodes = fronts.size();
+    BottomUpSweep
+    ( schedule,
+      [&]( Int i )
+      {
+          store.Acquire( *fronts[i] );
+          if( i+1 < numNodes )
+              store.Prefetch( *fronts[i+1] );
+          LowerForwardSolveNode
+          ( *schedule.nodes[i], *fronts[i], *XNodes[i], false );
+          store.Release( *fronts[i] );
+      } );
+}
+
 template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+        FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -86,7 +147,12 @@ void LowerForwardSolve
     const Grid& grid = ( frontIs1D ? front.L1D.Grid() : front.L2D.Grid() );
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        if( store != nullptr )
+            LowerForwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate, *store );
+        else
+            LowerForwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -98,7 +164,7 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -183,7 +249,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+        FrontStore<F>* store=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -194,7 +261,12 @@ void LowerForwardSolve
     const Grid& grid = front.L2D.Grid();
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        if( store != nullptr )
+            LowerForwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate, *store );
+        else
+            LowerForwardSolve
+            ( *info.duplicate, *front.duplicate, *X.duplicate );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -206,7 +278,7 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, store );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
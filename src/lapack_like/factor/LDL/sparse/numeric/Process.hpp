@@ -24,13 +24,20 @@
 #define EL_LDL_PROCESS_HPP
 
 #include "./ProcessFront.hpp"
+#include "./Schedule.hpp"
 
 namespace El {
 namespace ldl {
 
+// Factor a front after adding in the updates from its children, which are
+// first recursively processed if 'recurse' is true (and must otherwise have
+// already been processed)
 template<typename Field>
-void Process
-( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+void ProcessNode
+( const NodeInfo& info,
+  Front<Field>& front,
+  LDLFrontType factorType,
+  bool recurse=true )
 {
     EL_DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
@@ -123,7 +130,9 @@ void Process
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            if( recurse )
+                ProcessNode
+                ( *info.children[c], *front.children[c], factorType );
 
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
@@ -146,9 +155,46 @@ void Process
     }
 }
 
+// If 'store' is non-null, each front is brought into memory just before it is
+// factored and handed back to the store immediately afterwards
+template<typename Field>
+void Process
+( const NodeInfo& info,
+  Front<Field>& front,
+  LDLFrontType factorType,
+  FrontStore<Field>* store=nullptr )
+{
+    EL_DEBUG_CSE
+    const int numThreads = NumTreeThreads();
+    if( store == nullptr && (numThreads == 1 || info.children.empty()) )
+    {
+        ProcessNode( info, front, factorType );
+        return;
+    }
+
+    // Factor the small subtrees concurrently and then the large fronts near
+    // the root one at a time
+    TreeSchedule schedule( info, numThreads );
+    vector<Front<Field>*> fronts;
+    PostOrder<Front<Field>>( front, fronts );
+    BottomUpSweep
+    ( schedule,
+      [&]( Int i )
+      {
+          if( store != nullptr )
+              store->Acquire( *fronts[i], true );
+          ProcessNode( *schedule.nodes[i], *fronts[i], factorType, false );
+          if( store != nullptr )
+              store->Release( *fronts[i] );
+      } );
+}
+
 template<typename Field>
 void Process
-( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
+( const DistNodeInfo& info,
+  DistFront<Field>& front,
+  LDLFrontType factorType,
+  FrontStore<Field>* store=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -158,7 +204,7 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, store );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -179,7 +225,7 @@ void Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, store );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -0,0 +1,248 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_SCHEDULE_HPP
+#define EL_LDL_SCHEDULE_HPP
+
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace El {
+namespace ldl {
+
+// Flatten the tree rooted at 'node' into post-order (children before their
+// parents), returning the index of 'node'. The NodeInfo, Front, and
+// MatrixNode trees all share the same shape, and so their flattenings line up.
+template<typename Node>
+Int PostOrder( Node& node, vector<Node*>& nodes, vector<Int>& parents )
+{
+    const Int numChildren = node.children.size();
+    vector<Int> childIndices(numChildren);
+    for( Int c=0; c<numChildren; ++c )
+        childIndices[c] = PostOrder<Node>( *node.children[c], nodes, parents );
+    const Int index = nodes.size();
+    nodes.push_back( &node );
+    parents.push_back( -1 );
+    for( Int c=0; c<numChildren; ++c )
+        parents[childIndices[c]] = index;
+    return index;
+}
+
+template<typename Node>
+void PostOrder( Node& root, vector<Node*>& nodes )
+{
+    vector<Int> parents;
+    PostOrder<Node>( root, nodes, parents );
+}
+
+// A rough count of the flops required to factor a front
+inline double FrontWork( const NodeInfo& info )
+{
+    const double n = info.size;
+    const double m = info.lowerStruct.size();
+    return n*n*n/3 + n*n*m + n*m*m;
+}
+
+// A partition of a sequential elimination tree into the subtrees near the
+// leaves, each of which is small enough to be handled by a single thread,
+// and the remaining large fronts near the root, which are handled one at a
+// time with a threaded BLAS.
+struct TreeSchedule
+{
+    // The nodes in post-order
+    vector<const NodeInfo*> nodes;
+    vector<Int> parents;
+    vector<vector<Int>> children;
+    // Whether or not each node lies within one of the small subtrees
+    vector<bool> inSubtree;
+
+    TreeSchedule( const NodeInfo& root, int numThreads )
+    {
+        EL_DEBUG_CSE
+        PostOrder<const NodeInfo>( root, nodes, parents );
+        const Int numNodes = nodes.size();
+        children.resize( numNodes );
+        vector<double> subtreeWork(numNodes);
+        for( Int i=0; i<numNodes; ++i )
+        {
+            subtreeWork[i] += FrontWork( *nodes[i] );
+            if( parents[i] >= 0 )
+            {
+                subtreeWork[parents[i]] += subtreeWork[i];
+                children[parents[i]].push_back( i );
+            }
+        }
+
+        // Since the subtree work is monotonic in the height of the node, the
+        // set of nodes whose subtrees fall beneath the threshold is closed
+        // under taking descendants. A few subtrees per thread leaves enough
+        // slack for balancing the load dynamically.
+        inSubtree.resize( numNodes, false );
+        if( numThreads > 1 && numNodes > 1 )
+        {
+            const double threshold = subtreeWork.back() / (2*numThreads);
+            for( Int i=0; i<numNodes; ++i )
+                inSubtree[i] = ( subtreeWork[i] <= threshold );
+        }
+    }
+};
+
+// Call 'processNode(i)' for each node index such that every node is
+// processed after all of its children.
+//
+// The small subtrees are handled in parallel by maintaining the number of
+// unprocessed children of each node: a node is pushed onto a shared stack of
+// ready nodes once its count reaches zero, and idle threads pop from the top
+// of the stack (so that each thread tends to continue up the subtree whose
+// data it just touched).
+template<typename Function>
+void BottomUpSweep( const TreeSchedule& schedule, Function processNode )
+{
+    EL_DEBUG_CSE
+    const Int numNodes = schedule.nodes.size();
+#ifdef EL_HYBRID
+    vector<Int> numPending(numNodes,0), ready;
+    Int numRemaining = 0;
+    for( Int i=0; i<numNodes; ++i )
+    {
+        if( !schedule.inSubtree[i] )
+            continue;
+        ++numRemaining;
+        numPending[i] = schedule.children[i].size();
+        if( numPending[i] == 0 )
+            ready.push_back( i );
+    }
+    if( numRemaining > 0 )
+    {
+        std::mutex mutex;
+        std::exception_ptr exception;
+        #pragma omp parallel
+        {
+            while( true )
+            {
+                Int i = -1;
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    if( numRemaining == 0 || exception )
+                        break;
+                    if( !ready.empty() )
+                    {
+                        i = ready.back();
+                        ready.pop_back();
+                    }
+                }
+                if( i < 0 )
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                try { processNode( i ); }
+                catch( ... )
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    exception = std::current_exception();
+                    break;
+                }
+                std::lock_guard<std::mutex> guard(mutex);
+                --numRemaining;
+                const Int parent = schedule.parents[i];
+                if( parent >= 0 && schedule.inSubtree[parent] &&
+                    --numPending[parent] == 0 )
+                    ready.push_back( parent );
+            }
+        }
+        if( exception )
+            std::rethrow_exception( exception );
+    }
+#endif
+    for( Int i=0; i<numNodes; ++i )
+        if( !schedule.inSubtree[i] )
+            processNode( i );
+}
+
+// Call 'processNode(i)' for each node index such that every node is
+// processed before any of its children.
+template<typename Function>
+void TopDownSweep( const TreeSchedule& schedule, Function processNode )
+{
+    EL_DEBUG_CSE
+    const Int numNodes = schedule.nodes.size();
+    // The reverse of a post-ordering visits parents before their children
+    for( Int i=numNodes-1; i>=0; --i )
+        if( !schedule.inSubtree[i] )
+            processNode( i );
+#ifdef EL_HYBRID
+    vector<Int> ready;
+    Int numRemaining = 0;
+    for( Int i=0; i<numNodes; ++i )
+    {
+        if( !schedule.inSubtree[i] )
+            continue;
+        ++numRemaining;
+        const Int parent = schedule.parents[i];
+        if( parent < 0 || !schedule.inSubtree[parent] )
+            ready.push_back( i );
+    }
+    if( numRemaining > 0 )
+    {
+        std::mutex mutex;
+        std::exception_ptr exception;
+        #pragma omp parallel
+        {
+            while( true )
+            {
+                Int i = -1;
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    if( numRemaining == 0 || exception )
+                        break;
+                    if( !ready.empty() )
+                    {
+                        i = ready.back();
+                        ready.pop_back();
+                    }
+                }
+                if( i < 0 )
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                try { processNode( i ); }
+                catch( ... )
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    exception = std::current_exception();
+                    break;
+                }
+                std::lock_guard<std::mutex> guard(mutex);
+                --numRemaining;
+                for( const Int child : schedule.children[i] )
+                    ready.push_back( child );
+            }
+        }
+        if( exception )
+            std::rethrow_exception( exception );
+    }
+#endif
+}
+
+// Whether the sweeps over a sequential tree should be multithreaded
+inline int NumTreeThreads()
+{
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+        return omp_get_max_threads();
+#endif
+    return 1;
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_SCHEDULE_HPP
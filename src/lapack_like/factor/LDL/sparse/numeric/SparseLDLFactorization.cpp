@@ -13,6 +13,7 @@
 #include "./LowerSolve/Backward.hpp"
 #include "./LowerMultiply/Forward.hpp"
 #include "./LowerMultiply/Backward.hpp"
+#include "../Pack.hpp"
 
 namespace El {
 
@@ -33,6 +34,82 @@ void DiagonalScale
   const Front<Field>& front,
         MatrixNode<Field>& B );
 
+// The format of the files written by SparseLDLFactorization::Save
+const string saveMagic = "ElSparseLDL";
+const Int saveVersion = 1;
+
+template<typename Field>
+void PackFront( const Front<Field>& front, vector<byte>& buffer )
+{
+    PackValue( Int(front.isHermitian), buffer );
+    PackValue( Int(front.type), buffer );
+    PackValue( Int(front.sparseLeaf), buffer );
+    PackMatrix( front.LDense, buffer );
+    if( front.sparseLeaf )
+    {
+        const auto& LSparse = front.LSparse;
+        const Int numSources = LSparse.Height();
+        const Int numEntries = LSparse.NumEntries();
+        PackValue( numSources, buffer );
+        PackValue( numEntries, buffer );
+        PackFields( numEntries, LSparse.LockedSourceBuffer(), buffer );
+        PackFields( numEntries, LSparse.LockedTargetBuffer(), buffer );
+        PackFields( numSources+1, LSparse.LockedOffsetBuffer(), buffer );
+        PackFields( numEntries, LSparse.LockedValueBuffer(), buffer );
+    }
+    PackMatrix( front.diag, buffer );
+    PackMatrix( front.subdiag, buffer );
+    Matrix<Int> p;
+    front.p.ExplicitVector( p );
+    PackMatrix( p, buffer );
+}
+
+template<typename Field>
+void UnpackFront( const vector<byte>& buffer, Front<Field>& front )
+{
+    size_t pos = 0;
+    front.isHermitian = UnpackValue<Int>( buffer, pos );
+    front.type = static_cast<LDLFrontType>( UnpackValue<Int>( buffer, pos ) );
+    front.sparseLeaf = UnpackValue<Int>( buffer, pos );
+    UnpackMatrix( buffer, pos, front.LDense );
+    if( front.sparseLeaf )
+    {
+        auto& LSparse = front.LSparse;
+        const Int numSources = UnpackValue<Int>( buffer, pos );
+        const Int numEntries = UnpackValue<Int>( buffer, pos );
+        if( numSources < 0 || numEntries < 0 )
+            RuntimeError("Invalid sparse front");
+        Zeros( LSparse, numSources, numSources );
+        LSparse.ForceNumEntries( numEntries );
+        UnpackFields( numEntries, buffer, pos, LSparse.SourceBuffer() );
+        UnpackFields( numEntries, buffer, pos, LSparse.TargetBuffer() );
+        UnpackFields( numSources+1, buffer, pos, LSparse.OffsetBuffer() );
+        UnpackFields( numEntries, buffer, pos, LSparse.ValueBuffer() );
+        LSparse.ForceConsistency();
+    }
+    UnpackMatrix( buffer, pos, front.diag );
+    UnpackMatrix( buffer, pos, front.subdiag );
+    Matrix<Int> p;
+    UnpackMatrix( buffer, pos, p );
+    const Int n = p.Height();
+    front.p.MakeIdentity( n );
+    for( Int i=0; i<n; ++i )
+        front.p.SetImage( p(i), i );
+    if( pos != buffer.size() )
+        RuntimeError("Front had trailing data");
+}
+
+// Give 'front' the same shape as the tree rooted at 'info'
+template<typename Field>
+void BuildFrontTree( const NodeInfo& info, Front<Field>& front )
+{
+    for( const auto& childInfo : info.children )
+    {
+        front.children.emplace_back( new Front<Field>(&front) );
+        BuildFrontTree( *childInfo, *front.children.back() );
+    }
+}
+
 } // namespace ldl
 
 template<typename Field>
@@ -51,7 +128,8 @@ void SparseLDLFactorization<Field>::Initialize
     ldl::NestedDissection
     ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    front_.reset
+    ( new ldl::Front<Field>(A,map_,*info_,hermitian,store_.get()) );
 
     initialized_ = true;
     factored_ = false;
@@ -72,7 +150,8 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
     ( gridDim0, gridDim1, 1, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    front_.reset
+    ( new ldl::Front<Field>(A,map_,*info_,hermitian,store_.get()) );
 
     initialized_ = true;
     factored_ = false;
@@ -94,7 +173,8 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
     ( gridDim0, gridDim1, gridDim2, A.LockedGraph(),
       map_, *separator_, *info_, bisectCtrl.cutoff );
     InvertMap( map_, inverseMap_ );
-    front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
+    front_.reset
+    ( new ldl::Front<Field>(A,map_,*info_,hermitian,store_.get()) );
 
     initialized_ = true;
     factored_ = false;
@@ -115,7 +195,8 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), store_.get() );
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -138,7 +219,118 @@ void SparseLDLFactorization<Field>::ChangeNonzeroValues
     EL_DEBUG_CSE
     if( !initialized_ )
         LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
-    front_->Pull( ANew, map_, *info_ );
+    front_->Pull( ANew, map_, *info_, front_->isHermitian, store_.get() );
+    factored_ = false;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Save( const string& filename ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Save()'");
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename," for writing");
+
+    vector<byte> buffer;
+    ldl::PackHeader
+    ( ldl::saveMagic, ldl::saveVersion, TypeName<Field>(), buffer );
+    ldl::PackValue( Int(factored_), buffer );
+    ldl::WriteBlock( file, buffer );
+
+    ldl::SerializeSymbolic( *separator_, *info_, buffer );
+    ldl::WriteBlock( file, buffer );
+
+    if( factored_ )
+    {
+        // Each front is written as a separate block (and, if the fronts are
+        // out of core, only one of them is brought back into memory at a time)
+        vector<ldl::Front<Field>*> fronts;
+        ldl::PostOrder( *front_, fronts );
+        for( auto front : fronts )
+        {
+            if( store_ != nullptr )
+                store_->Acquire( *front );
+            buffer.clear();
+            ldl::PackFront( *front, buffer );
+            if( store_ != nullptr )
+                store_->Release( *front );
+            ldl::WriteBlock( file, buffer );
+        }
+    }
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Load( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename," for reading");
+
+    vector<byte> buffer;
+    ldl::ReadBlock( file, buffer );
+    size_t pos = 0;
+    ldl::UnpackHeader
+    ( ldl::saveMagic, ldl::saveVersion, TypeName<Field>(), buffer, pos );
+    const bool hasFactors = ldl::UnpackValue<Int>( buffer, pos );
+    if( !hasFactors )
+        LogicError
+        (filename," does not contain factors; use Load(filename,A) instead");
+
+    ldl::ReadBlock( file, buffer );
+    info_.reset( new ldl::NodeInfo );
+    separator_.reset( new ldl::Separator );
+    ldl::DeserializeSymbolic( buffer, map_, *separator_, *info_ );
+    InvertMap( map_, inverseMap_ );
+
+    if( store_ != nullptr )
+        store_->Clear();
+    front_.reset( new ldl::Front<Field> );
+    ldl::BuildFrontTree( *info_, *front_ );
+    vector<ldl::Front<Field>*> fronts;
+    ldl::PostOrder( *front_, fronts );
+    for( auto front : fronts )
+    {
+        ldl::ReadBlock( file, buffer );
+        ldl::UnpackFront( buffer, *front );
+        if( store_ != nullptr )
+            store_->Release( *front );
+    }
+
+    initialized_ = true;
+    factored_ = true;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Load
+( const string& filename,
+  const SparseMatrix<Field>& A,
+        bool hermitian )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename," for reading");
+
+    vector<byte> buffer;
+    ldl::ReadBlock( file, buffer );
+    size_t pos = 0;
+    ldl::UnpackHeader
+    ( ldl::saveMagic, ldl::saveVersion, TypeName<Field>(), buffer, pos );
+
+    ldl::ReadBlock( file, buffer );
+    info_.reset( new ldl::NodeInfo );
+    separator_.reset( new ldl::Separator );
+    ldl::DeserializeSymbolic( buffer, map_, *separator_, *info_ );
+    if( Int(map_.size()) != A.Height() )
+        LogicError("Saved analysis was for a different matrix size");
+    InvertMap( map_, inverseMap_ );
+    front_.reset
+    ( new ldl::Front<Field>(A,map_,*info_,hermitian,store_.get()) );
+
+    initialized_ = true;
     factored_ = false;
 }
 
@@ -258,10 +450,21 @@ void SparseLDLFactorization<Field>::SolveAgainstL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before SolveAgainstL()");
-    if( orientation == NORMAL )
-        ldl::LowerForwardSolve( *info_, *front_, B );
+    if( store_ != nullptr )
+    {
+        if( orientation == NORMAL )
+            ldl::LowerForwardSolve( *info_, *front_, B, *store_ );
+        else
+            ldl::LowerBackwardSolve
+            ( *info_, *front_, B, orientation==ADJOINT, *store_ );
+    }
     else
-        ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+    {
+        if( orientation == NORMAL )
+            ldl::LowerForwardSolve( *info_, *front_, B );
+        else
+            ldl::LowerBackwardSolve( *info_, *front_, B, orientation==ADJOINT );
+    }
 }
 
 template<typename Field>
@@ -283,10 +486,14 @@ void SparseLDLFactorization<Field>::MultiplyWithL
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before MultiplyWithL()");
+    if( store_ != nullptr )
+        store_->AcquireTree( *front_ );
     if( orientation == NORMAL )
         ldl::LowerForwardMultiply( *info_, *front_, B );
     else
         ldl::LowerBackwardMultiply( *info_, *front_, B, orientation==ADJOINT );
+    if( store_ != nullptr )
+        store_->ReleaseTree( *front_ );
 }
 
 template<typename Field>
@@ -347,6 +554,41 @@ void SparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::SetOutOfCore
+( const string& scratchDir, size_t maxResidentBytes )
+{
+    EL_DEBUG_CSE
+    SetInCore();
+    store_.reset( new ldl::FrontStore<Field>(scratchDir,maxResidentBytes) );
+    if( initialized_ )
+        store_->ReleaseTree( *front_ );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetInCore()
+{
+    EL_DEBUG_CSE
+    if( store_ == nullptr )
+        return;
+    if( initialized_ )
+        store_->AcquireTree( *front_ );
+    store_.reset();
+}
+
+template<typename Field>
+bool SparseLDLFactorization<Field>::OutOfCore() const
+{ return store_ != nullptr; }
+
+template<typename Field>
+const ldl::FrontStore<Field>& SparseLDLFactorization<Field>::FrontStore() const
+{
+    EL_DEBUG_CSE
+    if( store_ == nullptr )
+        LogicError("Out-of-core mode has not been enabled");
+    return *store_;
+}
+
 template<typename Field>
 bool SparseLDLFactorization<Field>::Factored() const
 { return factored_; }
@@ -396,6 +638,15 @@ double SparseLDLFactorization<Field>::SolveGFlops( Int numRHS ) const
     return front_->SolveGFlops( numRHS );
 }
 
+template<typename Field>
+InertiaType SparseLDLFactorization<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must factor before calling 'Inertia()'");
+    return front_->Inertia();
+}
+
 template<typename Field>
 ldl::Front<Field>& SparseLDLFactorization<Field>::Front()
 {
@@ -0,0 +1,239 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <list>
+#include <mutex>
+
+#include "./Cache.hpp"
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+struct CacheEntry
+{
+    SymbolicKey key;
+    vector<byte> buffer;
+};
+
+// The most recently used entries are kept at the front of the list
+Int cacheCapacity = 4;
+Int numCacheHits = 0;
+std::list<CacheEntry> cache;
+std::mutex cacheMutex;
+
+// The finalizer of SplitMix64, which thoroughly mixes the bits of its input
+inline unsigned long long Mix( unsigned long long value )
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+inline void HashCombine( unsigned long long& hash, unsigned long long value )
+{ hash = Mix( hash ^ (value + 0x9e3779b97f4a7c15ULL + (hash<<6)) ); }
+
+void HashValues( unsigned long long& hash, const vector<Int>& values )
+{
+    HashCombine( hash, values.size() );
+    for( const auto& value : values )
+        HashCombine( hash, value );
+}
+
+// Append the parameters, the given sizes, and the offsets and targets of the
+// (local) graph to the description of a key
+void Describe
+( vector<Int>& description,
+  const vector<Int>& params,
+  const vector<Int>& sizes,
+  Int numSources,
+  Int numEdges,
+  const Int* offsetBuf,
+  const Int* targetBuf )
+{
+    description.reserve( params.size()+sizes.size()+numSources+numEdges+3 );
+    description.push_back( params.size() );
+    description.insert( description.end(), params.begin(), params.end() );
+    description.insert( description.end(), sizes.begin(), sizes.end() );
+    description.insert( description.end(), offsetBuf, offsetBuf+numSources+1 );
+    description.insert( description.end(), targetBuf, targetBuf+numEdges );
+}
+
+void Trim()
+{
+    while( Int(cache.size()) > cacheCapacity )
+        cache.pop_back();
+}
+
+bool Lookup( const SymbolicKey& key, vector<byte>& buffer )
+{
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    for( auto it=cache.begin(); it!=cache.end(); ++it )
+    {
+        if( it->key == key )
+        {
+            cache.splice( cache.begin(), cache, it );
+            buffer = cache.front().buffer;
+            return true;
+        }
+    }
+    return false;
+}
+
+void CountHit()
+{
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    ++numCacheHits;
+}
+
+void Insert( const SymbolicKey& key, vector<byte>& buffer )
+{
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    if( cacheCapacity <= 0 )
+        return;
+    for( auto it=cache.begin(); it!=cache.end(); ++it )
+    {
+        if( it->key == key )
+        {
+            cache.erase( it );
+            break;
+        }
+    }
+    cache.push_front( CacheEntry() );
+    cache.front().key = key;
+    cache.front().buffer.swap( buffer );
+    Trim();
+}
+
+} // anonymous namespace
+
+void SetSymbolicCacheCapacity( Int numEntries )
+{
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    cacheCapacity = Max( numEntries, Int(0) );
+    Trim();
+}
+
+Int SymbolicCacheCapacity()
+{ return cacheCapacity; }
+
+void ClearSymbolicCache()
+{
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    cache.clear();
+}
+
+Int NumSymbolicCacheHits()
+{
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    return numCacheHits;
+}
+
+SymbolicKey SymbolicCacheKey( const Graph& graph, const vector<Int>& params )
+{
+    EL_DEBUG_CSE
+    SymbolicKey key;
+    Describe
+    ( key.description, params, {graph.NumSources(),graph.NumTargets()},
+      graph.NumSources(), graph.NumEdges(), graph.LockedOffsetBuffer(),
+      graph.LockedTargetBuffer() );
+    HashValues( key.hash, key.description );
+    return key;
+}
+
+SymbolicKey SymbolicCacheKey
+( const DistGraph& graph, const vector<Int>& params )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    SymbolicKey key;
+    Describe
+    ( key.description, params,
+      {graph.NumSources(),graph.NumTargets(),graph.FirstLocalSource()},
+      graph.NumLocalSources(), graph.NumLocalEdges(),
+      graph.LockedOffsetBuffer(), graph.LockedTargetBuffer() );
+    unsigned long long localHash = 0;
+    HashValues( localHash, key.description );
+
+    // Each process caches its own portion of the analysis, which is only
+    // valid if the entire graph matches
+    const int commSize = grid.Size();
+    vector<unsigned long long> localHashes( commSize );
+    mpi::AllGather( &localHash, 1, localHashes.data(), 1, grid.Comm() );
+    for( const auto& processHash : localHashes )
+        HashCombine( key.hash, processHash );
+    HashCombine( key.hash, mpi::Rank(grid.Comm()) );
+    return key;
+}
+
+bool FindCachedSymbolic
+( const SymbolicKey& key,
+  vector<Int>& map,
+  Separator& rootSep,
+  NodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    vector<byte> buffer;
+    if( !Lookup( key, buffer ) )
+        return false;
+    DeserializeSymbolic( buffer, map, rootSep, rootInfo );
+    CountHit();
+    return true;
+}
+
+bool FindCachedSymbolic
+( const SymbolicKey& key,
+  const Grid& grid,
+  DistMap& map,
+  DistSeparator& rootSep,
+  DistNodeInfo& rootInfo,
+  bool storeFactRecvInds )
+{
+    EL_DEBUG_CSE
+    vector<byte> buffer;
+    const int found = Lookup( key, buffer );
+    if( !mpi::AllReduce( found, mpi::MIN, grid.Comm() ) )
+        return false;
+    DeserializeSymbolic
+    ( buffer, grid, map, rootSep, rootInfo, storeFactRecvInds );
+    CountHit();
+    return true;
+}
+
+void CacheSymbolic
+( const SymbolicKey& key, const Separator& rootSep, const NodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    if( cacheCapacity <= 0 )
+        return;
+    vector<byte> buffer;
+    SerializeSymbolic( rootSep, rootInfo, buffer );
+    Insert( key, buffer );
+}
+
+void CacheSymbolic
+( const SymbolicKey& key,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    if( cacheCapacity <= 0 )
+        return;
+    vector<byte> buffer;
+    SerializeSymbolic( rootSep, rootInfo, buffer );
+    Insert( key, buffer );
+}
+
+} // namespace ldl
+} // namespace El
@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_SYMBOLIC_CACHE_HPP
+#define EL_LDL_SYMBOLIC_CACHE_HPP
+
+namespace El {
+namespace ldl {
+
+// The key of a symbolic analysis combines the parameters of the reordering
+// with (this process's portion of) the graph. Lookups compare the hash first
+// and then verify the full description so that a hash collision cannot return
+// the analysis of a different graph.
+struct SymbolicKey
+{
+    unsigned long long hash=0;
+    vector<Int> description;
+};
+inline bool operator==( const SymbolicKey& a, const SymbolicKey& b )
+{ return a.hash == b.hash && a.description == b.description; }
+
+// The distributed version is collective, and its hash covers the entire graph
+// whereas its description only covers the local portion.
+SymbolicKey SymbolicCacheKey( const Graph& graph, const vector<Int>& params );
+SymbolicKey SymbolicCacheKey
+( const DistGraph& graph, const vector<Int>& params );
+
+// Restore (and re-analyze) a cached symbolic analysis, returning false if
+// there was none. The distributed version is collective and only succeeds if
+// every process found its portion of the analysis.
+bool FindCachedSymbolic
+( const SymbolicKey& key,
+  vector<Int>& map,
+  Separator& rootSep,
+  NodeInfo& rootInfo );
+bool FindCachedSymbolic
+( const SymbolicKey& key,
+  const Grid& grid,
+  DistMap& map,
+  DistSeparator& rootSep,
+  DistNodeInfo& rootInfo,
+  bool storeFactRecvInds );
+
+void CacheSymbolic
+( const SymbolicKey& key, const Separator& rootSep, const NodeInfo& rootInfo );
+void CacheSymbolic
+( const SymbolicKey& key,
+  const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo );
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_SYMBOLIC_CACHE_HPP
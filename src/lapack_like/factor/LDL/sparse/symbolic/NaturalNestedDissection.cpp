@@ -11,6 +11,8 @@
 #include <El.hpp>
 #include <set>
 
+#include "./Cache.hpp"
+
 namespace El {
 namespace ldl {
 
@@ -318,6 +320,10 @@ void NaturalNestedDissection
         Int cutoff )
 {
     EL_DEBUG_CSE
+    const SymbolicKey key =
+      SymbolicCacheKey( graph, {1,nx,ny,nz,cutoff} );
+    if( FindCachedSymbolic( key, map, sep, info ) )
+        return;
 
     const Int numSources = graph.NumSources();
     vector<Int> perm( numSources );
@@ -326,6 +332,7 @@ void NaturalNestedDissection
 
     NaturalNestedDissectionRecursion
     ( nx, ny, nz, graph, perm, sep, info, 0, cutoff );
+    CacheSymbolic( key, sep, info );
 
     // Construct the distributed reordering
     sep.BuildMap( map );
@@ -347,6 +354,11 @@ void NaturalNestedDissection
         bool storeFactRecvInds )
 {
     EL_DEBUG_CSE
+    const SymbolicKey key =
+      SymbolicCacheKey( graph, {1,nx,ny,nz,cutoff} );
+    if( FindCachedSymbolic
+        ( key, graph.Grid(), map, sep, info, storeFactRecvInds ) )
+        return;
 
     DistMap perm( graph.NumSources(), graph.Grid() );
     const Int firstLocalSource = perm.FirstLocalSource();
@@ -357,6 +369,7 @@ void NaturalNestedDissection
     info.SetRootGrid( graph.Grid() );
     NaturalNestedDissectionRecursion
     ( nx, ny, nz, graph, perm, sep, info, 0, cutoff );
+    CacheSymbolic( key, sep, info );
 
     // Construct the distributed reordering
     sep.BuildMap( info, map );
@@ -9,8 +9,11 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <exception>
 #include <set>
 
+#include "./Cache.hpp"
+
 namespace El {
 namespace ldl {
 
@@ -242,21 +245,94 @@ NestedDissectionRecursion
 
         sep.children.reserve( 2 );
         info.children.reserve( 2 );
-
-        sep.children.emplace_back( new Separator(&sep) );
-        info.children.emplace_back( new NodeInfo(&info) );
+        for( Int c=0; c<2; ++c )
+        {
+            sep.children.emplace_back( new Separator(&sep) );
+            info.children.emplace_back( new NodeInfo(&info) );
+        }
+        Separator& leftSep = *sep.children[0];
+        Separator& rightSep = *sep.children[1];
+        NodeInfo& leftInfo = *info.children[0];
+        NodeInfo& rightInfo = *info.children[1];
+
+#ifdef EL_HYBRID
+        // The native bisection is thread-safe, and so, within the parallel
+        // region opened by NestedDissectionTree, the left subtree can be
+        // handled by another thread when it is large enough to be worth it
+        if( omp_in_parallel() && NativeBisection(ctrl) &&
+            leftChildSize > 4*ctrl.cutoff )
+        {
+            std::exception_ptr leftException, rightException;
+            #pragma omp task \
+              shared(leftChild,leftPerm,leftSep,leftInfo,leftException)
+            {
+                try
+                {
+                    NestedDissectionRecursion
+                    ( leftChild, leftPerm, leftSep, leftInfo, off, ctrl );
+                }
+                catch( ... ) { leftException = std::current_exception(); }
+            }
+            // The task refers to this frame, so nothing may escape it before
+            // the task completes
+            try
+            {
+                NestedDissectionRecursion
+                ( rightChild, rightPerm, rightSep, rightInfo,
+                  off+leftChildSize, ctrl );
+            }
+            catch( ... ) { rightException = std::current_exception(); }
+            #pragma omp taskwait
+            if( leftException )
+                std::rethrow_exception( leftException );
+            if( rightException )
+                std::rethrow_exception( rightException );
+            return;
+        }
+#endif
         NestedDissectionRecursion
-        ( leftChild, leftPerm,
-          *sep.children.back(), *info.children.back(),
-          off, ctrl );
-
-        sep.children.emplace_back( new Separator(&sep) );
-        info.children.emplace_back( new NodeInfo(&info) );
+        ( leftChild, leftPerm, leftSep, leftInfo, off, ctrl );
         NestedDissectionRecursion
-        ( rightChild, rightPerm,
-          *sep.children.back(), *info.children.back(),
-          off+leftChildSize, ctrl );
+        ( rightChild, rightPerm, rightSep, rightInfo, off+leftChildSize,
+          ctrl );
+    }
+}
+
+// Run the sequential recursion, with the independent subtrees spread over the
+// available threads when the native bisection is in use
+inline void
+NestedDissectionTree
+( const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    if( NativeBisection(ctrl) && !omp_in_parallel() &&
+        omp_get_max_threads() > 1 && graph.NumSources() > 4*ctrl.cutoff )
+    {
+        std::exception_ptr exception;
+        #pragma omp parallel
+        {
+            #pragma omp single
+            {
+                try
+                {
+                    NestedDissectionRecursion
+                    ( graph, perm, sep, info, off, ctrl );
+                }
+                catch( ... ) { exception = std::current_exception(); }
+            }
+        }
+        if( exception )
+            std::rethrow_exception( exception );
+        return;
     }
+#endif
+    NestedDissectionRecursion( graph, perm, sep, info, off, ctrl );
 }
 
 inline void
@@ -375,7 +451,7 @@ NestedDissectionRecursion
 
         sep.duplicate.reset( new Separator(&sep) );
         info.duplicate.reset( new NodeInfo(&info) );
-        NestedDissectionRecursion
+        NestedDissectionTree
         ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off, ctrl );
 
         // Pull information up from the duplicates
@@ -395,13 +471,21 @@ void NestedDissection
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    const SymbolicKey key =
+      SymbolicCacheKey
+      ( graph,
+        {0,ctrl.sequential,ctrl.numDistSeps,ctrl.numSeqSeps,ctrl.cutoff,
+         ctrl.method} );
+    if( FindCachedSymbolic( key, map, sep, info ) )
+        return;
 
     const Int numSources = graph.NumSources();
     vector<Int> perm(numSources);
     for( Int s=0; s<numSources; ++s )
         perm[s] = s;
 
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    NestedDissectionTree( graph, perm, sep, info, 0, ctrl );
+    CacheSymbolic( key, sep, info );
 
     // Construct the distributed reordering
     sep.BuildMap( map );
@@ -419,6 +503,14 @@ void NestedDissection
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    const SymbolicKey key =
+      SymbolicCacheKey
+      ( graph,
+        {0,ctrl.sequential,ctrl.numDistSeps,ctrl.numSeqSeps,ctrl.cutoff,
+         ctrl.method} );
+    if( FindCachedSymbolic
+        ( key, graph.Grid(), map, sep, info, ctrl.storeFactRecvInds ) )
+        return;
 
     DistMap perm( graph.NumSources(), graph.Grid() );
     const Int firstLocalSource = perm.FirstLocalSource();
@@ -428,6 +520,7 @@ void NestedDissection
 
     info.SetRootGrid( graph.Grid() );
     NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    CacheSymbolic( key, sep, info );
 
     // Construct the distributed reordering
     sep.BuildMap( info, map );
@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../Pack.hpp"
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Only the output of the reordering (the "known before analysis" members) is
+// stored, in pre-order, since the remainder of the symbolic analysis is cheap
+// to recompute.
+
+void PackTree
+( const Separator& sep, const NodeInfo& info, vector<byte>& buffer )
+{
+    PackValue( sep.off, buffer );
+    PackValues( sep.inds, buffer );
+    PackValue( info.size, buffer );
+    PackValue( info.off, buffer );
+    PackValues( info.origLowerStruct, buffer );
+    PackValues( info.LOffsets, buffer );
+    PackValues( info.LParents, buffer );
+    const Int numChildren = info.children.size();
+    PackValue( numChildren, buffer );
+    for( Int c=0; c<numChildren; ++c )
+        PackTree( *sep.children[c], *info.children[c], buffer );
+}
+
+void UnpackTree
+( const vector<byte>& buffer, size_t& pos, Separator& sep, NodeInfo& info )
+{
+    sep.off = UnpackValue<Int>( buffer, pos );
+    UnpackValues( buffer, pos, sep.inds );
+    info.size = UnpackValue<Int>( buffer, pos );
+    info.off = UnpackValue<Int>( buffer, pos );
+    UnpackValues( buffer, pos, info.origLowerStruct );
+    UnpackValues( buffer, pos, info.LOffsets );
+    UnpackValues( buffer, pos, info.LParents );
+    const Int numChildren = UnpackValue<Int>( buffer, pos );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        sep.children.emplace_back( new Separator(&sep) );
+        info.children.emplace_back( new NodeInfo(&info) );
+        UnpackTree( buffer, pos, *sep.children.back(), *info.children.back() );
+    }
+}
+
+void PackTree
+( const DistSeparator& sep, const DistNodeInfo& info, vector<byte>& buffer )
+{
+    PackValue( sep.off, buffer );
+    PackValues( sep.inds, buffer );
+    PackValue( info.size, buffer );
+    PackValue( info.off, buffer );
+    PackValues( info.origLowerStruct, buffer );
+    const Int hasChild = ( info.child != nullptr );
+    PackValue( hasChild, buffer );
+    if( hasChild )
+    {
+        PackValue( Int(info.child->onLeft), buffer );
+        PackTree( *sep.child, *info.child, buffer );
+    }
+    else
+        PackTree( *sep.duplicate, *info.duplicate, buffer );
+}
+
+void UnpackTree
+( const vector<byte>& buffer, size_t& pos,
+  DistSeparator& sep, DistNodeInfo& info )
+{
+    sep.off = UnpackValue<Int>( buffer, pos );
+    UnpackValues( buffer, pos, sep.inds );
+    info.size = UnpackValue<Int>( buffer, pos );
+    info.off = UnpackValue<Int>( buffer, pos );
+    UnpackValues( buffer, pos, info.origLowerStruct );
+    const bool hasChild = UnpackValue<Int>( buffer, pos );
+    const Grid& grid = info.Grid();
+    if( hasChild != (grid.Size() > 1) )
+        RuntimeError("Symbolic analysis was for a different team size");
+    if( hasChild )
+    {
+        const bool onLeft = UnpackValue<Int>( buffer, pos );
+        info.child.reset( new DistNodeInfo(&info) );
+        info.child->onLeft = onLeft;
+
+        // Recreate the child team exactly as the bisection did, which
+        // preserved the relative ranks of the processes within each half
+        mpi::Comm childComm;
+        mpi::Split( grid.Comm(), onLeft, mpi::Rank(grid.Comm()), childComm );
+        unique_ptr<Grid> childGrid( new Grid(childComm) );
+        info.child->AssignGrid( childGrid );
+        mpi::Free( childComm );
+
+        sep.child.reset( new DistSeparator(&sep) );
+        UnpackTree( buffer, pos, *sep.child, *info.child );
+    }
+    else
+    {
+        sep.duplicate.reset( new Separator(&sep) );
+        info.duplicate.reset( new NodeInfo(&info) );
+        UnpackTree( buffer, pos, *sep.duplicate, *info.duplicate );
+    }
+}
+
+} // anonymous namespace
+
+void SerializeSymbolic
+( const Separator& rootSep, const NodeInfo& rootInfo, vector<byte>& buffer )
+{
+    EL_DEBUG_CSE
+    buffer.clear();
+    PackTree( rootSep, rootInfo, buffer );
+}
+
+void SerializeSymbolic
+( const DistSeparator& rootSep,
+  const DistNodeInfo& rootInfo,
+        vector<byte>& buffer )
+{
+    EL_DEBUG_CSE
+    buffer.clear();
+    PackValue( Int(rootInfo.Grid().Size()), buffer );
+    PackTree( rootSep, rootInfo, buffer );
+}
+
+void DeserializeSymbolic
+( const vector<byte>& buffer,
+        vector<Int>& map,
+        Separator& rootSep,
+        NodeInfo& rootInfo )
+{
+    EL_DEBUG_CSE
+    size_t pos = 0;
+    UnpackTree( buffer, pos, rootSep, rootInfo );
+    if( pos != buffer.size() )
+        RuntimeError("Symbolic analysis had trailing data");
+
+    rootSep.BuildMap( map );
+    EL_DEBUG_ONLY(EnsurePermutation(map))
+    Analysis( rootInfo );
+}
+
+void DeserializeSymbolic
+( const vector<byte>& buffer,
+  const Grid& grid,
+        DistMap& map,
+        DistSeparator& rootSep,
+        DistNodeInfo& rootInfo,
+        bool storeFactRecvInds )
+{
+    EL_DEBUG_CSE
+    size_t pos = 0;
+    const Int commSize = UnpackValue<Int>( buffer, pos );
+    if( commSize != grid.Size() )
+        RuntimeError
+        ("Symbolic analysis was for ",commSize," processes rather than ",
+         grid.Size());
+    rootInfo.SetRootGrid( grid );
+    UnpackTree( buffer, pos, rootSep, rootInfo );
+    if( pos != buffer.size() )
+        RuntimeError("Symbolic analysis had trailing data");
+
+    rootSep.BuildMap( rootInfo, map );
+    EL_DEBUG_ONLY(EnsurePermutation(map))
+    Analysis( rootInfo, storeFactRecvInds );
+}
+
+} // namespace ldl
+} // namespace El
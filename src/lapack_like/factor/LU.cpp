@@ -10,6 +10,8 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./PanelGather.hpp"
+#include "./LU/LookAhead.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -25,7 +27,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU");
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -47,6 +49,7 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -60,7 +63,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU",g.Height(),g.Width());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -109,7 +112,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU");
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -155,10 +158,18 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("LU")
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
+    const Int lookAheadDepth = LookAheadDepth();
+    if( lookAheadDepth > 0 )
+    {
+        lu::LookAhead( A, P, lookAheadDepth );
+        return;
+    }
+
     const Grid& g = A.Grid();
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
     DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
@@ -176,7 +187,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU",g.Height(),g.Width());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_LOOKAHEAD_HPP
+#define EL_LU_LOOKAHEAD_HPP
+
+#include <deque>
+
+namespace El {
+namespace lu {
+
+// A factored panel, A(k:m,k:k+nb), whose trailing update,
+//
+//   A(k+nb:m,k+nb:n) -= L21 U12,
+//
+// has only been applied to the columns in [k+nb,updatedEnd)
+template<typename F>
+struct LookAheadPanel
+{
+    Int end;
+    Int updatedEnd;
+    vector<F> buffer;
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR;
+    DistMatrix<F,MC,  STAR> A21_MC_STAR;
+    DistMatrix<F,STAR,MR  > A12_STAR_MR;
+    DistPermutation PB;
+
+    LookAheadPanel( const Grid& g )
+    : A11_STAR_STAR(g), A21_MC_STAR(g), A12_STAR_MR(g), PB(g)
+    { }
+};
+
+// A(rowBeg:rowEnd,colBeg:colEnd) -=
+//   L21(rowBeg:rowEnd,:) U12(:,colBeg:colEnd),
+// where the indices of L21 and U12 are those of A
+template<typename F>
+void LookAheadUpdate
+( const LookAheadPanel<F>& panel,
+  DistMatrix<F>& A,
+  Int rowBeg, Int rowEnd, Int colBeg, Int colEnd )
+{
+    EL_DEBUG_CSE
+    if( rowBeg >= rowEnd || colBeg >= colEnd )
+        return;
+    const Int off = panel.end;
+    auto L21 = panel.A21_MC_STAR( IR(rowBeg,rowEnd)-off, ALL );
+    auto U12 = panel.A12_STAR_MR( ALL, IR(colBeg,colEnd)-off );
+    auto ASub = A( IR(rowBeg,rowEnd), IR(colBeg,colEnd) );
+    LocalGemm( NORMAL, NORMAL, F(-1), L21, U12, F(1), ASub );
+}
+
+// LU with partial pivoting where the trailing updates of up to 'depth'
+// factored panels are deferred. The next panel is brought up to date first
+// and its redistribution is overlapped with the (blocked) application of the
+// oldest deferred updates.
+template<typename F>
+void LookAhead( DistMatrix<F>& A, DistPermutation& P, Int depth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( depth < 1 )
+          LogicError("Look-ahead depth must be positive");
+    )
+    typedef LookAheadPanel<F> Panel;
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,VR> A12_STAR_VR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    if( minDim == 0 )
+        return;
+
+    std::deque<unique_ptr<Panel>> pending;
+    unique_ptr<Panel> next;
+    PanelGather<F> gather;
+    vector<F> pivotBuf;
+    const Int bsize = Blocksize<F>("LU",g.Height(),g.Width());
+
+    // Attach the [* ,* ] and [MC,* ] copies of A(k:m,k:k+nb) to a contiguous
+    // buffer and start gathering the latter
+    auto startPanel = [&]( Int k, Int nb )
+    {
+        next.reset( new Panel(g) );
+        next->end = next->updatedEnd = k+nb;
+        auto A21 = A( IR(k+nb,m), IR(k,k+nb) );
+        const Int A21Height = A21.Height();
+        const Int panelLDim = nb+A21.LocalHeight();
+        FastResize( next->buffer, panelLDim*nb );
+        next->A11_STAR_STAR.Attach
+        ( nb, nb, g, 0, 0, &next->buffer[0], panelLDim, 0 );
+        next->A21_MC_STAR.Attach
+        ( A21Height, nb, g, A21.ColAlign(), 0,
+          &next->buffer[nb], panelLDim, 0 );
+        gather.StartRowAllGather( A21, next->A21_MC_STAR );
+    };
+
+    // Apply the remainder of the oldest deferred update in blocks of columns,
+    // giving MPI a chance to progress the panel gather in between
+    auto retire = [&]( Int rowBeg )
+    {
+        Panel& old = *pending.front();
+        for( Int j=old.updatedEnd; j<n; j+=bsize )
+        {
+            LookAheadUpdate( old, A, rowBeg, m, j, Min(j+bsize,n) );
+            gather.Progress();
+        }
+        pending.pop_front();
+    };
+
+    startPanel( 0, Min(bsize,minDim) );
+    gather.Finish();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB  = A( indB, ALL );
+
+        // Factor the (up-to-date) panel
+        Panel& panel = *next;
+        panel.A11_STAR_STAR = A11;
+        lu::Panel
+        ( panel.A11_STAR_STAR, panel.A21_MC_STAR, P, panel.PB, k, pivotBuf );
+
+        // Pivot the matrix as well as the copies of the deferred panels
+        panel.PB.PermuteRows( AB );
+        for( auto& old : pending )
+        {
+            auto L21 = old->A21_MC_STAR( IR(k-old->end,END), ALL );
+            panel.PB.PermuteRows( L21 );
+        }
+
+        // Bring the row panel up to date and solve for U12
+        for( auto& old : pending )
+            LookAheadUpdate( *old, A, k, k+nb, old->updatedEnd, n );
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), panel.A11_STAR_STAR, A12_STAR_VR );
+        panel.A12_STAR_MR.AlignWith( A22 );
+        panel.A12_STAR_MR = A12_STAR_VR;
+
+        A11 = panel.A11_STAR_STAR;
+        A12 = panel.A12_STAR_MR;
+        A21 = panel.A21_MC_STAR;
+        pending.push_back( std::move(next) );
+
+        const Int kNext = k+nb;
+        if( kNext >= minDim )
+            break;
+        const Int nbNext = Min(bsize,minDim-kNext);
+
+        // Bring the next panel up to date and start redistributing it
+        for( auto& old : pending )
+        {
+            if( old->updatedEnd < kNext+nbNext )
+            {
+                LookAheadUpdate
+                ( *old, A, kNext, m, old->updatedEnd, kNext+nbNext );
+                old->updatedEnd = kNext+nbNext;
+            }
+        }
+        startPanel( kNext, nbNext );
+
+        // Overlap the gather with the oldest deferred updates
+        while( Int(pending.size()) > depth-1 )
+            retire( kNext );
+        gather.Finish();
+    }
+
+    // Apply the remaining deferred updates
+    while( !pending.empty() )
+        retire( minDim );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_LOOKAHEAD_HPP
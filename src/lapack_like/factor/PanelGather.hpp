@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_PANELGATHER_HPP
+#define EL_FACTOR_PANELGATHER_HPP
+
+#include <functional>
+
+namespace El {
+
+// The all-gathers used to redistribute the panels of the look-ahead
+// factorizations, split into a call which packs the data and starts the
+// communication and a call which waits for it and unpacks the result, so that
+// local computation (e.g., the deferred trailing updates) can be performed in
+// between. The output matrix must not be modified (or resized) in between.
+//
+// If MPI does not support non-blocking collectives, or if the output is not
+// aligned with the input, the communication is performed immediately.
+template<typename T>
+class PanelGather
+{
+public:
+    // (U,V) |-> (U,Collect(V)), e.g., [MC,MR] -> [MC,* ]
+    void StartRowAllGather
+    ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+    // (U,V) |-> (Partial(U),V), e.g., [VC,* ] -> [MC,* ]
+    void StartPartialColAllGather
+    ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+    // (U,V) |-> (U,Partial(V)), e.g., [* ,VC] -> [* ,MC]
+    void StartPartialRowAllGather
+    ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+    // Give MPI an opportunity to progress the communication
+    void Progress();
+
+    // Wait for the communication to complete and unpack the result
+    void Finish();
+
+private:
+    bool active_=false;
+    vector<T> buffer_;
+    mpi::Request<T> request_;
+    std::function<void()> unpack_;
+
+    void Start( Int portionSize, mpi::Comm comm );
+};
+
+template<typename T>
+void PanelGather<T>::Start( Int portionSize, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    mpi::IAllGather
+    ( &buffer_[0],           portionSize,
+      &buffer_[portionSize], portionSize, comm, request_ );
+#else
+    mpi::AllGather
+    ( &buffer_[0],           portionSize,
+      &buffer_[portionSize], portionSize, comm );
+#endif
+    active_ = true;
+}
+
+template<typename T>
+void PanelGather<T>::StartRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( active_ )
+          LogicError("The previous gather was not finished");
+      if( A.ColDist() != B.ColDist() ||
+          Collect(A.RowDist()) != B.RowDist() )
+          LogicError("Incompatible distributions");
+    )
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    if( B.ColAlign() != A.ColAlign() )
+    {
+        Copy( A, B );
+        return;
+    }
+    const Int rowStride = A.RowStride();
+    if( rowStride == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+
+    const Int localHeight = A.LocalHeight();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
+    FastResize( buffer_, (rowStride+1)*portionSize );
+    copy::util::InterleaveMatrix
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      &buffer_[0],      1, localHeight );
+
+    const Int rowAlign = A.RowAlign();
+    unpack_ = [=,&B]()
+    {
+        copy::util::RowStridedUnpack
+        ( localHeight, width, rowAlign, rowStride,
+          &buffer_[portionSize], portionSize,
+          B.Buffer(), B.LDim() );
+    };
+    Start( portionSize, A.RowComm() );
+}
+
+template<typename T>
+void PanelGather<T>::StartPartialColAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( active_ )
+          LogicError("The previous gather was not finished");
+      if( B.ColDist() != Partial(A.ColDist()) ||
+          B.RowDist() != A.RowDist() )
+          LogicError("Incompatible distributions");
+    )
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    const Int colStrideUnion = A.PartialUnionColStride();
+    const Int colStridePart = A.PartialColStride();
+    if( B.ColAlign() != Mod(A.ColAlign(),colStridePart) )
+    {
+        Copy( A, B );
+        return;
+    }
+    if( colStrideUnion == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+
+    const Int maxLocalHeight = MaxLength(height,A.ColStride());
+    const Int portionSize = mpi::Pad( maxLocalHeight*width );
+    FastResize( buffer_, (colStrideUnion+1)*portionSize );
+    copy::util::InterleaveMatrix
+    ( A.LocalHeight(), width,
+      A.LockedBuffer(), 1, A.LDim(),
+      &buffer_[0],      1, A.LocalHeight() );
+
+    const Int colAlign = A.ColAlign();
+    const Int colStride = A.ColStride();
+    const Int colRankPart = A.PartialColRank();
+    unpack_ = [=,&B]()
+    {
+        copy::util::PartialColStridedUnpack
+        ( height, width,
+          colAlign, colStride,
+          colStrideUnion, colStridePart, colRankPart,
+          B.ColShift(),
+          &buffer_[portionSize], portionSize,
+          B.Buffer(), B.LDim() );
+    };
+    Start( portionSize, A.PartialUnionColComm() );
+}
+
+template<typename T>
+void PanelGather<T>::StartPartialRowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( active_ )
+          LogicError("The previous gather was not finished");
+      if( B.ColDist() != A.ColDist() ||
+          B.RowDist() != Partial(A.RowDist()) )
+          LogicError("Incompatible distributions");
+    )
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize
+    ( Mod(A.RowAlign(),B.RowStride()), height, width, false, false );
+    if( !A.Participating() )
+        return;
+    const Int rowStrideUnion = A.PartialUnionRowStride();
+    const Int rowStridePart = A.PartialRowStride();
+    if( B.RowAlign() != Mod(A.RowAlign(),rowStridePart) )
+    {
+        Copy( A, B );
+        return;
+    }
+    if( rowStrideUnion == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+
+    const Int rowStride = A.RowStride();
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( height*maxLocalWidth );
+    FastResize( buffer_, (rowStrideUnion+1)*portionSize );
+    copy::util::InterleaveMatrix
+    ( height, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      &buffer_[0],      1, height );
+
+    const Int rowAlign = A.RowAlign();
+    const Int rowRankPart = A.PartialRowRank();
+    unpack_ = [=,&B]()
+    {
+        copy::util::PartialRowStridedUnpack
+        ( height, width,
+          rowAlign, rowStride,
+          rowStrideUnion, rowStridePart, rowRankPart,
+          B.RowShift(),
+          &buffer_[portionSize], portionSize,
+          B.Buffer(), B.LDim() );
+    };
+    Start( portionSize, A.PartialUnionRowComm() );
+}
+
+template<typename T>
+void PanelGather<T>::Progress()
+{
+    EL_DEBUG_CSE
+#if EL_HAVE_NONBLOCKING
+    if( active_ )
+        mpi::Test( request_ );
+#endif
+}
+
+template<typename T>
+void PanelGather<T>::Finish()
+{
+    EL_DEBUG_CSE
+    if( !active_ )
+        return;
+#if EL_HAVE_NONBLOCKING
+    mpi::Wait( request_ );
+#endif
+    unpack_();
+    unpack_ = nullptr;
+    active_ = false;
+}
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_PANELGATHER_HPP
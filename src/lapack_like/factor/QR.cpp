@@ -72,6 +72,7 @@ void QR
   AbstractDistMatrix<Base<F>>& signature )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("QR")
     qr::Householder( A, householderScalars, signature );
 }
 
@@ -198,7 +199,8 @@ void QR
   template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    const TSQRCtrl<Base<F>>& ctrl ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
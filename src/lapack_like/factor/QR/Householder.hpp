@@ -29,7 +29,7 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("QR");
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -72,7 +72,8 @@ Householder
     householderScalars.Resize( minDim, 1 );
     signature.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Grid& g = A.Grid();
+    const Int bsize = Blocksize<F>("QR",g.Height(),g.Width());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
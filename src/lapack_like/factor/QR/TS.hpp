@@ -50,9 +50,13 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
         const bool top = rank < partner;
         if( top )
         {
+            // Post the receive before packing so that the partner's message
+            // need not be buffered
+            mpi::Request<F> recvRequest;
+            mpi::IRecv( ZBot.Buffer(), n*n, partner, colComm, recvRequest );
             ZTop = lastZ;
             MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
+            mpi::Wait( recvRequest );
         }
         else
         {
@@ -205,8 +209,12 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
         LogicError("TSQR currently requires power-of-two number of processes");
     const Int logp = FlooredLog2(p);
 
-    // Run the binary tree scatter
+    // Run the binary tree scatter. The sends are nonblocking so that each
+    // process can immediately move on to its next stage.
     Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
+    vector<Matrix<F>> sendBufs(logp);
+    vector<mpi::Request<F>> sendRequests(logp);
+    Int numSends = 0;
     if( rank == 0 )
         Z = RootQR( A, treeData );
     auto ZTop = Z( IR(0,n),   IR(0,n) );
@@ -237,8 +245,12 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
                   Z );
             }
             // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
+            auto& sendBuf = sendBufs[numSends];
+            sendBuf = ZBot;
+            mpi::ISend
+            ( sendBuf.LockedBuffer(), n*n, partner, colComm,
+              sendRequests[numSends] );
+            ++numSends;
             ZHalf = ZTop;
         }
         else
@@ -248,6 +260,8 @@ void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
         }
     }
 
+    mpi::WaitAll( numSends, sendRequests.data() );
+
     // Apply the initial Q
     Zero( A );
     auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
@@ -313,6 +327,299 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     }
 }
 
+template<typename F>
+void ExpandQ
+( const Matrix<F>& QR,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+        Matrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    Q = QR;
+    ExpandPackedReflectors
+    ( LOWER, VERTICAL, CONJUGATED, 0, Q, householderScalars );
+    DiagonalScale( RIGHT, NORMAL, signature, Q );
+}
+
+template<typename F>
+void CheckTreeDimensions
+( const AbstractDistMatrix<F>& A, bool requirePowerOfTwo )
+{
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    const Int p = mpi::Size( A.ColComm() );
+    if( A.Height() < p*A.Width() )
+        LogicError("TSQR currently assumes height >= width*numProcesses");
+    if( requirePowerOfTwo && !PowerOfTwo(p) )
+        LogicError("TSQR currently requires power-of-two number of processes");
+}
+
+// Overwrite A with the explicit Q factor of its QR factorization and
+// return the upper-triangular R on every process using a flat reduction tree
+template<typename F>
+void Flat( AbstractDistMatrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    CheckTreeDimensions( A, false );
+    const Int n = A.Width();
+    const mpi::Comm colComm = A.ColComm();
+    const Int p = mpi::Size( colComm );
+    const Int rank = mpi::Rank( colComm );
+
+    Matrix<F> QR0, householderScalars0;
+    Matrix<Base<F>> signature0;
+    QR0 = A.LockedMatrix();
+    QR( QR0, householderScalars0, signature0 );
+    if( p == 1 )
+    {
+        R = QR0( IR(0,n), IR(0,n) );
+        MakeTrapezoidal( UPPER, R );
+        ExpandQ( QR0, householderScalars0, signature0, A.Matrix() );
+        return;
+    }
+
+    // Gather the local R factors onto the root while forming the local Q
+    Matrix<F> RLoc(n,n,n);
+    RLoc = QR0( IR(0,n), IR(0,n) );
+    MakeTrapezoidal( UPPER, RLoc );
+    vector<F> gathered;
+    if( rank == 0 )
+        gathered.resize( p*n*n );
+    mpi::Request<F> gatherRequest;
+    mpi::IGather
+    ( RLoc.LockedBuffer(), n*n, gathered.data(), n*n, 0, colComm,
+      gatherRequest );
+    Matrix<F> Q0;
+    ExpandQ( QR0, householderScalars0, signature0, Q0 );
+    mpi::Wait( gatherRequest );
+
+    // Factor the stacked R factors on the root and pack the corresponding
+    // n x n block of Q, followed by the final R, for each process
+    vector<F> packed;
+    if( rank == 0 )
+    {
+        Matrix<F> Z, householderScalars, QStacked, RRoot;
+        Matrix<Base<F>> signature;
+        Z.Resize( p*n, n );
+        for( Int q=0; q<p; ++q )
+        {
+            Matrix<F> RGathered;
+            RGathered.LockedAttach( n, n, &gathered[q*n*n], n );
+            auto ZBlock = Z( IR(q*n,(q+1)*n), ALL );
+            ZBlock = RGathered;
+        }
+        QR( Z, householderScalars, signature );
+        RRoot = Z( IR(0,n), IR(0,n) );
+        MakeTrapezoidal( UPPER, RRoot );
+        ExpandQ( Z, householderScalars, signature, QStacked );
+
+        packed.resize( 2*p*n*n );
+        for( Int q=0; q<p; ++q )
+        {
+            Matrix<F> QBlock, RBlock;
+            QBlock.Attach( n, n, &packed[2*q*n*n], n );
+            RBlock.Attach( n, n, &packed[(2*q+1)*n*n], n );
+            QBlock = QStacked( IR(q*n,(q+1)*n), ALL );
+            RBlock = RRoot;
+        }
+    }
+    Matrix<F> QAndR(n,2*n,n);
+    mpi::Scatter
+    ( packed.data(), 2*n*n, QAndR.Buffer(), 2*n*n, 0, colComm );
+
+    R = QAndR( ALL, IR(n,2*n) );
+    Gemm
+    ( NORMAL, NORMAL, F(1), Q0, QAndR(ALL,IR(0,n)), F(0), A.Matrix() );
+}
+
+// Overwrite A with the explicit Q factor of its QR factorization and
+// return the upper-triangular R on every process using an all-reduce
+// (butterfly) tree. Each exchange of R factors is overlapped with the local
+// work which depends upon the previous stage.
+//
+// NOTE: Both members of each pair must compute bitwise-identical
+//       factorizations of the same stacked matrix.
+template<typename F>
+void Butterfly( AbstractDistMatrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    CheckTreeDimensions( A, true );
+    const Int n = A.Width();
+    const mpi::Comm colComm = A.ColComm();
+    const Int p = mpi::Size( colComm );
+    const Int rank = mpi::Rank( colComm );
+    const Int logp = FlooredLog2(p);
+
+    Matrix<F> QR0, householderScalars0;
+    Matrix<Base<F>> signature0;
+    QR0 = A.LockedMatrix();
+    QR( QR0, householderScalars0, signature0 );
+    Matrix<F> RMine(n,n,n), RPartner(n,n,n);
+    RMine = QR0( IR(0,n), IR(0,n) );
+    MakeTrapezoidal( UPPER, RMine );
+    if( p == 1 )
+    {
+        R = RMine;
+        ExpandQ( QR0, householderScalars0, signature0, A.Matrix() );
+        return;
+    }
+
+    // Q = Q0 QAcc, where QAcc is the product of the relevant n x n halves of
+    // the Q factors of each stage
+    Matrix<F> Q0, QAcc, QAccPrev, QHalf;
+    Matrix<F> Z(2*n,n,2*n), householderScalars, QStage;
+    Matrix<Base<F>> signature;
+    for( Int stage=0; stage<logp; ++stage )
+    {
+        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
+        const bool top = rank < partner;
+        mpi::Request<F> sendRequest, recvRequest;
+        mpi::IRecv( RPartner.Buffer(), n*n, partner, colComm, recvRequest );
+        mpi::ISend( RMine.LockedBuffer(), n*n, partner, colComm, sendRequest );
+
+        if( stage == 0 )
+        {
+            ExpandQ( QR0, householderScalars0, signature0, Q0 );
+            Identity( QAcc, n, n );
+        }
+        else
+        {
+            QAccPrev = QAcc;
+            Gemm( NORMAL, NORMAL, F(1), QAccPrev, QHalf, F(0), QAcc );
+        }
+
+        mpi::Wait( recvRequest );
+        mpi::Wait( sendRequest );
+        auto ZTop = Z( IR(0,n),   ALL );
+        auto ZBot = Z( IR(n,2*n), ALL );
+        ZTop = ( top ? RMine : RPartner );
+        ZBot = ( top ? RPartner : RMine );
+        QR( Z, householderScalars, signature );
+        RMine = Z( IR(0,n), IR(0,n) );
+        MakeTrapezoidal( UPPER, RMine );
+        ExpandQ( Z, householderScalars, signature, QStage );
+        QHalf = QStage( ( top ? IR(0,n) : IR(n,2*n) ), ALL );
+    }
+    QAccPrev = QAcc;
+    Gemm( NORMAL, NORMAL, F(1), QAccPrev, QHalf, F(0), QAcc );
+    Gemm( NORMAL, NORMAL, F(1), Q0, QAcc, F(0), A.Matrix() );
+    R = RMine;
+}
+
+// Overwrite the n x n matrix G with its upper-triangular Cholesky factor,
+// returning false if the factorization broke down
+template<typename F>
+bool CholeskyFactor( Matrix<F>& G )
+{
+    EL_DEBUG_CSE
+    try { El::Cholesky( UPPER, G ); }
+    catch( NonHPDMatrixException& ) { return false; }
+    MakeTrapezoidal( UPPER, G );
+    return true;
+}
+
+// Form the Gramian A^H A, which is needed by every process
+template<typename F>
+void Gramian( const Matrix<F>& ALoc, Matrix<F>& G, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = ALoc.Width();
+    G.Resize( n, n, n );
+    Zero( G );
+    Herk( UPPER, ADJOINT, Base<F>(1), ALoc, Base<F>(0), G );
+    mpi::AllReduce( G.Buffer(), n*n, comm );
+}
+
+// A := A inv(R), where R is the Cholesky factor of the Gramian of A
+template<typename F>
+bool CholeskyQRStep( Matrix<F>& ALoc, Matrix<F>& R, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Gramian( ALoc, R, comm );
+    if( !CholeskyFactor( R ) )
+        return false;
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, ALoc );
+    return true;
+}
+
+// Overwrite A with Q and return R on every process using CholeskyQR2 if the
+// estimated condition number of A is at most ctrl.maxCholeskyQR2Cond and
+// shifted CholeskyQR3, i.e.,
+//
+//   Fukaya, Kannan, Nakatsukasa, Yamamoto, and Yanagisawa,
+//   "Shifted Cholesky QR for computing the QR factorization of
+//    ill-conditioned matrices",
+//   SIAM J. Sci. Comput., Vol. 42, No. 1, pp. A477--A503, 2020,
+//
+// otherwise. False is returned if a Cholesky factorization broke down, in
+// which case A has been modified.
+//
+// NOTE: Every process factors its own copy of the reduced Gramian, so all
+//       of the processes are assumed to receive identical reductions (as
+//       advised by the MPI standard) and to therefore make identical
+//       decisions.
+template<typename F>
+bool Cholesky
+( AbstractDistMatrix<F>& A, Matrix<F>& R, const TSQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("A^H A will be singular");
+    const mpi::Comm colComm = A.ColComm();
+    auto& ALoc = A.Matrix();
+
+    Matrix<F> G;
+    Gramian( ALoc, G, colComm );
+
+    // Estimate the condition number of A as the one-norm condition number of
+    // the Cholesky factor of its Gramian
+    R = G;
+    bool useCholeskyQR2 = CholeskyFactor( R );
+    if( useCholeskyQR2 )
+    {
+        Matrix<F> RInv( R );
+        TriangularInverse( UPPER, NON_UNIT, RInv );
+        const Real condEst = OneNorm(R)*OneNorm(RInv);
+        useCholeskyQR2 = ( condEst <= ctrl.maxCholeskyQR2Cond );
+    }
+
+    Matrix<F> RStep;
+    if( !useCholeskyQR2 )
+    {
+        // Factor the Gramian after shifting it by
+        // 11 (m n + n (n+1)) eps || A ||_F^2
+        const Real eps = limits::Epsilon<Real>();
+        Real frobNormSquared = 0;
+        for( Int j=0; j<n; ++j )
+            frobNormSquared += RealPart(G(j,j));
+        const Real shift =
+          11*(Real(m)*Real(n) + Real(n)*Real(n+1))*eps*frobNormSquared;
+        ShiftDiagonal( G, F(shift) );
+        if( !CholeskyFactor( G ) )
+            return false;
+        R = G;
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, ALoc );
+        if( !CholeskyQRStep( ALoc, RStep, colComm ) )
+            return false;
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RStep, R );
+    }
+    else
+    {
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, ALoc );
+    }
+
+    // Perform the final (unshifted) CholeskyQR step
+    if( !CholeskyQRStep( ALoc, RStep, colComm ) )
+        return false;
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RStep, R );
+    return true;
+}
+
 } // namespace ts
 
 template<typename F>
@@ -338,11 +645,55 @@ TreeData<F> TS( const AbstractDistMatrix<F>& A )
 }
 
 template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+void ExplicitTS
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& RPre,
+  const TSQRCtrl<Base<F>>& ctrl )
 {
-    auto treeData = TS( A );
-    Copy( ts::FormR( A, treeData ), R );
-    ts::FormQ( A, treeData );
+    EL_DEBUG_CSE
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& R = RProx.Get();
+    const Int n = A.Width();
+
+    Matrix<F> RLoc;
+    if( ctrl.alg == TSQR_CHOLESKY )
+    {
+        Matrix<F> ACopy;
+        if( ctrl.fallback )
+            ACopy = A.LockedMatrix();
+        if( ts::Cholesky( A, RLoc, ctrl ) )
+        {
+            R.Resize( n, n );
+            R.Matrix() = RLoc;
+            return;
+        }
+        if( !ctrl.fallback )
+            RuntimeError("CholeskyQR broke down");
+        A.Matrix() = ACopy;
+    }
+
+    switch( ctrl.tree )
+    {
+    case TSQR_BINARY_TREE:
+    {
+        auto treeData = TS( A );
+        Copy( ts::FormR( A, treeData ), R );
+        ts::FormQ( A, treeData );
+        return;
+    }
+    case TSQR_FLAT_TREE:
+        ts::Flat( A, RLoc );
+        break;
+    case TSQR_BUTTERFLY_TREE:
+        ts::Butterfly( A, RLoc );
+        break;
+    default:
+        LogicError("Invalid TSQR tree");
+    }
+    R.Resize( n, n );
+    R.Matrix() = RLoc;
 }
 
 } // namespace qr
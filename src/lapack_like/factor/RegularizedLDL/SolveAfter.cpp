@@ -239,12 +239,13 @@ Int RegularizedSolveAfterNoPromote
   bool time )
 {
     EL_DEBUG_CSE
+    DistSparseMultPlan<Field> multPlan;
     auto applyA =
       [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
       {
         Y = X;
         DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+        Multiply( NORMAL, Field(1), A, X, Field(1), Y, multPlan );
       };
     auto applyAInv =
       [&]( DistMultiVec<Field>& Y )
@@ -268,12 +269,13 @@ Int RegularizedSolveAfterNoPromote
   bool time )
 {
     EL_DEBUG_CSE
+    DistSparseMultPlan<Field> multPlan;
     auto applyA =
       [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
       {
         Y = X;
         DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+        Multiply( NORMAL, Field(1), A, X, Field(1), Y, multPlan );
       };
     auto applyAInv = 
       [&]( DistMultiVec<Field>& Y )
@@ -310,12 +312,14 @@ RegularizedSolveAfterPromote
     Copy( reg, regProm );
 
     // TODO(poulson): Use time in these lambdas
+    DistSparseMultPlan<PField> multPlan;
     auto applyA =
       [&]( const DistMultiVec<PField>& XProm, DistMultiVec<PField>& YProm )
       {
         YProm = XProm;
         DiagonalScale( LEFT, NORMAL, regProm, YProm ); 
-        Multiply( NORMAL, PField(1), AProm, XProm, PField(1), YProm );
+        Multiply
+        ( NORMAL, PField(1), AProm, XProm, PField(1), YProm, multPlan );
       };
     auto applyAInv =
       [&]( DistMultiVec<Field>& Y )
@@ -369,12 +373,14 @@ RegularizedSolveAfterPromote
     Copy( reg, regProm );
 
     // TODO(poulson): Use time in these lambdas
+    DistSparseMultPlan<PField> multPlan;
     auto applyA =
       [&]( const DistMultiVec<PField>& XProm, DistMultiVec<PField>& YProm )
       {
         YProm = XProm;
         DiagonalScale( LEFT, NORMAL, regProm, YProm ); 
-        Multiply( NORMAL, PField(1), AProm, XProm, PField(1), YProm );
+        Multiply
+        ( NORMAL, PField(1), AProm, XProm, PField(1), YProm, multPlan );
       };
     auto applyAInv = 
       [&]( DistMultiVec<Field>& Y )
@@ -515,11 +521,12 @@ Int LGMRESSolveAfter
 {
     EL_DEBUG_CSE
 
+    DistSparseMultPlan<Field> multPlan;
     auto applyA =
       [&]( Field alpha, const DistMultiVec<Field>& X,
            Field beta, DistMultiVec<Field>& Y )
       {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
+          Multiply( NORMAL, alpha, A, X, beta, Y, multPlan );
       };
     auto precond =
       [&]( DistMultiVec<Field>& W )
@@ -546,11 +553,12 @@ Int LGMRESSolveAfter
         bool progress )
 {
     EL_DEBUG_CSE
+    DistSparseMultPlan<Field> multPlan;
     auto applyA =
       [&]( Field alpha, const DistMultiVec<Field>& X,
            Field beta, DistMultiVec<Field>& Y )
       {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
+          Multiply( NORMAL, alpha, A, X, beta, Y, multPlan );
       };
     auto precond =
       [&]( DistMultiVec<Field>& W )
@@ -640,11 +648,12 @@ Int FGMRESSolveAfter
 {
     EL_DEBUG_CSE
 
+    DistSparseMultPlan<Field> multPlan;
     auto applyA =
       [&]( Field alpha, const DistMultiVec<Field>& X,
            Field beta, DistMultiVec<Field>& Y )
       {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
+          Multiply( NORMAL, alpha, A, X, beta, Y, multPlan );
       };
     auto precond =
       [&]( DistMultiVec<Field>& W )
@@ -673,11 +682,12 @@ Int FGMRESSolveAfter
 {
     EL_DEBUG_CSE
 
+    DistSparseMultPlan<Field> multPlan;
     auto applyA =
       [&]( Field alpha, const DistMultiVec<Field>& X,
            Field beta, DistMultiVec<Field>& Y )
       {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
+          Multiply( NORMAL, alpha, A, X, beta, Y, multPlan );
       };
     auto precond =
       [&]( DistMultiVec<Field>& W )
@@ -689,6 +699,75 @@ Int FGMRESSolveAfter
     return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
 }
 
+template<typename Field>
+Int SStepGMRESSolveAfter
+( const DistSparseMatrix<Field>& A, 
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistSparseMultPlan<Field> multPlan;
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y, multPlan );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    SStepCtrl<Base<Field>> sStepCtrl;
+    sStepCtrl.s = ctrl.sStep;
+    sStepCtrl.numBlocks = Max(ctrl.restart/ctrl.sStep,1);
+    sStepCtrl.relTol = ctrl.relTol;
+    sStepCtrl.maxIts = ctrl.maxIts;
+    sStepCtrl.progress = ctrl.progress;
+    return SStepGMRES( applyA, precond, B, sStepCtrl );
+}
+
+template<typename Field>
+Int SStepGMRESSolveAfter
+( const DistSparseMatrix<Field>& A, 
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistSparseMultPlan<Field> multPlan;
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y, multPlan );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W, ctrl.relTolRefine, ctrl.maxRefineIts,
+          ctrl.progress );
+      };
+
+    SStepCtrl<Base<Field>> sStepCtrl;
+    sStepCtrl.s = ctrl.sStep;
+    sStepCtrl.numBlocks = Max(ctrl.restart/ctrl.sStep,1);
+    sStepCtrl.relTol = ctrl.relTol;
+    sStepCtrl.maxIts = ctrl.maxIts;
+    sStepCtrl.progress = ctrl.progress;
+    return SStepGMRES( applyA, precond, B, sStepCtrl );
+}
+
 // TODO(poulson): Add RGMRES
 
 template<typename Field>
@@ -702,7 +781,9 @@ Int SolveAfter
     EL_DEBUG_CSE
     switch( ctrl.alg )
     {
+    // There is no communication for s-step GMRES to avoid here
     case REG_SOLVE_FGMRES:
+    case REG_SOLVE_SSTEP_GMRES:
         return FGMRESSolveAfter
         ( A, reg, sparseLDLFact, B, 
           ctrl.relTol,
@@ -739,7 +820,9 @@ Int SolveAfter
     EL_DEBUG_CSE
     switch( ctrl.alg )
     {
+    // There is no communication for s-step GMRES to avoid here
     case REG_SOLVE_FGMRES:
+    case REG_SOLVE_SSTEP_GMRES:
         return FGMRESSolveAfter
         ( A, reg, d, sparseLDLFact, B, 
           ctrl.relTol,
@@ -794,6 +877,8 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_SSTEP_GMRES:
+        return SStepGMRESSolveAfter( A, reg, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -831,6 +916,8 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_SSTEP_GMRES:
+        return SStepGMRESSolveAfter( A, reg, d, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
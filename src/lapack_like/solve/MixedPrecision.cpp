@@ -0,0 +1,494 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace mixed_precision {
+
+template<typename Field>
+void GatherColumnMaxNorms
+( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    ColumnMaxNorms( X, norms );
+}
+
+template<typename Field>
+void GatherColumnMaxNorms
+( const DistMatrix<Field>& X, Matrix<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Base<Field>,MR,STAR> distNorms(X.Grid());
+    ColumnMaxNorms( X, distNorms );
+    DistMatrix<Base<Field>,STAR,STAR> distNorms_STAR_STAR( distNorms );
+    norms = distNorms_STAR_STAR.Matrix();
+}
+
+// Return the maximum over the columns of || r_j ||_max / || b_j ||_max
+template<typename Field,class MatrixType>
+Base<Field> RelativeError
+( const MatrixType& R, const Matrix<Base<Field>>& bNorms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Real> rNorms;
+    GatherColumnMaxNorms( R, rNorms );
+    Real relError = 0;
+    for( Int j=0; j<rNorms.Height(); ++j )
+    {
+        const Real bNorm = bNorms(j);
+        const Real ratio = ( bNorm > Real(0) ? rNorms(j)/bNorm : rNorms(j) );
+        // Propagate NaN's so that a diverging solve is never accepted
+        if( !(ratio <= relError) )
+            relError = ratio;
+    }
+    return relError;
+}
+
+// Overwrite column j of X with X(:,j) * scales(j)
+template<typename Field>
+void ScaleColumns( const Matrix<Base<Field>>& scales, Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    for( Int j=0; j<X.Width(); ++j )
+    {
+        const Field scale = scales(j);
+        for( Int i=0; i<X.Height(); ++i )
+            X(i,j) *= scale;
+    }
+}
+
+template<typename Field>
+void ScaleColumns( const Matrix<Base<Field>>& scales, DistMatrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    auto& XLoc = X.Matrix();
+    for( Int jLoc=0; jLoc<X.LocalWidth(); ++jLoc )
+    {
+        const Field scale = scales(X.GlobalCol(jLoc));
+        for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+            XLoc(iLoc,jLoc) *= scale;
+    }
+}
+
+// Overwrite X with an approximation of inv(A) X after scaling each column of
+// X by its max norm so that its entries lie well within the range of the low
+// precision (a single global scaling would allow the corrections of columns
+// with small residuals to underflow)
+template<typename Field,class MatrixType,class ApplyLowInvType>
+void ApplyScaledInverse
+( const ApplyLowInvType& applyLowInv, MatrixType& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Real> norms, invNorms;
+    GatherColumnMaxNorms( X, norms );
+    const Int width = norms.Height();
+    invNorms.Resize( width, 1 );
+    bool nonzero = false;
+    for( Int j=0; j<width; ++j )
+    {
+        // Zero columns are left unscaled
+        if( norms(j) == Real(0) )
+            norms(j) = Real(1);
+        else
+            nonzero = true;
+        invNorms(j) = Real(1)/norms(j);
+    }
+    if( !nonzero )
+        return;
+    ScaleColumns( invNorms, X );
+    applyLowInv( X );
+    ScaleColumns( norms, X );
+}
+
+// Iteratively refine the solution X of A X = B, where 'subtractA' should
+// overwrite R := R - A X and 'applyAInv' should overwrite X with an
+// approximation of inv(A) X. The iteration stops as soon as the residual of
+// a candidate solution fails to decrease.
+template<typename Field,class MatrixType,class SubtractAType,
+         class ApplyAInvType>
+Int Refine
+( const SubtractAType& subtractA,
+  const ApplyAInvType& applyAInv,
+  const MatrixType& B,
+        MatrixType& X,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl,
+        bool& converged )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Real> bNorms;
+    GatherColumnMaxNorms( B, bNorms );
+
+    X = B;
+    applyAInv( X );
+    MatrixType R( B );
+    subtractA( X, R );
+    Real relError = RelativeError<Field>( R, bNorms );
+    if( ctrl.progress )
+        Output("original rel error: ",relError);
+
+    Int refineIt = 0;
+    MatrixType XCand( X );
+    while( refineIt < ctrl.maxIts && !(relError <= ctrl.relTol) )
+    {
+        // Use the low-precision factorization to correct the solution
+        applyAInv( R );
+        XCand = X;
+        XCand += R;
+
+        R = B;
+        subtractA( XCand, R );
+        const Real newRelError = RelativeError<Field>( R, bNorms );
+        if( ctrl.progress )
+            Output("refined rel error: ",newRelError);
+        ++refineIt;
+        if( !(newRelError < relError) )
+            break;
+        X = XCand;
+        relError = newRelError;
+    }
+    converged = ( relError <= ctrl.relTol );
+    return refineIt;
+}
+
+// Use FGMRES preconditioned with the low-precision factorization, where
+// 'applyA' should overwrite y := alpha A x + beta y
+template<typename Field,class ApplyAType,class ApplyAInvType>
+Int PreconditionedFGMRES
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl,
+        bool& converged )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    X = B;
+    Int numIts;
+    try
+    {
+        numIts =
+          FGMRES
+          ( applyA, applyAInv, X, ctrl.relTol, ctrl.restart, ctrl.maxIts,
+            ctrl.progress );
+    }
+    catch( std::runtime_error& e )
+    {
+        if( ctrl.progress )
+            Output(e.what());
+        converged = false;
+        return ctrl.maxIts;
+    }
+
+    // FGMRES measures convergence in the two-norm, so confirm that the
+    // max-norm tolerance was met
+    Matrix<Real> bNorms;
+    GatherColumnMaxNorms( B, bNorms );
+    Matrix<Field> R( B );
+    applyA( Field(-1), X, Field(1), R );
+    converged = ( RelativeError<Field>( R, bNorms ) <= ctrl.relTol );
+    return numIts;
+}
+
+} // namespace mixed_precision
+
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    LU( ALow, P );
+
+    auto applyLowInv =
+      [&]( Matrix<Field>& Z )
+      {
+          Matrix<FieldLow> ZLow;
+          Copy( Z, ZLow );
+          lu::SolveAfter( NORMAL, ALow, P, ZLow );
+          Copy( ZLow, Z );
+      };
+    auto applyAInv =
+      [&]( Matrix<Field>& Z )
+      { mixed_precision::ApplyScaledInverse<Field>( applyLowInv, Z ); };
+
+    Matrix<Field> X;
+    bool converged;
+    Int numIts;
+    if( ctrl.useFGMRES )
+    {
+        auto applyA =
+          [&]( Field alpha, const Matrix<Field>& Z, Field beta,
+               Matrix<Field>& Y )
+          { Gemm( NORMAL, NORMAL, alpha, A, Z, beta, Y ); };
+        numIts =
+          mixed_precision::PreconditionedFGMRES
+          ( applyA, applyAInv, B, X, ctrl, converged );
+    }
+    else
+    {
+        auto subtractA =
+          [&]( const Matrix<Field>& Z, Matrix<Field>& R )
+          { Gemm( NORMAL, NORMAL, Field(-1), A, Z, Field(1), R ); };
+        numIts =
+          mixed_precision::Refine<Field>
+          ( subtractA, applyAInv, B, X, ctrl, converged );
+    }
+
+    if( !converged && ctrl.fallback )
+    {
+        if( ctrl.progress )
+            Output("Falling back to a full-precision solve");
+        LinearSolve( A, B );
+    }
+    else
+        B = X;
+    return numIts;
+}
+
+template<typename Field>
+Int MixedPrecisionLinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    const Grid& g = B.Grid();
+
+    DistMatrix<FieldLow> ALow(g);
+    Copy( A, ALow );
+    DistPermutation P(g);
+    LU( ALow, P );
+
+    auto applyLowInv =
+      [&]( DistMatrix<Field>& Z )
+      {
+          DistMatrix<FieldLow> ZLow(g);
+          Copy( Z, ZLow );
+          lu::SolveAfter( NORMAL, ALow, P, ZLow );
+          Copy( ZLow, Z );
+      };
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Z )
+      { mixed_precision::ApplyScaledInverse<Field>( applyLowInv, Z ); };
+    auto subtractA =
+      [&]( const DistMatrix<Field>& Z, DistMatrix<Field>& R )
+      { Gemm( NORMAL, NORMAL, Field(-1), A, Z, Field(1), R ); };
+
+    DistMatrix<Field> X(g);
+    bool converged;
+    const Int numIts =
+      mixed_precision::Refine<Field>
+      ( subtractA, applyAInv, B, X, ctrl, converged );
+
+    if( !converged && ctrl.fallback )
+    {
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Falling back to a full-precision solve");
+        LinearSolve( A, B );
+    }
+    else
+        B = X;
+    return numIts;
+}
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    try
+    {
+        Cholesky( uplo, ALow );
+    }
+    catch( NonHPDMatrixException& )
+    {
+        // A may be too ill-conditioned to be numerically HPD in the low
+        // precision
+        if( !ctrl.fallback )
+            throw;
+        if( ctrl.progress )
+            Output("Falling back to a full-precision solve");
+        HPDSolve( uplo, NORMAL, A, B );
+        return 0;
+    }
+
+    auto applyLowInv =
+      [&]( Matrix<Field>& Z )
+      {
+          Matrix<FieldLow> ZLow;
+          Copy( Z, ZLow );
+          cholesky::SolveAfter( uplo, NORMAL, ALow, ZLow );
+          Copy( ZLow, Z );
+      };
+    auto applyAInv =
+      [&]( Matrix<Field>& Z )
+      { mixed_precision::ApplyScaledInverse<Field>( applyLowInv, Z ); };
+
+    Matrix<Field> X;
+    bool converged;
+    Int numIts;
+    if( ctrl.useFGMRES )
+    {
+        auto applyA =
+          [&]( Field alpha, const Matrix<Field>& Z, Field beta,
+               Matrix<Field>& Y )
+          { Hemm( LEFT, uplo, alpha, A, Z, beta, Y ); };
+        numIts =
+          mixed_precision::PreconditionedFGMRES
+          ( applyA, applyAInv, B, X, ctrl, converged );
+    }
+    else
+    {
+        auto subtractA =
+          [&]( const Matrix<Field>& Z, Matrix<Field>& R )
+          { Hemm( LEFT, uplo, Field(-1), A, Z, Field(1), R ); };
+        numIts =
+          mixed_precision::Refine<Field>
+          ( subtractA, applyAInv, B, X, ctrl, converged );
+    }
+
+    if( !converged && ctrl.fallback )
+    {
+        if( ctrl.progress )
+            Output("Falling back to a full-precision solve");
+        HPDSolve( uplo, NORMAL, A, B );
+    }
+    else
+        B = X;
+    return numIts;
+}
+
+template<typename Field>
+Int MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    const Grid& g = B.Grid();
+
+    DistMatrix<FieldLow> ALow(g);
+    Copy( A, ALow );
+    try
+    {
+        Cholesky( uplo, ALow );
+    }
+    catch( NonHPDMatrixException& )
+    {
+        if( !ctrl.fallback )
+            throw;
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Falling back to a full-precision solve");
+        HPDSolve( uplo, NORMAL, A, B );
+        return 0;
+    }
+
+    auto applyLowInv =
+      [&]( DistMatrix<Field>& Z )
+      {
+          DistMatrix<FieldLow> ZLow(g);
+          Copy( Z, ZLow );
+          cholesky::SolveAfter( uplo, NORMAL, ALow, ZLow );
+          Copy( ZLow, Z );
+      };
+    auto applyAInv =
+      [&]( DistMatrix<Field>& Z )
+      { mixed_precision::ApplyScaledInverse<Field>( applyLowInv, Z ); };
+    auto subtractA =
+      [&]( const DistMatrix<Field>& Z, DistMatrix<Field>& R )
+      { Hemm( LEFT, uplo, Field(-1), A, Z, Field(1), R ); };
+
+    DistMatrix<Field> X(g);
+    bool converged;
+    const Int numIts =
+      mixed_precision::Refine<Field>
+      ( subtractA, applyAInv, B, X, ctrl, converged );
+
+    if( !converged && ctrl.fallback )
+    {
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("Falling back to a full-precision solve");
+        HPDSolve( uplo, NORMAL, A, B );
+    }
+    else
+        B = X;
+    return numIts;
+}
+
+#define PROTO(Field) \
+  template Int MixedPrecisionLinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionLinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template Int MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
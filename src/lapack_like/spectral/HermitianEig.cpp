@@ -579,13 +579,28 @@ BlackBox
     DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
     DistMatrix<F,VC,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars );
+    BandReflectors<F> bandReflectors;
+    const bool twoStage =
+      ctrl.tridiagCtrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE;
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bandReflectors, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
 
+    auto backtransform = [&]( AbstractDistMatrix<F>& Q )
+      {
+        if( twoStage )
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, bandReflectors, Q );
+        else
+            herm_tridiag::ApplyQ
+            ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+      };
     if( ctrl.tridiagEigCtrl.accumulateEigVecs )
     {
         DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre );
@@ -593,7 +608,7 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        backtransform( Q );
     }
     else
     {
@@ -602,7 +617,7 @@ BlackBox
 
         info.tridiagEigInfo =
           HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
-        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+        backtransform( Q );
     }
 
     return info;
@@ -866,7 +881,14 @@ MRRR
             timer.Start();
     }
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    BandReflectors<F> bandReflectors;
+    const bool twoStage =
+      ctrl.tridiagCtrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE;
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bandReflectors, ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -986,7 +1008,11 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( twoStage )
+        herm_tridiag::ApplyQ
+        ( LEFT, uplo, NORMAL, A, householderScalars, bandReflectors, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
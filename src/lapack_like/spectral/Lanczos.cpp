@@ -94,6 +94,75 @@ Base<Field> LanczosDecomp
     return LanczosDecomp( n, applyA, V, T, v, basisSize );
 }
 
+template<typename Field>
+void SStepLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& TPre,
+        Int basisSize,
+  const SStepCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    if( ctrl.s < 1 )
+        LogicError("The step size must be positive");
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> TProx( TPre );
+    auto& T = TProx.Get();
+    auto& TLoc = T.Matrix();
+
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    basisSize = Min(n,basisSize);
+
+    DistMultiVec<Field> x(grid), y(grid);
+    DistSparseMultPlan<Field> multPlan;
+    auto applyA =
+      [&]( const Matrix<Field>& xLoc, Matrix<Field>& yLoc )
+      {
+          x.Matrix() = xLoc;
+          Multiply( NORMAL, Field(1), A, x, Field(0), y, multPlan );
+          yLoc = y.LockedMatrix();
+      };
+
+    // Create the initial unit-vector
+    // ------------------------------
+    Uniform( x, n, 1 );
+    Zeros( y, n, 1 );
+    Shift( x, SampleUniform<Field>() );
+    x *= Real(1)/FrobeniusNorm( x );
+
+    Matrix<Field> VLoc, H;
+    Zeros( VLoc, x.LocalHeight(), basisSize+1 );
+    Zeros( H, basisSize+1, basisSize );
+    auto v0Loc = VLoc( ALL, IR(0) );
+    v0Loc = x.LockedMatrix();
+
+    // Since the basis is fully reorthogonalized, the Hessenberg matrix is
+    // numerically tridiagonal
+    vector<Field> shifts;
+    SStepInfo info;
+    Int numCols = 0;
+    while( numCols < basisSize )
+    {
+        const Int numSteps = Min( ctrl.s, basisSize-numCols );
+        if( !sstep::Extend
+            ( applyA, ctrl.s, numSteps, shifts, VLoc, H, numCols, comm,
+              info ) )
+            break;
+    }
+
+    Zeros( T, numCols, numCols );
+    for( Int k=0; k<numCols; ++k )
+    {
+        TLoc(k,k) = RealPart(H(k,k));
+        if( k < numCols-1 )
+            TLoc(k+1,k) = TLoc(k,k+1) = Abs(H(k+1,k));
+    }
+}
+
 #define PROTO(Field) \
   template void Lanczos \
   ( const SparseMatrix<Field>& A, \
@@ -114,7 +183,12 @@ Base<Field> LanczosDecomp
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
-          Int basisSize );
+          Int basisSize ); \
+  template void SStepLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& T, \
+          Int basisSize, \
+    const SStepCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -662,9 +662,38 @@ SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& UPre,
         AbstractDistMatrix<Base<Field>>& sPre,
-        AbstractDistMatrix<Field>& VPre )
+        AbstractDistMatrix<Field>& VPre,
+  const qr::TSQRCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.alg != qr::TSQR_HOUSEHOLDER ||
+        ctrl.tree != qr::TSQR_BINARY_TREE )
+    {
+        // Since every process has a copy of R, each can redundantly compute
+        // its SVD and form its rows of U without any further communication
+        DistMatrixWriteProxy<Field,Field,VC,STAR> UProx( UPre );
+        DistMatrixWriteProxy<Base<Field>,Base<Field>,STAR,STAR> sProx( sPre );
+        DistMatrixWriteProxy<Field,Field,STAR,STAR> VProx( VPre );
+        auto& U = UProx.Get();
+        auto& s = sProx.Get();
+        auto& V = VProx.Get();
+
+        const Int m = A.Height();
+        const Int n = A.Width();
+        if( m < n )
+            LogicError("svd::TSQR assumes m >= n");
+        Copy( A, U );
+        DistMatrix<Field,STAR,STAR> R(U.Grid());
+        qr::ExplicitTS( U, R, ctrl );
+
+        Matrix<Field> UR;
+        s.Resize( n, 1 );
+        V.Resize( n, n );
+        auto info = SVD( R.Matrix(), UR, s.Matrix(), V.Matrix() );
+        Matrix<Field> Q( U.Matrix() );
+        Gemm( NORMAL, NORMAL, Field(1), Q, UR, Field(0), U.Matrix() );
+        return info;
+    }
 
     DistMatrixWriteProxy<Field,Field,VC,STAR> UProx( UPre );
     DistMatrixWriteProxy<Base<Field>,Base<Field>,CIRC,CIRC> sProx( sPre );
@@ -766,7 +795,8 @@ SVDInfo TSQR
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& U, \
           AbstractDistMatrix<Base<Field>>& s, \
-          AbstractDistMatrix<Field>& V );
+          AbstractDistMatrix<Field>& V, \
+    const qr::TSQRCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -117,9 +117,17 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    BandReflectors<Field> bandReflectorsP, bandReflectorsQ;
+    const bool twoStage =
+      ctrl.bidiagCtrl.approach == BIDIAG_TWO_STAGE && m >= n;
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+        bidiag::TwoStage
+        ( A, householderScalarsP, householderScalarsQ,
+          bandReflectorsP, bandReflectorsQ, ctrl.bidiagCtrl );
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -173,8 +181,22 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    if( twoStage )
+    {
+        if( !avoidU )
+            bidiag::ApplyQ
+            ( LEFT, NORMAL, A, householderScalarsQ, bandReflectorsQ, U );
+        if( !avoidV )
+            bidiag::ApplyP
+            ( LEFT, NORMAL, A, householderScalarsP, bandReflectorsP, V );
+    }
+    else
+    {
+        if( !avoidU )
+            bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV )
+            bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -248,10 +270,19 @@ SVDInfo GolubReinsch
 
     // Bidiagonalize A
     Timer timer;
-    DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( ctrl.bidiagCtrl.approach == BIDIAG_TWO_STAGE )
+    {
+        // Neither the first-stage nor the band reflectors are needed
+        bidiag::ExplicitCondensed( A, ctrl.bidiagCtrl );
+    }
+    else
+    {
+        DistMatrix<Field,STAR,STAR> householderScalarsP(g),
+          householderScalarsQ(g);
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
@@ -0,0 +1,691 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See, for example, Campos and Roman's "Strategies for spectrum slicing based
+// on restarted Lanczos methods", Numerical Algorithms, 2012, and the
+// EVSL/SLEPc implementations of the same idea.
+//
+// By Sylvester's law of inertia, the number of negative entries of D in the
+// factorization A - sigma I = L D L^H is the number of eigenvalues of A which
+// are less than sigma. Counting the eigenvalues below the endpoints of each
+// slice therefore yields the exact number of eigenvalues that shift-and-invert
+// Lanczos must find within it, and, since the slices are disjoint, no
+// eigenvalue can be reported twice.
+
+namespace El {
+
+namespace spectrum_slice {
+
+template<typename Real>
+struct Slice
+{
+    Real lower, upper;
+    // The number of eigenvalues less than each of the endpoints
+    Int numBelowLower, numBelowUpper;
+
+    Int Size() const { return numBelowUpper-numBelowLower; }
+};
+
+// Form a full copy of A over each subcommunicator, where subcommunicator s
+// consists of the ranks [subcommOffs[s],subcommOffs[s+1]) of A's communicator.
+// The diagonal is explicitly stored so that the copies may be shifted in place.
+template<typename Field>
+void RedistributeToSubcomms
+( const DistSparseMatrix<Field>& A,
+  const vector<int>& subcommOffs,
+        DistSparseMatrix<Field>& ASub )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int numSubcomms = subcommOffs.size()-1;
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+
+    // Mirror the row distribution of a DistSparseMatrix over each subgrid
+    vector<Int> blocksizes(numSubcomms);
+    for( int s=0; s<numSubcomms; ++s )
+    {
+        const int subSize = subcommOffs[s+1]-subcommOffs[s];
+        blocksizes[s] = n / subSize;
+        if( blocksizes[s]*subSize < n || n == 0 )
+            ++blocksizes[s];
+    }
+    auto owner = [&]( int s, Int i ) { return subcommOffs[s]+i/blocksizes[s]; };
+
+    vector<int> sendCounts(commSize,0);
+    for( int s=0; s<numSubcomms; ++s )
+    {
+        for( Int e=0; e<numLocalEntries; ++e )
+            ++sendCounts[owner(s,A.Row(e))];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ++sendCounts[owner(s,A.GlobalRow(iLoc))];
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+
+    vector<Entry<Field>> sendBuf(totalSend);
+    auto offs = sendOffs;
+    for( int s=0; s<numSubcomms; ++s )
+    {
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int i = A.Row(e);
+            sendBuf[offs[owner(s,i)]++] =
+              Entry<Field>{ i, A.Col(e), A.Value(e) };
+        }
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            sendBuf[offs[owner(s,i)]++] = Entry<Field>{ i, i, Field(0) };
+        }
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+
+    // Duplicate entries are summed, so the explicit zeros are harmless
+    ASub.Resize( n, n );
+    ASub.Reserve( recvBuf.size() );
+    for( const auto& entry : recvBuf )
+        ASub.QueueUpdate( entry );
+    ASub.ProcessQueues();
+}
+
+// Factor A - shift I and return the number of eigenvalues of A less than
+// the shift. If the factorization is (numerically) singular, the shift is
+// perturbed until it is not, and the shift which was used is returned.
+// A positive (negative) direction only moves the shift upwards (downwards),
+// whereas a direction of zero alternates about the original shift.
+template<typename Field>
+Int NumEigsBelow
+( const DistSparseMatrix<Field>& A,
+        DistSparseMatrix<Field>& AShift,
+        DistSparseLDLFactorization<Field>& factorization,
+        Base<Field>& shift,
+  const Base<Field>& scale,
+        int direction,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int maxPerturbations = 10;
+    const Real perturbation = Sqrt(limits::Epsilon<Real>())*scale;
+    const Real origShift = shift;
+    for( Int attempt=0; attempt<=maxPerturbations; ++attempt )
+    {
+        AShift = A;
+        ShiftDiagonal( AShift, -shift, 0, true );
+        factorization.ChangeNonzeroValues( AShift );
+        bool singular = false;
+        try { factorization.Factor( ctrl.frontType ); }
+        catch( ZeroPivotException& ) { singular = true; }
+        catch( SingularMatrixException& ) { singular = true; }
+        if( !singular )
+        {
+            const InertiaType inertia = factorization.Inertia();
+            if( inertia.numZero == 0 &&
+                inertia.numPositive+inertia.numNegative == n )
+                return inertia.numNegative;
+        }
+        // Alternate the direction of the perturbations about the original
+        // shift (unless a direction was requested) while increasing their
+        // magnitudes
+        const Real step = (attempt+1)*perturbation;
+        if( direction == 0 )
+            shift += ( attempt % 2 == 0 ? step : -step );
+        else
+            shift = origShift + direction*step;
+    }
+    RuntimeError("Could not find a nonsingular shift near ",shift);
+    return -1;
+}
+
+// Find the eigenpairs within [slice.lower,slice.upper) using shift-and-invert
+// Lanczos about 'shift', for which 'factorization' must hold the factored
+// A - shift I. The converged Ritz vectors are locked and, upon each restart,
+// the new Lanczos basis is kept orthogonal to them. The eigenvalues are
+// returned in ascending order alongside the local rows of the eigenvectors.
+template<typename Field>
+void SliceLanczos
+( const DistSparseLDLFactorization<Field>& factorization,
+  const Base<Field>& shift,
+  const Slice<Base<Field>>& slice,
+        DistMultiVec<Field>& q,
+        vector<Base<Field>>& eigs,
+        Matrix<Field>& ZLoc,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    mpi::Comm comm = q.Grid().Comm();
+    const Int n = q.Height();
+    const Int localHeight = q.LocalHeight();
+    const Int numWanted = slice.Size();
+    const Real eps = limits::Epsilon<Real>();
+
+    auto norm = [&]( const Matrix<Field>& x )
+      {
+          const Real localNorm = FrobeniusNorm( x );
+          return Sqrt( mpi::AllReduce( localNorm*localNorm, comm ) );
+      };
+    // x := (I - Q Q^H) x
+    auto projectOut = [&]( const Matrix<Field>& Q, Matrix<Field>& x )
+      {
+          if( Q.Width() == 0 )
+              return;
+          Matrix<Field> h;
+          Gemm( ADJOINT, NORMAL, Field(1), Q, x, h );
+          mpi::AllReduce( h.Buffer(), h.Height(), comm );
+          Gemm( NORMAL, NORMAL, Field(-1), Q, h, Field(1), x );
+      };
+
+    eigs.resize( 0 );
+    Zeros( ZLoc, localHeight, 0 );
+    Matrix<Field> v0;
+    Uniform( v0, localHeight, 1 );
+    for( Int restart=0; restart<=ctrl.maxRestarts; ++restart )
+    {
+        const Int numLocked = eigs.size();
+        const Int numRemaining = numWanted - numLocked;
+        const Int basisSize =
+          Min( 2*numRemaining+ctrl.extraBasisSize, n-numLocked );
+        if( numRemaining == 0 || basisSize <= 0 )
+            break;
+
+        // Build the Lanczos basis with full reorthogonalization
+        // =====================================================
+        Matrix<Field> V;
+        Zeros( V, localHeight, basisSize+1 );
+        vector<Real> alpha(basisSize), beta(basisSize);
+        auto v = V( ALL, IR(0) );
+        v = v0;
+        for( Int pass=0; pass<2; ++pass )
+            projectOut( ZLoc, v );
+        Real vNorm = norm( v );
+        if( vNorm == Real(0) )
+        {
+            Uniform( v, localHeight, 1 );
+            projectOut( ZLoc, v );
+            vNorm = norm( v );
+        }
+        v *= Real(1)/vNorm;
+
+        Int numBasis = basisSize;
+        for( Int j=0; j<basisSize; ++j )
+        {
+            auto vj = V( ALL, IR(j) );
+            q.Matrix() = vj;
+            factorization.Solve( q );
+            Matrix<Field> x( q.Matrix() );
+
+            alpha[j] = RealPart( mpi::AllReduce( Dot(vj,x), comm ) );
+            Axpy( Field(-alpha[j]), vj, x );
+            if( j > 0 )
+                Axpy( Field(-beta[j-1]), V(ALL,IR(j-1)), x );
+            for( Int pass=0; pass<2; ++pass )
+            {
+                projectOut( ZLoc, x );
+                projectOut( V(ALL,IR(0,j+1)), x );
+            }
+            beta[j] = norm( x );
+            if( beta[j] <= eps*Abs(alpha[j]) )
+            {
+                // We have found an invariant subspace
+                beta[j] = 0;
+                numBasis = j+1;
+                break;
+            }
+            auto vNext = V( ALL, IR(j+1) );
+            vNext = x;
+            vNext *= Real(1)/beta[j];
+        }
+
+        // Extract the Ritz pairs
+        // ======================
+        Matrix<Real> d, dSub, theta, S;
+        Zeros( d, numBasis, 1 );
+        Zeros( dSub, Max(numBasis-1,0), 1 );
+        for( Int j=0; j<numBasis; ++j )
+        {
+            d(j) = alpha[j];
+            if( j < numBasis-1 )
+                dSub(j) = beta[j];
+        }
+        HermitianTridiagEig( d, dSub, theta, S );
+        const Real betaLast = beta[numBasis-1];
+
+        vector<ValueInt<Real>> converged;
+        vector<Int> unconverged;
+        for( Int i=0; i<numBasis; ++i )
+        {
+            const Real theta_i = theta(i);
+            if( theta_i == Real(0) )
+                continue;
+            const Real lambda = shift + Real(1)/theta_i;
+            if( lambda < slice.lower || lambda >= slice.upper )
+                continue;
+            const Real residual = Abs(betaLast*S(numBasis-1,i));
+            if( residual <= ctrl.tol*Abs(theta_i) )
+                converged.push_back( ValueInt<Real>{ Abs(theta_i), i } );
+            else
+                unconverged.push_back( i );
+        }
+        // Prefer the Ritz values nearest to the shift
+        std::sort
+        ( converged.begin(), converged.end(), ValueInt<Real>::Greater );
+        const Int numNew = Min( Int(converged.size()), numRemaining );
+        if( ctrl.progress && mpi::Rank(comm) == 0 )
+            Output
+            ("  restart ",restart,": ",numNew," new eigenpairs (",
+             numLocked+numNew," of ",numWanted,")");
+
+        // Lock the converged Ritz vectors
+        // ===============================
+        auto VBasis = V( ALL, IR(0,numBasis) );
+        if( numNew > 0 )
+        {
+            Matrix<Field> SNew;
+            Zeros( SNew, numBasis, numNew );
+            for( Int k=0; k<numNew; ++k )
+            {
+                const Int i = converged[k].index;
+                for( Int s=0; s<numBasis; ++s )
+                    SNew(s,k) = S(s,i);
+                eigs.push_back( shift + Real(1)/theta(i) );
+            }
+            Matrix<Field> ZNew;
+            Zeros( ZNew, localHeight, numLocked+numNew );
+            auto ZOld = ZNew( ALL, IR(0,numLocked) );
+            auto ZAppend = ZNew( ALL, IR(numLocked,numLocked+numNew) );
+            ZOld = ZLoc;
+            Gemm( NORMAL, NORMAL, Field(1), VBasis, SNew, Field(0), ZAppend );
+            ZLoc = ZNew;
+        }
+
+        // Restart from the sum of the unconverged Ritz vectors in the slice
+        // (or a random vector if there are none)
+        if( unconverged.empty() )
+        {
+            Uniform( v0, localHeight, 1 );
+        }
+        else
+        {
+            Matrix<Field> s;
+            Zeros( s, numBasis, 1 );
+            for( const Int i : unconverged )
+                for( Int t=0; t<numBasis; ++t )
+                    s(t) += S(t,i);
+            Gemm( NORMAL, NORMAL, Field(1), VBasis, s, Field(0), v0 );
+        }
+    }
+
+    // Sort the eigenpairs in ascending order
+    const Int numFound = eigs.size();
+    vector<ValueInt<Real>> order(numFound);
+    for( Int k=0; k<numFound; ++k )
+        order[k] = ValueInt<Real>{ eigs[k], k };
+    std::sort( order.begin(), order.end(), ValueInt<Real>::Lesser );
+    Matrix<Field> ZSort;
+    Zeros( ZSort, localHeight, numFound );
+    for( Int k=0; k<numFound; ++k )
+    {
+        eigs[k] = order[k].value;
+        auto zSort = ZSort( ALL, IR(k) );
+        zSort = ZLoc( ALL, IR(order[k].index) );
+    }
+    ZLoc = ZSort;
+}
+
+template<typename Field>
+void Helper
+( const DistSparseMatrix<Field>& A,
+  const Base<Field>& lowerBound,
+  const Base<Field>& upperBound,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>* Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    if( ctrl.maxSliceSize <= 0 )
+        LogicError("The maximum slice size must be positive");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    if( n == 0 || lowerBound >= upperBound )
+    {
+        Zeros( w, 0, 1 );
+        if( Z != nullptr )
+        {
+            Z->SetGrid( A.Grid() );
+            Zeros( *Z, n, 0 );
+        }
+        return;
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real scale = Max( Max(Abs(lowerBound),Abs(upperBound)),
+                            upperBound-lowerBound );
+
+    // Split the communicator into contiguous subcommunicators
+    // =======================================================
+    const int numSubcomms =
+      ( ctrl.numSubcomms > 0 ? int(Min(ctrl.numSubcomms,Int(commSize)))
+                             : commSize );
+    vector<int> subcommOffs(numSubcomms+1);
+    for( int s=0; s<=numSubcomms; ++s )
+        subcommOffs[s] = (s*commSize) / numSubcomms;
+    int subcomm = 0;
+    while( subcommOffs[subcomm+1] <= commRank )
+        ++subcomm;
+    mpi::Comm subComm;
+    mpi::Split( comm, subcomm, commRank, subComm );
+    const Grid subGrid( subComm );
+    mpi::Free( subComm );
+    const bool subRoot = ( subGrid.Rank() == 0 );
+
+    DistSparseMatrix<Field> ASub(subGrid), AShift(subGrid);
+    RedistributeToSubcomms( A, subcommOffs, ASub );
+    DistSparseLDLFactorization<Field> factorization;
+    factorization.Initialize( ASub, true, ctrl.bisectCtrl );
+
+    // Each subcommunicator works independently between the collectives over
+    // the full communicator, so a failure within one of them must be agreed
+    // upon before the next such collective lest the others wait forever
+    auto agreeOnError = [&]( string error )
+      {
+          const int failed = ( error.empty() ? 0 : 1 );
+          if( mpi::AllReduce( failed, mpi::MAX, comm ) == 0 )
+              return;
+          if( failed )
+          {
+              if( error.back() == '\n' )
+                  error.pop_back();
+              RuntimeError(error);
+          }
+          RuntimeError("Spectrum slicing failed on another subcommunicator");
+      };
+
+    // Count the eigenvalues below each shift, with the shifts distributed
+    // over the subcommunicators in a round-robin manner. The (possibly
+    // perturbed) shifts are returned in place.
+    auto countBelow = [&]( vector<Real>& shifts, const vector<int>& directions )
+      {
+          const Int numShifts = shifts.size();
+          vector<Real> usedShifts(numShifts,Real(0));
+          vector<Int> counts(numShifts,0);
+          string error;
+          try
+          {
+              for( Int k=subcomm; k<numShifts; k+=numSubcomms )
+              {
+                  Real shift = shifts[k];
+                  const Int numBelow =
+                    NumEigsBelow
+                    ( ASub, AShift, factorization, shift, scale,
+                      directions[k], ctrl );
+                  if( subRoot )
+                  {
+                      usedShifts[k] = shift;
+                      counts[k] = numBelow;
+                  }
+              }
+          }
+          catch( std::exception& e ) { error = e.what(); }
+          agreeOnError( error );
+          mpi::AllReduce( usedShifts.data(), numShifts, comm );
+          mpi::AllReduce( counts.data(), numShifts, comm );
+          shifts = usedShifts;
+          return counts;
+      };
+
+    // Partition the interval into slices of bounded size
+    // ==================================================
+    // The endpoints are only ever perturbed into the interior of
+    // [lowerBound,upperBound) so that no eigenvalue outside of it is
+    // returned. The price is that, if A - lowerBound I is numerically
+    // singular, the eigenvalues within a small multiple of sqrt(eps) scale
+    // above lowerBound may be omitted.
+    vector<Slice<Real>> slices;
+    {
+        vector<Real> shifts{ lowerBound, upperBound };
+        auto counts = countBelow( shifts, vector<int>{ 1, -1 } );
+        if( shifts[0] < shifts[1] )
+            slices.push_back
+            ( Slice<Real>{ shifts[0], shifts[1], counts[0], counts[1] } );
+    }
+    const Real minWidth = 100*eps*scale;
+    const Int maxLevels = 64;
+    for( Int level=0; level<maxLevels; ++level )
+    {
+        vector<Real> midpoints;
+        vector<bool> split(slices.size(),false);
+        for( size_t k=0; k<slices.size(); ++k )
+        {
+            const auto& slice = slices[k];
+            if( slice.Size() > ctrl.maxSliceSize &&
+                slice.upper-slice.lower > minWidth )
+            {
+                split[k] = true;
+                midpoints.push_back( (slice.lower+slice.upper)/Real(2) );
+            }
+        }
+        if( midpoints.empty() )
+            break;
+        auto counts =
+          countBelow( midpoints, vector<int>(midpoints.size(),0) );
+
+        vector<Slice<Real>> newSlices;
+        Int midIndex = 0;
+        for( size_t k=0; k<slices.size(); ++k )
+        {
+            const auto& slice = slices[k];
+            if( !split[k] )
+            {
+                newSlices.push_back( slice );
+                continue;
+            }
+            const Real mid = midpoints[midIndex];
+            const Int numBelowMid = counts[midIndex++];
+            if( mid <= slice.lower || mid >= slice.upper )
+            {
+                newSlices.push_back( slice );
+                continue;
+            }
+            newSlices.push_back
+            ( Slice<Real>
+              { slice.lower, mid, slice.numBelowLower, numBelowMid } );
+            newSlices.push_back
+            ( Slice<Real>
+              { mid, slice.upper, numBelowMid, slice.numBelowUpper } );
+        }
+        slices = newSlices;
+    }
+    {
+        vector<Slice<Real>> nonemptySlices;
+        for( const auto& slice : slices )
+            if( slice.Size() > 0 )
+                nonemptySlices.push_back( slice );
+        slices = nonemptySlices;
+    }
+    const Int numSlices = slices.size();
+    if( ctrl.progress && commRank == 0 )
+        Output
+        (slices.empty() ? 0 : slices.back().numBelowUpper-
+                              slices.front().numBelowLower,
+         " eigenvalues in ",numSlices," slices");
+
+    // Assign the largest remaining slice to the least loaded subcommunicator
+    // ======================================================================
+    vector<int> sliceOwners(numSlices);
+    {
+        vector<ValueInt<Int>> sizes(numSlices);
+        for( Int k=0; k<numSlices; ++k )
+            sizes[k] = ValueInt<Int>{ slices[k].Size(), k };
+        std::stable_sort
+        ( sizes.begin(), sizes.end(), ValueInt<Int>::Greater );
+        vector<Int> loads(numSubcomms,0);
+        for( const auto& size : sizes )
+        {
+            const int owner =
+              std::min_element(loads.begin(),loads.end()) - loads.begin();
+            sliceOwners[size.index] = owner;
+            loads[owner] += size.value;
+        }
+    }
+
+    // Compute the eigenpairs within each of our slices
+    // ================================================
+    DistMultiVec<Field> q(subGrid);
+    Zeros( q, n, 1 );
+    vector<vector<Real>> sliceEigs(numSlices);
+    vector<Matrix<Field>> sliceVecs(numSlices);
+    string error;
+    try
+    {
+        for( Int k=0; k<numSlices; ++k )
+        {
+            if( sliceOwners[k] != subcomm )
+                continue;
+            const auto& slice = slices[k];
+            if( ctrl.progress && subRoot )
+                Output
+                ("Slice [",slice.lower,",",slice.upper,") with ",slice.Size(),
+                 " eigenvalues");
+            Real shift = (slice.lower+slice.upper)/Real(2);
+            NumEigsBelow( ASub, AShift, factorization, shift, scale, 0, ctrl );
+            SliceLanczos
+            ( factorization, shift, slice, q, sliceEigs[k], sliceVecs[k],
+              ctrl );
+        }
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    agreeOnError( error );
+
+    // Ensure that every eigenvalue was found
+    // ======================================
+    vector<Int> numFound(numSlices,0);
+    for( Int k=0; k<numSlices; ++k )
+        if( sliceOwners[k] == subcomm && subRoot )
+            numFound[k] = sliceEigs[k].size();
+    mpi::AllReduce( numFound.data(), numSlices, comm );
+    vector<Int> sliceOffs(numSlices);
+    Int numEigs = 0;
+    for( Int k=0; k<numSlices; ++k )
+    {
+        if( numFound[k] != slices[k].Size() )
+            RuntimeError
+            ("Only found ",numFound[k]," of the ",slices[k].Size(),
+             " eigenvalues in [",slices[k].lower,",",slices[k].upper,")");
+        sliceOffs[k] = numEigs;
+        numEigs += numFound[k];
+    }
+
+    // Gather the eigenvalues onto every process
+    // =========================================
+    vector<Real> wBuf(numEigs,Real(0));
+    for( Int k=0; k<numSlices; ++k )
+        if( sliceOwners[k] == subcomm && subRoot )
+            for( Int j=0; j<numFound[k]; ++j )
+                wBuf[sliceOffs[k]+j] = sliceEigs[k][j];
+    mpi::AllReduce( wBuf.data(), numEigs, comm );
+    w.Resize( numEigs, 1 );
+    for( Int j=0; j<numEigs; ++j )
+        w(j) = wBuf[j];
+    if( Z == nullptr )
+        return;
+
+    // Redistribute the eigenvectors over the grid of A
+    // ================================================
+    Z->SetGrid( A.Grid() );
+    Zeros( *Z, n, numEigs );
+    const Int localHeight = q.LocalHeight();
+    vector<int> sendCounts(commSize,0);
+    for( Int k=0; k<numSlices; ++k )
+        if( sliceOwners[k] == subcomm )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                sendCounts[Z->RowOwner(q.GlobalRow(iLoc))] += numFound[k];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Entry<Field>> sendBuf(totalSend);
+    auto offs = sendOffs;
+    for( Int k=0; k<numSlices; ++k )
+    {
+        if( sliceOwners[k] != subcomm )
+            continue;
+        const auto& ZLoc = sliceVecs[k];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = q.GlobalRow(iLoc);
+            const int owner = Z->RowOwner(i);
+            for( Int j=0; j<numFound[k]; ++j )
+                sendBuf[offs[owner]++] =
+                  Entry<Field>{ i, sliceOffs[k]+j, ZLoc(iLoc,j) };
+        }
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    for( const auto& entry : recvBuf )
+        Z->SetLocal( Z->LocalRow(entry.i), entry.j, entry.value );
+}
+
+} // namespace spectrum_slice
+
+template<typename Field>
+void HermitianEig
+( const DistSparseMatrix<Field>& A,
+  const Base<Field>& lowerBound,
+  const Base<Field>& upperBound,
+        Matrix<Base<Field>>& w,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    spectrum_slice::Helper
+    ( A, lowerBound, upperBound, w, (DistMultiVec<Field>*)nullptr, ctrl );
+}
+
+template<typename Field>
+void HermitianEig
+( const DistSparseMatrix<Field>& A,
+  const Base<Field>& lowerBound,
+  const Base<Field>& upperBound,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& Z,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    spectrum_slice::Helper( A, lowerBound, upperBound, w, &Z, ctrl );
+}
+
+#define PROTO(Field) \
+  template void HermitianEig \
+  ( const DistSparseMatrix<Field>& A, \
+    const Base<Field>& lowerBound, \
+    const Base<Field>& upperBound, \
+          Matrix<Base<Field>>& w, \
+    const SpectrumSliceCtrl<Base<Field>>& ctrl ); \
+  template void HermitianEig \
+  ( const DistSparseMatrix<Field>& A, \
+    const Base<Field>& lowerBound, \
+    const Base<Field>& upperBound, \
+          Matrix<Base<Field>>& w, \
+          DistMultiVec<Field>& Z, \
+    const SpectrumSliceCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
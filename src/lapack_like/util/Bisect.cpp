@@ -12,12 +12,173 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
+#include "./MultilevelBisect.hpp"
+
 namespace El {
 
+bool NativeBisection( const BisectCtrl& ctrl, bool distributed )
+{
+    if( ctrl.method == BISECT_NATIVE )
+        return true;
+    if( ctrl.method == BISECT_METIS )
+        return false;
+#ifdef EL_HAVE_PARMETIS
+    return false;
+#elif defined(EL_HAVE_METIS)
+    return distributed && !ctrl.sequential;
+#else
+    return true;
+#endif
+}
+
+namespace {
+
+// Convert a partition into the left half (0), right half (1), and separator
+// (2) into a permutation which orders the vertices in that order
+void PartitionToPerm( const vector<Int>& part, Int* sizes, vector<Int>& perm )
+{
+    const Int numSources = part.size();
+    for( Int j=0; j<3; ++j )
+        sizes[j] = 0;
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[part[s]];
+    Int offsets[3];
+    offsets[0] = 0;
+    offsets[1] = sizes[0];
+    offsets[2] = sizes[1] + offsets[1];
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[part[s]]++;
+}
+
+Int NativeBisect
+( const Graph& graph,
+  Graph& leftChild,
+  Graph& rightChild,
+  vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int numEdges = graph.NumEdges();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    vector<Int> offsets( offsetBuf, offsetBuf+numSources+1 );
+    vector<Int> targets( targetBuf, targetBuf+numEdges );
+    bisect::Symmetrize( numSources, offsets, targets );
+
+    vector<Int> part;
+    bisect::MultilevelBisect( offsets, targets, part, ctrl.numSeqSeps );
+    Int sizes[3];
+    PartitionToPerm( part, sizes, perm );
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+    return sizes[2];
+}
+
+// Every process gathers the (typically already small) graph and runs its
+// share of the independent trials, and the best separator is then chosen
+Int NativeBisect
+( const DistGraph& graph, 
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child, 
+        DistMap& perm,
+        bool& onLeft, 
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+
+    // Gather the number of connections of each source
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    vector<Int> localLengths( numLocalSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        localLengths[s] = offsetBuf[s+1] - offsetBuf[s];
+    vector<int> sourceSizes( commSize ), sourceOffs;
+    const int numLocalSourcesInt = numLocalSources;
+    mpi::AllGather
+    ( &numLocalSourcesInt, 1, sourceSizes.data(), 1, grid.Comm() );
+    Scan( sourceSizes, sourceOffs );
+    vector<Int> offsets( numSources+1 );
+    mpi::AllGather
+    ( localLengths.data(), numLocalSources,
+      offsets.data(), sourceSizes.data(), sourceOffs.data(), grid.Comm() );
+    Int numEdges = 0;
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int numConnections = offsets[s];
+        offsets[s] = numEdges;
+        numEdges += numConnections;
+    }
+    offsets[numSources] = numEdges;
+
+    // Gather the connections
+    vector<int> edgeSizes( commSize ), edgeOffs;
+    const int numLocalEdgesInt = numLocalEdges;
+    mpi::AllGather
+    ( &numLocalEdgesInt, 1, edgeSizes.data(), 1, grid.Comm() );
+    Scan( edgeSizes, edgeOffs );
+    vector<Int> targets( numEdges );
+    mpi::AllGather
+    ( targetBuf, numLocalEdges,
+      targets.data(), edgeSizes.data(), edgeOffs.data(), grid.Comm() );
+    bisect::Symmetrize( numSources, offsets, targets );
+
+    // Spread the trials over the team, each with a distinct seed
+    const Int numTrials =
+      Max( Int(1), (ctrl.numDistSeps+commSize-1)/commSize );
+    vector<Int> part;
+    const Int sepSize =
+      bisect::MultilevelBisect
+      ( offsets, targets, part, numTrials, commRank );
+    Int sizes[3];
+    vector<Int> seqPerm;
+    PartitionToPerm( part, sizes, seqPerm );
+
+    // Keep the smallest separator, breaking ties with the balance and then
+    // with the rank
+    Int result[2] = { sepSize, Abs(sizes[0]-sizes[1]) };
+    vector<Int> results( 2*commSize );
+    mpi::AllGather( result, 2, results.data(), 2, grid.Comm() );
+    int bestRank = 0;
+    for( int q=1; q<commSize; ++q )
+        if( results[2*q] < results[2*bestRank] ||
+            (results[2*q] == results[2*bestRank] &&
+             results[2*q+1] < results[2*bestRank+1]) )
+            bestRank = q;
+    mpi::Broadcast( part.data(), numSources, bestRank, grid.Comm() );
+    PartitionToPerm( part, sizes, seqPerm );
+
+    perm.SetGrid( grid );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, seqPerm[firstLocalSource+s] );
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
+    return sizes[2];
+}
+
+} // anonymous namespace
+
 Int Bisect
 ( const Graph& graph,
   Graph& leftChild,
@@ -26,6 +187,8 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( NativeBisection( ctrl ) )
+        return NativeBisect( graph, leftChild, rightChild, perm, ctrl );
 #ifdef EL_HAVE_METIS
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -104,6 +267,8 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( NativeBisection( ctrl, true ) )
+        return NativeBisect( graph, childGrid, child, perm, onLeft, ctrl );
 #ifdef EL_HAVE_METIS
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
@@ -0,0 +1,720 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <queue>
+#include <random>
+
+#include "./MultilevelBisect.hpp"
+
+namespace El {
+namespace bisect {
+
+namespace {
+
+// Stop coarsening once a graph has at most this many vertices
+const Int coarsenTo = 100;
+// ...or once a level fails to remove at least this fraction of the vertices
+const double minCoarsenReduction = 0.1;
+// The allowed deviation of each half's weight from half of the total
+const double imbalanceTol = 0.05;
+const Int numInitialTrials = 4;
+const Int maxRefinePasses = 4;
+
+typedef std::mt19937_64 Generator;
+
+struct Level
+{
+    Int n;
+    vector<Int> offsets, targets, edgeWeights, vertexWeights;
+    // Maps each vertex to its vertex in the next coarser level
+    vector<Int> coarseMap;
+};
+
+Int TotalWeight( const Level& level )
+{
+    Int total = 0;
+    for( const Int weight : level.vertexWeights )
+        total += weight;
+    return total;
+}
+
+// Heavy-edge matching: visit the vertices in a random order and match each
+// unmatched vertex with the unmatched neighbor which it shares the heaviest
+// edge with
+void Coarsen
+( Level& fine, Level& coarse, Int maxVertexWeight, Generator& generator )
+{
+    const Int n = fine.n;
+    vector<Int> order( n );
+    for( Int v=0; v<n; ++v )
+        order[v] = v;
+    std::shuffle( order.begin(), order.end(), generator );
+
+    vector<Int> match( n, -1 );
+    for( const Int v : order )
+    {
+        if( match[v] >= 0 )
+            continue;
+        Int best = -1, bestWeight = -1;
+        for( Int e=fine.offsets[v]; e<fine.offsets[v+1]; ++e )
+        {
+            const Int u = fine.targets[e];
+            if( match[u] < 0 && u != v &&
+                fine.edgeWeights[e] > bestWeight &&
+                fine.vertexWeights[u]+fine.vertexWeights[v] <= maxVertexWeight )
+            {
+                best = u;
+                bestWeight = fine.edgeWeights[e];
+            }
+        }
+        if( best >= 0 )
+        {
+            match[v] = best;
+            match[best] = v;
+        }
+        else
+            match[v] = v;
+    }
+
+    // Number the coarse vertices by their smallest constituent
+    fine.coarseMap.resize( n );
+    vector<Int> representatives;
+    representatives.reserve( n );
+    for( Int v=0; v<n; ++v )
+    {
+        if( v <= match[v] )
+        {
+            fine.coarseMap[v] = representatives.size();
+            fine.coarseMap[match[v]] = representatives.size();
+            representatives.push_back( v );
+        }
+    }
+    const Int numCoarse = representatives.size();
+
+    // Merge the adjacencies of each pair, summing the weights of parallel
+    // edges and dropping the edge between the pair
+    coarse.n = numCoarse;
+    coarse.offsets.resize( numCoarse+1 );
+    coarse.vertexWeights.resize( numCoarse );
+    coarse.targets.clear();
+    coarse.edgeWeights.clear();
+    coarse.targets.reserve( fine.targets.size() );
+    coarse.edgeWeights.reserve( fine.targets.size() );
+    vector<Int> position( numCoarse, -1 );
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        const Int rowStart = coarse.targets.size();
+        coarse.offsets[c] = rowStart;
+        const Int v = representatives[c];
+        const Int u = match[v];
+        coarse.vertexWeights[c] = fine.vertexWeights[v];
+        if( u != v )
+            coarse.vertexWeights[c] += fine.vertexWeights[u];
+        for( Int k=0; k<(u==v?1:2); ++k )
+        {
+            const Int w = ( k==0 ? v : u );
+            for( Int e=fine.offsets[w]; e<fine.offsets[w+1]; ++e )
+            {
+                const Int target = fine.coarseMap[fine.targets[e]];
+                if( target == c )
+                    continue;
+                if( position[target] >= rowStart )
+                {
+                    coarse.edgeWeights[position[target]] += fine.edgeWeights[e];
+                }
+                else
+                {
+                    position[target] = coarse.targets.size();
+                    coarse.targets.push_back( target );
+                    coarse.edgeWeights.push_back( fine.edgeWeights[e] );
+                }
+            }
+        }
+    }
+    coarse.offsets[numCoarse] = coarse.targets.size();
+}
+
+Int EdgeCut( const Level& level, const vector<Int>& part )
+{
+    Int cut = 0;
+    for( Int v=0; v<level.n; ++v )
+        for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+            if( part[level.targets[e]] != part[v] )
+                cut += level.edgeWeights[e];
+    return cut/2;
+}
+
+// The gain of moving each vertex to the other half, i.e., the weight of its
+// edges to the other half minus the weight of its edges to its own half
+void ComputeGains
+( const Level& level, const vector<Int>& part, vector<Int>& gains )
+{
+    gains.assign( level.n, 0 );
+    for( Int v=0; v<level.n; ++v )
+        for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+            gains[v] += ( part[level.targets[e]] != part[v] ?
+                          level.edgeWeights[e] : -level.edgeWeights[e] );
+}
+
+// Fiduccia-Mattheyses refinement of an edge bisection: each pass greedily
+// moves the unlocked vertex of highest gain (subject to the balance
+// constraint, or from the heavier half if the constraint is violated), locks
+// it, and finally rolls back to the best state encountered
+void Refine( const Level& level, vector<Int>& part, Int maxWeight )
+{
+    const Int n = level.n;
+    if( n < 2 )
+        return;
+    Int weights[2] = { 0, 0 };
+    for( Int v=0; v<n; ++v )
+        weights[part[v]] += level.vertexWeights[v];
+    vector<Int> gains;
+    ComputeGains( level, part, gains );
+    Int cut = EdgeCut( level, part );
+
+    typedef std::pair<Int,Int> GainEntry;
+    const Int maxStagnantMoves = Max( Int(50), n/100 );
+    vector<bool> locked( n );
+    vector<Int> moves;
+    for( Int pass=0; pass<maxRefinePasses; ++pass )
+    {
+        std::priority_queue<GainEntry> queues[2];
+        for( Int v=0; v<n; ++v )
+        {
+            locked[v] = false;
+            queues[part[v]].push( GainEntry(gains[v],v) );
+        }
+
+        auto imbalance = [&]()
+        { return Max( Max(weights[0],weights[1])-maxWeight, Int(0) ); };
+        const Int startCut = cut;
+        const Int startImbalance = imbalance();
+        Int bestCut = cut, bestImbalance = startImbalance;
+        Int numBestMoves = 0, numStagnantMoves = 0;
+        moves.clear();
+        while( numStagnantMoves < maxStagnantMoves )
+        {
+            // Discard the stale entries atop each queue
+            for( Int side=0; side<2; ++side )
+            {
+                auto& queue = queues[side];
+                while( !queue.empty() )
+                {
+                    const Int v = queue.top().second;
+                    if( locked[v] || part[v] != side ||
+                        queue.top().first != gains[v] )
+                        queue.pop();
+                    else
+                        break;
+                }
+            }
+
+            Int from = -1;
+            if( weights[0] > maxWeight || weights[1] > maxWeight )
+            {
+                from = ( weights[0] > weights[1] ? 0 : 1 );
+                if( queues[from].empty() )
+                    break;
+            }
+            else
+            {
+                Int bestGain = std::numeric_limits<Int>::min();
+                for( Int side=0; side<2; ++side )
+                {
+                    if( queues[side].empty() )
+                        continue;
+                    const Int v = queues[side].top().second;
+                    if( weights[1-side]+level.vertexWeights[v] > maxWeight )
+                        continue;
+                    if( gains[v] > bestGain )
+                    {
+                        bestGain = gains[v];
+                        from = side;
+                    }
+                }
+                if( from < 0 )
+                    break;
+            }
+
+            const Int v = queues[from].top().second;
+            queues[from].pop();
+            part[v] = 1-from;
+            locked[v] = true;
+            weights[from] -= level.vertexWeights[v];
+            weights[1-from] += level.vertexWeights[v];
+            cut -= gains[v];
+            gains[v] = -gains[v];
+            for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+            {
+                const Int u = level.targets[e];
+                gains[u] += ( part[u] == part[v] ?
+                              -2*level.edgeWeights[e] :
+                               2*level.edgeWeights[e] );
+                if( !locked[u] )
+                    queues[part[u]].push( GainEntry(gains[u],u) );
+            }
+            moves.push_back( v );
+
+            const Int newImbalance = imbalance();
+            if( newImbalance < bestImbalance ||
+                (newImbalance == bestImbalance && cut < bestCut) )
+            {
+                bestCut = cut;
+                bestImbalance = newImbalance;
+                numBestMoves = moves.size();
+                numStagnantMoves = 0;
+            }
+            else
+                ++numStagnantMoves;
+        }
+
+        // Roll back to the best state
+        for( Int k=moves.size()-1; k>=numBestMoves; --k )
+        {
+            const Int v = moves[k];
+            weights[part[v]] -= level.vertexWeights[v];
+            part[v] = 1-part[v];
+            weights[part[v]] += level.vertexWeights[v];
+        }
+        if( Int(moves.size()) > numBestMoves )
+            ComputeGains( level, part, gains );
+        cut = bestCut;
+        if( bestCut >= startCut && bestImbalance >= startImbalance )
+            break;
+    }
+}
+
+// Grow one half from a random vertex in breadth-first order until it holds
+// half of the weight (restarting from another random vertex whenever a
+// connected component is exhausted), then refine
+void InitialBisection
+( const Level& level, vector<Int>& part, Int maxWeight, Generator& generator )
+{
+    const Int n = level.n;
+    const Int halfWeight = TotalWeight(level) / 2;
+    vector<Int> trialPart( n );
+    Int bestCut = std::numeric_limits<Int>::max();
+    Int bestImbalance = std::numeric_limits<Int>::max();
+    std::uniform_int_distribution<Int> dist( 0, Max(n-1,Int(0)) );
+    for( Int trial=0; trial<numInitialTrials; ++trial )
+    {
+        std::fill( trialPart.begin(), trialPart.end(), 1 );
+        vector<bool> visited( n, false );
+        std::queue<Int> queue;
+        Int weight = 0, numVisited = 0, scan = dist(generator);
+        while( weight < halfWeight )
+        {
+            if( queue.empty() )
+            {
+                if( numVisited == n )
+                    break;
+                while( visited[scan] )
+                    scan = (scan+1) % n;
+                visited[scan] = true;
+                ++numVisited;
+                queue.push( scan );
+            }
+            const Int v = queue.front();
+            queue.pop();
+            trialPart[v] = 0;
+            weight += level.vertexWeights[v];
+            for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+            {
+                const Int u = level.targets[e];
+                if( !visited[u] )
+                {
+                    visited[u] = true;
+                    ++numVisited;
+                    queue.push( u );
+                }
+            }
+        }
+        Refine( level, trialPart, maxWeight );
+
+        Int weights[2] = { 0, 0 };
+        for( Int v=0; v<n; ++v )
+            weights[trialPart[v]] += level.vertexWeights[v];
+        const Int imbalance =
+          Max( Max(weights[0],weights[1])-maxWeight, Int(0) );
+        const Int cut = EdgeCut( level, trialPart );
+        if( imbalance < bestImbalance ||
+            (imbalance == bestImbalance && cut < bestCut) )
+        {
+            bestCut = cut;
+            bestImbalance = imbalance;
+            part = trialPart;
+        }
+    }
+}
+
+// Find a maximum matching of the bipartite graph of cut edges with the
+// algorithm of Hopcroft and Karp (using an explicit stack for the searches)
+void MaximumMatching
+( Int numLeft, Int numRight,
+  const vector<Int>& offsets, const vector<Int>& targets,
+  vector<Int>& matchLeft, vector<Int>& matchRight )
+{
+    matchLeft.assign( numLeft, -1 );
+    matchRight.assign( numRight, -1 );
+    vector<Int> level( numLeft ), next( numLeft ), stack;
+    std::queue<Int> queue;
+    while( true )
+    {
+        // Layer the left vertices by their alternating distance from a free
+        // left vertex
+        bool foundFree = false;
+        for( Int u=0; u<numLeft; ++u )
+        {
+            if( matchLeft[u] < 0 )
+            {
+                level[u] = 0;
+                queue.push( u );
+            }
+            else
+                level[u] = -1;
+        }
+        while( !queue.empty() )
+        {
+            const Int u = queue.front();
+            queue.pop();
+            for( Int e=offsets[u]; e<offsets[u+1]; ++e )
+            {
+                const Int w = matchRight[targets[e]];
+                if( w < 0 )
+                    foundFree = true;
+                else if( level[w] < 0 )
+                {
+                    level[w] = level[u] + 1;
+                    queue.push( w );
+                }
+            }
+        }
+        if( !foundFree )
+            break;
+
+        // Augment along vertex-disjoint shortest paths
+        for( Int u=0; u<numLeft; ++u )
+            next[u] = offsets[u];
+        for( Int root=0; root<numLeft; ++root )
+        {
+            if( matchLeft[root] >= 0 || level[root] != 0 )
+                continue;
+            stack.assign( 1, root );
+            while( !stack.empty() )
+            {
+                const Int u = stack.back();
+                if( next[u] == offsets[u+1] )
+                {
+                    level[u] = -1;
+                    stack.pop_back();
+                    continue;
+                }
+                const Int v = targets[next[u]++];
+                const Int w = matchRight[v];
+                if( w < 0 )
+                {
+                    for( const Int x : stack )
+                    {
+                        const Int y = targets[next[x]-1];
+                        matchLeft[x] = y;
+                        matchRight[y] = x;
+                    }
+                    break;
+                }
+                if( level[w] == level[u]+1 )
+                    stack.push_back( w );
+            }
+        }
+    }
+}
+
+// Convert an edge bisection into a vertex separator by placing a minimum
+// vertex cover of the cut edges (via Koenig's theorem) into the separator
+Int ExtractSeparator( const Level& level, vector<Int>& part )
+{
+    const Int n = level.n;
+    vector<Int> index( n, -1 ), leftVertices, rightVertices;
+    for( Int v=0; v<n; ++v )
+    {
+        for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+        {
+            if( part[level.targets[e]] != part[v] )
+            {
+                auto& vertices = ( part[v] == 0 ? leftVertices : rightVertices );
+                index[v] = vertices.size();
+                vertices.push_back( v );
+                break;
+            }
+        }
+    }
+    const Int numLeft = leftVertices.size();
+    const Int numRight = rightVertices.size();
+    vector<Int> offsets( numLeft+1, 0 ), targets;
+    for( Int i=0; i<numLeft; ++i )
+    {
+        const Int v = leftVertices[i];
+        for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+        {
+            const Int u = level.targets[e];
+            if( part[u] == 1 )
+                targets.push_back( index[u] );
+        }
+        offsets[i+1] = targets.size();
+    }
+    vector<Int> matchLeft, matchRight;
+    MaximumMatching
+    ( numLeft, numRight, offsets, targets, matchLeft, matchRight );
+
+    // The left vertices which are not reachable by alternating paths from the
+    // free left vertices, together with the reachable right vertices, form a
+    // minimum vertex cover
+    vector<bool> reachedLeft( numLeft, false ), reachedRight( numRight, false );
+    std::queue<Int> queue;
+    for( Int i=0; i<numLeft; ++i )
+    {
+        if( matchLeft[i] < 0 )
+        {
+            reachedLeft[i] = true;
+            queue.push( i );
+        }
+    }
+    while( !queue.empty() )
+    {
+        const Int i = queue.front();
+        queue.pop();
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+        {
+            const Int j = targets[e];
+            if( reachedRight[j] )
+                continue;
+            reachedRight[j] = true;
+            const Int k = matchRight[j];
+            if( k >= 0 && !reachedLeft[k] )
+            {
+                reachedLeft[k] = true;
+                queue.push( k );
+            }
+        }
+    }
+    for( Int i=0; i<numLeft; ++i )
+        if( !reachedLeft[i] )
+            part[leftVertices[i]] = 2;
+    for( Int j=0; j<numRight; ++j )
+        if( reachedRight[j] )
+            part[rightVertices[j]] = 2;
+
+    // Release any separator vertices which only neighbor one of the halves
+    Int sepSize = 0;
+    for( Int v=0; v<n; ++v )
+    {
+        if( part[v] != 2 )
+            continue;
+        bool touches[2] = { false, false };
+        for( Int e=level.offsets[v]; e<level.offsets[v+1]; ++e )
+        {
+            const Int p = part[level.targets[e]];
+            if( p < 2 )
+                touches[p] = true;
+        }
+        if( !touches[1] )
+            part[v] = 0;
+        else if( !touches[0] )
+            part[v] = 1;
+        else
+            ++sepSize;
+    }
+    return sepSize;
+}
+
+Int SingleBisection
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+        vector<Int>& part,
+        Generator& generator )
+{
+    // Form the hierarchy of coarse graphs
+    vector<Level> levels( 1 );
+    Level& finest = levels[0];
+    finest.n = offsets.size()-1;
+    finest.offsets = offsets;
+    finest.targets = targets;
+    finest.edgeWeights.assign( targets.size(), 1 );
+    finest.vertexWeights.assign( finest.n, 1 );
+    const Int totalWeight = finest.n;
+    const Int maxVertexWeight =
+      Max( Int(1), Int(1.5*totalWeight/coarsenTo) );
+    while( levels.back().n > coarsenTo )
+    {
+        Level coarse;
+        Coarsen( levels.back(), coarse, maxVertexWeight, generator );
+        const Int fineSize = levels.back().n;
+        if( coarse.n > (1-minCoarsenReduction)*fineSize )
+        {
+            // Keep the coarse level if it is at least smaller
+            if( coarse.n < fineSize )
+                levels.push_back( std::move(coarse) );
+            break;
+        }
+        levels.push_back( std::move(coarse) );
+    }
+
+    // Allow for the weight of the heaviest vertex on each level
+    auto maxWeight = [&]( const Level& level )
+    {
+        Int heaviest = 0;
+        for( const Int weight : level.vertexWeights )
+            heaviest = Max( heaviest, weight );
+        return Max
+          ( Int(Ceil((1+imbalanceTol)*totalWeight/2.)),
+            (totalWeight+1)/2 + heaviest );
+    };
+
+    // Bisect the coarsest graph and project the result back up, refining
+    // along the way
+    const Int numLevels = levels.size();
+    vector<Int> coarsePart;
+    InitialBisection
+    ( levels.back(), coarsePart, maxWeight(levels.back()), generator );
+    for( Int l=numLevels-2; l>=0; --l )
+    {
+        const Level& level = levels[l];
+        vector<Int> finePart( level.n );
+        for( Int v=0; v<level.n; ++v )
+            finePart[v] = coarsePart[level.coarseMap[v]];
+        Refine( level, finePart, maxWeight(level) );
+        coarsePart.swap( finePart );
+    }
+    part.swap( coarsePart );
+    return ExtractSeparator( levels[0], part );
+}
+
+} // anonymous namespace
+
+void Symmetrize( Int n, vector<Int>& offsets, vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    vector<Int> degrees( n, 0 );
+    for( Int s=0; s<n; ++s )
+    {
+        for( Int e=offsets[s]; e<offsets[s+1]; ++e )
+        {
+            const Int t = targets[e];
+            if( t != s && t >= 0 && t < n )
+            {
+                ++degrees[s];
+                ++degrees[t];
+            }
+        }
+    }
+    vector<Int> newOffsets( n+1 );
+    newOffsets[0] = 0;
+    for( Int s=0; s<n; ++s )
+        newOffsets[s+1] = newOffsets[s] + degrees[s];
+    vector<Int> newTargets( newOffsets[n] ), fill( newOffsets.begin(),
+                                                  newOffsets.end()-1 );
+    for( Int s=0; s<n; ++s )
+    {
+        for( Int e=offsets[s]; e<offsets[s+1]; ++e )
+        {
+            const Int t = targets[e];
+            if( t != s && t >= 0 && t < n )
+            {
+                newTargets[fill[s]++] = t;
+                newTargets[fill[t]++] = s;
+            }
+        }
+    }
+
+    // Sort each row and remove the duplicates
+    offsets.resize( n+1 );
+    targets.resize( newTargets.size() );
+    Int numEdges = 0;
+    for( Int s=0; s<n; ++s )
+    {
+        offsets[s] = numEdges;
+        auto rowBeg = newTargets.begin() + newOffsets[s];
+        auto rowEnd = newTargets.begin() + newOffsets[s+1];
+        std::sort( rowBeg, rowEnd );
+        rowEnd = std::unique( rowBeg, rowEnd );
+        for( auto it=rowBeg; it!=rowEnd; ++it )
+            targets[numEdges++] = *it;
+    }
+    offsets[n] = numEdges;
+    targets.resize( numEdges );
+}
+
+Int MultilevelBisect
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+        vector<Int>& part,
+        Int numTrials,
+        unsigned long long seed )
+{
+    EL_DEBUG_CSE
+    const Int n = offsets.size()-1;
+    if( targets.empty() )
+    {
+        // There is nothing to separate, so simply split the vertices in half
+        part.resize( n );
+        for( Int v=0; v<n; ++v )
+            part[v] = ( v <= n/2 ? 0 : 1 );
+        return 0;
+    }
+
+    numTrials = Max( numTrials, Int(1) );
+    vector<vector<Int>> parts( numTrials );
+    vector<Int> sepSizes( numTrials ), imbalances( numTrials );
+    auto runTrial = [&]( Int trial )
+    {
+        Generator generator( seed + 0x9e3779b97f4a7c15ULL*(trial+1) );
+        sepSizes[trial] =
+          SingleBisection( offsets, targets, parts[trial], generator );
+        Int sizes[3] = { 0, 0, 0 };
+        for( const Int p : parts[trial] )
+            ++sizes[p];
+        imbalances[trial] = Abs( sizes[0]-sizes[1] );
+    };
+#ifdef EL_HYBRID
+    if( numTrials > 1 && !omp_in_parallel() )
+    {
+        // Exceptions (e.g., std::bad_alloc) may not escape a parallel region
+        std::exception_ptr exception;
+        #pragma omp parallel for schedule(dynamic)
+        for( Int trial=0; trial<numTrials; ++trial )
+        {
+            try { runTrial( trial ); }
+            catch( ... )
+            {
+                #pragma omp critical
+                exception = std::current_exception();
+            }
+        }
+        if( exception )
+            std::rethrow_exception( exception );
+    }
+    else
+#endif
+    {
+        for( Int trial=0; trial<numTrials; ++trial )
+            runTrial( trial );
+    }
+
+    Int best = 0;
+    for( Int trial=1; trial<numTrials; ++trial )
+        if( sepSizes[trial] < sepSizes[best] ||
+            (sepSizes[trial] == sepSizes[best] &&
+             imbalances[trial] < imbalances[best]) )
+            best = trial;
+    part.swap( parts[best] );
+    return sepSizes[best];
+}
+
+} // namespace bisect
+} // namespace El
@@ -0,0 +1,36 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_UTIL_MULTILEVEL_BISECT_HPP
+#define EL_UTIL_MULTILEVEL_BISECT_HPP
+
+namespace El {
+namespace bisect {
+
+// Overwrite the adjacency structure of an n-vertex graph with its symmetric
+// closure, with sorted targets and without self-connections, duplicates, or
+// targets outside of [0,n).
+void Symmetrize( Int n, vector<Int>& offsets, vector<Int>& targets );
+
+// Compute a vertex separator of a symmetric graph (as produced by Symmetrize)
+// using a multilevel scheme. Upon return, 'part' assigns each vertex to the
+// left half (0), the right half (1), or the separator (2), and the size of
+// the separator is returned. Each of the 'numTrials' attempts (which are
+// spread over the available threads) uses a different random seed, and the
+// smallest separator is kept.
+Int MultilevelBisect
+( const vector<Int>& offsets,
+  const vector<Int>& targets,
+        vector<Int>& part,
+        Int numTrials=1,
+        unsigned long long seed=0 );
+
+} // namespace bisect
+} // namespace El
+
+#endif // ifndef EL_UTIL_MULTILEVEL_BISECT_HPP
@@ -68,7 +68,9 @@ Int ADMM
         Output(" || pinv(A) b ||_1 = ",qOneNorm);
     }
 
-    // Start the basis pursuit
+    // Start the basis pursuit (the projection is independent of rho, so it
+    // may be freely adapted)
+    Real rho = ctrl.rho;
     Int numIter=0;
     Matrix<Field> x, u, t, zOld, xHat;
     Zeros( x, n, 1 );
@@ -110,7 +112,7 @@ Int ADMM
         // z := SoftThresh(xHat+u,1/rho)
         z = xHat;
         z += u;
-        SoftThreshold( z, 1/ctrl.rho );
+        SoftThreshold( z, 1/rho );
 
         // u := u + (xHat - z)
         u += xHat;
@@ -124,12 +126,12 @@ Int ADMM
         // sNorm := || rho*(z-zOld) ||_2
         s = z;
         s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.progress )
         {
@@ -142,6 +144,15 @@ Int ADMM
 
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            u *= 1/scaling;
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -212,7 +223,9 @@ Int ADMM
             Output(" || pinv(A) b ||_1 = ",qOneNorm);
     }
 
-    // Start the basis pursuit
+    // Start the basis pursuit (the projection is independent of rho, so it
+    // may be freely adapted)
+    Real rho = ctrl.rho;
     Int numIter=0;
     DistMatrix<Field> x(grid), u(grid), t(grid), zOld(grid), xHat(grid);
     Zeros( x, n, 1 );
@@ -254,7 +267,7 @@ Int ADMM
         // z := SoftThresh(xHat+u,1/rho)
         z = xHat;
         z += u;
-        SoftThreshold( z, 1/ctrl.rho );
+        SoftThreshold( z, 1/rho );
 
         // u := u + (xHat - z)
         u += xHat;
@@ -268,12 +281,12 @@ Int ADMM
         // sNorm := || rho*(z-zOld) ||_2
         s = z;
         s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.progress )
         {
@@ -287,6 +300,15 @@ Int ADMM
 
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            u *= 1/scaling;
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -44,21 +44,24 @@ Int ADMM
     const Int m = A.Height();
     const Int n = A.Width();
 
-    Matrix<Field> P;
+    // Cache the Gram matrix, which is shifted by rho and refactored only
+    // when the penalty parameter is adapted
+    Real rho = ctrl.rho;
+    Matrix<Field> gram, P;
     if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
-    else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
+        Herk( LOWER, ADJOINT, Real(1), A, gram );
     else
-        Cholesky( LOWER, P );
+        Herk( LOWER, NORMAL, Real(1), A, gram );
+    auto factor = [&]()
+      {
+          P = gram;
+          ShiftDiagonal( P, Field(rho) );
+          if( ctrl.inv )
+              HPDInverse( LOWER, P );
+          else
+              Cholesky( LOWER, P );
+      };
+    factor();
 
     // Cache w := A^H b
     Matrix<Field> w;
@@ -76,8 +79,8 @@ Int ADMM
 
         // x := (A^H A + rho) \ (A^H b + rho*(z-u))
         x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
+        Axpy(  rho, z, x );
+        Axpy( -rho, u, x );
         if( m >= n )
         {
             if( ctrl.inv )
@@ -105,7 +108,7 @@ Int ADMM
                 Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
             }
             Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
+            x *= 1/rho;
         }
 
         // xHat := alpha x + (1-alpha) zOld
@@ -116,7 +119,7 @@ Int ADMM
         // z := SoftThresh(xHat+u,lambda/rho)
         z = xHat;
         z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
+        SoftThreshold( z, lambda/rho );
 
         // u := u + (xHat - z)
         u += xHat;
@@ -130,12 +133,12 @@ Int ADMM
         // sNorm := || rho*(z-zOld) ||_2
         s = z;
         s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.progress )
         {
@@ -151,6 +154,16 @@ Int ADMM
 
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            u *= 1/scaling;
+            factor();
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -182,21 +195,24 @@ Int ADMM
     const Int n = A.Width();
     const Grid& g = A.Grid();
 
-    DistMatrix<Field> P(g);
+    // Cache the Gram matrix, which is shifted by rho and refactored only
+    // when the penalty parameter is adapted
+    Real rho = ctrl.rho;
+    DistMatrix<Field> gram(g), P(g);
     if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
-    else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
+        Herk( LOWER, ADJOINT, Real(1), A, gram );
     else
-        Cholesky( LOWER, P );
+        Herk( LOWER, NORMAL, Real(1), A, gram );
+    auto factor = [&]()
+      {
+          P = gram;
+          ShiftDiagonal( P, Field(rho) );
+          if( ctrl.inv )
+              HPDInverse( LOWER, P );
+          else
+              Cholesky( LOWER, P );
+      };
+    factor();
 
     // Cache w := A^H b
     DistMatrix<Field> w(g);
@@ -214,8 +230,8 @@ Int ADMM
 
         // x := (A^H A + rho) \ (A^H b + rho*(z-u))
         x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
+        Axpy(  rho, z, x );
+        Axpy( -rho, u, x );
         if( m >= n )
         {
             if( ctrl.inv )
@@ -243,7 +259,7 @@ Int ADMM
                 Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
             }
             Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
+            x *= 1/rho;
         }
 
         // xHat := alpha x + (1-alpha) zOld
@@ -254,7 +270,7 @@ Int ADMM
         // z := SoftThresh(xHat+u,lambda/rho)
         z = xHat;
         z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
+        SoftThreshold( z, lambda/rho );
 
         // u := u + (xHat - z)
         u += xHat;
@@ -268,12 +284,12 @@ Int ADMM
         // sNorm := || rho*(z-zOld) ||_2
         s = z;
         s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.progress )
         {
@@ -292,6 +308,16 @@ Int ADMM
 
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            u *= 1/scaling;
+            factor();
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -37,7 +37,7 @@ void NormalizeEntries( AbstractDistMatrix<Field>& A )
 // NOTE: If 'tau' is passed in as zero, it is set to 1/sqrt(max(m,n))
 
 template<typename Field>
-void ADMM
+Int ADMM
 ( const Matrix<Field>& M,
         Matrix<Field>& L,
         Matrix<Field>& S,
@@ -55,11 +55,11 @@ void ADMM
         LogicError("beta cannot be non-positive");
     if( ctrl.tol <= Real(0) )
         LogicError("tol cannot be non-positive");
-    const Real beta = ctrl.beta;
+    Real beta = ctrl.beta;
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<Field> E, Y;
+    Matrix<Field> E, Y, LOld;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -77,6 +77,8 @@ void ADMM
     while( true )
     {
         ++numIts;
+        if( ctrl.penaltyCtrl.adapt )
+            LOld = L;
 
         // ST_{tau/beta}(M - L + Y/beta)
         S = M;
@@ -129,11 +131,22 @@ void ADMM
 
         // Y := Y + beta E
         Axpy( beta, E, Y );
+
+        // Balance the primal residual, || E ||_F, against the dual residual,
+        // beta || L - LOld ||_F (Y is unscaled, so only beta changes)
+        if( ctrl.penaltyCtrl.adapt )
+        {
+            LOld -= L;
+            const Real dualResid = beta*FrobeniusNorm( LOld );
+            beta *=
+              ADMMPenaltyScaling( frobE, dualResid, numIts, ctrl.penaltyCtrl );
+        }
     }
+    return numIts;
 }
 
 template<typename Field>
-void ADMM
+Int ADMM
 ( const AbstractDistMatrix<Field>& MPre,
         AbstractDistMatrix<Field>& LPre,
         AbstractDistMatrix<Field>& SPre,
@@ -161,11 +174,11 @@ void ADMM
         LogicError("beta cannot be non-positive");
     if( ctrl.tol <= Real(0) )
         LogicError("tol cannot be non-positive");
-    const Real beta = ctrl.beta;
+    Real beta = ctrl.beta;
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() ), LOld( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -183,6 +196,8 @@ void ADMM
     while( true )
     {
         ++numIts;
+        if( ctrl.penaltyCtrl.adapt )
+            LOld = L;
 
         // ST_{tau/beta}(M - L + Y/beta)
         S = M;
@@ -235,13 +250,24 @@ void ADMM
 
         // Y := Y + beta E
         Axpy( beta, E, Y );
+
+        // Balance the primal residual, || E ||_F, against the dual residual,
+        // beta || L - LOld ||_F (Y is unscaled, so only beta changes)
+        if( ctrl.penaltyCtrl.adapt )
+        {
+            LOld -= L;
+            const Real dualResid = beta*FrobeniusNorm( LOld );
+            beta *=
+              ADMMPenaltyScaling( frobE, dualResid, numIts, ctrl.penaltyCtrl );
+        }
     }
+    return numIts;
 }
 
 // NOTE: If 'beta' or 'tau' is zero, then an estimate is used instead
 
 template<typename Field>
-void ALM
+Int ALM
 ( const Matrix<Field>& M,
         Matrix<Field>& L,
         Matrix<Field>& S,
@@ -378,10 +404,11 @@ void ALM
         Axpy( beta, E, Y );
         beta *= ctrl.rho;
     }
+    return numIts;
 }
 
 template<typename Field>
-void ALM
+Int ALM
 ( const AbstractDistMatrix<Field>& MPre,
         AbstractDistMatrix<Field>& LPre,
         AbstractDistMatrix<Field>& SPre,
@@ -527,12 +554,13 @@ void ALM
         Axpy( beta, E, Y );
         beta *= ctrl.rho;
     }
+    return numIts;
 }
 
 } // namespace rpca
 
 template<typename Field>
-void RPCA
+Int RPCA
 ( const Matrix<Field>& M,
         Matrix<Field>& L,
         Matrix<Field>& S,
@@ -540,13 +568,13 @@ void RPCA
 {
     EL_DEBUG_CSE
     if( ctrl.useALM )
-        rpca::ALM( M, L, S, ctrl );
+        return rpca::ALM( M, L, S, ctrl );
     else
-        rpca::ADMM( M, L, S, ctrl );
+        return rpca::ADMM( M, L, S, ctrl );
 }
 
 template<typename Field>
-void RPCA
+Int RPCA
 ( const AbstractDistMatrix<Field>& M,
         AbstractDistMatrix<Field>& L,
         AbstractDistMatrix<Field>& S,
@@ -554,18 +582,18 @@ void RPCA
 {
     EL_DEBUG_CSE
     if( ctrl.useALM )
-        rpca::ALM( M, L, S, ctrl );
+        return rpca::ALM( M, L, S, ctrl );
     else
-        rpca::ADMM( M, L, S, ctrl );
+        return rpca::ADMM( M, L, S, ctrl );
 }
 
 #define PROTO(Field) \
-  template void RPCA \
+  template Int RPCA \
   ( const Matrix<Field>& M, \
           Matrix<Field>& L, \
           Matrix<Field>& S, \
     const RPCACtrl<Base<Field>>& ctrl ); \
-  template void RPCA \
+  template Int RPCA \
   ( const AbstractDistMatrix<Field>& M, \
           AbstractDistMatrix<Field>& L, \
           AbstractDistMatrix<Field>& S, \
@@ -34,6 +34,7 @@ Int SparseInvCov
     Covariance( D, S );
     MakeHermitian( LOWER, S );
 
+    Real rho = ctrl.rho;
     Int numIter=0;
     Matrix<Field> X, U, ZOld, XHat, T;
     Zeros( X, n, n );
@@ -46,13 +47,13 @@ Int SparseInvCov
         // X := rho*(Z-U) - S
         X = Z;
         X -= U;
-        X *= ctrl.rho;
+        X *= rho;
         X -= S;
 
         // X := f(X), f(gamma) = (gamma+sqrt(gamma+4*rho)) / (2*rho)
         auto eigMap =
           [&](const Real& gamma)
-          { return (gamma+Sqrt(gamma*gamma+4*ctrl.rho))/(2*ctrl.rho); };
+          { return (gamma+Sqrt(gamma*gamma+4*rho))/(2*rho); };
         HermitianFunction( LOWER, X, MakeFunction(eigMap) );
         // Make X explicitly Hermitian since HermitianHilbertSchmidt is not
         // yet available. This should result in Z and U remaining explicitly
@@ -67,7 +68,7 @@ Int SparseInvCov
         // Z := SoftThreshold(XHat+U,lambda/rho)
         Z = XHat;
         Z += U;
-        SoftThreshold( Z, lambda/ctrl.rho );
+        SoftThreshold( Z, lambda/rho );
 
         // U := U + (XHat-Z)
         U += XHat;
@@ -80,12 +81,12 @@ Int SparseInvCov
         // sNorm := |rho| || Z - ZOld ||_F
         T = Z;
         T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm(T);
+        const Real sNorm = Abs(rho)*FrobeniusNorm(T);
 
         const Real epsPri = n*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
         const Real epsDual = n*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(U);
 
         if( ctrl.progress )
         {
@@ -100,6 +101,15 @@ Int SparseInvCov
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            U *= 1/scaling;
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -127,6 +137,7 @@ Int SparseInvCov
     Covariance( D, S );
     MakeHermitian( LOWER, S );
 
+    Real rho = ctrl.rho;
     Int numIter=0;
     DistMatrix<Field> X(g), U(g), ZOld(g), XHat(g), T(g);
     Zeros( X, n, n );
@@ -139,13 +150,13 @@ Int SparseInvCov
         // X := rho*(Z-U) - S
         X = Z;
         X -= U;
-        X *= ctrl.rho;
+        X *= rho;
         X -= S;
 
         // X := f(X), f(gamma) = (gamma+sqrt(gamma+4*rho)) / (2*rho)
         auto eigMap =
           [&](const Real& gamma)
-          { return (gamma+Sqrt(gamma*gamma+4*ctrl.rho))/(2*ctrl.rho); };
+          { return (gamma+Sqrt(gamma*gamma+4*rho))/(2*rho); };
         HermitianFunction( LOWER, X, MakeFunction(eigMap) );
         // Make X explicitly Hermitian since HermitianHilbertSchmidt is not
         // yet available. This should result in Z and U remaining explicitly
@@ -160,7 +171,7 @@ Int SparseInvCov
         // Z := SoftThreshold(XHat+U,lambda/rho)
         Z = XHat;
         Z += U;
-        SoftThreshold( Z, lambda/ctrl.rho );
+        SoftThreshold( Z, lambda/rho );
 
         // U := U + (XHat-Z)
         U += XHat;
@@ -173,12 +184,12 @@ Int SparseInvCov
         // sNorm := |rho| || Z - ZOld ||_F
         T = Z;
         T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm(T);
+        const Real sNorm = Abs(rho)*FrobeniusNorm(T);
 
         const Real epsPri = n*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
         const Real epsDual = n*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(U);
 
         if( ctrl.progress )
         {
@@ -194,6 +205,15 @@ Int SparseInvCov
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            U *= 1/scaling;
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
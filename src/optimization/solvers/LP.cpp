@@ -10,6 +10,8 @@
 #include "./LP/direct/IPM.hpp"
 #include "./LP/affine/IPM.hpp"
 #include "./LP/MPS.hpp"
+#include "./LP/CPLEXLP.hpp"
+#include "./LP/Presolve.hpp"
 
 namespace El {
 
@@ -201,7 +203,12 @@ void LP
 {
     EL_DEBUG_CSE
     if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    {
+        if( ctrl.presolve )
+            lp::direct::PresolvedMehrotra( problem, solution, ctrl );
+        else
+            lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    }
     else
         LogicError("Unsupported solver");
 }
@@ -240,7 +247,12 @@ void LP
 {
     EL_DEBUG_CSE
     if( ctrl.approach == LP_MEHROTRA )
-        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    {
+        if( ctrl.presolve )
+            lp::affine::PresolvedMehrotra( problem, solution, ctrl );
+        else
+            lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    }
     else
         LogicError("Unsupported solver");
 }
@@ -286,7 +298,12 @@ void LP
 {
     EL_DEBUG_CSE
     if( ctrl.approach == LP_MEHROTRA )
-        lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    {
+        if( ctrl.presolve )
+            lp::direct::PresolvedMehrotra( problem, solution, ctrl );
+        else
+            lp::direct::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    }
     else
         LogicError("Unsupported solver");
 }
@@ -330,7 +347,12 @@ void LP
 {
     EL_DEBUG_CSE
     if( ctrl.approach == LP_MEHROTRA )
-        lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    {
+        if( ctrl.presolve )
+            lp::affine::PresolvedMehrotra( problem, solution, ctrl );
+        else
+            lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
+    }
     else
         LogicError("Unsupported solver");
 }
@@ -510,6 +532,26 @@ void LP
     bool minimize, \
     bool keepNonnegativeWithZeroUpperBounds, \
     bool metadataSummary ); \
+  template void ReadCPLEXLP \
+  ( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
+    const string& filename, \
+    bool compressed, \
+    bool metadataSummary ); \
+  template void ReadCPLEXLP \
+  ( AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem, \
+    const string& filename, \
+    bool compressed, \
+    bool metadataSummary ); \
+  template void ReadCPLEXLP \
+  ( AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+    const string& filename, \
+    bool compressed, \
+    bool metadataSummary ); \
+  template void ReadCPLEXLP \
+  ( AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+    const string& filename, \
+    bool compressed, \
+    bool metadataSummary ); \
   template void WriteMPS \
   ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
     const string& filename, \
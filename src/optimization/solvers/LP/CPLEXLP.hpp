@@ -0,0 +1,717 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// The CPLEX LP format describes a problem algebraically, e.g.,
+//
+//   \ A comment
+//   Maximize
+//    obj: x1 + 2 x2 - x3
+//   Subject To
+//    c1: x1 + x2 <= 4
+//    c2: 2 <= x1 + x3 <= 4
+//   Bounds
+//    -1 <= x2 <= 1
+//    x3 free
+//   End
+//
+// Statements may span several lines, and ranged constraints are written as
+// double inequalities. Since the integrality of the variables listed in the
+// 'Generals' and 'Binaries' sections is dropped, the LP relaxation is read.
+//
+// Unlike the COLUMNS section of an MPS file, an LP file does not group its
+// coefficients in a manner which allows for a chunked parse, so each process
+// parses the entire file and keeps the coefficients of a cyclic subset of the
+// rows.
+
+namespace read_cplex_lp {
+
+enum TokenType {
+  CPLEX_LP_NAME,
+  CPLEX_LP_NUMBER,
+  CPLEX_LP_PLUS,
+  CPLEX_LP_MINUS,
+  CPLEX_LP_LESSER,
+  CPLEX_LP_GREATER,
+  CPLEX_LP_EQUAL,
+  CPLEX_LP_COLON
+};
+
+enum Section {
+  CPLEX_LP_OBJECTIVE,
+  CPLEX_LP_CONSTRAINTS,
+  CPLEX_LP_BOUNDS,
+  CPLEX_LP_GENERALS,
+  CPLEX_LP_BINARIES,
+  CPLEX_LP_NONE,
+  CPLEX_LP_END
+};
+
+struct Token
+{
+  TokenType type;
+  string text;
+  double value;
+};
+
+inline bool IsComparison( const Token& token )
+{
+    return token.type == CPLEX_LP_LESSER ||
+           token.type == CPLEX_LP_GREATER ||
+           token.type == CPLEX_LP_EQUAL;
+}
+
+inline string LowerCase( string word )
+{
+    for( auto& character : word )
+        character = std::tolower( character );
+    return word;
+}
+
+inline bool IsInfinity( const Token& token )
+{
+    if( token.type != CPLEX_LP_NAME )
+        return false;
+    const string word = LowerCase( token.text );
+    return word == "inf" || word == "infinity";
+}
+
+// Append the tokens of [p,end) to 'tokens'.
+inline void Tokenize( const char* p, const char* end, vector<Token>& tokens )
+{
+    Token token;
+    while( p < end )
+    {
+        const char c = *p;
+        if( std::isspace(c) )
+        {
+            ++p;
+            continue;
+        }
+        if( c == '\\' )
+            break;
+        token.text.clear();
+        token.value = 0;
+        if( std::isdigit(c) ||
+            (c == '.' && p+1 < end && std::isdigit(*(p+1))) )
+        {
+            char* numberEnd;
+            token.type = CPLEX_LP_NUMBER;
+            token.value = std::strtod( p, &numberEnd );
+            p = numberEnd;
+        }
+        else if( c == '+' )
+        {
+            token.type = CPLEX_LP_PLUS;
+            ++p;
+        }
+        else if( c == '-' )
+        {
+            token.type = CPLEX_LP_MINUS;
+            ++p;
+        }
+        else if( c == '<' || c == '>' || c == '=' )
+        {
+            // Accept '<', '<=', '=<', '>', '>=', '=>', and '='.
+            char next = ( p+1 < end ? *(p+1) : '\0' );
+            if( c == '<' || (c == '=' && next == '<') )
+                token.type = CPLEX_LP_LESSER;
+            else if( c == '>' || (c == '=' && next == '>') )
+                token.type = CPLEX_LP_GREATER;
+            else
+                token.type = CPLEX_LP_EQUAL;
+            ++p;
+            if( p < end &&
+                (*p == '=' || (c == '=' && (*p == '<' || *p == '>'))) )
+                ++p;
+        }
+        else if( c == ':' )
+        {
+            token.type = CPLEX_LP_COLON;
+            ++p;
+        }
+        else if( c == '[' )
+        {
+            LogicError("Quadratic terms are not supported by the LP reader");
+        }
+        else
+        {
+            token.type = CPLEX_LP_NAME;
+            const char* nameBegin = p;
+            while( p < end && !std::isspace(*p) &&
+                   *p != '+' && *p != '-' && *p != '<' && *p != '>' &&
+                   *p != '=' && *p != ':' && *p != '\\' && *p != '[' )
+                ++p;
+            token.text.assign( nameBegin, p );
+        }
+        tokens.push_back( token );
+    }
+}
+
+// If the (trimmed) line begins with a section keyword, return the section,
+// its objective sense (if applicable), and the remainder of the line.
+inline bool MatchSection
+( const string& line, Section& section, bool& minimize, string& remainder )
+{
+    // Collapse the whitespace so that, e.g., 'subject   to' is recognized.
+    string collapsed;
+    for( const char c : line )
+    {
+        if( std::isspace(c) )
+        {
+            if( collapsed.size() > 0 && collapsed.back() != ' ' )
+                collapsed.push_back( ' ' );
+        }
+        else
+            collapsed.push_back( c );
+    }
+    const string lowered = LowerCase( collapsed );
+
+    struct Keyword { const char* word; Section section; bool minimize; };
+    static const Keyword keywords[] = {
+      { "minimize", CPLEX_LP_OBJECTIVE, true },
+      { "minimum", CPLEX_LP_OBJECTIVE, true },
+      { "min", CPLEX_LP_OBJECTIVE, true },
+      { "maximize", CPLEX_LP_OBJECTIVE, false },
+      { "maximum", CPLEX_LP_OBJECTIVE, false },
+      { "max", CPLEX_LP_OBJECTIVE, false },
+      { "subject to", CPLEX_LP_CONSTRAINTS, true },
+      { "such that", CPLEX_LP_CONSTRAINTS, true },
+      { "s.t.", CPLEX_LP_CONSTRAINTS, true },
+      { "st.", CPLEX_LP_CONSTRAINTS, true },
+      { "st", CPLEX_LP_CONSTRAINTS, true },
+      { "bounds", CPLEX_LP_BOUNDS, true },
+      { "bound", CPLEX_LP_BOUNDS, true },
+      { "generals", CPLEX_LP_GENERALS, true },
+      { "general", CPLEX_LP_GENERALS, true },
+      { "gen", CPLEX_LP_GENERALS, true },
+      { "integers", CPLEX_LP_GENERALS, true },
+      { "binaries", CPLEX_LP_BINARIES, true },
+      { "binary", CPLEX_LP_BINARIES, true },
+      { "bin", CPLEX_LP_BINARIES, true },
+      { "end", CPLEX_LP_END, true }
+    };
+    for( const auto& keyword : keywords )
+    {
+        const size_t length = std::strlen( keyword.word );
+        if( lowered.compare( 0, length, keyword.word ) == 0 &&
+            (lowered.size() == length || lowered[length] == ' ') )
+        {
+            section = keyword.section;
+            minimize = keyword.minimize;
+            remainder = collapsed.substr( length );
+            return true;
+        }
+    }
+    if( lowered.compare( 0, 4, "semi" ) == 0 ||
+        lowered.compare( 0, 3, "sos" ) == 0 )
+        LogicError
+        ("Semi-continuous variables and SOS constraints are not supported");
+    return false;
+}
+
+// Consume a constant of the form [+|-]* (number | inf | infinity).
+inline bool ParseValue
+( const vector<Token>& tokens, Int& pos, double& value )
+{
+    const Int numTokens = tokens.size();
+    Int newPos = pos;
+    double sign = 1;
+    while( newPos < numTokens &&
+           (tokens[newPos].type == CPLEX_LP_PLUS ||
+            tokens[newPos].type == CPLEX_LP_MINUS) )
+    {
+        if( tokens[newPos].type == CPLEX_LP_MINUS )
+            sign = -sign;
+        ++newPos;
+    }
+    if( newPos == numTokens )
+        return false;
+    if( tokens[newPos].type == CPLEX_LP_NUMBER )
+        value = sign*tokens[newPos].value;
+    else if( IsInfinity(tokens[newPos]) )
+        value = sign*std::numeric_limits<double>::infinity();
+    else
+        return false;
+    pos = newPos + 1;
+    return true;
+}
+
+// Parse a sum of signed terms of the form '[coefficient] name' (or constants),
+// stopping at a comparison, the label of another statement, or the end.
+inline void ParseExpression
+( const vector<Token>& tokens,
+  Int& pos,
+  vector<std::pair<string,double>>& terms,
+  double& constant )
+{
+    const Int numTokens = tokens.size();
+    const auto isLabel = [&]( Int index )
+      {
+          return index+1 < numTokens &&
+                 tokens[index].type == CPLEX_LP_NAME &&
+                 tokens[index+1].type == CPLEX_LP_COLON;
+      };
+    terms.clear();
+    constant = 0;
+    while( pos < numTokens && !IsComparison(tokens[pos]) && !isLabel(pos) )
+    {
+        double sign = 1;
+        while( pos < numTokens &&
+               (tokens[pos].type == CPLEX_LP_PLUS ||
+                tokens[pos].type == CPLEX_LP_MINUS) )
+        {
+            if( tokens[pos].type == CPLEX_LP_MINUS )
+                sign = -sign;
+            ++pos;
+        }
+        if( pos == numTokens )
+            LogicError("Expression ended with a sign");
+
+        double coefficient = sign;
+        if( tokens[pos].type == CPLEX_LP_NUMBER )
+        {
+            coefficient *= tokens[pos].value;
+            ++pos;
+            if( pos == numTokens || tokens[pos].type != CPLEX_LP_NAME ||
+                isLabel(pos) )
+            {
+                constant += coefficient;
+                continue;
+            }
+        }
+        if( tokens[pos].type != CPLEX_LP_NAME )
+            LogicError("Invalid term in linear expression");
+        terms.push_back( std::make_pair(tokens[pos].text,coefficient) );
+        ++pos;
+    }
+}
+
+} // namespace read_cplex_lp
+
+class CPLEXLPReader : public LPFileReader
+{
+public:
+    CPLEXLPReader
+    ( const string& filename,
+      bool compressed=false,
+      mpi::Comm comm=mpi::COMM_SELF );
+
+private:
+    Int Variable( const string& name );
+    void AddConstraint
+    ( const string& name,
+      MPSRowType type,
+      const vector<std::pair<string,double>>& terms,
+      double rhs,
+      bool ranged=false,
+      double range=0 );
+
+    void ParseObjective( const vector<read_cplex_lp::Token>& tokens );
+    void ParseConstraints( const vector<read_cplex_lp::Token>& tokens );
+    void ParseBounds( const vector<read_cplex_lp::Token>& tokens );
+    void ParseIntegers
+    ( const vector<read_cplex_lp::Token>& tokens, bool binary );
+
+    vector<double> lowerBounds_, upperBounds_;
+    vector<bool> free_;
+    Int numIntegers_=0;
+};
+
+CPLEXLPReader::CPLEXLPReader
+( const string& filename,
+  bool compressed,
+  mpi::Comm comm )
+: LPFileReader( true, true, comm )
+{
+    EL_DEBUG_CSE
+    using namespace read_cplex_lp;
+    LPFileSource source( filename, compressed );
+    vector<char> buffer;
+    read_mps::ReadSection( source, 0, source.Size(), buffer );
+
+    // Accumulate the tokens of each section before parsing its statements
+    // since statements may span several lines.
+    Section section = CPLEX_LP_NONE;
+    bool foundObjective = false;
+    vector<Token> tokens;
+    const auto parseSection = [&]()
+      {
+          if( section == CPLEX_LP_OBJECTIVE )
+              ParseObjective( tokens );
+          else if( section == CPLEX_LP_CONSTRAINTS )
+              ParseConstraints( tokens );
+          else if( section == CPLEX_LP_BOUNDS )
+              ParseBounds( tokens );
+          else if( section == CPLEX_LP_GENERALS )
+              ParseIntegers( tokens, false );
+          else if( section == CPLEX_LP_BINARIES )
+              ParseIntegers( tokens, true );
+          else if( tokens.size() > 0 )
+              LogicError("Statements must follow a section keyword");
+          tokens.clear();
+      };
+
+    const char* p = buffer.data();
+    const char* bufferEnd = buffer.data() + (buffer.size()-1);
+    string line, remainder;
+    while( p < bufferEnd && section != CPLEX_LP_END )
+    {
+        const char* lineEnd = std::find( p, bufferEnd, '\n' );
+        const char* lineBegin = p;
+        p = ( lineEnd == bufferEnd ? bufferEnd : lineEnd+1 );
+        while( lineBegin < lineEnd && std::isspace(*lineBegin) )
+            ++lineBegin;
+        line.assign( lineBegin, std::find( lineBegin, lineEnd, '\\' ) );
+
+        Section newSection;
+        bool minimize;
+        if( MatchSection( line, newSection, minimize, remainder ) )
+        {
+            parseSection();
+            section = newSection;
+            if( section == CPLEX_LP_OBJECTIVE )
+            {
+                if( foundObjective )
+                    LogicError("Multiple objective sections");
+                foundObjective = true;
+                meta_.minimize = minimize;
+            }
+            Tokenize
+            ( remainder.data(), remainder.data()+remainder.size(), tokens );
+        }
+        else
+        {
+            Tokenize( line.data(), line.data()+line.size(), tokens );
+        }
+    }
+    parseSection();
+    if( section != CPLEX_LP_END && commRank_ == 0 )
+        Output("WARNING: LP file did not terminate with 'End'");
+    if( numIntegers_ > 0 && commRank_ == 0 )
+        Output
+        ("WARNING: Ignoring the integrality of ",numIntegers_," variables");
+
+    // Convert the bounds into the MPS conventions.
+    const Int numVariables = meta_.variables.size();
+    const double infinity = std::numeric_limits<double>::infinity();
+    for( Int j=0; j<numVariables; ++j )
+    {
+        auto& data = meta_.variables[j];
+        const double lowerBound = lowerBounds_[j];
+        const double upperBound = upperBounds_[j];
+        if( lowerBound > upperBound )
+            LogicError
+            ("Cannot enforce a lower bound of ",lowerBound,
+             " and an upper bound of ",upperBound," for ",
+             meta_.variableNames[j]);
+        if( free_[j] || (lowerBound == -infinity && upperBound == infinity) )
+        {
+            data.free = true;
+        }
+        else if( lowerBound == upperBound )
+        {
+            data.fixed = true;
+            data.fixedValue = lowerBound;
+        }
+        else
+        {
+            if( lowerBound == -infinity )
+                data.lowerUnbounded = true;
+            else if( lowerBound == 0. )
+                data.nonnegative = true;
+            else
+            {
+                data.lowerBounded = true;
+                data.lowerBound = lowerBound;
+            }
+            if( upperBound < infinity )
+            {
+                data.upperBounded = true;
+                data.upperBound = upperBound;
+            }
+        }
+    }
+
+    Finalize();
+}
+
+Int CPLEXLPReader::Variable( const string& name )
+{
+    const Int index = AddVariable( name );
+    if( index == Int(lowerBounds_.size()) )
+    {
+        lowerBounds_.push_back( 0 );
+        upperBounds_.push_back( std::numeric_limits<double>::infinity() );
+        free_.push_back( false );
+    }
+    return index;
+}
+
+void CPLEXLPReader::AddConstraint
+( const string& name,
+  MPSRowType type,
+  const vector<std::pair<string,double>>& terms,
+  double rhs,
+  bool ranged,
+  double range )
+{
+    EL_DEBUG_CSE
+    const Int row = AddRow( name, type );
+    auto& rowData = meta_.rows[row];
+    rowData.rhs = rhs;
+    rowData.ranged = ranged;
+    rowData.range = range;
+
+    // Combine any repeated variables.
+    vector<MPSTriplet> triplets;
+    for( const auto& term : terms )
+    {
+        MPSTriplet triplet;
+        triplet.row = row;
+        triplet.column = Variable( term.first );
+        triplet.value = term.second;
+        triplets.push_back( triplet );
+    }
+    std::sort
+    ( triplets.begin(), triplets.end(),
+      []( const MPSTriplet& a, const MPSTriplet& b )
+      { return a.column < b.column; } );
+    Int numCombined = 0;
+    for( const auto& triplet : triplets )
+    {
+        if( numCombined > 0 &&
+            triplets[numCombined-1].column == triplet.column )
+            triplets[numCombined-1].value += triplet.value;
+        else
+            triplets[numCombined++] = triplet;
+    }
+    triplets.resize( numCombined );
+
+    rowData.numNonzeros = numCombined;
+    if( row % commSize_ == commRank_ )
+        triplets_.insert( triplets_.end(), triplets.begin(), triplets.end() );
+}
+
+void CPLEXLPReader::ParseObjective
+( const vector<read_cplex_lp::Token>& tokens )
+{
+    EL_DEBUG_CSE
+    using namespace read_cplex_lp;
+    Int pos = 0;
+    string name = "obj";
+    if( tokens.size() >= 2 && tokens[0].type == CPLEX_LP_NAME &&
+        tokens[1].type == CPLEX_LP_COLON )
+    {
+        name = tokens[0].text;
+        pos = 2;
+    }
+    vector<std::pair<string,double>> terms;
+    double constant;
+    ParseExpression( tokens, pos, terms, constant );
+    if( pos != Int(tokens.size()) )
+        LogicError("Invalid objective");
+    if( constant != 0. && commRank_ == 0 )
+        Output("WARNING: Ignoring objective constant of ",constant);
+    AddConstraint( name, MPS_NONCONSTRAINING_ROW, terms, 0 );
+    meta_.costName = name;
+}
+
+void CPLEXLPReader::ParseConstraints
+( const vector<read_cplex_lp::Token>& tokens )
+{
+    EL_DEBUG_CSE
+    using namespace read_cplex_lp;
+    const Int numTokens = tokens.size();
+    vector<std::pair<string,double>> terms;
+    Int pos = 0;
+    while( pos < numTokens )
+    {
+        string name = "c" + std::to_string( meta_.rows.size()+1 );
+        if( pos+1 < numTokens && tokens[pos].type == CPLEX_LP_NAME &&
+            tokens[pos+1].type == CPLEX_LP_COLON )
+        {
+            name = tokens[pos].text;
+            pos += 2;
+        }
+
+        // Ranged constraints are of the form 'value op expression op value'.
+        bool ranged = false;
+        double leftValue = 0;
+        TokenType leftComparison = CPLEX_LP_EQUAL;
+        Int valuePos = pos;
+        if( ParseValue( tokens, valuePos, leftValue ) &&
+            valuePos < numTokens && IsComparison(tokens[valuePos]) )
+        {
+            ranged = true;
+            leftComparison = tokens[valuePos].type;
+            pos = valuePos + 1;
+        }
+
+        double constant;
+        ParseExpression( tokens, pos, terms, constant );
+        if( pos == numTokens || !IsComparison(tokens[pos]) )
+            LogicError("Constraint ",name," is missing a comparison");
+        const TokenType comparison = tokens[pos++].type;
+        double rightValue;
+        if( !ParseValue( tokens, pos, rightValue ) )
+            LogicError("Constraint ",name," is missing a right-hand side");
+
+        if( ranged )
+        {
+            if( leftComparison != comparison ||
+                comparison == CPLEX_LP_EQUAL )
+                LogicError("Invalid ranged constraint ",name);
+            double lower = leftValue - constant;
+            double upper = rightValue - constant;
+            if( comparison == CPLEX_LP_GREATER )
+                std::swap( lower, upper );
+            const double infinity = std::numeric_limits<double>::infinity();
+            if( lower > upper )
+                LogicError("Empty range for constraint ",name);
+            if( lower == -infinity && upper == infinity )
+                LogicError("Constraint ",name," is unbounded");
+            if( lower == -infinity )
+                AddConstraint( name, MPS_LESSER_ROW, terms, upper );
+            else if( upper == infinity )
+                AddConstraint( name, MPS_GREATER_ROW, terms, lower );
+            else if( lower == upper )
+                AddConstraint( name, MPS_EQUALITY_ROW, terms, lower );
+            else
+                AddConstraint
+                ( name, MPS_GREATER_ROW, terms, lower, true, upper-lower );
+        }
+        else
+        {
+            const double rhs = rightValue - constant;
+            if( comparison == CPLEX_LP_LESSER )
+                AddConstraint( name, MPS_LESSER_ROW, terms, rhs );
+            else if( comparison == CPLEX_LP_GREATER )
+                AddConstraint( name, MPS_GREATER_ROW, terms, rhs );
+            else
+                AddConstraint( name, MPS_EQUALITY_ROW, terms, rhs );
+        }
+    }
+}
+
+void CPLEXLPReader::ParseBounds
+( const vector<read_cplex_lp::Token>& tokens )
+{
+    EL_DEBUG_CSE
+    using namespace read_cplex_lp;
+    const Int numTokens = tokens.size();
+    const auto applyBound = [&]( Int j, TokenType comparison, double value )
+      {
+          // 'comparison' is the relation of the variable to the value.
+          if( comparison == CPLEX_LP_LESSER )
+              upperBounds_[j] = value;
+          else if( comparison == CPLEX_LP_GREATER )
+              lowerBounds_[j] = value;
+          else
+          {
+              lowerBounds_[j] = value;
+              upperBounds_[j] = value;
+          }
+      };
+    const auto reverse = []( TokenType comparison )
+      {
+          if( comparison == CPLEX_LP_LESSER )
+              return CPLEX_LP_GREATER;
+          else if( comparison == CPLEX_LP_GREATER )
+              return CPLEX_LP_LESSER;
+          else
+              return comparison;
+      };
+
+    Int pos = 0;
+    while( pos < numTokens )
+    {
+        double value;
+        Int valuePos = pos;
+        if( ParseValue( tokens, valuePos, value ) )
+        {
+            // 'value op name [op value]'
+            pos = valuePos;
+            if( pos+1 >= numTokens || !IsComparison(tokens[pos]) ||
+                tokens[pos+1].type != CPLEX_LP_NAME )
+                LogicError("Invalid bound");
+            const TokenType comparison = tokens[pos].type;
+            const Int j = Variable( tokens[pos+1].text );
+            applyBound( j, reverse(comparison), value );
+            pos += 2;
+            if( pos < numTokens && IsComparison(tokens[pos]) )
+            {
+                const TokenType secondComparison = tokens[pos++].type;
+                if( !ParseValue( tokens, pos, value ) )
+                    LogicError("Invalid bound");
+                applyBound( j, secondComparison, value );
+            }
+        }
+        else if( tokens[pos].type == CPLEX_LP_NAME )
+        {
+            const Int j = Variable( tokens[pos].text );
+            ++pos;
+            if( pos < numTokens && tokens[pos].type == CPLEX_LP_NAME &&
+                LowerCase(tokens[pos].text) == "free" )
+            {
+                // 'name free'
+                free_[j] = true;
+                lowerBounds_[j] = -std::numeric_limits<double>::infinity();
+                upperBounds_[j] = std::numeric_limits<double>::infinity();
+                ++pos;
+                continue;
+            }
+            // 'name op value'
+            if( pos == numTokens || !IsComparison(tokens[pos]) )
+                LogicError("Invalid bound for ",meta_.variableNames[j]);
+            const TokenType comparison = tokens[pos++].type;
+            if( !ParseValue( tokens, pos, value ) )
+                LogicError("Invalid bound for ",meta_.variableNames[j]);
+            applyBound( j, comparison, value );
+        }
+        else
+            LogicError("Invalid bound");
+    }
+}
+
+void CPLEXLPReader::ParseIntegers
+( const vector<read_cplex_lp::Token>& tokens, bool binary )
+{
+    EL_DEBUG_CSE
+    for( const auto& token : tokens )
+    {
+        if( token.type != read_cplex_lp::CPLEX_LP_NAME )
+            LogicError("Invalid integer variable list");
+        const Int j = Variable( token.text );
+        if( binary )
+        {
+            // The relaxation of a binary variable lies in [0,1].
+            lowerBounds_[j] = Max( lowerBounds_[j], 0. );
+            upperBounds_[j] = Min( upperBounds_[j], 1. );
+        }
+        ++numIntegers_;
+    }
+}
+
+template<class MatrixType,class VectorType>
+void ReadCPLEXLP
+( AffineLPProblem<MatrixType,VectorType>& problem,
+  const string& filename,
+  bool compressed,
+  bool metadataSummary )
+{
+    EL_DEBUG_CSE
+    CPLEXLPReader reader
+      ( filename, compressed, read_mps::ReaderComm(problem) );
+    read_mps::Helper( reader, problem, metadataSummary );
+}
+
+} // namespace El
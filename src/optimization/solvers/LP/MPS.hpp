@@ -8,6 +8,11 @@
 */
 #include <El.hpp>
 
+#include <unordered_map>
+#ifdef EL_HAVE_ZLIB
+# include <zlib.h>
+#endif
+
 namespace El {
 
 // Please see http://lpsolve.sourceforge.net/5.5/mps-format.htm for a very
@@ -16,6 +21,9 @@ namespace El {
 // An important, but seemingly not widely discussed, issue is that some of the
 // lp_data LP examples (e.g., tuff.mps) are not well-formed. I found out the
 // hard way that the fourth equality constraint of tuff.mps is empty.
+//
+// Both the fixed and free MPS formats are handled by splitting each data line
+// on whitespace, so row and variable names may not contain spaces.
 
 // TODO(poulson): Allow the default lower and upper bounds to be configurable.
 
@@ -41,8 +49,18 @@ enum MPSRowType {
 struct MPSRowData
 {
   MPSRowType type;
-  Int typeIndex;
+  Int typeIndex=-1;
   Int numNonzeros=0; // We will delete rows with no nonzeros (e.g., for tuff).
+
+  // From the RHS section
+  double rhs=0;
+
+  // From the RANGES section. A ranged row is stored as a lesser or greater row
+  // along with an extra row of 'G x <= h' which enforces the opposite side of
+  // the range.
+  bool ranged=false;
+  double range=0;
+  Int rangeIndex=-1;
 };
 
 // We will follow the de facto convention of assuming that variables live within
@@ -58,11 +76,12 @@ struct MPSRowData
 // but ILOG famously does not. We provide an option to choose between the two
 // behaviors.
 //
+// Formats which allow an explicit lower bound of -\infty (e.g., CPLEX LP)
+// mark such variables with 'lowerUnbounded' so that the default
+// non-negativity is never imposed.
+//
 struct MPSVariableData
 {
-  Int index;
-  Int numNonzeros=0;
-
   bool lowerBounded=false;
   Int lowerBoundIndex=-1;
   double lowerBound;
@@ -83,6 +102,8 @@ struct MPSVariableData
 
   bool nonnegative=false;
   Int nonnegativeIndex=-1;
+
+  bool lowerUnbounded=false;
 };
 
 struct MPSMeta
@@ -90,16 +111,27 @@ struct MPSMeta
   // From the NAME section
   string name="";
 
-  // From the ROWS section
+  // From the OBJSENSE section (or the 'minimize' argument of the reader)
+  bool minimize=true;
+
+  // From the ROWS section (or the OBJNAME section)
   string costName="";
+  Int costIndex=-1;
   Int numLesserRows=0;
   Int numGreaterRows=0;
   Int numEqualityRows=0;
   Int numNonconstrainingRows=0;
-  std::map<string,MPSRowData> rowDict;
 
-  // From the COLUMNS section
-  std::map<string,MPSVariableData> variableDict;
+  // Row names are interned in order of appearance: 'rowIndices' maps each
+  // name to its position in 'rowNames' and 'rows'.
+  vector<string> rowNames;
+  vector<MPSRowData> rows;
+  std::unordered_map<string,Int> rowIndices;
+
+  // From the COLUMNS section (variables are interned in the same manner)
+  vector<string> variableNames;
+  vector<MPSVariableData> variables;
+  std::unordered_map<string,Int> variableIndices;
   Int numEqualityEntries=0;
   Int numInequalityEntries=0;
 
@@ -113,7 +145,9 @@ struct MPSMeta
   Int numNonnegativeBounds=0;
 
   // From the RANGES section
-  // TODO(poulson)
+  string rangesName="";
+  Int numRanges=0;
+  Int numRangeRows=0;
 
   // From the RHS section
   string rhsName="";
@@ -134,23 +168,27 @@ struct MPSMeta
   //   | G3 |      | h3 |
   //   | G4 |      | h4 |
   //   | G5 |      | h5 |
+  //   | G6 |      | h6 |
   //
   Int lesserOffset=-1,
       greaterOffset=-1,
       upperBoundOffset=-1,
       lowerBoundOffset=-1,
       nonpositiveOffset=-1,
-      nonnegativeOffset=-1;
+      nonnegativeOffset=-1,
+      rangeOffset=-1;
 
   void PrintSummary() const
   {
       Output("MPSMeta summary:");
       Output("  name=",name);
+      Output("  minimize=",minimize);
       Output("  costName=",costName);
       Output("  numLesserRows=",numLesserRows);
       Output("  numGreaterRows=",numGreaterRows);
       Output("  numEqualityRows=",numEqualityRows);
       Output("  numNonconstrainingRows=",numNonconstrainingRows);
+      Output("  numRangeRows=",numRangeRows);
       Output("  numEqualityEntries=",numEqualityEntries);
       Output("  numInequalityEntries=",numInequalityEntries);
       Output("  boundName=",boundName);
@@ -160,6 +198,7 @@ struct MPSMeta
       Output("  numFreeBounds=",numFreeBounds);
       Output("  numNonpositiveBounds=",numNonpositiveBounds);
       Output("  numNonnegativeBounds=",numNonnegativeBounds);
+      Output("  rangesName=",rangesName);
       Output("  rhsName=",rhsName);
       Output("  m=",m,", n=",n,", k=",k);
   }
@@ -182,6 +221,304 @@ struct AffineLPEntry
   Real value;
 };
 
+// A coefficient of the constraint (or objective) matrix in terms of the
+// interned row and variable indices.
+struct MPSTriplet
+{
+  Int row;
+  Int column;
+  double value;
+};
+
+// Random access to the bytes of an LP file. Since gzip streams cannot be
+// seeked into, compressed files are inflated into memory in their entirety.
+class LPFileSource
+{
+public:
+    LPFileSource( const string& filename, bool compressed );
+
+    std::streamoff Size() const;
+    void Read( std::streamoff offset, std::streamoff count, char* buffer );
+
+private:
+    bool inMemory_=false;
+    vector<char> contents_;
+    std::ifstream file_;
+    std::streamoff size_=0;
+};
+
+LPFileSource::LPFileSource( const string& filename, bool compressed )
+{
+    EL_DEBUG_CSE
+    file_.open( filename.c_str(), std::ios::binary );
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    // Detect gzip-compressed input from its magic bytes.
+    unsigned char magic[2] = { 0, 0 };
+    file_.read( reinterpret_cast<char*>(magic), 2 );
+    const bool gzipped = file_.gcount() == 2 &&
+      magic[0] == 0x1f && magic[1] == 0x8b;
+    if( compressed && !gzipped )
+        RuntimeError(filename," is not gzip-compressed");
+    if( gzipped )
+    {
+#ifdef EL_HAVE_ZLIB
+        file_.close();
+        gzFile compressedFile = gzopen( filename.c_str(), "rb" );
+        if( compressedFile == NULL )
+            RuntimeError("Could not open ",filename);
+        const unsigned chunkSize = 1u << 20;
+        while( true )
+        {
+            const size_t oldSize = contents_.size();
+            contents_.resize( oldSize+chunkSize );
+            const int numRead =
+              gzread( compressedFile, &contents_[oldSize], chunkSize );
+            if( numRead < 0 )
+            {
+                gzclose( compressedFile );
+                RuntimeError("Could not decompress ",filename);
+            }
+            contents_.resize( oldSize+numRead );
+            if( numRead == 0 )
+                break;
+        }
+        gzclose( compressedFile );
+        inMemory_ = true;
+        size_ = contents_.size();
+#else
+        RuntimeError
+        ("Reading the gzip-compressed file ",filename," requires Elemental "
+         "to be configured with zlib");
+#endif
+    }
+    else
+    {
+        file_.clear();
+        file_.seekg( 0, std::ios::end );
+        size_ = file_.tellg();
+    }
+}
+
+std::streamoff LPFileSource::Size() const
+{ return size_; }
+
+void LPFileSource::Read
+( std::streamoff offset, std::streamoff count, char* buffer )
+{
+    EL_DEBUG_CSE
+    if( offset < 0 || count < 0 || offset+count > size_ )
+        LogicError("Invalid byte range [",offset,",",offset+count,")");
+    if( inMemory_ )
+    {
+        MemCopy( buffer, &contents_[offset], count );
+    }
+    else
+    {
+        file_.seekg( offset );
+        file_.read( buffer, count );
+        if( !file_ )
+            RuntimeError("Could not read bytes [",offset,",",offset+count,")");
+    }
+}
+
+namespace read_mps {
+
+// Fill 'buffer' with the lines of [dataBegin,dataEnd) owned by part 'rank' of
+// 'numParts' (a line belongs to the part containing its first byte), followed
+// by a null terminator, and return the offset of the first such line.
+inline std::streamoff ReadLineRange
+( LPFileSource& source,
+  std::streamoff dataBegin,
+  std::streamoff dataEnd,
+  int rank,
+  int numParts,
+  vector<char>& buffer )
+{
+    EL_DEBUG_CSE
+    const std::streamoff numBytes = dataEnd - dataBegin;
+    const std::streamoff lo = dataBegin + (numBytes*rank)/numParts;
+    const std::streamoff hi = dataBegin + (numBytes*(rank+1))/numParts;
+    if( lo == hi )
+    {
+        buffer.assign( 1, '\0' );
+        return hi;
+    }
+    const std::streamoff readBegin = ( lo == dataBegin ? lo : lo-1 );
+    buffer.resize( hi-readBegin );
+    source.Read( readBegin, hi-readBegin, buffer.data() );
+
+    Int begin = 0;
+    if( readBegin != lo )
+    {
+        auto newline = std::find( buffer.begin(), buffer.end(), '\n' );
+        begin = ( newline - buffer.begin() ) + 1;
+    }
+    if( begin >= Int(buffer.size()) )
+    {
+        // No line begins within this range
+        buffer.assign( 1, '\0' );
+        return hi;
+    }
+
+    const std::streamoff chunkSize = 4096;
+    std::streamoff pos = hi;
+    while( pos < dataEnd && buffer.back() != '\n' )
+    {
+        const std::streamoff count = Min(chunkSize,dataEnd-pos);
+        const Int oldSize = buffer.size();
+        buffer.resize( oldSize+count );
+        source.Read( pos, count, &buffer[oldSize] );
+        auto newline =
+          std::find( buffer.begin()+oldSize, buffer.end(), '\n' );
+        if( newline != buffer.end() )
+            buffer.resize( (newline-buffer.begin())+1 );
+        pos += count;
+    }
+    buffer.erase( buffer.begin(), buffer.begin()+begin );
+    buffer.push_back( '\0' );
+    return readBegin + begin;
+}
+
+// Fill 'buffer' with all of [begin,end) followed by a null terminator.
+inline void ReadSection
+( LPFileSource& source,
+  std::streamoff begin,
+  std::streamoff end,
+  vector<char>& buffer )
+{
+    EL_DEBUG_CSE
+    buffer.resize( end-begin );
+    source.Read( begin, end-begin, buffer.data() );
+    buffer.push_back( '\0' );
+}
+
+// Only the processes which failed to parse their share of a section know of
+// the failure, so the message of the lowest such rank is shared and thrown by
+// every process before any of them enters a subsequent collective.
+inline void AgreeOnError( string error, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+    {
+        if( error != "" )
+            LogicError(error);
+        return;
+    }
+    const int errorRank =
+      mpi::AllReduce
+      ( error == "" ? commSize : mpi::Rank(comm), mpi::MIN, comm );
+    if( errorRank == commSize )
+        return;
+    Int errorSize = error.size();
+    mpi::Broadcast( errorSize, errorRank, comm );
+    error.resize( errorSize );
+    vector<byte> message( error.begin(), error.end() );
+    mpi::Broadcast( message.data(), errorSize, errorRank, comm );
+    LogicError(string(message.begin(),message.end()));
+}
+
+// Read the line starting at 'offset' (without its newline) and return the
+// offset of the next line.
+inline std::streamoff ReadLine
+( LPFileSource& source,
+  std::streamoff offset,
+  std::streamoff dataEnd,
+  string& line )
+{
+    EL_DEBUG_CSE
+    line.clear();
+    const std::streamoff chunkSize = 256;
+    char chunk[256];
+    std::streamoff pos = offset;
+    while( pos < dataEnd )
+    {
+        const std::streamoff count = Min(chunkSize,dataEnd-pos);
+        source.Read( pos, count, chunk );
+        const char* newline = std::find( chunk, chunk+count, '\n' );
+        line.append( chunk, newline-chunk );
+        if( newline != chunk+count )
+            return pos + (newline-chunk) + 1;
+        pos += count;
+    }
+    return dataEnd;
+}
+
+struct Token
+{
+  const char* begin;
+  const char* end;
+};
+
+// Split [p,lineEnd) on whitespace, storing at most 'maxTokens' tokens, and
+// return the total number of tokens.
+inline Int Tokenize
+( const char* p, const char* lineEnd, Token* tokens, Int maxTokens )
+{
+    Int numTokens = 0;
+    while( true )
+    {
+        while( p < lineEnd && (*p == ' ' || *p == '\t' || *p == '\r') )
+            ++p;
+        if( p == lineEnd )
+            break;
+        const char* tokenBegin = p;
+        while( p < lineEnd && *p != ' ' && *p != '\t' && *p != '\r' )
+            ++p;
+        if( numTokens < maxTokens )
+        {
+            tokens[numTokens].begin = tokenBegin;
+            tokens[numTokens].end = p;
+        }
+        ++numTokens;
+    }
+    return numTokens;
+}
+
+inline string TokenString( const Token& token )
+{ return string( token.begin, token.end ); }
+
+inline string UpperCase( const Token& token )
+{
+    string word( token.begin, token.end );
+    for( auto& character : word )
+        character = std::toupper( character );
+    return word;
+}
+
+// Tokens are always followed by whitespace or a null terminator, which stops
+// 'strtod'.
+inline bool ParseValue( const Token& token, double& value )
+{
+    char* end;
+    value = std::strtod( token.begin, &end );
+    return end == token.end;
+}
+
+// Call 'function(lineBegin,lineEnd)' on each line of [begin,end) which is not
+// a comment.
+template<typename Function>
+void ForEachLine( const char* begin, const char* end, Function function )
+{
+    const char* p = begin;
+    while( p < end )
+    {
+        const char* lineEnd = std::find( p, end, '\n' );
+        if( *p != '*' )
+            function( p, lineEnd );
+        p = ( lineEnd == end ? end : lineEnd+1 );
+    }
+}
+
+} // namespace read_mps
+
+// The format-independent portion of reading an affine LP from a file: the
+// parsers of each format intern the rows and variables, record the right-hand
+// sides, ranges, and bounds, and collect the (locally owned) coefficients
+// as triplets, after which 'Finalize' lays out the affine problem.
+//
 // We form the primal problem
 //
 //   arginf_{x,s} { c^T x | A x = b, G x + s = h, s >= 0 },
@@ -204,26 +541,24 @@ struct AffineLPEntry
 //   | G3 |      | h3 |
 //   | G4 |      | h4 |
 //   | G5 |      | h5 |
+//   | G6 |      | h6 |
 //
 // where 'G0 x <= h0' consists of the 'lesser' rows, 'G1 x <= h1' is the
 // negation of the 'greater' rows, 'G2 x <= h2' consists of the upper
 // bounds (each row of 'G0' is all zeros except for a single one),
 // 'G3 x <= h3' is the negation of the lower bounds (each row of 'G3'
 // is all zeros except for a single negative one), 'G4 x <= h4' is the
-// set of nonpositive bounds, and 'G5 x <= h5' is the set of nonnegative
-// bounds.
+// set of nonpositive bounds, 'G5 x <= h5' is the set of nonnegative
+// bounds, and 'G6 x <= h6' enforces the opposite sides of the ranged rows.
+//
+// When the reader is given a communicator, each process only enqueues its
+// share of the entries (its own coefficients and a cyclic share of the
+// right-hand sides and bounds), so that the entries can be sent directly to
+// their owners.
 //
-class MPSReader
+class LPFileReader
 {
 public:
-    MPSReader
-    ( const string& filename,
-      bool compressed=false,
-      bool minimize=true,
-      bool keepNonnegativeWithZeroUpperBound=true );
-    // The PILOT netlib lp_data model appears to require
-    // 'keepNonnegativeWithZeroUpperBound=true'.
-
     // Attempt to enqueue another entry and return true if successful.
     bool QueuedEntry();
 
@@ -232,491 +567,184 @@ public:
 
     const MPSMeta& Meta() const;
 
-private:
-    string filename_;
-    std::ifstream file_;
-
-    bool minimize_;
-    bool keepNonnegativeWithZeroUpperBound_;
-    MPSMeta meta_;
-
-    vector<AffineLPEntry<double>> queuedEntries_;
+protected:
+    LPFileReader
+    ( bool minimize, bool keepNonnegativeWithZeroUpperBound, mpi::Comm comm );
 
-    MPSSection section_=MPS_NONE;
+    Int AddRow( const string& name, MPSRowType type );
+    Int AddVariable( const string& name );
 
-    // The RHS section typically has a name followed by either one or two pairs
-    // per row, but some models (e.g., dfl001.mps) do not involve a name.
-    bool initializedRHSSection_=false;
-    bool rhsHasName_;
+    // Resolve the ranges and bounds and lay out the affine problem. This
+    // requires the row nonzero counts to already be summed over 'comm_'.
+    void Finalize();
 
-    // The BOUNDS section typically has a bound type marker, followed by a
-    // bound set name, followed by a variable name, and, if applicable,
-    // a numeric value). But some models (e.g., dfl001.mps) do not involve a
-    // bound set name.
-    bool initializedBoundsSection_=false;
-    bool boundsHasName_;
+    mpi::Comm comm_;
+    int commRank_, commSize_;
+    bool keepNonnegativeWithZeroUpperBound_;
+    MPSMeta meta_;
+    vector<MPSTriplet> triplets_;
 
-    // Temporaries for the metadata extraction process.
-    string line_;
-    string token_, rowType_, rowName_, variableName_, boundMark_;
-    double value_;
+private:
+    void QueueTriplet( const MPSTriplet& triplet );
+    void QueueRowVectors( Int row );
+    void QueueBounds( Int column );
 
-    // For the final loop over the variable dictionary to extract the
-    // nonpositive and nonnegative bounds.
-    typename std::map<string,MPSVariableData>::const_iterator variableIter_;
+    vector<AffineLPEntry<double>> queuedEntries_;
+    Int tripletCursor_=0, rowCursor_=-1, variableCursor_=-1;
 };
 
-MPSReader::MPSReader
-( const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound )
-: filename_(filename),
-  file_(filename.c_str()),
-  minimize_(minimize),
+LPFileReader::LPFileReader
+( bool minimize, bool keepNonnegativeWithZeroUpperBound, mpi::Comm comm )
+: comm_(comm),
+  commRank_(mpi::Rank(comm)),
+  commSize_(mpi::Size(comm)),
   keepNonnegativeWithZeroUpperBound_(keepNonnegativeWithZeroUpperBound)
+{
+    meta_.minimize = minimize;
+    rowCursor_ = commRank_;
+    variableCursor_ = commRank_;
+}
+
+Int LPFileReader::AddRow( const string& name, MPSRowType type )
 {
     EL_DEBUG_CSE
-    if( compressed )
-        LogicError("Compressed reads are not yet supported");
-    if( !file_.is_open() )
-        RuntimeError("Could not open ",filename);
+    const Int index = meta_.rows.size();
+    if( !meta_.rowIndices.insert( std::make_pair(name,index) ).second )
+        LogicError("Row ",name," was declared more than once");
+    MPSRowData rowData;
+    // We set the 'typeIndex' fields later since it is not uncommon
+    // (e.g., see tuff.mps) for rows to be empty.
+    rowData.type = type;
+    meta_.rows.push_back( rowData );
+    meta_.rowNames.push_back( name );
+    return index;
+}
 
-    // Rather than assuming that std::map<string,Int>::size() is constant-time,
-    // we can maintain counters for the sizes of the variable dictionary.
-    Int variableCounter=0;
+Int LPFileReader::AddVariable( const string& name )
+{
+    EL_DEBUG_CSE
+    const Int index = meta_.variables.size();
+    auto result = meta_.variableIndices.insert( std::make_pair(name,index) );
+    if( !result.second )
+        return result.first->second;
+    meta_.variables.push_back( MPSVariableData() );
+    meta_.variableNames.push_back( name );
+    return index;
+}
 
-    // Temporaries for the metadata extraction process.
-    string token, rowType, rowName, variableName, boundMark;
-    string rhsNameCandidate, boundNameCandidate;
-    double value;
+void LPFileReader::Finalize()
+{
+    EL_DEBUG_CSE
+    const bool print = commRank_ == 0;
+    const Int numRows = meta_.rows.size();
 
-    // TODO(poulson): Convert each token to upper-case letters before each
-    // comparison. While capital letters are used by convention, they are
-    // not required.
-    MPSSection section = MPS_NONE;
-    string line;
-    while( std::getline( file_, line ) )
+    // The first nonconstraining row is the objective unless another was named.
+    if( meta_.costName != "" )
     {
-        // We first determine which section we are in
-        // ------------------------------------------
-        std::stringstream sectionStream( line );
-        const char firstChar = sectionStream.peek();
-        const bool isDataLine =
-          firstChar == ' ' ||
-          firstChar == '\t' ||
-          firstChar == '*' ||
-          firstChar == '#';
-
-        // The first token on each line should be a string. We will check it for
-        // equivalence with each section string.
-        if( !(sectionStream >> token) )
-        {
-            // This line only consists of whitespace.
-            continue;
-        }
-
-        if( !isDataLine )
+        auto iter = meta_.rowIndices.find( meta_.costName );
+        if( iter == meta_.rowIndices.end() )
+            LogicError("Could not find objective row ",meta_.costName);
+        if( meta_.rows[iter->second].type != MPS_NONCONSTRAINING_ROW )
+            LogicError("Objective row ",meta_.costName," is constraining");
+        meta_.costIndex = iter->second;
+    }
+    else
+    {
+        for( Int i=0; i<numRows; ++i )
         {
-            if( token == "NAME" )
+            if( meta_.rows[i].type == MPS_NONCONSTRAINING_ROW )
             {
-                if( meta_.name != "" )
-                    LogicError("Multiple 'NAME' sections");
-                if( !(sectionStream >> meta_.name) )
-                    LogicError("Missing 'NAME' string");
-                section = MPS_NAME;
-            }
-            else if( token == "OBJSENSE" )
-            {
-                LogicError("OBJSENSE is not yet handled");
-            }
-            else if( token == "ROWS" )
-            {
-                if( meta_.numLesserRows > 0 ||
-                    meta_.numGreaterRows > 0 ||
-                    meta_.numEqualityRows > 0 ||
-                    meta_.numNonconstrainingRows > 0 )
-                    LogicError("Multiple ROWS sections");
-                section = MPS_ROWS;
-            }
-            else if( token == "COLUMNS" )
-            {
-                if( meta_.numEqualityEntries > 0 ||
-                    meta_.numInequalityEntries > 0 )
-                    LogicError("Multiple 'COLUMNS' sections");
-                section = MPS_COLUMNS;
-            }
-            else if( token == "RHS" )
-            {
-                section = MPS_RHS;
-            }
-            else if( token == "BOUNDS" )
-            {
-                if( meta_.numUpperBounds > 0 ||
-                    meta_.numLowerBounds > 0 ||
-                    meta_.numFixedBounds > 0 ||
-                    meta_.numFreeBounds > 0 ||
-                    meta_.numNonpositiveBounds > 0 ||
-                    meta_.numNonnegativeBounds > 0 )
-                    Output("WARNING: Multiple 'BOUNDS' sections");
-                section = MPS_BOUNDS;
-            }
-            else if( token == "RANGES" )
-            {
-                section = MPS_RANGES;
-                LogicError("MPS 'RANGES' section is not yet supported");
-            }
-            else if( token == "ENDATA" )
-            {
-                section = MPS_END;
+                meta_.costIndex = i;
+                meta_.costName = meta_.rowNames[i];
                 break;
             }
-            else if( token == "MARKER" )
-            {
-                LogicError("MPS 'MARKER' section is not yet supported");
-            }
-            else if( token == "SOS" )
-            {
-                LogicError("MPS 'SOS' section is not yet supported");
-            }
-            else
+        }
+    }
+    if( meta_.costIndex == -1 && print )
+        Output("WARNING: No objective row was found");
+
+    for( Int i=0; i<numRows; ++i )
+    {
+        auto& rowData = meta_.rows[i];
+        const string& name = meta_.rowNames[i];
+        if( rowData.type == MPS_NONCONSTRAINING_ROW )
+        {
+            ++meta_.numNonconstrainingRows;
+            if( rowData.ranged && print )
+                Output("WARNING: Ignoring range of nonconstraining row ",name);
+            rowData.ranged = false;
+            if( i == meta_.costIndex )
             {
-                LogicError("Section token ",token," is not recognized");
+                if( rowData.numNonzeros == 0 && print )
+                    Output("WARNING: Objective was entirely zero.");
+                rowData.typeIndex = 0;
             }
             continue;
         }
 
-        // No section marker was found, so handle this data line.
-        if( section == MPS_ROWS )
+        // An equality row with a nonzero range R becomes the interval
+        // [rhs,rhs+|R|] if R > 0 and [rhs-|R|,rhs] otherwise.
+        if( rowData.ranged && rowData.type == MPS_EQUALITY_ROW )
         {
-            std::stringstream rowStream( line );
-            if( !(rowStream >> rowType) )
-                LogicError("Invalid 'ROWS' section");
-            if( !(rowStream >> rowName) )
-                LogicError("Invalid 'ROWS' section");
-            MPSRowData rowData;
-            // We set the 'typeIndex' fields later since it is not uncommon
-            // (e.g., see tuff.mps) for rows to be empty.
-            if( rowType == "L" )
-            {
-                rowData.type = MPS_LESSER_ROW;
-                meta_.rowDict[rowName] = rowData;
-            }
-            else if( rowType == "G" )
-            {
+            if( rowData.range > 0. )
                 rowData.type = MPS_GREATER_ROW;
-                meta_.rowDict[rowName] = rowData;
-            }
-            else if( rowType == "E" )
-            {
-                rowData.type = MPS_EQUALITY_ROW;
-                meta_.rowDict[rowName] = rowData;
-            }
-            else if( rowType == "N" )
-            {
-                rowData.type = MPS_NONCONSTRAINING_ROW;
-                meta_.rowDict[rowName] = rowData;
-                if( meta_.numNonconstrainingRows == 1 )
-                    meta_.costName = rowName;
-            }
+            else if( rowData.range < 0. )
+                rowData.type = MPS_LESSER_ROW;
             else
-                LogicError("Invalid 'ROWS' section");
+                rowData.ranged = false;
         }
-        else if( section == MPS_COLUMNS )
-        {
-            std::stringstream columnStream( line );
-            if( !(columnStream >> variableName) )
-                LogicError("Invalid 'COLUMNS' section");
-            auto variableIter = meta_.variableDict.find( variableName );
-            if( variableIter == meta_.variableDict.end() )
-            {
-                MPSVariableData variableData;
-                variableData.index = variableCounter++;
-                meta_.variableDict[variableName] = variableData;
-                variableIter = meta_.variableDict.find( variableName );
-            }
-            MPSVariableData& variableData = variableIter->second;
 
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
+        if( rowData.numNonzeros == 0 )
+        {
+            if( print )
             {
-                if( !(columnStream >> rowName) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'COLUMNS' section");
-                    else
-                        break;
-                }
-                if( !(columnStream >> value) )
-                    LogicError("Invalid 'COLUMNS' section");
-                ++variableData.numNonzeros;
-
-                auto rowIter = meta_.rowDict.find( rowName );
-                if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName);
-                auto& rowData = rowIter->second;
                 if( rowData.type == MPS_EQUALITY_ROW )
-                {
-                    // A(row,column) = value
-                    ++meta_.numEqualityEntries;
-                    ++rowData.numNonzeros;
-                }
-                else if( rowData.type == MPS_LESSER_ROW )
-                {
-                    // G(row,column) = value
-                    ++meta_.numInequalityEntries;
-                    ++rowData.numNonzeros;
-                }
+                    Output("WARNING: Deleting empty equality row ",name);
                 else if( rowData.type == MPS_GREATER_ROW )
-                {
-                    // G(row,column) = -value
-                    ++meta_.numInequalityEntries;
-                    ++rowData.numNonzeros;
-                }
-                else if( rowData.type == MPS_NONCONSTRAINING_ROW )
-                {
-                    // c(column) = value (assuming typeIndex==0)
-                    ++rowData.numNonzeros;
-                }
-                else
-                    LogicError("Unknown row data type");
-            }
-        }
-        else if( section == MPS_RHS )
-        {
-            if( !initializedRHSSection_ )
-            {
-                std::stringstream rhsTestStream( line );
-                Int numTokens=0;
-                string rhsToken;
-                while( rhsTestStream >> rhsToken )
-                    ++numTokens;
-                if( numTokens == 2 || numTokens == 4 )
-                {
-                    // There were either one or two pairs with no name.
-                    rhsHasName_ = false;
-                    meta_.numRHS = 1;
-                }
-                else if( numTokens == 3 || numTokens == 5 )
-                {
-                    // There were either one or two pairs with a name.
-                    rhsHasName_ = true;
-                }
-                else
-                {
-                    LogicError("Invalid 'RHS' section (1)");
-                }
-                
-                initializedRHSSection_ = true;
-            }
-
-            std::stringstream rhsStream( line );
-            if( rhsHasName_ )
-            {
-                if( !(rhsStream >> rhsNameCandidate) )
-                    LogicError("Invalid 'RHS' section (2)");
-                if( meta_.numRHS == 0 )
-                {
-                    // We should currently have that rhsName == "".
-                    meta_.rhsName = rhsNameCandidate;
-                    meta_.numRHS = 1;
-                }
-                else if( rhsNameCandidate != meta_.rhsName )
-                    LogicError
-                    ("Only single problem instances are currently supported "
-                     "(multiple right-hand side names were encountered)");
-            }
-
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
-            {
-                if( !(rhsStream >> rowName) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'RHS' section (3)");
-                    else
-                        break;
-                }
-                if( !(rhsStream >> value) )
-                    LogicError("Invalid 'RHS' section (4)");
-            }
-        }
-        else if( section == MPS_BOUNDS )
-        {
-            if( !initializedBoundsSection_ )
-            {
-                std::stringstream boundsTestStream( line );
-                if( !(boundsTestStream >> boundMark) )
-                    LogicError("Invalid 'BOUNDS' section");
-                if( !(boundsTestStream >> token) )
-                    LogicError("Invalid 'BOUNDS' section");
-
-                Int numTokens=2;
-                string rhsToken;
-                while( boundsTestStream >> rhsToken )
-                    ++numTokens;
-                if( boundMark == "LO" ||
-                    boundMark == "UP" ||
-                    boundMark == "FX" )
-                {
-                    if( numTokens == 4 )
-                        boundsHasName_ = true;
-                    else if( numTokens == 3 )
-                        boundsHasName_ = false;
-                    else
-                        LogicError("Invalid ",boundMark," 'BOUNDS' line");
-                }
-                else if( boundMark == "FR" ||
-                         boundMark == "MI" ||
-                         boundMark == "PL" )
-                {
-                    if( numTokens == 3 )
-                        boundsHasName_ = true;
-                    else if( numTokens == 2 )
-                        boundsHasName_ = false;
-                    else
-                        LogicError("Invalid ",boundMark," 'BOUNDS' line");
-                }
+                    Output("WARNING: Deleting empty greater row ",name);
                 else
-                    LogicError("Unknown bound mark ",boundMark);
-
-                // If there is a name, it occurred in the second position.
-                if( boundsHasName_ )
-                    meta_.boundName = token;
-
-                initializedBoundsSection_ = true;
-            }
-
-            std::stringstream boundStream( line );
-            // We already have the first token of a bounding row, which should
-            // be of the same general form as
-            //
-            //   FX BOUNDROW VARIABLENAME 1734.
-            //
-            // in the case of 'VARIABLENAME' being fixed ('FX') at the value
-            // 1734 (with this problem's bound name being 'BOUNDROW').
-            if( !(boundStream >> boundMark) )
-                LogicError("Invalid 'BOUNDS' section");
-            if( boundsHasName_ )
-            {
-                if( !(boundStream >> boundNameCandidate) )
-                    LogicError("Invalid 'BOUNDS' section");
-                if( meta_.boundName != boundNameCandidate )
-                    LogicError
-                    ("Only single problem instances are currently supported "
-                     "(multiple bound names were encountered)");
-            }
-            if( !(boundStream >> variableName) )
-                LogicError("Invalid 'BOUNDS' section");
-            auto variableIter = meta_.variableDict.find( variableName );
-            if( variableIter == meta_.variableDict.end() )
-                LogicError
-                ("Invalid 'BOUNDS' section (name ",variableName," not found)");
-            MPSVariableData& data = variableIter->second;
-            if( boundMark == "UP" )
-            {
-                if( !(boundStream >> value) )
-                    LogicError("Invalid 'BOUNDS' section");
-                data.upperBounded = true;
-                data.upperBound = value;
-            }
-            else if( boundMark == "LO" )
-            {
-                if( !(boundStream >> value) )
-                    LogicError("Invalid 'BOUNDS' section");
-                data.lowerBounded = true;
-                data.lowerBound = value;
-            }
-            else if( boundMark == "FX" )
-            {
-                if( !(boundStream >> value) )
-                    LogicError("Invalid 'BOUNDS' section");
-                data.fixed = true;
-                data.fixedValue = value;
+                    Output("WARNING: Deleting empty lesser row ",name);
             }
-            else if( boundMark == "FR" )
-                data.free = true;
-            else if( boundMark == "MI" )
-                data.nonpositive = true;
-            else if( boundMark == "PL" )
-                data.nonnegative = true;
-            else
-                LogicError("Invalid 'BOUNDS' section (unknown bound mark)");
+            continue;
         }
-        else if( section == MPS_RANGES )
+        if( rowData.type == MPS_EQUALITY_ROW )
         {
-            LogicError("The 'RANGES' section is not yet supported");
+            rowData.typeIndex = meta_.numEqualityRows++;
+            meta_.numEqualityEntries += rowData.numNonzeros;
         }
-        else
+        else if( rowData.type == MPS_GREATER_ROW )
         {
-            LogicError("Invalid MPS file");
+            rowData.typeIndex = meta_.numGreaterRows++;
+            meta_.numInequalityEntries += rowData.numNonzeros;
         }
-    }
-    if( meta_.name == "" )
-        LogicError("No nontrivial 'NAME' was found");
-    if( meta_.numRHS == 0 )
-    {
-        // Any unmentioned values are assumed to be zero.
-        meta_.numRHS = 1;
-    }
-
-    // Iterate through the row map to delete any empty rows.
-    for( auto iter=meta_.rowDict.begin(); iter!=meta_.rowDict.end(); )
-    {
-        if( iter->second.numNonzeros == 0 )
+        else if( rowData.type == MPS_LESSER_ROW )
         {
-            if( iter->second.type == MPS_NONCONSTRAINING_ROW )
-            {
-                Output("WARNING: Objective was entirely zero.");
-                iter->second.typeIndex = 0;
-                ++iter;
-            }
-            else
-            {
-                if( iter->second.type == MPS_EQUALITY_ROW )
-                    Output("WARNING: Deleting empty equality row ",iter->first);
-                else if( iter->second.type == MPS_GREATER_ROW )
-                    Output("WARNING: Deleting empty greater row ",iter->first);
-                else if( iter->second.type == MPS_LESSER_ROW )
-                    Output("WARNING: Deleting empty lesser row ",iter->first);
-                else
-                    LogicError("Unknown empty row type");
-                // Delete this entry.
-                iter = meta_.rowDict.erase(iter);
-            }
+            rowData.typeIndex = meta_.numLesserRows++;
+            meta_.numInequalityEntries += rowData.numNonzeros;
         }
         else
+            LogicError("Unknown row type");
+        if( rowData.ranged )
         {
-            if( iter->second.type == MPS_EQUALITY_ROW )
-            {
-                iter->second.typeIndex = meta_.numEqualityRows++;
-            }
-            else if( iter->second.type == MPS_GREATER_ROW )
-            {
-                iter->second.typeIndex = meta_.numGreaterRows++;
-            }
-            else if( iter->second.type == MPS_LESSER_ROW )
-            {
-                iter->second.typeIndex = meta_.numLesserRows++;
-            }
-            else if( iter->second.type == MPS_NONCONSTRAINING_ROW )
-            {
-                iter->second.typeIndex = 0;
-            }
-            else
-                LogicError("Unknown row type");
-            ++iter;
+            rowData.rangeIndex = meta_.numRangeRows++;
+            meta_.numInequalityEntries += rowData.numNonzeros;
         }
     }
 
-    // Now iterate through the variable map and make use of the requested
+    // Now iterate through the variables and make use of the requested
     // conventions for counting the number of bounds of each type.
     // Also warn if there are possibly conflicting bound types.
-    for( auto& entry : meta_.variableDict )
+    const Int numVariables = meta_.variables.size();
+    for( Int j=0; j<numVariables; ++j )
     {
-        auto& data = entry.second;
+        auto& data = meta_.variables[j];
+        const string& name = meta_.variableNames[j];
+
+        // An explicitly unbounded lower bound without any other bounds
+        // yields a free variable.
+        if( data.lowerUnbounded && !data.upperBounded && !data.fixed &&
+            !data.nonpositive )
+            data.free = true;
 
         // Handle explicit upper and lower bounds.
         if( data.upperBounded )
@@ -735,18 +763,22 @@ MPSReader::MPSReader
                     data.lowerBounded = false;
                     data.fixed = true;
                     data.fixedValue = data.upperBound;
-                    Output
-                    ("WARNING: Fixing ",entry.first," since the lower and "
-                     "upper bounds were both ",data.fixedValue);
+                    if( print )
+                        Output
+                        ("WARNING: Fixing ",name," since the lower and "
+                         "upper bounds were both ",data.fixedValue);
                 }
                 else
                 {
                     LogicError
                     ("Cannot enforce a lower bound of ",data.lowerBound,
-                     " and an upper bound of ",data.upperBound," for ",
-                     entry.first);
+                     " and an upper bound of ",data.upperBound," for ",name);
                 }
             }
+            else if( data.lowerUnbounded )
+            {
+                data.upperBoundIndex = meta_.numUpperBounds++;
+            }
             else
             {
                 // Handling the default non-negativity is somewhat subtle and
@@ -770,22 +802,23 @@ MPSReader::MPSReader
                         data.upperBounded = false;
                         data.fixed = true;
                         data.fixedValue = 0.;
-                        Output
-                        ("WARNING: Fixing ",entry.first,
-                         " at zero due to zero upper bound. If this is not "
-                         "desired, please set "
-                         "'keepNonnegativeWithZeroUpperBound=false'");
+                        if( print )
+                            Output
+                            ("WARNING: Fixing ",name," at zero due to zero "
+                             "upper bound. If this is not desired, please set "
+                             "'keepNonnegativeWithZeroUpperBound=false'");
                     }
                     else
                     {
                         // Do not enforce non-negativity.
                         data.upperBoundIndex = meta_.numUpperBounds++;
                         data.nonnegative = false;
-                        Output
-                        ("WARNING: Removing default non-negativity of ",
-                         entry.first," due to zero upper bound. If this is "
-                         "not desired, please set "
-                         "'keepNonnegativeWithZeroUpperBound=true'");
+                        if( print )
+                            Output
+                            ("WARNING: Removing default non-negativity of ",
+                             name," due to zero upper bound. If this is "
+                             "not desired, please set "
+                             "'keepNonnegativeWithZeroUpperBound=true'");
                     }
                 }
                 else
@@ -826,7 +859,7 @@ MPSReader::MPSReader
         // Handle non-positive values.
         if( data.nonpositive )
         {
-            if( data.upperBounded )
+            if( data.upperBounded && print )
                 Output
                 ("WARNING: Combined nonpositive constraint with upper bound");
             data.nonpositiveIndex = meta_.numNonpositiveBounds++;
@@ -839,417 +872,1006 @@ MPSReader::MPSReader
           data.fixed ||
           data.free ||
           data.nonpositive ||
-          data.nonnegative;
+          data.nonnegative ||
+          data.lowerUnbounded;
         if( !hasAMark )
             data.nonnegative = true;
 
         // Handle non-negative values.
         if( data.nonnegative )
         {
-            if( data.lowerBounded )
+            if( data.lowerBounded && print )
                 Output
                 ("WARNING: Combined nonnegative constraint with lower bound");
             data.nonnegativeIndex = meta_.numNonnegativeBounds++;
         }
     }
+    meta_.numEqualityEntries += meta_.numFixedBounds;
+    meta_.numInequalityEntries +=
+      meta_.numUpperBounds + meta_.numLowerBounds +
+      meta_.numNonpositiveBounds + meta_.numNonnegativeBounds;
+
+    // Extract the number of variables
+    // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
+    meta_.n = numVariables;
+
+    //
+    //   | A0 | x = | b0 |
+    //   | A1 |     | b1 |
+    //
+    meta_.equalityOffset = 0;
+    meta_.fixedOffset = meta_.numEqualityRows;
+    meta_.m = meta_.fixedOffset + meta_.numFixedBounds;
+
+    //
+    //   | G0 | x <= | h0 |
+    //   | G1 |      | h1 |
+    //   | G2 |      | h2 |
+    //   | G3 |      | h3 |
+    //   | G4 |      | h4 |
+    //   | G5 |      | h5 |
+    //   | G6 |      | h6 |
+    //
+    meta_.lesserOffset = 0;
+    meta_.greaterOffset = meta_.numLesserRows;
+    meta_.upperBoundOffset = meta_.greaterOffset + meta_.numGreaterRows;
+    meta_.lowerBoundOffset = meta_.upperBoundOffset + meta_.numUpperBounds;
+    meta_.nonpositiveOffset = meta_.lowerBoundOffset + meta_.numLowerBounds;
+    meta_.nonnegativeOffset =
+      meta_.nonpositiveOffset + meta_.numNonpositiveBounds;
+    meta_.rangeOffset = meta_.nonnegativeOffset + meta_.numNonnegativeBounds;
+    meta_.k = meta_.rangeOffset + meta_.numRangeRows;
+}
+
+void LPFileReader::QueueTriplet( const MPSTriplet& triplet )
+{
+    const auto& rowData = meta_.rows[triplet.row];
+    const Int column = triplet.column;
+    AffineLPEntry<double> entry;
+    if( triplet.row == meta_.costIndex )
+    {
+        // c(column) = value
+        entry.type = AFFINE_LP_COST_VECTOR;
+        entry.row = column;
+        entry.column = 0;
+        entry.value = meta_.minimize ? triplet.value : -triplet.value;
+        queuedEntries_.push_back( entry );
+        return;
+    }
+    if( rowData.typeIndex < 0 )
+    {
+        // This is an additional nonconstraining row.
+        return;
+    }
+
+    if( rowData.type == MPS_EQUALITY_ROW )
+    {
+        // A(row,column) = value
+        entry.type = AFFINE_LP_EQUALITY_MATRIX;
+        entry.row = meta_.equalityOffset + rowData.typeIndex;
+        entry.column = column;
+        entry.value = triplet.value;
+        queuedEntries_.push_back( entry );
+    }
+    else if( rowData.type == MPS_LESSER_ROW )
+    {
+        // G(row,column) = value
+        entry.type = AFFINE_LP_INEQUALITY_MATRIX;
+        entry.row = meta_.lesserOffset + rowData.typeIndex;
+        entry.column = column;
+        entry.value = triplet.value;
+        queuedEntries_.push_back( entry );
+        if( rowData.ranged )
+        {
+            // G(rangeRow,column) = -value
+            entry.row = meta_.rangeOffset + rowData.rangeIndex;
+            entry.value = -triplet.value;
+            queuedEntries_.push_back( entry );
+        }
+    }
+    else if( rowData.type == MPS_GREATER_ROW )
+    {
+        // G(row,column) = -value
+        entry.type = AFFINE_LP_INEQUALITY_MATRIX;
+        entry.row = meta_.greaterOffset + rowData.typeIndex;
+        entry.column = column;
+        entry.value = -triplet.value;
+        queuedEntries_.push_back( entry );
+        if( rowData.ranged )
+        {
+            // G(rangeRow,column) = value
+            entry.row = meta_.rangeOffset + rowData.rangeIndex;
+            entry.value = triplet.value;
+            queuedEntries_.push_back( entry );
+        }
+    }
+}
+
+void LPFileReader::QueueRowVectors( Int i )
+{
+    const auto& rowData = meta_.rows[i];
+    if( rowData.type == MPS_NONCONSTRAINING_ROW || rowData.typeIndex < 0 )
+        return;
+
+    AffineLPEntry<double> entry;
+    entry.column = 0;
+    if( rowData.type == MPS_EQUALITY_ROW )
+    {
+        // b(row) = rhs
+        entry.type = AFFINE_LP_EQUALITY_VECTOR;
+        entry.row = meta_.equalityOffset + rowData.typeIndex;
+        entry.value = rowData.rhs;
+        if( entry.value != 0. )
+            queuedEntries_.push_back( entry );
+        return;
+    }
+
+    entry.type = AFFINE_LP_INEQUALITY_VECTOR;
+    if( rowData.type == MPS_LESSER_ROW )
+    {
+        // h(row) = rhs
+        entry.row = meta_.lesserOffset + rowData.typeIndex;
+        entry.value = rowData.rhs;
+    }
+    else
+    {
+        // h(row) = -rhs
+        entry.row = meta_.greaterOffset + rowData.typeIndex;
+        entry.value = -rowData.rhs;
+    }
+    if( entry.value != 0. )
+        queuedEntries_.push_back( entry );
+
+    if( rowData.ranged )
+    {
+        // A lesser row additionally enforces a^T x >= rhs - |R| and a greater
+        // row a^T x <= rhs + |R|.
+        entry.row = meta_.rangeOffset + rowData.rangeIndex;
+        if( rowData.type == MPS_LESSER_ROW )
+            entry.value = -(rowData.rhs - Abs(rowData.range));
+        else
+            entry.value = rowData.rhs + Abs(rowData.range);
+        if( entry.value != 0. )
+            queuedEntries_.push_back( entry );
+    }
+}
+
+void LPFileReader::QueueBounds( Int column )
+{
+    const auto& data = meta_.variables[column];
+    AffineLPEntry<double> entry;
+
+    if( data.upperBounded )
+    {
+        const Int row = meta_.upperBoundOffset + data.upperBoundIndex;
+
+        // G(row,column) = 1
+        entry.type = AFFINE_LP_INEQUALITY_MATRIX;
+        entry.row = row;
+        entry.column = column;
+        entry.value = 1;
+        queuedEntries_.push_back( entry );
+
+        // h(row) = value
+        entry.type = AFFINE_LP_INEQUALITY_VECTOR;
+        entry.row = row;
+        entry.column = 0;
+        entry.value = data.upperBound;
+        queuedEntries_.push_back( entry );
+    }
+
+    if( data.lowerBounded )
+    {
+        const Int row = meta_.lowerBoundOffset + data.lowerBoundIndex;
+
+        // G(row,column) = -1
+        entry.type = AFFINE_LP_INEQUALITY_MATRIX;
+        entry.row = row;
+        entry.column = column;
+        entry.value = -1;
+        queuedEntries_.push_back( entry );
+
+        // h(row) = -value
+        entry.type = AFFINE_LP_INEQUALITY_VECTOR;
+        entry.row = row;
+        entry.column = 0;
+        entry.value = -data.lowerBound;
+        queuedEntries_.push_back( entry );
+    }
+
+    if( data.fixed )
+    {
+        const Int row = meta_.fixedOffset + data.fixedIndex;
+
+        // A(row,column) = 1
+        entry.type = AFFINE_LP_EQUALITY_MATRIX;
+        entry.row = row;
+        entry.column = column;
+        entry.value = 1;
+        queuedEntries_.push_back( entry );
+
+        // h(row) = value
+        entry.type = AFFINE_LP_EQUALITY_VECTOR;
+        entry.row = row;
+        entry.column = 0;
+        entry.value = data.fixedValue;
+        queuedEntries_.push_back( entry );
+    }
+
+    // Handle non-positive values.
+    if( data.nonpositive )
+    {
+        // G(row,column) = 1
+        const Int row = meta_.nonpositiveOffset + data.nonpositiveIndex;
+        entry.type = AFFINE_LP_INEQUALITY_MATRIX;
+        entry.row = row;
+        entry.column = column;
+        entry.value = 1;
+        queuedEntries_.push_back( entry );
+
+        // There is no need to explicitly set h(row) to zero.
+    }
+
+    // Handle non-negative values.
+    if( data.nonnegative )
+    {
+        // G(row,column) = -1
+        const Int row = meta_.nonnegativeOffset + data.nonnegativeIndex;
+        entry.type = AFFINE_LP_INEQUALITY_MATRIX;
+        entry.row = row;
+        entry.column = column;
+        entry.value = -1;
+        queuedEntries_.push_back( entry );
+
+        // There is no need to explicitly set h(row) to zero.
+    }
+}
+
+bool LPFileReader::QueuedEntry()
+{
+    EL_DEBUG_CSE
+    // Each process enqueues its own coefficients and then a cyclic share of
+    // the right-hand sides and bounds.
+    const Int numTriplets = triplets_.size();
+    while( queuedEntries_.size() == 0 && tripletCursor_ < numTriplets )
+        QueueTriplet( triplets_[tripletCursor_++] );
+
+    const Int numRows = meta_.rows.size();
+    while( queuedEntries_.size() == 0 && rowCursor_ < numRows )
+    {
+        QueueRowVectors( rowCursor_ );
+        rowCursor_ += commSize_;
+    }
+
+    while( queuedEntries_.size() == 0 && variableCursor_ < meta_.n )
+    {
+        QueueBounds( variableCursor_ );
+        variableCursor_ += commSize_;
+    }
+    return queuedEntries_.size() > 0;
+}
+
+AffineLPEntry<double> LPFileReader::GetEntry()
+{
+    EL_DEBUG_CSE
+    if( queuedEntries_.size() == 0 )
+        LogicError("No entries are currently enqueued");
+    AffineLPEntry<double> entry = queuedEntries_.back();
+    queuedEntries_.pop_back();
+    return entry;
+}
 
-    // Now that the initial pass over the file is done, we can set up for the
-    // 'QueuedEntry'/'GetEntry' cycle.
+const MPSMeta& LPFileReader::Meta() const
+{
+    EL_DEBUG_CSE
+    return meta_;
+}
+
+// The MPS reader begins by having each process scan its share of the file for
+// section headers (lines which begin in the first column). Every process then
+// parses the comparatively small NAME, OBJSENSE, ROWS, RHS, RANGES, and BOUNDS
+// sections, while the COLUMNS section, which holds essentially all of the
+// file, is split into line-aligned byte ranges over the processes and then
+// over the threads of each process.
+//
+class MPSReader : public LPFileReader
+{
+public:
+    MPSReader
+    ( const string& filename,
+      bool compressed=false,
+      bool minimize=true,
+      bool keepNonnegativeWithZeroUpperBound=true,
+      mpi::Comm comm=mpi::COMM_SELF );
+    // The PILOT netlib lp_data model appears to require
+    // 'keepNonnegativeWithZeroUpperBound=true'.
+    //
+    // An OBJSENSE section within the file takes precedence over 'minimize'.
 
-    // Reset the file.
-    file_.clear();
-    file_.seekg( 0, std::ios::beg );
+private:
+    void ParseObjectiveSense( const read_mps::Token& token );
+    void ParseRows( const char* begin, const char* end );
+    void ParseColumns
+    ( LPFileSource& source, std::streamoff begin, std::streamoff end );
+    void ParseRHS( const char* begin, const char* end );
+    void ParseRanges( const char* begin, const char* end );
+    void ParseBounds( const char* begin, const char* end );
+};
 
-    // Extract the number of variables
-    // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
-    meta_.n = meta_.variableDict.size();
-    variableIter_ = meta_.variableDict.cbegin();
+namespace read_mps {
 
-    //
-    //   | A0 | x = | b0 |
-    //   | A1 |     | b1 |
-    //
-    meta_.equalityOffset = 0;
-    meta_.fixedOffset = meta_.numEqualityRows;
-    meta_.m = meta_.fixedOffset + meta_.numFixedBounds;
+// The variables and coefficients found within a contiguous piece of the
+// COLUMNS section. The variables are indexed in their order of appearance
+// within the piece.
+struct ColumnChunk
+{
+  vector<string> variableNames;
+  vector<MPSTriplet> triplets;
+  Int numMarkers=0;
+  string error;
+};
 
-    //
-    //   | G0 | x <= | h0 |
-    //   | G1 |      | h1 |
-    //   | G2 |      | h2 |
-    //   | G3 |      | h3 |
-    //   | G4 |      | h4 |
-    //   | G5 |      | h5 |
-    //
-    meta_.lesserOffset = 0;
-    meta_.greaterOffset = meta_.numLesserRows;
-    meta_.upperBoundOffset = meta_.greaterOffset + meta_.numGreaterRows;
-    meta_.lowerBoundOffset = meta_.upperBoundOffset + meta_.numUpperBounds;
-    meta_.nonpositiveOffset = meta_.lowerBoundOffset + meta_.numLowerBounds;
-    meta_.nonnegativeOffset =
-      meta_.nonpositiveOffset + meta_.numNonpositiveBounds;
-    meta_.k = meta_.nonnegativeOffset + meta_.numNonnegativeBounds;
+inline void ParseColumnChunk
+( const char* begin,
+  const char* end,
+  const std::unordered_map<string,Int>& rowIndices,
+  ColumnChunk& chunk )
+{
+    // Since this routine is called from within a parallel loop, errors are
+    // recorded rather than thrown.
+    try
+    {
+        std::unordered_map<string,Int> variableIndices;
+        Int column = -1;
+        Token tokens[5];
+        ForEachLine( begin, end,
+          [&]( const char* lineBegin, const char* lineEnd )
+          {
+              const Int numTokens = Tokenize( lineBegin, lineEnd, tokens, 5 );
+              if( numTokens == 0 )
+                  return;
+              if( numTokens >= 2 && UpperCase(tokens[1]) == "'MARKER'" )
+              {
+                  // Integrality markers are ignored by the LP relaxation.
+                  ++chunk.numMarkers;
+                  return;
+              }
+              if( numTokens != 3 && numTokens != 5 )
+                  LogicError
+                  ("Invalid 'COLUMNS' line: ",string(lineBegin,lineEnd));
+
+              // The COLUMNS section is grouped by variable, so we only need to
+              // consult the dictionary when the variable changes.
+              if( column == -1 ||
+                  chunk.variableNames[column].compare
+                  ( 0, string::npos, tokens[0].begin,
+                    tokens[0].end-tokens[0].begin ) != 0 )
+              {
+                  const string name = TokenString( tokens[0] );
+                  auto result = variableIndices.insert
+                    ( std::make_pair(name,Int(chunk.variableNames.size())) );
+                  if( result.second )
+                      chunk.variableNames.push_back( name );
+                  column = result.first->second;
+              }
+
+              // There should be either one or two pairs of entries left to
+              // read from this line.
+              for( Int pair=0; 2*pair+2<numTokens; ++pair )
+              {
+                  const Token& rowToken = tokens[2*pair+1];
+                  const Token& valueToken = tokens[2*pair+2];
+                  MPSTriplet triplet;
+                  triplet.column = column;
+                  if( !ParseValue( valueToken, triplet.value ) )
+                      LogicError
+                      ("Invalid 'COLUMNS' value ",TokenString(valueToken));
+                  auto rowIter = rowIndices.find( TokenString(rowToken) );
+                  if( rowIter == rowIndices.end() )
+                      LogicError("Could not find row ",TokenString(rowToken));
+                  triplet.row = rowIter->second;
+                  chunk.triplets.push_back( triplet );
+              }
+          });
+    }
+    catch( std::exception& e )
+    {
+        chunk.error = e.what();
+    }
 }
 
-bool MPSReader::QueuedEntry()
+} // namespace read_mps
+
+MPSReader::MPSReader
+( const string& filename,
+  bool compressed,
+  bool minimize,
+  bool keepNonnegativeWithZeroUpperBound,
+  mpi::Comm comm )
+: LPFileReader( minimize, keepNonnegativeWithZeroUpperBound, comm )
 {
     EL_DEBUG_CSE
+    LPFileSource source( filename, compressed );
+    const std::streamoff fileSize = source.Size();
 
-    while( queuedEntries_.size() == 0 &&
-           section_ != MPS_END &&
-           std::getline( file_, line_ ) )
+    // Locate the section headers (comments begin with an asterisk).
+    vector<std::streamoff> headers;
     {
-        std::stringstream sectionStream( line_ );
-        const char firstChar = sectionStream.peek();
-        const bool isDataLine =
-          firstChar == ' ' ||
-          firstChar == '\t' ||
-          firstChar == '*' ||
-          firstChar == '#';
-
-        // The first token on each line should be a string. We will check it for
-        // equivalence with each section string.
-        if( !(sectionStream >> token_) )
+        vector<char> buffer;
+        std::streamoff offset = 0;
+        string error;
+        try
         {
-            // This line only consists of whitespace.
-            continue;
+            offset =
+              read_mps::ReadLineRange
+              ( source, 0, fileSize, commRank_, commSize_, buffer );
+        }
+        catch( std::exception& e ) { error = e.what(); }
+        while( error.size() > 0 && error.back() == '\n' )
+            error.pop_back();
+        read_mps::AgreeOnError( error, comm_ );
+        vector<std::streamoff> localHeaders;
+        const char* bufferBegin = buffer.data();
+        const char* bufferEnd = buffer.data() + (buffer.size()-1);
+        const char* p = bufferBegin;
+        while( p < bufferEnd )
+        {
+            const char firstChar = *p;
+            if( firstChar != ' ' && firstChar != '\t' && firstChar != '\r' &&
+                firstChar != '\n' && firstChar != '*' )
+                localHeaders.push_back( offset + (p-bufferBegin) );
+            const char* lineEnd = std::find( p, bufferEnd, '\n' );
+            p = ( lineEnd == bufferEnd ? bufferEnd : lineEnd+1 );
         }
 
-        if( !isDataLine )
+        const int numLocalHeaders = localHeaders.size();
+        vector<int> headerSizes(commSize_), headerOffsets(commSize_);
+        mpi::AllGather
+        ( &numLocalHeaders, 1, headerSizes.data(), 1, comm_ );
+        int numHeaders = 0;
+        for( int q=0; q<commSize_; ++q )
         {
-            if( token_ == "NAME" )
-            {
-                section_ = MPS_NAME;
-            }
-            else if( token_ == "OBJSENSE" )
-            {
-                LogicError("OBJSENSE is not yet handled");
-            }
-            else if( token_ == "ROWS" )
-            {
-                section_ = MPS_ROWS;
-            }
-            else if( token_ == "COLUMNS" )
-            {
-                section_ = MPS_COLUMNS;
-            }
-            else if( token_ == "RHS" )
-            {
-                section_ = MPS_RHS;
-            }
-            else if( token_ == "BOUNDS" )
+            headerOffsets[q] = numHeaders;
+            numHeaders += headerSizes[q];
+        }
+        headers.resize( numHeaders );
+        mpi::AllGather
+        ( localHeaders.data(), numLocalHeaders,
+          headers.data(), headerSizes.data(), headerOffsets.data(), comm_ );
+    }
+
+    // Every process walks through the sections in the same order so that the
+    // collective parse of the COLUMNS section is matched. The remaining
+    // sections are read and parsed redundantly by every process, so their
+    // errors are raised consistently.
+    bool foundObjectiveSense = false;
+    string line;
+    vector<char> buffer;
+    read_mps::Token tokens[3];
+    const Int numHeaders = headers.size();
+    for( Int header=0; header<numHeaders; ++header )
+    {
+        const std::streamoff sectionEnd =
+          ( header+1 < numHeaders ? headers[header+1] : fileSize );
+        const std::streamoff dataBegin =
+          read_mps::ReadLine( source, headers[header], sectionEnd, line );
+        const char* lineBegin = line.c_str();
+        const Int numTokens =
+          read_mps::Tokenize
+          ( lineBegin, lineBegin+line.size(), tokens, 3 );
+        const string token = read_mps::UpperCase( tokens[0] );
+
+        if( token == "NAME" )
+        {
+            if( meta_.name != "" )
+                LogicError("Multiple 'NAME' sections");
+            if( numTokens >= 2 )
+                meta_.name =
+                  string( tokens[1].begin, lineBegin+line.size() );
+            while( meta_.name.size() > 0 &&
+                   std::isspace(meta_.name.back()) )
+                meta_.name.pop_back();
+        }
+        else if( token == "OBJSENSE" )
+        {
+            if( foundObjectiveSense )
+                LogicError("Multiple 'OBJSENSE' sections");
+            foundObjectiveSense = true;
+            if( numTokens >= 2 )
             {
-                section_ = MPS_BOUNDS;
+                // The free MPS format allows the sense on the same line.
+                ParseObjectiveSense( tokens[1] );
             }
-            else if( token_ == "RANGES" )
+            else
             {
-                section_ = MPS_RANGES;
+                read_mps::ReadSection( source, dataBegin, sectionEnd, buffer );
+                bool found = false;
+                read_mps::ForEachLine
+                ( buffer.data(), buffer.data()+(buffer.size()-1),
+                  [&]( const char* dataLineBegin, const char* dataLineEnd )
+                  {
+                      read_mps::Token senseToken;
+                      if( read_mps::Tokenize
+                          ( dataLineBegin, dataLineEnd, &senseToken, 1 ) == 0 )
+                          return;
+                      if( found )
+                          LogicError("Invalid 'OBJSENSE' section");
+                      ParseObjectiveSense( senseToken );
+                      found = true;
+                  });
+                if( !found )
+                    LogicError("Empty 'OBJSENSE' section");
             }
-            else if( token_ == "ENDATA" )
+        }
+        else if( token == "OBJNAME" )
+        {
+            if( numTokens >= 2 )
             {
-                section_ = MPS_END;
-                break;
+                meta_.costName = read_mps::TokenString( tokens[1] );
             }
             else
             {
-                LogicError("Section token ",token_," is not recognized");
+                read_mps::ReadSection( source, dataBegin, sectionEnd, buffer );
+                read_mps::ForEachLine
+                ( buffer.data(), buffer.data()+(buffer.size()-1),
+                  [&]( const char* dataLineBegin, const char* dataLineEnd )
+                  {
+                      read_mps::Token nameToken;
+                      if( read_mps::Tokenize
+                          ( dataLineBegin, dataLineEnd, &nameToken, 1 ) > 0 )
+                          meta_.costName = read_mps::TokenString( nameToken );
+                  });
             }
-            continue;
         }
-
-        // No section marker was found, so handle this data line.
-        if( section_ == MPS_ROWS )
+        else if( token == "ROWS" )
         {
-            // We already have the row names.
+            if( meta_.rows.size() > 0 )
+                LogicError("Multiple ROWS sections");
+            read_mps::ReadSection( source, dataBegin, sectionEnd, buffer );
+            ParseRows( buffer.data(), buffer.data()+(buffer.size()-1) );
         }
-        else if( section_ == MPS_COLUMNS )
+        else if( token == "COLUMNS" )
         {
-           double columnValue;
-           std::stringstream columnStream( line_ );
-
-           if( !(columnStream >> variableName_) )
-                LogicError("Invalid 'COLUMNS' section");
-            auto variableIter = meta_.variableDict.find( variableName_ );
-            if( variableIter == meta_.variableDict.end() )
-                LogicError("Could not find variable ",variableName_);
-            const MPSVariableData& variableData = variableIter->second;
-            const Int column = variableData.index;
-
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
-            {
-                if( !(columnStream >> rowName_) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'COLUMNS' section");
-                    else
-                        break;
-                }
-                if( !(columnStream >> columnValue) )
-                    LogicError("Invalid 'COLUMNS' section");
-                auto rowIter = meta_.rowDict.find( rowName_ );
-                if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName_);
-                const auto& rowData = rowIter->second;
-                AffineLPEntry<double> entry;
-                if( rowData.type == MPS_EQUALITY_ROW )
-                {
-                    // A(row,column) = columnValue
-                    const Int row = meta_.equalityOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_EQUALITY_MATRIX;
-                    entry.row = row;
-                    entry.column = column;
-                    entry.value = columnValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_LESSER_ROW )
-                {
-                    // G(row,column) = columnValue
-                    const Int row = meta_.lesserOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-                    entry.row = row;
-                    entry.column = column;
-                    entry.value = columnValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_GREATER_ROW )
-                {
-                    // G(row,column) = -columnValue
-                    const Int row = meta_.greaterOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-                    entry.row = row;
-                    entry.column = column;
-                    entry.value = -columnValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_NONCONSTRAINING_ROW )
-                {
-                    if( rowData.typeIndex == 0 )
-                    {
-                        // c(column) = columnValue
-                        entry.type = AFFINE_LP_COST_VECTOR;
-                        entry.row = column;
-                        entry.column = 0;
-                        entry.value = minimize_ ? columnValue : -columnValue;
-                        queuedEntries_.push_back( entry );
-                    }
-                    // else?
-                }
-            }
+            if( meta_.variables.size() > 0 )
+                LogicError("Multiple 'COLUMNS' sections");
+            ParseColumns( source, dataBegin, sectionEnd );
         }
-        else if( section_ == MPS_RHS )
+        else if( token == "RHS" )
         {
-            double rhsValue;
-            std::stringstream rhsStream( line_ );
-
-            if( rhsHasName_ )
-            {
-                if( !(rhsStream >> token_) )
-                    LogicError("Invalid 'RHS' section");
-            }
-
-            // There should be either one or two pairs of entries left to read
-            // from this line.
-            for( Int pair=0; pair<2; ++pair )
-            {
-                if( !(rhsStream >> rowName_) )
-                {
-                    if( pair == 0 )
-                        LogicError("Invalid 'RHS' section");
-                    else
-                        break;
-                }
-                if( !(rhsStream >> rhsValue) )
-                    LogicError("Invalid 'RHS' section");
-                auto rowIter = meta_.rowDict.find( rowName_ );
-                if( rowIter == meta_.rowDict.end() )
-                    LogicError("Could not find row ",rowName_);
-                const auto& rowData = rowIter->second;
-                AffineLPEntry<double> entry;
-                if( rowData.type == MPS_EQUALITY_ROW )
-                {
-                    // b(row) = rhsValue
-                    const Int row = meta_.equalityOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_EQUALITY_VECTOR;
-                    entry.row = row;
-                    entry.column = 0;
-                    entry.value = rhsValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_LESSER_ROW )
-                {
-                    // h(row) = rhsValue
-                    const Int row = meta_.lesserOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-                    entry.row = row;
-                    entry.column = 0;
-                    entry.value = rhsValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_GREATER_ROW )
-                {
-                    // h(row) = -rhsValue
-                    const Int row = meta_.greaterOffset + rowData.typeIndex;
-                    entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-                    entry.row = row;
-                    entry.column = 0;
-                    entry.value = -rhsValue;
-                    queuedEntries_.push_back( entry );
-                }
-                else if( rowData.type == MPS_NONCONSTRAINING_ROW )
-                {
-                    Output("WARNING: Nonsensical RHS for nonconstrained row");
-                }
-            }
+            read_mps::ReadSection( source, dataBegin, sectionEnd, buffer );
+            ParseRHS( buffer.data(), buffer.data()+(buffer.size()-1) );
+        }
+        else if( token == "RANGES" )
+        {
+            read_mps::ReadSection( source, dataBegin, sectionEnd, buffer );
+            ParseRanges( buffer.data(), buffer.data()+(buffer.size()-1) );
+        }
+        else if( token == "BOUNDS" )
+        {
+            if( (meta_.numUpperBounds > 0 ||
+                 meta_.numLowerBounds > 0 ||
+                 meta_.numFixedBounds > 0 ||
+                 meta_.numFreeBounds > 0 ||
+                 meta_.numNonpositiveBounds > 0 ||
+                 meta_.numNonnegativeBounds > 0) && commRank_ == 0 )
+                Output("WARNING: Multiple 'BOUNDS' sections");
+            read_mps::ReadSection( source, dataBegin, sectionEnd, buffer );
+            ParseBounds( buffer.data(), buffer.data()+(buffer.size()-1) );
         }
-        else if( section_ == MPS_BOUNDS )
+        else if( token == "ENDATA" )
         {
-            // All bounds are handled at the bottom of this routine.
+            break;
         }
-        else if( section_ == MPS_RANGES )
+        else if( token == "SOS" )
         {
-            LogicError("The 'RANGES' section is not yet supported");
+            LogicError("MPS 'SOS' section is not yet supported");
         }
         else
         {
-            LogicError("Invalid MPS file");
+            LogicError("Section token ",token," is not recognized");
         }
     }
-    if( queuedEntries_.size() > 0 )
-        return true;
-
-    // Now iterate through the variable map to handle the bounds.
-    AffineLPEntry<double> entry;
-    while( queuedEntries_.size() == 0 &&
-           variableIter_ != meta_.variableDict.end() )
+    if( meta_.numRHS == 0 )
     {
-        const auto& data = variableIter_->second;
-        const Int column = data.index;
+        // Any unmentioned values are assumed to be zero.
+        meta_.numRHS = 1;
+    }
 
-        if( data.upperBounded )
-        {
-            const Int row = meta_.upperBoundOffset + data.upperBoundIndex;
+    Finalize();
+}
 
-            // G(row,column) = 1
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = 1;
-            queuedEntries_.push_back( entry );
+void MPSReader::ParseObjectiveSense( const read_mps::Token& token )
+{
+    EL_DEBUG_CSE
+    const string sense = read_mps::UpperCase( token );
+    if( sense == "MIN" || sense == "MINIMIZE" )
+        meta_.minimize = true;
+    else if( sense == "MAX" || sense == "MAXIMIZE" )
+        meta_.minimize = false;
+    else
+        LogicError("Invalid objective sense ",sense);
+}
 
-            // h(row) = value
-            entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-            entry.row = row;
-            entry.column = 0;
-            entry.value = data.upperBound;
-            queuedEntries_.push_back( entry );
-        }
+void MPSReader::ParseRows( const char* begin, const char* end )
+{
+    EL_DEBUG_CSE
+    read_mps::Token tokens[2];
+    read_mps::ForEachLine( begin, end,
+      [&]( const char* lineBegin, const char* lineEnd )
+      {
+          const Int numTokens =
+            read_mps::Tokenize( lineBegin, lineEnd, tokens, 2 );
+          if( numTokens == 0 )
+              return;
+          if( numTokens != 2 )
+              LogicError("Invalid 'ROWS' section");
+          const string rowType = read_mps::UpperCase( tokens[0] );
+          const string rowName = read_mps::TokenString( tokens[1] );
+          if( rowType == "L" )
+              AddRow( rowName, MPS_LESSER_ROW );
+          else if( rowType == "G" )
+              AddRow( rowName, MPS_GREATER_ROW );
+          else if( rowType == "E" )
+              AddRow( rowName, MPS_EQUALITY_ROW );
+          else if( rowType == "N" )
+              AddRow( rowName, MPS_NONCONSTRAINING_ROW );
+          else
+              LogicError("Invalid 'ROWS' section");
+      });
+}
 
-        if( data.lowerBounded )
+void MPSReader::ParseColumns
+( LPFileSource& source, std::streamoff begin, std::streamoff end )
+{
+    EL_DEBUG_CSE
+    vector<char> buffer;
+    string readError;
+    try
+    {
+        read_mps::ReadLineRange
+        ( source, begin, end, commRank_, commSize_, buffer );
+    }
+    catch( std::exception& e )
+    {
+        readError = e.what();
+        buffer.assign( 1, '\0' );
+    }
+    const char* bufferBegin = buffer.data();
+    const char* bufferEnd = buffer.data() + (buffer.size()-1);
+
+    // Split this process's lines into a line-aligned chunk per thread.
+    Int numChunks = 1;
+#ifdef EL_HYBRID
+    numChunks = omp_get_max_threads();
+#endif
+    const Int numBytes = bufferEnd - bufferBegin;
+    vector<const char*> chunkBegins( numChunks+1 );
+    chunkBegins[0] = bufferBegin;
+    for( Int chunk=1; chunk<numChunks; ++chunk )
+    {
+        const char* p = std::max
+          ( bufferBegin+(numBytes*chunk)/numChunks, chunkBegins[chunk-1] );
+        if( p > bufferBegin && p < bufferEnd && *(p-1) != '\n' )
         {
-            const Int row = meta_.lowerBoundOffset + data.lowerBoundIndex;
-
-            // G(row,column) = -1
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = -1;
-            queuedEntries_.push_back( entry );
-
-            // h(row) = -value
-            entry.type = AFFINE_LP_INEQUALITY_VECTOR;
-            entry.row = row;
-            entry.column = 0;
-            entry.value = -data.lowerBound;
-            queuedEntries_.push_back( entry );
+            p = std::find( p, bufferEnd, '\n' );
+            if( p != bufferEnd )
+                ++p;
         }
-
-        if( data.fixed )
+        chunkBegins[chunk] = p;
+    }
+    chunkBegins[numChunks] = bufferEnd;
+
+    vector<read_mps::ColumnChunk> chunks( numChunks );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        read_mps::ParseColumnChunk
+        ( chunkBegins[chunk], chunkBegins[chunk+1],
+          meta_.rowIndices, chunks[chunk] );
+
+    // Every process must learn of a failure on any other before the
+    // collectives below.
+    string error = readError;
+    for( const auto& chunk : chunks )
+        if( error == "" )
+            error = chunk.error;
+    while( error.size() > 0 && error.back() == '\n' )
+        error.pop_back();
+    read_mps::AgreeOnError( error, comm_ );
+
+    // Merge the chunks into this process's variables and coefficients.
+    Int numLocalMarkers = 0;
+    Int numLocalTriplets = 0;
+    for( const auto& chunk : chunks )
+    {
+        numLocalMarkers += chunk.numMarkers;
+        numLocalTriplets += chunk.triplets.size();
+    }
+    vector<string> localNames;
+    std::unordered_map<string,Int> localIndices;
+    triplets_.reserve( numLocalTriplets );
+    for( auto& chunk : chunks )
+    {
+        const Int numChunkVariables = chunk.variableNames.size();
+        vector<Int> chunkToLocal( numChunkVariables );
+        for( Int j=0; j<numChunkVariables; ++j )
         {
-            const Int row = meta_.fixedOffset + data.fixedIndex;
-
-            // A(row,column) = 1
-            entry.type = AFFINE_LP_EQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = 1;
-            queuedEntries_.push_back( entry );
-
-            // h(row) = value
-            entry.type = AFFINE_LP_EQUALITY_VECTOR;
-            entry.row = row;
-            entry.column = 0;
-            entry.value = data.fixedValue;
-            queuedEntries_.push_back( entry );
+            auto result = localIndices.insert
+              ( std::make_pair(chunk.variableNames[j],Int(localNames.size())) );
+            if( result.second )
+                localNames.push_back( chunk.variableNames[j] );
+            chunkToLocal[j] = result.first->second;
         }
-
-        // Handle non-positive values.
-        if( data.nonpositive )
+        for( auto triplet : chunk.triplets )
         {
-            // G(row,column) = 1
-            const Int row = meta_.nonpositiveOffset + data.nonpositiveIndex;
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = 1;
-            queuedEntries_.push_back( entry );
-
-            // There is no need to explicitly set h(row) to zero.
+            triplet.column = chunkToLocal[triplet.column];
+            triplets_.push_back( triplet );
         }
+        SwapClear( chunk.triplets );
+    }
 
-        // Handle non-negative values.
-        if( data.nonnegative )
-        {
-            // G(row,column) = -1
-            const Int row = meta_.nonnegativeOffset + data.nonnegativeIndex;
-            entry.type = AFFINE_LP_INEQUALITY_MATRIX;
-            entry.row = row;
-            entry.column = column;
-            entry.value = -1;
-            queuedEntries_.push_back( entry );
-
-            // There is no need to explicitly set h(row) to zero.
-        }
+    // Gather the variable names in process order so that every process
+    // interns the variables in their order of appearance within the file.
+    vector<byte> packedNames;
+    for( const auto& name : localNames )
+    {
+        packedNames.insert( packedNames.end(), name.begin(), name.end() );
+        packedNames.push_back( '\0' );
+    }
+    const int numPackedBytes = packedNames.size();
+    vector<int> packedSizes(commSize_), packedOffsets(commSize_);
+    mpi::AllGather( &numPackedBytes, 1, packedSizes.data(), 1, comm_ );
+    int numTotalBytes = 0;
+    for( int q=0; q<commSize_; ++q )
+    {
+        packedOffsets[q] = numTotalBytes;
+        numTotalBytes += packedSizes[q];
+    }
+    vector<byte> allPackedNames( numTotalBytes );
+    mpi::AllGather
+    ( packedNames.data(), numPackedBytes,
+      allPackedNames.data(), packedSizes.data(), packedOffsets.data(), comm_ );
+    const char* namePtr =
+      reinterpret_cast<const char*>(allPackedNames.data());
+    const char* namesEnd = namePtr + numTotalBytes;
+    while( namePtr < namesEnd )
+    {
+        const string name( namePtr );
+        AddVariable( name );
+        namePtr += name.size() + 1;
+    }
 
-        ++variableIter_;
+    const Int numLocalVariables = localNames.size();
+    vector<Int> localToGlobal( numLocalVariables );
+    for( Int j=0; j<numLocalVariables; ++j )
+        localToGlobal[j] = meta_.variableIndices[localNames[j]];
+    const Int numRows = meta_.rows.size();
+    vector<Int> rowCounts( numRows, 0 );
+    for( auto& triplet : triplets_ )
+    {
+        triplet.column = localToGlobal[triplet.column];
+        ++rowCounts[triplet.row];
     }
-    return queuedEntries_.size() > 0;
+    mpi::AllReduce( rowCounts.data(), numRows, mpi::SUM, comm_ );
+    for( Int i=0; i<numRows; ++i )
+        meta_.rows[i].numNonzeros = rowCounts[i];
+
+    const Int numMarkers = mpi::AllReduce( numLocalMarkers, mpi::SUM, comm_ );
+    if( numMarkers > 0 && commRank_ == 0 )
+        Output("WARNING: Ignoring ",numMarkers," integrality markers");
 }
 
-AffineLPEntry<double> MPSReader::GetEntry()
+void MPSReader::ParseRHS( const char* begin, const char* end )
 {
     EL_DEBUG_CSE
-    if( queuedEntries_.size() == 0 )
-        LogicError("No entries are currently enqueued");
-    AffineLPEntry<double> entry = queuedEntries_.back();
-    queuedEntries_.pop_back();
-    return entry;
+    read_mps::Token tokens[5];
+    read_mps::ForEachLine( begin, end,
+      [&]( const char* lineBegin, const char* lineEnd )
+      {
+          const Int numTokens =
+            read_mps::Tokenize( lineBegin, lineEnd, tokens, 5 );
+          if( numTokens == 0 )
+              return;
+
+          // There are either one or two pairs, optionally preceded by the
+          // name of the right-hand side (some models, e.g., dfl001.mps, do
+          // not involve a name).
+          if( numTokens < 2 || numTokens > 5 )
+              LogicError("Invalid 'RHS' line: ",string(lineBegin,lineEnd));
+          const bool hasName = numTokens % 2 == 1;
+          if( hasName )
+          {
+              const string rhsName = read_mps::TokenString( tokens[0] );
+              if( meta_.numRHS == 0 )
+              {
+                  meta_.rhsName = rhsName;
+                  meta_.numRHS = 1;
+              }
+              else if( rhsName != meta_.rhsName )
+                  LogicError
+                  ("Only single problem instances are currently supported "
+                   "(multiple right-hand side names were encountered)");
+          }
+          else
+              meta_.numRHS = 1;
+
+          for( Int token=(hasName ? 1 : 0); token<numTokens; token+=2 )
+          {
+              const string rowName = read_mps::TokenString( tokens[token] );
+              double value;
+              if( !read_mps::ParseValue( tokens[token+1], value ) )
+                  LogicError("Invalid 'RHS' section");
+              auto rowIter = meta_.rowIndices.find( rowName );
+              if( rowIter == meta_.rowIndices.end() )
+                  LogicError("Could not find row ",rowName);
+              auto& rowData = meta_.rows[rowIter->second];
+              if( rowData.type == MPS_NONCONSTRAINING_ROW )
+              {
+                  if( commRank_ == 0 )
+                      Output("WARNING: Nonsensical RHS for nonconstrained row");
+                  continue;
+              }
+              rowData.rhs = value;
+          }
+      });
 }
 
-const MPSMeta& MPSReader::Meta() const
+void MPSReader::ParseRanges( const char* begin, const char* end )
 {
     EL_DEBUG_CSE
-    return meta_;
+    read_mps::Token tokens[5];
+    read_mps::ForEachLine( begin, end,
+      [&]( const char* lineBegin, const char* lineEnd )
+      {
+          const Int numTokens =
+            read_mps::Tokenize( lineBegin, lineEnd, tokens, 5 );
+          if( numTokens == 0 )
+              return;
+          if( numTokens < 2 || numTokens > 5 )
+              LogicError("Invalid 'RANGES' line: ",string(lineBegin,lineEnd));
+          const bool hasName = numTokens % 2 == 1;
+          if( hasName )
+          {
+              const string rangesName = read_mps::TokenString( tokens[0] );
+              if( meta_.numRanges == 0 )
+              {
+                  meta_.rangesName = rangesName;
+                  meta_.numRanges = 1;
+              }
+              else if( rangesName != meta_.rangesName )
+                  LogicError
+                  ("Only single problem instances are currently supported "
+                   "(multiple range names were encountered)");
+          }
+          else
+              meta_.numRanges = 1;
+
+          for( Int token=(hasName ? 1 : 0); token<numTokens; token+=2 )
+          {
+              const string rowName = read_mps::TokenString( tokens[token] );
+              double value;
+              if( !read_mps::ParseValue( tokens[token+1], value ) )
+                  LogicError("Invalid 'RANGES' section");
+              auto rowIter = meta_.rowIndices.find( rowName );
+              if( rowIter == meta_.rowIndices.end() )
+                  LogicError("Could not find row ",rowName);
+              auto& rowData = meta_.rows[rowIter->second];
+              rowData.ranged = true;
+              rowData.range = value;
+          }
+      });
+}
+
+void MPSReader::ParseBounds( const char* begin, const char* end )
+{
+    EL_DEBUG_CSE
+    read_mps::Token tokens[4];
+    read_mps::ForEachLine( begin, end,
+      [&]( const char* lineBegin, const char* lineEnd )
+      {
+          // Each line should be of the same general form as
+          //
+          //   FX BOUNDROW VARIABLENAME 1734.
+          //
+          // in the case of 'VARIABLENAME' being fixed ('FX') at the value
+          // 1734 (with this problem's bound name being 'BOUNDROW'). But some
+          // models (e.g., dfl001.mps) do not involve a bound set name.
+          const Int numTokens =
+            read_mps::Tokenize( lineBegin, lineEnd, tokens, 4 );
+          if( numTokens == 0 )
+              return;
+          const string boundMark = read_mps::UpperCase( tokens[0] );
+          bool hasValue=false;
+          if( boundMark == "LO" || boundMark == "UP" || boundMark == "FX" )
+              hasValue = true;
+          else if( boundMark == "FR" || boundMark == "MI" ||
+                   boundMark == "PL" )
+              hasValue = false;
+          else
+              LogicError("Unknown bound mark ",boundMark);
+
+          const Int numUnnamedTokens = ( hasValue ? 3 : 2 );
+          bool hasName=false;
+          if( numTokens == numUnnamedTokens+1 )
+              hasName = true;
+          else if( numTokens == numUnnamedTokens )
+              hasName = false;
+          else
+              LogicError("Invalid ",boundMark," 'BOUNDS' line");
+
+          if( hasName )
+          {
+              const string boundName = read_mps::TokenString( tokens[1] );
+              if( meta_.boundName == "" )
+                  meta_.boundName = boundName;
+              else if( meta_.boundName != boundName )
+                  LogicError
+                  ("Only single problem instances are currently supported "
+                   "(multiple bound names were encountered)");
+          }
+          const string variableName =
+            read_mps::TokenString( tokens[hasName ? 2 : 1] );
+          auto variableIter = meta_.variableIndices.find( variableName );
+          if( variableIter == meta_.variableIndices.end() )
+              LogicError
+              ("Invalid 'BOUNDS' section (name ",variableName," not found)");
+          MPSVariableData& data = meta_.variables[variableIter->second];
+          double value=0;
+          if( hasValue &&
+              !read_mps::ParseValue( tokens[numTokens-1], value ) )
+              LogicError("Invalid 'BOUNDS' section");
+
+          if( boundMark == "UP" )
+          {
+              data.upperBounded = true;
+              data.upperBound = value;
+          }
+          else if( boundMark == "LO" )
+          {
+              data.lowerBounded = true;
+              data.lowerBound = value;
+          }
+          else if( boundMark == "FX" )
+          {
+              data.fixed = true;
+              data.fixedValue = value;
+          }
+          else if( boundMark == "FR" )
+              data.free = true;
+          else if( boundMark == "MI" )
+              data.nonpositive = true;
+          else /* boundMark == "PL" */
+              data.nonnegative = true;
+      });
 }
 
 namespace read_mps {
 
+template<typename Real>
+mpi::Comm ReaderComm( const AffineLPProblem<Matrix<Real>,Matrix<Real>>& )
+{ return mpi::COMM_SELF; }
+
+template<typename Real>
+mpi::Comm ReaderComm
+( const AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem )
+{ return problem.A.Grid().Comm(); }
+
+template<typename Real>
+mpi::Comm ReaderComm
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& )
+{ return mpi::COMM_SELF; }
+
+template<typename Real>
+mpi::Comm ReaderComm
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem )
+{ return problem.A.Grid().Comm(); }
+
 template<typename Real>
 void Helper
-( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
+( LPFileReader& reader,
+  AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
   bool metadataSummary )
 {
     EL_DEBUG_CSE
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
-
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
     const MPSMeta& meta = reader.Meta();
     if( metadataSummary )
         meta.PrintSummary();
@@ -1304,23 +1926,11 @@ void Helper
 
 template<typename Real>
 void Helper
-( AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
+( LPFileReader& reader,
+  AffineLPProblem<DistMatrix<Real>,DistMatrix<Real>>& problem,
   bool metadataSummary )
 {
     EL_DEBUG_CSE
-
-    // TODO(poulson): Consider loading on a single process and then distributing
-    // the results instead.
-
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
-
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
     const MPSMeta& meta = reader.Meta();
     if( metadataSummary && problem.A.Grid().Rank() == 0 )
         meta.PrintSummary();
@@ -1331,37 +1941,36 @@ void Helper
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
 
+    // Each process only holds its share of the entries, which are sent to
+    // their owners.
     while( reader.QueuedEntry() )
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
-            problem.c.Set( entry.row, 0, entry.value );
+            problem.c.QueueUpdate( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
-            problem.A.Set( entry.row, entry.column, entry.value );
+            problem.A.QueueUpdate( entry.row, entry.column, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-            problem.b.Set( entry.row, 0, entry.value );
+            problem.b.QueueUpdate( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
-            problem.G.Set( entry.row, entry.column, entry.value );
+            problem.G.QueueUpdate( entry.row, entry.column, entry.value );
         else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-            problem.h.Set( entry.row, 0, entry.value );
+            problem.h.QueueUpdate( entry.row, 0, entry.value );
     }
+    problem.c.ProcessQueues();
+    problem.A.ProcessQueues();
+    problem.b.ProcessQueues();
+    problem.G.ProcessQueues();
+    problem.h.ProcessQueues();
 }
 
 template<typename Real>
 void Helper
-( AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
+( LPFileReader& reader,
+  AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
   bool metadataSummary )
 {
     EL_DEBUG_CSE
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
-
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
     const MPSMeta& meta = reader.Meta();
     if( metadataSummary )
         meta.PrintSummary();
@@ -1394,21 +2003,14 @@ void Helper
 
 template<typename Real>
 void Helper
-( AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
-  const string& filename,
-  bool compressed,
-  bool minimize,
-  bool keepNonnegativeWithZeroUpperBound,
+( LPFileReader& reader,
+  AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
   bool metadataSummary )
 {
     EL_DEBUG_CSE
-    if( compressed )
-        LogicError("Compressed MPS is not yet supported");
-
-    MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
     const MPSMeta& meta = reader.Meta();
-    if( metadataSummary && problem.A.Grid().Rank() == 0 )
+    const Grid& grid = problem.A.Grid();
+    if( metadataSummary && grid.Rank() == 0 )
         meta.PrintSummary();
 
     Zeros( problem.c, meta.n, 1 );
@@ -1417,27 +2019,36 @@ void Helper
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
 
-    bool passive=true;
-    problem.A.Reserve( meta.numEqualityEntries );
-    problem.G.Reserve( meta.numInequalityEntries );
+    // Each process enqueues roughly an equal share of the entries, and all
+    // but roughly a fraction of 1/p of them are owned by other processes.
+    const Int commSize = grid.Size();
+    const Int numEqualityEntries = meta.numEqualityEntries / commSize + 1;
+    const Int numInequalityEntries = meta.numInequalityEntries / commSize + 1;
+    problem.A.Reserve
+    ( numEqualityEntries/commSize,
+      numEqualityEntries-numEqualityEntries/commSize );
+    problem.G.Reserve
+    ( numInequalityEntries/commSize,
+      numInequalityEntries-numInequalityEntries/commSize );
     while( reader.QueuedEntry() )
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
-            problem.c.Set( entry.row, 0, entry.value );
+            problem.c.QueueUpdate( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
-            problem.A.QueueUpdate
-            ( entry.row, entry.column, entry.value, passive );
+            problem.A.QueueUpdate( entry.row, entry.column, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-            problem.b.Set( entry.row, 0, entry.value );
+            problem.b.QueueUpdate( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
-            problem.G.QueueUpdate
-            ( entry.row, entry.column, entry.value, passive );
+            problem.G.QueueUpdate( entry.row, entry.column, entry.value );
         else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-            problem.h.Set( entry.row, 0, entry.value );
+            problem.h.QueueUpdate( entry.row, 0, entry.value );
     }
-    problem.A.ProcessLocalQueues();
-    problem.G.ProcessLocalQueues();
+    problem.c.ProcessQueues();
+    problem.A.ProcessQueues();
+    problem.b.ProcessQueues();
+    problem.G.ProcessQueues();
+    problem.h.ProcessQueues();
 }
 
 } // namespace read_mps
@@ -1452,9 +2063,10 @@ void ReadMPS
   bool metadataSummary )
 {
     EL_DEBUG_CSE
-    read_mps::Helper
-    ( problem, filename, compressed,
-      minimize, keepNonnegativeWithZeroUpperBound, metadataSummary );
+    MPSReader reader
+      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+        read_mps::ReaderComm(problem) );
+    read_mps::Helper( reader, problem, metadataSummary );
 }
 
 namespace write_mps {
@@ -1565,14 +2177,72 @@ void CompressMPS
 ( const string& filename, const string& compressedFilename )
 {
     EL_DEBUG_CSE
-    LogicError("This routine is not yet written");
+#ifdef EL_HAVE_ZLIB
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    gzFile compressedFile = gzopen( compressedFilename.c_str(), "wb" );
+    if( compressedFile == NULL )
+        RuntimeError("Could not open ",compressedFilename);
+    vector<char> buffer( 1u << 20 );
+    while( file )
+    {
+        file.read( buffer.data(), buffer.size() );
+        const int numRead = file.gcount();
+        if( numRead > 0 &&
+            gzwrite( compressedFile, buffer.data(), numRead ) != numRead )
+        {
+            gzclose( compressedFile );
+            RuntimeError("Could not write to ",compressedFilename);
+        }
+    }
+    if( gzclose( compressedFile ) != Z_OK )
+        RuntimeError("Could not finish writing ",compressedFilename);
+#else
+    RuntimeError("Compressing MPS files requires Elemental to be configured "
+                 "with zlib");
+#endif
 }
 
 void DecompressMPS
 ( const string& filename, const string& decompressedFilename )
 {
     EL_DEBUG_CSE
-    LogicError("This routine is not yet written");
+#ifdef EL_HAVE_ZLIB
+    gzFile compressedFile = gzopen( filename.c_str(), "rb" );
+    if( compressedFile == NULL )
+        RuntimeError("Could not open ",filename);
+    std::ofstream file( decompressedFilename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+    {
+        gzclose( compressedFile );
+        RuntimeError("Could not open ",decompressedFilename);
+    }
+    const unsigned chunkSize = 1u << 20;
+    vector<char> buffer( chunkSize );
+    while( true )
+    {
+        const int numRead =
+          gzread( compressedFile, buffer.data(), chunkSize );
+        if( numRead < 0 )
+        {
+            gzclose( compressedFile );
+            RuntimeError("Could not decompress ",filename);
+        }
+        if( numRead == 0 )
+            break;
+        file.write( buffer.data(), numRead );
+        if( !file )
+        {
+            gzclose( compressedFile );
+            RuntimeError("Could not write to ",decompressedFilename);
+        }
+    }
+    gzclose( compressedFile );
+#else
+    RuntimeError("Decompressing MPS files requires Elemental to be configured "
+                 "with zlib");
+#endif
 }
 
 } // namespace El
@@ -0,0 +1,1292 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace lp {
+
+// The presolve works with LPs of the general form
+//
+//   min c^T x,
+//   s.t. A x = b, G x <= h, l <= x <= u,
+//
+// where the rows of A and G are stored within a single index space (the
+// equalities come first) and both the rows and columns are deleted lazily.
+// Each reduction is pushed onto a stack so that the postsolve can traverse
+// the reductions in reverse order.
+//
+// The postsolve maintains the duals, y, of the (equality and inequality) rows
+// as well as the multipliers, d, of the current bounds of each column, where
+//
+//   d = c + A^T y + G^T z
+//
+// is positive when a lower bound is active and negative when an upper bound
+// is active. In the "direct" form, d is the dual variable z, whereas in the
+// "affine" form all bounds originated from singleton rows of G and so the
+// multipliers are eventually transferred back onto said rows.
+//
+// The reductions are applied redundantly to a sequential copy of the problem
+// (the distributed interfaces gather the problem onto each process); they
+// are described in, for example, E.D. Andersen and K.D. Andersen, "Presolving
+// in linear programming", Mathematical Programming, 71 (1995), pp. 221--245.
+
+enum PresolveReductionType {
+  PRESOLVE_REMOVED_ROW,
+  PRESOLVE_FIXED_COLUMN,
+  PRESOLVE_SINGLETON_ROW,
+  PRESOLVE_BOUND_ROW,
+  PRESOLVE_FORCING_ROW,
+  PRESOLVE_FREE_COLUMN,
+  PRESOLVE_DOUBLETON
+};
+
+template<typename Real>
+struct PresolveReduction
+{
+    PresolveReductionType type;
+    Int row=-1, col=-1, otherCol=-1;
+    Real coef=Real(0), otherCoef=Real(0), rhs=Real(0), value=Real(0);
+    bool flag=false, otherFlag=false;
+
+    // A copy of the active entries of a row or column at the time of the
+    // reduction
+    vector<pair<Int,Real>> entries;
+};
+
+template<typename Real>
+class Presolver
+{
+public:
+    Presolver
+    ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+      const PresolveCtrl<Real>& ctrl );
+    Presolver
+    ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+      const PresolveCtrl<Real>& ctrl );
+
+    void Reduce( DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& reduced );
+    void Reduce( AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reduced );
+
+    void Postsolve
+    ( const DirectLPSolution<Matrix<Real>>& reducedSolution,
+            DirectLPSolution<Matrix<Real>>& solution ) const;
+    void Postsolve
+    ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+      const AffineLPSolution<Matrix<Real>>& reducedSolution,
+            AffineLPSolution<Matrix<Real>>& solution ) const;
+
+private:
+    PresolveCtrl<Real> ctrl_;
+    bool affine_;
+    const Real inf_=limits::Infinity<Real>();
+
+    Int numCols_, numEqs_, numRows_;
+    vector<vector<pair<Int,Real>>> rowEntries_, colEntries_;
+    vector<Real> rhs_, cost_, lower_, upper_;
+    vector<bool> activeRow_, activeCol_;
+    vector<PresolveReduction<Real>> stack_;
+    Int numChanges_=0;
+
+    // The map from the rows and columns of the reduced problem back to the
+    // original problem, as well as the rows of the reduced G which hold the
+    // (affine-form) bounds of each column
+    vector<Int> reducedRows_, reducedCols_;
+    vector<Int> lowerBoundRow_, upperBoundRow_;
+
+    void Initialize
+    ( const SparseMatrix<Real>& A, const Matrix<Real>& b,
+      const SparseMatrix<Real>* G, const Matrix<Real>* h,
+      const Matrix<Real>& c );
+
+    bool Finite( const Real& alpha ) const
+    { return alpha > -inf_ && alpha < inf_; }
+    bool Close( const Real& alpha, const Real& beta ) const
+    {
+        const Real scale = Max( Real(1), Max(Abs(alpha),Abs(beta)) );
+        return Abs(alpha-beta) <= ctrl_.tol*scale;
+    }
+    Real Slack( const Real& alpha ) const
+    { return ctrl_.tol*Max(Real(1),Abs(alpha)); }
+
+    vector<pair<Int,Real>> ActiveRow( Int i, Int skipCol=-1 ) const;
+    vector<pair<Int,Real>> ActiveCol( Int j, Int skipRow=-1 ) const;
+    void AddToEntry( Int i, Int j, const Real& delta );
+    void Activity
+    ( Int i, Int skipCol, Real& minActivity, Real& maxActivity ) const;
+    void Infeasible( Int i ) const;
+
+    void RemoveRow( Int i );
+    void FixColumn( Int j, const Real& value );
+
+    void SingletonRow( Int i, Int j, const Real& alpha );
+    void ForcingRow( Int i, bool atMinimum );
+    bool DoubletonRow( Int i );
+    bool FreeColumnSingleton( Int j );
+    void EmptyColumn( Int j );
+
+    void SweepRows();
+    void SweepColumns();
+    void RemoveDuplicateRows();
+    void DropImpliedBounds();
+    void Run();
+
+    void PostsolveStack( vector<Real>& x, vector<Real>& y, vector<Real>& d )
+    const;
+};
+
+template<typename Real>
+Presolver<Real>::Presolver
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const PresolveCtrl<Real>& ctrl )
+: ctrl_(ctrl), affine_(false)
+{
+    EL_DEBUG_CSE
+    Initialize( problem.A, problem.b, nullptr, nullptr, problem.c );
+    for( Int j=0; j<numCols_; ++j )
+        lower_[j] = Real(0);
+}
+
+template<typename Real>
+Presolver<Real>::Presolver
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const PresolveCtrl<Real>& ctrl )
+: ctrl_(ctrl), affine_(true)
+{
+    EL_DEBUG_CSE
+    Initialize( problem.A, problem.b, &problem.G, &problem.h, problem.c );
+}
+
+template<typename Real>
+void Presolver<Real>::Initialize
+( const SparseMatrix<Real>& A, const Matrix<Real>& b,
+  const SparseMatrix<Real>* G, const Matrix<Real>* h,
+  const Matrix<Real>& c )
+{
+    EL_DEBUG_CSE
+    numCols_ = A.Width();
+    numEqs_ = A.Height();
+    numRows_ = numEqs_ + ( G == nullptr ? 0 : G->Height() );
+
+    rowEntries_.resize( numRows_ );
+    colEntries_.resize( numCols_ );
+    rhs_.resize( numRows_ );
+    activeRow_.resize( numRows_, true );
+    activeCol_.resize( numCols_, true );
+    cost_.resize( numCols_ );
+    lower_.resize( numCols_, -inf_ );
+    upper_.resize( numCols_, inf_ );
+
+    auto addEntries = [&]( const SparseMatrix<Real>& B, Int rowOffset )
+    {
+        for( Int e=0; e<B.NumEntries(); ++e )
+        {
+            const Int i = B.Row(e) + rowOffset;
+            const Int j = B.Col(e);
+            const Real value = B.Value(e);
+            if( value == Real(0) )
+                continue;
+            rowEntries_[i].push_back( pair<Int,Real>(j,value) );
+            colEntries_[j].push_back( pair<Int,Real>(i,value) );
+        }
+    };
+    addEntries( A, 0 );
+    for( Int i=0; i<numEqs_; ++i )
+        rhs_[i] = b(i);
+    if( G != nullptr )
+    {
+        addEntries( *G, numEqs_ );
+        for( Int i=numEqs_; i<numRows_; ++i )
+            rhs_[i] = (*h)(i-numEqs_);
+    }
+    for( Int j=0; j<numCols_; ++j )
+        cost_[j] = c(j);
+}
+
+template<typename Real>
+vector<pair<Int,Real>> Presolver<Real>::ActiveRow( Int i, Int skipCol ) const
+{
+    vector<pair<Int,Real>> entries;
+    for( const auto& entry : rowEntries_[i] )
+        if( activeCol_[entry.first] && entry.first != skipCol &&
+            entry.second != Real(0) )
+            entries.push_back( entry );
+    return entries;
+}
+
+template<typename Real>
+vector<pair<Int,Real>> Presolver<Real>::ActiveCol( Int j, Int skipRow ) const
+{
+    vector<pair<Int,Real>> entries;
+    for( const auto& entry : colEntries_[j] )
+        if( activeRow_[entry.first] && entry.first != skipRow &&
+            entry.second != Real(0) )
+            entries.push_back( entry );
+    return entries;
+}
+
+template<typename Real>
+void Presolver<Real>::AddToEntry( Int i, Int j, const Real& delta )
+{
+    auto update = [&]( vector<pair<Int,Real>>& entries, Int index )
+    {
+        for( auto& entry : entries )
+        {
+            if( entry.first == index )
+            {
+                entry.second += delta;
+                // Treat cancellations as exact zeros
+                if( Abs(entry.second) <= ctrl_.tol*Abs(delta) )
+                    entry.second = Real(0);
+                return;
+            }
+        }
+        entries.push_back( pair<Int,Real>(index,delta) );
+    };
+    update( rowEntries_[i], j );
+    update( colEntries_[j], i );
+}
+
+// Compute the range of 'sum_{j != skipCol} a_j x_j' over the current bounds
+template<typename Real>
+void Presolver<Real>::Activity
+( Int i, Int skipCol, Real& minActivity, Real& maxActivity ) const
+{
+    bool minFinite=true, maxFinite=true;
+    minActivity = maxActivity = Real(0);
+    for( const auto& entry : rowEntries_[i] )
+    {
+        const Int j = entry.first;
+        const Real& alpha = entry.second;
+        if( !activeCol_[j] || j == skipCol || alpha == Real(0) )
+            continue;
+        const Real& minBound = ( alpha > Real(0) ? lower_[j] : upper_[j] );
+        const Real& maxBound = ( alpha > Real(0) ? upper_[j] : lower_[j] );
+        if( Finite(minBound) )
+            minActivity += alpha*minBound;
+        else
+            minFinite = false;
+        if( Finite(maxBound) )
+            maxActivity += alpha*maxBound;
+        else
+            maxFinite = false;
+    }
+    if( !minFinite )
+        minActivity = -inf_;
+    if( !maxFinite )
+        maxActivity = inf_;
+}
+
+template<typename Real>
+void Presolver<Real>::Infeasible( Int i ) const
+{ RuntimeError("Presolve detected that row ",i," is infeasible"); }
+
+template<typename Real>
+void Presolver<Real>::RemoveRow( Int i )
+{
+    PresolveReduction<Real> reduction;
+    reduction.type = PRESOLVE_REMOVED_ROW;
+    reduction.row = i;
+    stack_.push_back( reduction );
+    activeRow_[i] = false;
+    ++numChanges_;
+}
+
+template<typename Real>
+void Presolver<Real>::FixColumn( Int j, const Real& value )
+{
+    PresolveReduction<Real> reduction;
+    reduction.type = PRESOLVE_FIXED_COLUMN;
+    reduction.col = j;
+    reduction.value = value;
+    reduction.coef = cost_[j];
+    reduction.entries = ActiveCol( j );
+    for( const auto& entry : reduction.entries )
+        rhs_[entry.first] -= entry.second*value;
+    stack_.push_back( reduction );
+    activeCol_[j] = false;
+    ++numChanges_;
+}
+
+template<typename Real>
+void Presolver<Real>::SingletonRow( Int i, Int j, const Real& alpha )
+{
+    PresolveReduction<Real> reduction;
+    reduction.row = i;
+    reduction.col = j;
+    reduction.coef = alpha;
+    const Real bound = rhs_[i] / alpha;
+    if( i < numEqs_ )
+    {
+        if( bound < lower_[j]-Slack(lower_[j]) ||
+            bound > upper_[j]+Slack(upper_[j]) )
+            Infeasible( i );
+        reduction.type = PRESOLVE_SINGLETON_ROW;
+        stack_.push_back( reduction );
+        activeRow_[i] = false;
+        FixColumn( j, Min(Max(bound,lower_[j]),upper_[j]) );
+        return;
+    }
+
+    // Convert 'alpha x_j <= h_i' into a bound on x_j
+    reduction.type = PRESOLVE_BOUND_ROW;
+    if( alpha > Real(0) && bound < upper_[j] )
+    {
+        upper_[j] = bound;
+        reduction.flag = true;
+    }
+    else if( alpha < Real(0) && bound > lower_[j] )
+    {
+        lower_[j] = bound;
+        reduction.flag = true;
+    }
+    if( lower_[j] > upper_[j]+Slack(upper_[j]) )
+        Infeasible( i );
+    stack_.push_back( reduction );
+    activeRow_[i] = false;
+    ++numChanges_;
+}
+
+// Fix each variable in row i to the bound which achieves its minimum (or
+// maximum) activity
+template<typename Real>
+void Presolver<Real>::ForcingRow( Int i, bool atMinimum )
+{
+    PresolveReduction<Real> reduction;
+    reduction.type = PRESOLVE_FORCING_ROW;
+    reduction.row = i;
+    reduction.flag = atMinimum;
+    reduction.entries = ActiveRow( i );
+    stack_.push_back( reduction );
+    activeRow_[i] = false;
+    for( const auto& entry : reduction.entries )
+    {
+        const Int j = entry.first;
+        const bool useLower = ( (entry.second > Real(0)) == atMinimum );
+        FixColumn( j, useLower ? lower_[j] : upper_[j] );
+    }
+}
+
+// Eliminate x_k from the equation 'a_j x_j + a_k x_k = b' via
+// x_k = t - r x_j, where t = b / a_k and r = a_j / a_k, and transfer the
+// bounds of x_k onto x_j
+template<typename Real>
+bool Presolver<Real>::DoubletonRow( Int i )
+{
+    auto entries = ActiveRow( i );
+    if( Abs(entries[0].second) > Abs(entries[1].second) )
+        std::swap( entries[0], entries[1] );
+    const Int j = entries[0].first;
+    const Int k = entries[1].first;
+    const Real alphaJ = entries[0].second;
+    const Real alphaK = entries[1].second;
+    const Real t = rhs_[i] / alphaK;
+    const Real r = alphaJ / alphaK;
+
+    // The direct form cannot represent upper bounds
+    if( !affine_ && r > Real(0) )
+        return false;
+
+    Real impliedLower, impliedUpper;
+    const Real& kLower = ( r > Real(0) ? upper_[k] : lower_[k] );
+    const Real& kUpper = ( r > Real(0) ? lower_[k] : upper_[k] );
+    impliedLower = ( Finite(kLower) ? (t-kLower)/r : -inf_ );
+    impliedUpper = ( Finite(kUpper) ? (t-kUpper)/r : inf_ );
+
+    PresolveReduction<Real> reduction;
+    reduction.type = PRESOLVE_DOUBLETON;
+    reduction.row = i;
+    reduction.col = k;
+    reduction.otherCol = j;
+    reduction.coef = alphaK;
+    reduction.otherCoef = alphaJ;
+    reduction.rhs = rhs_[i];
+    reduction.value = cost_[k];
+    reduction.flag = ( impliedLower > lower_[j] );
+    reduction.otherFlag = ( impliedUpper < upper_[j] );
+    reduction.entries = ActiveCol( k, i );
+    stack_.push_back( reduction );
+
+    for( const auto& entry : reduction.entries )
+    {
+        rhs_[entry.first] -= entry.second*t;
+        AddToEntry( entry.first, j, -entry.second*r );
+    }
+    cost_[j] -= cost_[k]*r;
+    lower_[j] = Max( lower_[j], impliedLower );
+    upper_[j] = Min( upper_[j], impliedUpper );
+    if( lower_[j] > upper_[j]+Slack(upper_[j]) )
+        Infeasible( i );
+    activeRow_[i] = false;
+    activeCol_[k] = false;
+    ++numChanges_;
+    return true;
+}
+
+// Substitute out a column singleton in an equality row if its bounds are
+// implied by the remainder of the row
+template<typename Real>
+bool Presolver<Real>::FreeColumnSingleton( Int j )
+{
+    const auto colEntries = ActiveCol( j );
+    const Int i = colEntries[0].first;
+    const Real alpha = colEntries[0].second;
+    if( i >= numEqs_ )
+        return false;
+
+    const auto entries = ActiveRow( i, j );
+    Real maxAbs = Abs(alpha);
+    for( const auto& entry : entries )
+        maxAbs = Max( maxAbs, Abs(entry.second) );
+    if( Abs(alpha) < ctrl_.tol*maxAbs )
+        return false;
+
+    Real minRest, maxRest;
+    Activity( i, j, minRest, maxRest );
+    const Real& restLower = ( alpha > Real(0) ? maxRest : minRest );
+    const Real& restUpper = ( alpha > Real(0) ? minRest : maxRest );
+    const bool lowerImplied = !Finite(lower_[j]) ||
+      ( Finite(restLower) && (rhs_[i]-restLower)/alpha >= lower_[j] );
+    const bool upperImplied = !Finite(upper_[j]) ||
+      ( Finite(restUpper) && (rhs_[i]-restUpper)/alpha <= upper_[j] );
+    if( !lowerImplied || !upperImplied )
+        return false;
+
+    PresolveReduction<Real> reduction;
+    reduction.type = PRESOLVE_FREE_COLUMN;
+    reduction.row = i;
+    reduction.col = j;
+    reduction.coef = alpha;
+    reduction.rhs = rhs_[i];
+    reduction.value = cost_[j];
+    reduction.entries = entries;
+    stack_.push_back( reduction );
+
+    for( const auto& entry : entries )
+        cost_[entry.first] -= cost_[j]*entry.second/alpha;
+    activeRow_[i] = false;
+    activeCol_[j] = false;
+    ++numChanges_;
+    return true;
+}
+
+// Set a variable which appears in no constraints to its optimal bound
+template<typename Real>
+void Presolver<Real>::EmptyColumn( Int j )
+{
+    const Real& gamma = cost_[j];
+    Real value;
+    if( gamma > Real(0) && Finite(lower_[j]) )
+        value = lower_[j];
+    else if( gamma < Real(0) && Finite(upper_[j]) )
+        value = upper_[j];
+    else if( Abs(gamma) <= ctrl_.tol )
+    {
+        if( Finite(lower_[j]) )
+            value = lower_[j];
+        else if( Finite(upper_[j]) )
+            value = upper_[j];
+        else
+            value = Real(0);
+    }
+    else
+        RuntimeError("Presolve detected that column ",j," is unbounded");
+    FixColumn( j, value );
+}
+
+template<typename Real>
+void Presolver<Real>::SweepRows()
+{
+    EL_DEBUG_CSE
+    for( Int i=0; i<numRows_; ++i )
+    {
+        if( !activeRow_[i] )
+            continue;
+        const bool equality = ( i < numEqs_ );
+        const Real beta = rhs_[i];
+        const auto entries = ActiveRow( i );
+        const Int numEntries = entries.size();
+        if( numEntries == 0 )
+        {
+            if( (equality && Abs(beta) > Slack(Real(0))) ||
+                (!equality && beta < -Slack(Real(0))) )
+                Infeasible( i );
+            RemoveRow( i );
+            continue;
+        }
+        if( numEntries == 1 )
+        {
+            SingletonRow( i, entries[0].first, entries[0].second );
+            continue;
+        }
+
+        Real minActivity, maxActivity;
+        Activity( i, -1, minActivity, maxActivity );
+        if( minActivity > beta+Slack(beta) ||
+            (equality && maxActivity < beta-Slack(beta)) )
+            Infeasible( i );
+        if( Finite(minActivity) && Close(minActivity,beta) )
+            ForcingRow( i, true );
+        else if( equality && Finite(maxActivity) && Close(maxActivity,beta) )
+            ForcingRow( i, false );
+        else if( !equality && maxActivity <= beta )
+            RemoveRow( i );
+        else if( equality && numEntries == 2 )
+            DoubletonRow( i );
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::SweepColumns()
+{
+    EL_DEBUG_CSE
+    for( Int j=0; j<numCols_; ++j )
+    {
+        if( !activeCol_[j] )
+            continue;
+        if( Finite(lower_[j]) && Finite(upper_[j]) &&
+            Close(lower_[j],upper_[j]) )
+        {
+            FixColumn( j, lower_[j] );
+            continue;
+        }
+        const Int numEntries = ActiveCol( j ).size();
+        if( numEntries == 0 )
+            EmptyColumn( j );
+        else if( numEntries == 1 )
+            FreeColumnSingleton( j );
+    }
+}
+
+// Remove rows which are multiples of others and are either redundant or
+// looser than their counterparts
+template<typename Real>
+void Presolver<Real>::RemoveDuplicateRows()
+{
+    EL_DEBUG_CSE
+    std::map<vector<Int>,vector<Int>> patterns;
+    vector<vector<pair<Int,Real>>> sortedRows( numRows_ );
+    for( Int i=0; i<numRows_; ++i )
+    {
+        if( !activeRow_[i] )
+            continue;
+        sortedRows[i] = ActiveRow( i );
+        if( sortedRows[i].size() < 2 )
+            continue;
+        std::sort( sortedRows[i].begin(), sortedRows[i].end() );
+        vector<Int> pattern;
+        for( const auto& entry : sortedRows[i] )
+            pattern.push_back( entry.first );
+        patterns[pattern].push_back( i );
+    }
+
+    for( const auto& pattern : patterns )
+    {
+        const vector<Int>& rows = pattern.second;
+        const Int numPatternRows = rows.size();
+        for( Int s=0; s<numPatternRows; ++s )
+        {
+            const Int i = rows[s];
+            for( Int t=s+1; t<numPatternRows; ++t )
+            {
+                const Int p = rows[t];
+                if( !activeRow_[i] )
+                    break;
+                if( !activeRow_[p] )
+                    continue;
+
+                // Check if row p is lambda times row i
+                const auto& rowI = sortedRows[i];
+                const auto& rowP = sortedRows[p];
+                const Real lambda = rowP[0].second / rowI[0].second;
+                bool parallel = true;
+                for( Int e=1; e<Int(rowI.size()); ++e )
+                    if( !Close(rowP[e].second,lambda*rowI[e].second) )
+                    {
+                        parallel = false;
+                        break;
+                    }
+                if( !parallel )
+                    continue;
+
+                const bool equalityI = ( i < numEqs_ );
+                const bool equalityP = ( p < numEqs_ );
+                const Real scaledRHS = lambda*rhs_[i];
+                if( equalityI && equalityP )
+                {
+                    if( !Close(rhs_[p],scaledRHS) )
+                        Infeasible( p );
+                    RemoveRow( p );
+                }
+                else if( equalityI )
+                {
+                    if( scaledRHS > rhs_[p]+Slack(rhs_[p]) )
+                        Infeasible( p );
+                    RemoveRow( p );
+                }
+                else if( equalityP )
+                {
+                    if( rhs_[p] / lambda > rhs_[i]+Slack(rhs_[i]) )
+                        Infeasible( i );
+                    RemoveRow( i );
+                }
+                else if( lambda > Real(0) )
+                {
+                    // Keep the tighter of the two inequalities
+                    if( rhs_[p] / lambda < rhs_[i] )
+                        RemoveRow( i );
+                    else
+                        RemoveRow( p );
+                }
+                else if( rhs_[p] / lambda > rhs_[i]+Slack(rhs_[i]) )
+                    Infeasible( p );
+            }
+        }
+    }
+}
+
+// Drop the bounds of each column which are implied by one of its rows. The
+// dropped bounds are immediately set to infinity so that no bound is ever
+// used to justify the bound which justified it.
+template<typename Real>
+void Presolver<Real>::DropImpliedBounds()
+{
+    EL_DEBUG_CSE
+    for( Int j=0; j<numCols_; ++j )
+    {
+        if( !activeCol_[j] )
+            continue;
+        for( const auto& entry : ActiveCol( j ) )
+        {
+            if( !Finite(lower_[j]) && !Finite(upper_[j]) )
+                break;
+            const Int i = entry.first;
+            const Real& alpha = entry.second;
+            Real minRest, maxRest;
+            Activity( i, j, minRest, maxRest );
+
+            // Each row implies 'alpha x_j <= rhs - minRest', while equality
+            // rows also imply 'alpha x_j >= rhs - maxRest'
+            Real impliedLower=-inf_, impliedUpper=inf_;
+            if( Finite(minRest) )
+            {
+                const Real bound = (rhs_[i]-minRest) / alpha;
+                if( alpha > Real(0) )
+                    impliedUpper = bound;
+                else
+                    impliedLower = bound;
+            }
+            if( i < numEqs_ && Finite(maxRest) )
+            {
+                const Real bound = (rhs_[i]-maxRest) / alpha;
+                if( alpha > Real(0) )
+                    impliedLower = Max( impliedLower, bound );
+                else
+                    impliedUpper = Min( impliedUpper, bound );
+            }
+            if( Finite(lower_[j]) && impliedLower >= lower_[j] )
+            {
+                lower_[j] = -inf_;
+                ++numChanges_;
+            }
+            if( Finite(upper_[j]) && impliedUpper <= upper_[j] )
+            {
+                upper_[j] = inf_;
+                ++numChanges_;
+            }
+        }
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::Run()
+{
+    EL_DEBUG_CSE
+    for( Int pass=0; pass<ctrl_.maxPasses; ++pass )
+    {
+        const Int numChangesBefore = numChanges_;
+        SweepRows();
+        SweepColumns();
+        RemoveDuplicateRows();
+        if( numChanges_ == numChangesBefore )
+            break;
+    }
+    // The implied bounds are only dropped after all of the other reductions
+    // since the remaining bounds would otherwise be weakened
+    if( affine_ )
+        DropImpliedBounds();
+
+    reducedRows_.clear();
+    reducedCols_.clear();
+    for( Int i=0; i<numRows_; ++i )
+        if( activeRow_[i] )
+            reducedRows_.push_back( i );
+    for( Int j=0; j<numCols_; ++j )
+        if( activeCol_[j] )
+            reducedCols_.push_back( j );
+}
+
+template<typename Real>
+void Presolver<Real>::Reduce
+( DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& reduced )
+{
+    EL_DEBUG_CSE
+    if( affine_ )
+        LogicError("Presolver was constructed from an affine LP");
+    Run();
+    const Int numReducedRows = reducedRows_.size();
+    const Int numReducedCols = reducedCols_.size();
+    vector<Int> colMap( numCols_, -1 );
+    for( Int jRed=0; jRed<numReducedCols; ++jRed )
+        colMap[reducedCols_[jRed]] = jRed;
+
+    // Shift each variable by its (possibly tightened) lower bound
+    Zeros( reduced.c, numReducedCols, 1 );
+    Zeros( reduced.b, numReducedRows, 1 );
+    Zeros( reduced.A, numReducedRows, numReducedCols );
+    for( Int jRed=0; jRed<numReducedCols; ++jRed )
+    {
+        const Int j = reducedCols_[jRed];
+        if( !Finite(lower_[j]) || Finite(upper_[j]) )
+            LogicError("Direct-form presolve produced an invalid bound");
+        reduced.c(jRed) = cost_[j];
+    }
+    Int numEntries = 0;
+    for( Int iRed=0; iRed<numReducedRows; ++iRed )
+        numEntries += rowEntries_[reducedRows_[iRed]].size();
+    reduced.A.Reserve( numEntries );
+    for( Int iRed=0; iRed<numReducedRows; ++iRed )
+    {
+        const Int i = reducedRows_[iRed];
+        Real beta = rhs_[i];
+        for( const auto& entry : ActiveRow( i ) )
+        {
+            beta -= entry.second*lower_[entry.first];
+            reduced.A.QueueUpdate( iRed, colMap[entry.first], entry.second );
+        }
+        reduced.b(iRed) = beta;
+    }
+    reduced.A.ProcessQueues();
+
+    if( ctrl_.print )
+        Output
+        ("Presolve reduced the ",numEqs_," x ",numCols_," LP to ",
+         numReducedRows," x ",numReducedCols," with ",reduced.A.NumEntries(),
+         " nonzeros");
+}
+
+template<typename Real>
+void Presolver<Real>::Reduce
+( AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reduced )
+{
+    EL_DEBUG_CSE
+    if( !affine_ )
+        LogicError("Presolver was constructed from a direct LP");
+    Run();
+    const Int numReducedCols = reducedCols_.size();
+    vector<Int> colMap( numCols_, -1 );
+    for( Int jRed=0; jRed<numReducedCols; ++jRed )
+        colMap[reducedCols_[jRed]] = jRed;
+
+    Int numReducedEqs=0;
+    for( const Int i : reducedRows_ )
+        if( i < numEqs_ )
+            ++numReducedEqs;
+    const Int numReducedIneqs = reducedRows_.size() - numReducedEqs;
+
+    // The finite bounds are appended to G as singleton rows
+    lowerBoundRow_.assign( numCols_, -1 );
+    upperBoundRow_.assign( numCols_, -1 );
+    Int numReducedGRows = numReducedIneqs;
+    for( const Int j : reducedCols_ )
+    {
+        if( Finite(lower_[j]) )
+            lowerBoundRow_[j] = numReducedGRows++;
+        if( Finite(upper_[j]) )
+            upperBoundRow_[j] = numReducedGRows++;
+    }
+
+    Zeros( reduced.c, numReducedCols, 1 );
+    Zeros( reduced.A, numReducedEqs, numReducedCols );
+    Zeros( reduced.b, numReducedEqs, 1 );
+    Zeros( reduced.G, numReducedGRows, numReducedCols );
+    Zeros( reduced.h, numReducedGRows, 1 );
+    for( Int jRed=0; jRed<numReducedCols; ++jRed )
+        reduced.c(jRed) = cost_[reducedCols_[jRed]];
+    for( Int iRed=0; iRed<Int(reducedRows_.size()); ++iRed )
+    {
+        const Int i = reducedRows_[iRed];
+        const auto entries = ActiveRow( i );
+        if( i < numEqs_ )
+        {
+            reduced.b(iRed) = rhs_[i];
+            for( const auto& entry : entries )
+                reduced.A.QueueUpdate
+                ( iRed, colMap[entry.first], entry.second );
+        }
+        else
+        {
+            const Int iG = iRed - numReducedEqs;
+            reduced.h(iG) = rhs_[i];
+            for( const auto& entry : entries )
+                reduced.G.QueueUpdate
+                ( iG, colMap[entry.first], entry.second );
+        }
+    }
+    for( const Int j : reducedCols_ )
+    {
+        if( lowerBoundRow_[j] >= 0 )
+        {
+            reduced.G.QueueUpdate( lowerBoundRow_[j], colMap[j], Real(-1) );
+            reduced.h(lowerBoundRow_[j]) = -lower_[j];
+        }
+        if( upperBoundRow_[j] >= 0 )
+        {
+            reduced.G.QueueUpdate( upperBoundRow_[j], colMap[j], Real(1) );
+            reduced.h(upperBoundRow_[j]) = upper_[j];
+        }
+    }
+    reduced.A.ProcessQueues();
+    reduced.G.ProcessQueues();
+
+    if( ctrl_.print )
+        Output
+        ("Presolve reduced the LP with ",numEqs_," equalities, ",
+         numRows_-numEqs_," inequalities, and ",numCols_," variables to ",
+         numReducedEqs," equalities, ",numReducedGRows," inequalities, and ",
+         numReducedCols," variables");
+}
+
+template<typename Real>
+void Presolver<Real>::PostsolveStack
+( vector<Real>& x, vector<Real>& y, vector<Real>& d ) const
+{
+    EL_DEBUG_CSE
+    auto dualResidual = [&]( const Real& gamma,
+                             const vector<pair<Int,Real>>& entries )
+    {
+        Real residual = gamma;
+        for( const auto& entry : entries )
+            residual += entry.second*y[entry.first];
+        return residual;
+    };
+
+    for( auto it=stack_.rbegin(); it!=stack_.rend(); ++it )
+    {
+        const PresolveReduction<Real>& reduction = *it;
+        const Int i = reduction.row;
+        const Int j = reduction.col;
+        switch( reduction.type )
+        {
+        case PRESOLVE_REMOVED_ROW:
+            y[i] = Real(0);
+            break;
+        case PRESOLVE_FIXED_COLUMN:
+            x[j] = reduction.value;
+            d[j] = dualResidual( reduction.coef, reduction.entries );
+            break;
+        case PRESOLVE_SINGLETON_ROW:
+            y[i] = -d[j] / reduction.coef;
+            d[j] = Real(0);
+            break;
+        case PRESOLVE_BOUND_ROW:
+        {
+            // Transfer the multiplier of the bound this row introduced
+            y[i] = Real(0);
+            if( reduction.flag )
+            {
+                const Real& alpha = reduction.coef;
+                y[i] = Max( Real(0), -d[j]/alpha );
+                d[j] += alpha*y[i];
+            }
+            break;
+        }
+        case PRESOLVE_FORCING_ROW:
+        {
+            const bool atMinimum = reduction.flag;
+            bool initialized = false;
+            Real eta = Real(0);
+            for( const auto& entry : reduction.entries )
+            {
+                const Real ratio = -d[entry.first] / entry.second;
+                if( !initialized )
+                    eta = ratio;
+                else
+                    eta = ( atMinimum ? Max(eta,ratio) : Min(eta,ratio) );
+                initialized = true;
+            }
+            if( i >= numEqs_ )
+                eta = Max( eta, Real(0) );
+            y[i] = eta;
+            for( const auto& entry : reduction.entries )
+                d[entry.first] += entry.second*eta;
+            break;
+        }
+        case PRESOLVE_FREE_COLUMN:
+        {
+            Real value = reduction.rhs;
+            for( const auto& entry : reduction.entries )
+                value -= entry.second*x[entry.first];
+            x[j] = value / reduction.coef;
+            y[i] = -reduction.value / reduction.coef;
+            d[j] = Real(0);
+            break;
+        }
+        case PRESOLVE_DOUBLETON:
+        {
+            // Since d_j - r d_k equals the multiplier of the merged bounds,
+            // assign the latter to whichever variable contributed the
+            // active bound
+            const Int jOther = reduction.otherCol;
+            const Real& alphaK = reduction.coef;
+            const Real r = reduction.otherCoef / alphaK;
+            x[j] = (reduction.rhs - reduction.otherCoef*x[jOther]) / alphaK;
+            Real dK = Real(0);
+            if( (d[jOther] > Real(0) && reduction.flag) ||
+                (d[jOther] < Real(0) && reduction.otherFlag) )
+            {
+                dK = -d[jOther] / r;
+                d[jOther] = Real(0);
+            }
+            const Real residual =
+              dualResidual( reduction.value, reduction.entries );
+            y[i] = (dK-residual) / alphaK;
+            d[j] = dK;
+            break;
+        }
+        }
+    }
+}
+
+template<typename Real>
+void Presolver<Real>::Postsolve
+( const DirectLPSolution<Matrix<Real>>& reducedSolution,
+        DirectLPSolution<Matrix<Real>>& solution ) const
+{
+    EL_DEBUG_CSE
+    vector<Real> x(numCols_,Real(0)), d(numCols_,Real(0)),
+                 y(numRows_,Real(0));
+    for( Int jRed=0; jRed<Int(reducedCols_.size()); ++jRed )
+    {
+        const Int j = reducedCols_[jRed];
+        x[j] = lower_[j] + reducedSolution.x(jRed);
+        d[j] = reducedSolution.z(jRed);
+    }
+    for( Int iRed=0; iRed<Int(reducedRows_.size()); ++iRed )
+        y[reducedRows_[iRed]] = reducedSolution.y(iRed);
+
+    PostsolveStack( x, y, d );
+
+    Zeros( solution.x, numCols_, 1 );
+    Zeros( solution.y, numRows_, 1 );
+    Zeros( solution.z, numCols_, 1 );
+    for( Int j=0; j<numCols_; ++j )
+    {
+        solution.x(j) = x[j];
+        solution.z(j) = d[j];
+    }
+    for( Int i=0; i<numRows_; ++i )
+        solution.y(i) = y[i];
+}
+
+template<typename Real>
+void Presolver<Real>::Postsolve
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const AffineLPSolution<Matrix<Real>>& reducedSolution,
+        AffineLPSolution<Matrix<Real>>& solution ) const
+{
+    EL_DEBUG_CSE
+    vector<Real> x(numCols_,Real(0)), d(numCols_,Real(0)),
+                 y(numRows_,Real(0));
+    for( Int jRed=0; jRed<Int(reducedCols_.size()); ++jRed )
+    {
+        const Int j = reducedCols_[jRed];
+        x[j] = reducedSolution.x(jRed);
+        if( lowerBoundRow_[j] >= 0 )
+            d[j] += reducedSolution.z(lowerBoundRow_[j]);
+        if( upperBoundRow_[j] >= 0 )
+            d[j] -= reducedSolution.z(upperBoundRow_[j]);
+    }
+    Int numReducedEqs=0, numReducedIneqs=0;
+    for( const Int i : reducedRows_ )
+    {
+        if( i < numEqs_ )
+            y[i] = reducedSolution.y(numReducedEqs++);
+        else
+            y[i] = reducedSolution.z(numReducedIneqs++);
+    }
+
+    PostsolveStack( x, y, d );
+
+    const Int numIneqs = numRows_ - numEqs_;
+    Zeros( solution.x, numCols_, 1 );
+    Zeros( solution.y, numEqs_, 1 );
+    Zeros( solution.z, numIneqs, 1 );
+    for( Int j=0; j<numCols_; ++j )
+        solution.x(j) = x[j];
+    for( Int i=0; i<numEqs_; ++i )
+        solution.y(i) = y[i];
+    for( Int i=0; i<numIneqs; ++i )
+        solution.z(i) = y[i+numEqs_];
+    solution.s = problem.h;
+    Multiply( NORMAL, Real(-1), problem.G, solution.x, Real(1), solution.s );
+}
+
+// Gather a distributed problem onto every process and distribute the rows of
+// a sequential problem (or solution) which is redundantly stored on every
+// process
+template<typename Real>
+void GatherToAll( const DistSparseMatrix<Real>& ADist, SparseMatrix<Real>& A )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = ADist.Grid();
+    const int commSize = grid.Size();
+    const int numLocalEntries = ADist.NumLocalEntries();
+    vector<int> entrySizes(commSize);
+    mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, grid.Comm() );
+    vector<int> entryOffs;
+    const int numEntries = Scan( entrySizes, entryOffs );
+
+    vector<Int> sources(numEntries), targets(numEntries);
+    vector<Real> values(numEntries);
+    mpi::AllGather
+    ( ADist.LockedSourceBuffer(), numLocalEntries,
+      sources.data(), entrySizes.data(), entryOffs.data(), grid.Comm() );
+    mpi::AllGather
+    ( ADist.LockedTargetBuffer(), numLocalEntries,
+      targets.data(), entrySizes.data(), entryOffs.data(), grid.Comm() );
+    mpi::AllGather
+    ( ADist.LockedValueBuffer(), numLocalEntries,
+      values.data(), entrySizes.data(), entryOffs.data(), grid.Comm() );
+
+    A.Resize( ADist.Height(), ADist.Width() );
+    A.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        A.QueueUpdate( sources[e], targets[e], values[e] );
+    A.ProcessQueues();
+}
+
+template<typename Real>
+void GatherToAll( const DistMultiVec<Real>& XDist, Matrix<Real>& X )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Real,STAR,STAR> X_STAR_STAR(XDist.Grid());
+    Copy( XDist, X_STAR_STAR );
+    X = X_STAR_STAR.Matrix();
+}
+
+template<typename Real>
+void DistributeRows
+( const SparseMatrix<Real>& A, DistSparseMatrix<Real>& ADist )
+{
+    EL_DEBUG_CSE
+    ADist.Resize( A.Height(), A.Width() );
+    const Int localHeight = ADist.LocalHeight();
+    const Int firstLocalRow = ADist.FirstLocalRow();
+    const Int localOffset = A.RowOffset(firstLocalRow);
+    ADist.Reserve( A.RowOffset(firstLocalRow+localHeight)-localOffset );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        for( Int e=A.RowOffset(i); e<A.RowOffset(i+1); ++e )
+            ADist.QueueLocalUpdate( iLoc, A.Col(e), A.Value(e) );
+    }
+    ADist.ProcessLocalQueues();
+}
+
+template<typename Real>
+void DistributeRows( const Matrix<Real>& X, DistMultiVec<Real>& XDist )
+{
+    EL_DEBUG_CSE
+    XDist.Resize( X.Height(), X.Width() );
+    auto& XLoc = XDist.Matrix();
+    for( Int j=0; j<X.Width(); ++j )
+        for( Int iLoc=0; iLoc<XDist.LocalHeight(); ++iLoc )
+            XLoc(iLoc,j) = X(XDist.GlobalRow(iLoc),j);
+}
+
+namespace direct {
+
+template<typename Real>
+void PresolvedMehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Presolver<Real> presolver( problem, ctrl.presolveCtrl );
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> reduced;
+    presolver.Reduce( reduced );
+
+    DirectLPSolution<Matrix<Real>> reducedSolution;
+    if( reduced.A.Width() == 0 )
+    {
+        Zeros( reducedSolution.x, 0, 1 );
+        Zeros( reducedSolution.y, reduced.A.Height(), 1 );
+        Zeros( reducedSolution.z, 0, 1 );
+    }
+    else
+    {
+        auto mehrotraCtrl = ctrl.mehrotraCtrl;
+        mehrotraCtrl.primalInit = false;
+        mehrotraCtrl.dualInit = false;
+        Mehrotra( reduced, reducedSolution, mehrotraCtrl );
+    }
+    presolver.Postsolve( reducedSolution, solution );
+}
+
+template<typename Real>
+void PresolvedMehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = problem.A.Grid();
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem;
+    GatherToAll( problem.c, seqProblem.c );
+    GatherToAll( problem.A, seqProblem.A );
+    GatherToAll( problem.b, seqProblem.b );
+
+    auto presolveCtrl = ctrl.presolveCtrl;
+    presolveCtrl.print = ( presolveCtrl.print && grid.Rank() == 0 );
+    Presolver<Real> presolver( seqProblem, presolveCtrl );
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> seqReduced;
+    presolver.Reduce( seqReduced );
+
+    DirectLPSolution<Matrix<Real>> seqReducedSolution, seqSolution;
+    if( seqReduced.A.Width() == 0 )
+    {
+        Zeros( seqReducedSolution.x, 0, 1 );
+        Zeros( seqReducedSolution.y, seqReduced.A.Height(), 1 );
+        Zeros( seqReducedSolution.z, 0, 1 );
+    }
+    else
+    {
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> reduced;
+        DirectLPSolution<DistMultiVec<Real>> reducedSolution;
+        ForceSimpleAlignments( reduced, grid );
+        ForceSimpleAlignments( reducedSolution, grid );
+        DistributeRows( seqReduced.c, reduced.c );
+        DistributeRows( seqReduced.A, reduced.A );
+        DistributeRows( seqReduced.b, reduced.b );
+
+        auto mehrotraCtrl = ctrl.mehrotraCtrl;
+        mehrotraCtrl.primalInit = false;
+        mehrotraCtrl.dualInit = false;
+        Mehrotra( reduced, reducedSolution, mehrotraCtrl );
+
+        GatherToAll( reducedSolution.x, seqReducedSolution.x );
+        GatherToAll( reducedSolution.y, seqReducedSolution.y );
+        GatherToAll( reducedSolution.z, seqReducedSolution.z );
+    }
+    presolver.Postsolve( seqReducedSolution, seqSolution );
+
+    ForceSimpleAlignments( solution, grid );
+    DistributeRows( seqSolution.x, solution.x );
+    DistributeRows( seqSolution.y, solution.y );
+    DistributeRows( seqSolution.z, solution.z );
+}
+
+} // namespace direct
+
+namespace affine {
+
+template<typename Real>
+void PresolvedMehrotra
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPSolution<Matrix<Real>>& solution,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Presolver<Real> presolver( problem, ctrl.presolveCtrl );
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> reduced;
+    presolver.Reduce( reduced );
+
+    AffineLPSolution<Matrix<Real>> reducedSolution;
+    if( reduced.A.Width() == 0 )
+    {
+        Zeros( reducedSolution.x, 0, 1 );
+        Zeros( reducedSolution.y, reduced.A.Height(), 1 );
+        Zeros( reducedSolution.z, reduced.G.Height(), 1 );
+        Zeros( reducedSolution.s, reduced.G.Height(), 1 );
+    }
+    else
+    {
+        auto mehrotraCtrl = ctrl.mehrotraCtrl;
+        mehrotraCtrl.primalInit = false;
+        mehrotraCtrl.dualInit = false;
+        Mehrotra( reduced, reducedSolution, mehrotraCtrl );
+    }
+    presolver.Postsolve( problem, reducedSolution, solution );
+}
+
+template<typename Real>
+void PresolvedMehrotra
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPSolution<DistMultiVec<Real>>& solution,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = problem.A.Grid();
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem;
+    GatherToAll( problem.c, seqProblem.c );
+    GatherToAll( problem.A, seqProblem.A );
+    GatherToAll( problem.b, seqProblem.b );
+    GatherToAll( problem.G, seqProblem.G );
+    GatherToAll( problem.h, seqProblem.h );
+
+    auto presolveCtrl = ctrl.presolveCtrl;
+    presolveCtrl.print = ( presolveCtrl.print && grid.Rank() == 0 );
+    Presolver<Real> presolver( seqProblem, presolveCtrl );
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> seqReduced;
+    presolver.Reduce( seqReduced );
+
+    AffineLPSolution<Matrix<Real>> seqReducedSolution, seqSolution;
+    if( seqReduced.A.Width() == 0 )
+    {
+        Zeros( seqReducedSolution.x, 0, 1 );
+        Zeros( seqReducedSolution.y, seqReduced.A.Height(), 1 );
+        Zeros( seqReducedSolution.z, seqReduced.G.Height(), 1 );
+        Zeros( seqReducedSolution.s, seqReduced.G.Height(), 1 );
+    }
+    else
+    {
+        AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> reduced;
+        AffineLPSolution<DistMultiVec<Real>> reducedSolution;
+        ForceSimpleAlignments( reduced, grid );
+        ForceSimpleAlignments( reducedSolution, grid );
+        DistributeRows( seqReduced.c, reduced.c );
+        DistributeRows( seqReduced.A, reduced.A );
+        DistributeRows( seqReduced.b, reduced.b );
+        DistributeRows( seqReduced.G, reduced.G );
+        DistributeRows( seqReduced.h, reduced.h );
+
+        auto mehrotraCtrl = ctrl.mehrotraCtrl;
+        mehrotraCtrl.primalInit = false;
+        mehrotraCtrl.dualInit = false;
+        Mehrotra( reduced, reducedSolution, mehrotraCtrl );
+
+        GatherToAll( reducedSolution.x, seqReducedSolution.x );
+        GatherToAll( reducedSolution.y, seqReducedSolution.y );
+        GatherToAll( reducedSolution.z, seqReducedSolution.z );
+        GatherToAll( reducedSolution.s, seqReducedSolution.s );
+    }
+    presolver.Postsolve( seqProblem, seqReducedSolution, seqSolution );
+
+    ForceSimpleAlignments( solution, grid );
+    DistributeRows( seqSolution.x, solution.x );
+    DistributeRows( seqSolution.y, solution.y );
+    DistributeRows( seqSolution.z, solution.z );
+    DistributeRows( seqSolution.s, solution.s );
+}
+
+} // namespace affine
+
+} // namespace lp
+} // namespace El
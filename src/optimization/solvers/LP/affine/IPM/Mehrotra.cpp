@@ -421,6 +421,83 @@ void UndoEquilibration
     DiagonalScale( LEFT, NORMAL, equilibration.rowScaleG, solution.s );
 }
 
+// Gondzio's multiple centrality correctors: each corrector solves, using the
+// existing factorization of the KKT system, for a direction which pushes the
+// complementarity products at a trial point (with step lengths increased by
+// 'ctrl.gondzioStepIncrease') into the box
+//
+//   [gondzioMinRatio sigma mu, gondzioMaxRatio sigma mu],
+//
+// and the corrected direction is only accepted if it sufficiently increases
+// the step lengths.
+template<typename Real,class VectorType,class SolveType>
+void GondzioCorrectors
+( const AffineLPSolution<VectorType>& solution,
+        AffineLPResidual<VectorType>& residual,
+        AffineLPSolution<VectorType>& correction,
+        AffineLPSolution<VectorType>& gondzioCorrection,
+        Real sigma,
+        Real barrier,
+        Real& alphaPri,
+        Real& alphaDual,
+  const MehrotraCtrl<Real>& ctrl,
+  const SolveType& solveForDirection,
+        bool print )
+{
+    EL_DEBUG_CSE
+    const Real lowerBound = ctrl.gondzioMinRatio*sigma*barrier;
+    const Real upperBound = ctrl.gondzioMaxRatio*sigma*barrier;
+    for( Int corrector=0; corrector<ctrl.maxGondzioCorrectors; ++corrector )
+    {
+        const Real alphaMin = Min(alphaPri,alphaDual);
+        if( alphaMin == Real(1) )
+            break;
+        const Real alphaPriTrial =
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1));
+        const Real alphaDualTrial =
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1));
+
+        // r_mu := v - Proj_{[lowerBound,upperBound]}(v), where v is the
+        // complementarity product at the trial point
+        // ---------------------------------------------------------------
+        pos_orth::CentralityResidual
+        ( solution.s, correction.s, solution.z, correction.z,
+          alphaPriTrial, alphaDualTrial, lowerBound, upperBound,
+          residual.dualConic );
+        Zero( residual.primalEquality );
+        Zero( residual.primalConic );
+        Zero( residual.dualEquality );
+        try { solveForDirection( residual, gondzioCorrection ); }
+        catch(...) { break; }
+        Axpy( Real(1), correction.x, gondzioCorrection.x );
+        Axpy( Real(1), correction.y, gondzioCorrection.y );
+        Axpy( Real(1), correction.z, gondzioCorrection.z );
+        Axpy( Real(1), correction.s, gondzioCorrection.s );
+
+        Real alphaPriNew =
+          pos_orth::MaxStep
+          ( solution.s, gondzioCorrection.s, 1/ctrl.maxStepRatio );
+        Real alphaDualNew =
+          pos_orth::MaxStep
+          ( solution.z, gondzioCorrection.z, 1/ctrl.maxStepRatio );
+        alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+        alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPriNew = alphaDualNew = Min(alphaPriNew,alphaDualNew);
+        if( Min(alphaPriNew,alphaDualNew) <
+            alphaMin + ctrl.gondzioAcceptRatio*ctrl.gondzioStepIncrease )
+            break;
+
+        correction = gondzioCorrection;
+        alphaPri = alphaPriNew;
+        alphaDual = alphaDualNew;
+        if( print )
+            Output
+            ("Gondzio corrector ",corrector,": alphaPri = ",alphaPri,
+             ", alphaDual = ",alphaDual);
+    }
+}
+
 template<typename Real>
 void EquilibratedMehrotra
 ( const AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem,
@@ -480,8 +557,28 @@ void EquilibratedMehrotra
         return true;
       };
 
-    AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    AffineLPSolution<Matrix<Real>> affineCorrection, correction,
+      gondzioCorrection;
     AffineLPResidual<Matrix<Real>> residual, error;
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const AffineLPResidual<Matrix<Real>>& rhs,
+                 AffineLPSolution<Matrix<Real>>& direction )
+      {
+          KKTRHS
+          ( rhs.dualEquality,
+            rhs.primalEquality,
+            rhs.primalConic,
+            rhs.dualConic,
+            solution.z, d );
+          if( !attemptToSolve(d) )
+              RuntimeError("Could not solve for the direction");
+          ExpandSolution
+          ( m, n, d, rhs.dualConic, solution.s, solution.z,
+            direction.x, direction.y, direction.z, direction.s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -702,6 +799,9 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( solution, residual, correction, gondzioCorrection, sigma, mu,
+          alphaPri, alphaDual, ctrl, solveForDirection, ctrl.print );
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -823,11 +923,32 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<DistMatrix<Real>> residual, error;
-    AffineLPSolution<DistMatrix<Real>> affineCorrection, correction;
+    AffineLPSolution<DistMatrix<Real>> affineCorrection, correction,
+      gondzioCorrection;
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( gondzioCorrection, grid );
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const AffineLPResidual<DistMatrix<Real>>& rhs,
+                 AffineLPSolution<DistMatrix<Real>>& direction )
+      {
+          KKTRHS
+          ( rhs.dualEquality,
+            rhs.primalEquality,
+            rhs.primalConic,
+            rhs.dualConic,
+            solution.z, d );
+          if( !attemptToSolve(d) )
+              RuntimeError("Could not solve for the direction");
+          ExpandSolution
+          ( m, n, d, rhs.dualConic, solution.s, solution.z,
+            direction.x, direction.y, direction.z, direction.s );
+      };
 
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
@@ -1047,6 +1168,10 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( solution, residual, correction, gondzioCorrection, sigma, mu,
+          alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1244,7 +1369,27 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<Matrix<Real>> residual, error;
-    AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    AffineLPSolution<Matrix<Real>> affineCorrection, correction,
+      gondzioCorrection;
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const AffineLPResidual<Matrix<Real>>& rhs,
+                 AffineLPSolution<Matrix<Real>>& direction )
+      {
+          KKTRHS
+          ( rhs.dualEquality,
+            rhs.primalEquality,
+            rhs.primalConic,
+            rhs.dualConic,
+            solution.z, d );
+          if( !attemptToSolve(d) )
+              RuntimeError("Could not solve for the direction");
+          ExpandSolution
+          ( m, n, d, rhs.dualConic, solution.s, solution.z,
+            direction.x, direction.y, direction.z, direction.s );
+      };
 
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
@@ -1481,6 +1626,9 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( solution, residual, correction, gondzioCorrection, sigma, mu,
+          alphaPri, alphaDual, ctrl, solveForDirection, ctrl.print );
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1674,12 +1822,33 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<DistMultiVec<Real>> residual, error;
-    AffineLPSolution<DistMultiVec<Real>> affineCorrection, correction;
+    AffineLPSolution<DistMultiVec<Real>> affineCorrection, correction,
+      gondzioCorrection;
 
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( gondzioCorrection, grid );
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const AffineLPResidual<DistMultiVec<Real>>& rhs,
+                 AffineLPSolution<DistMultiVec<Real>>& direction )
+      {
+          KKTRHS
+          ( rhs.dualEquality,
+            rhs.primalEquality,
+            rhs.primalConic,
+            rhs.dualConic,
+            solution.z, d );
+          if( !attemptToSolve(d) )
+              RuntimeError("Could not solve for the direction");
+          ExpandSolution
+          ( m, n, d, rhs.dualConic, solution.s, solution.z,
+            direction.x, direction.y, direction.z, direction.s );
+      };
 
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
@@ -1920,6 +2089,10 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( solution, residual, correction, gondzioCorrection, sigma, mu,
+          alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -52,11 +52,16 @@ Int ADMM
     //   | I 0   | | rho*I A^H | = | I   0   | | rho*I U12 |,
     //   | 0 P22 | | A     0   |   | L21 L22 | | 0     U22 |
     // where [L22,U22] are stored within B22.
+    //
+    // Since partial pivoting is invariant to scaling, the pivots and L22 of
+    // the LU factorization of -(A*A^H)/rho are independent of rho, and its
+    // U22 is just 1/rho times that of -(A*A^H). We therefore only factor
+    // -(A*A^H) and apply the 1/rho scalings of L21 and U22 on the fly so that
+    // the penalty parameter can be adapted without refactoring.
     Matrix<Real> U12, L21, B22, bPiv;
     Adjoint( A, U12 );
     L21 = A;
-    L21 *= 1/ctrl.rho;
-    Herk( LOWER, NORMAL, -1/ctrl.rho, A, B22 );
+    Herk( LOWER, NORMAL, Real(-1), A, B22 );
     MakeHermitian( LOWER, B22 );
     // TODO: Replace with sparse-direct Cholesky version?
     Permutation P2;
@@ -76,6 +81,7 @@ Int ADMM
         Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
     }
 
+    Real rho = ctrl.rho;
     Int numIter=0;
     const Int m = A.Height();
     const Int n = A.Width();
@@ -103,22 +109,23 @@ Int ADMM
         //                                  | P22' b    |
         xTmp = z;
         xTmp -= u;
-        xTmp *= ctrl.rho;
+        xTmp *= rho;
         xTmp -= c;
         y = bPiv;
-        Gemv( NORMAL, Real(-1), L21, xTmp, Real(1), y );
+        Gemv( NORMAL, -1/rho, L21, xTmp, Real(1), y );
         if( ctrl.inv )
         {
-            Gemv( NORMAL, Real(1), X22, y, t );
+            Gemv( NORMAL, rho, X22, y, t );
             y = t;
         }
         else
         {
             Trsv( LOWER, NORMAL, UNIT, B22, y );
             Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
+            y *= rho;
         }
         Gemv( NORMAL, Real(-1), U12, y, Real(1), xTmp );
-        xTmp *= 1/ctrl.rho;
+        xTmp *= 1/rho;
 
         // xHat := alpha*x + (1-alpha)*zOld
         xHat = xTmp;
@@ -143,12 +150,12 @@ Int ADMM
         // sNorm := |rho| || z - zOld ||_2
         t = z;
         t -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( t );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( t );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(xTmp),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.print )
         {
@@ -166,6 +173,15 @@ Int ADMM
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals (no refactoring is needed)
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            u *= 1/scaling;
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -216,6 +232,12 @@ Int ADMM
     //   | I 0   | | rho*I A^H | = | I   0   | | rho*I U12 |,
     //   | 0 P22 | | A     0   |   | L21 L22 | | 0     U22 |
     // where [L22,U22] are stored within B22.
+    //
+    // Since partial pivoting is invariant to scaling, the pivots and L22 of
+    // the LU factorization of -(A*A^H)/rho are independent of rho, and its
+    // U22 is just 1/rho times that of -(A*A^H). We therefore only factor
+    // -(A*A^H) and apply the 1/rho scalings of L21 and U22 on the fly so that
+    // the penalty parameter can be adapted without refactoring.
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
@@ -225,8 +247,7 @@ Int ADMM
     B22.Align( n%B22.ColStride(), n%B22.RowStride() );
     Adjoint( A, U12 );
     L21 = A;
-    L21 *= 1/ctrl.rho;
-    Herk( LOWER, NORMAL, -1/ctrl.rho, A, B22 );
+    Herk( LOWER, NORMAL, Real(-1), A, B22 );
     MakeHermitian( LOWER, B22 );
     DistPermutation P2(grid);
     LU( B22, P2 );
@@ -245,6 +266,7 @@ Int ADMM
         Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Real(1), B22, X22 );
     }
 
+    Real rho = ctrl.rho;
     Int numIter=0;
     DistMatrix<Real> g(grid), xTmp(grid), y(grid), t(grid);
     Zeros( g, m+n, 1 );
@@ -270,22 +292,23 @@ Int ADMM
         //                                  | P22' b    |
         xTmp = z;
         xTmp -= u;
-        xTmp *= ctrl.rho;
+        xTmp *= rho;
         xTmp -= c;
         y = bPiv;
-        Gemv( NORMAL, Real(-1), L21, xTmp, Real(1), y );
+        Gemv( NORMAL, -1/rho, L21, xTmp, Real(1), y );
         if( ctrl.inv )
         {
-            Gemv( NORMAL, Real(1), X22, y, t );
+            Gemv( NORMAL, rho, X22, y, t );
             y = t;
         }
         else
         {
             Trsv( LOWER, NORMAL, UNIT, B22, y );
             Trsv( UPPER, NORMAL, NON_UNIT, B22, y );
+            y *= rho;
         }
         Gemv( NORMAL, Real(-1), U12, y, Real(1), xTmp );
-        xTmp *= 1/ctrl.rho;
+        xTmp *= 1/rho;
 
         // xHat := alpha*x + (1-alpha)*zOld
         xHat = xTmp;
@@ -310,12 +333,12 @@ Int ADMM
         // sNorm := |rho| || z - zOld ||_2
         t = z;
         t -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( t );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( t );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(xTmp),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.print )
         {
@@ -334,6 +357,15 @@ Int ADMM
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals (no refactoring is needed)
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            u *= 1/scaling;
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter && grid.Rank() == 0 )
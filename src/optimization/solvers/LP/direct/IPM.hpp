@@ -33,21 +33,22 @@ void Mehrotra
         DirectLPSolution<DistMultiVec<Real>>& solution,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
-// NOTE: This should be in a different header
+// The following variants keep the symbolic analysis of the KKT system in
+// 'analysis' (see SparseMehrotraSolver) and record per-iteration statistics.
 template<typename Real>
-Int ADMM
-( const Matrix<Real>& A,
-  const Matrix<Real>& b,
-  const Matrix<Real>& c,
-        Matrix<Real>& z,
-  const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+        SparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
+  const MehrotraCtrl<Real>& ctrl );
 template<typename Real>
-Int ADMM
-( const AbstractDistMatrix<Real>& A,
-  const AbstractDistMatrix<Real>& b,
-  const AbstractDistMatrix<Real>& c,
-        AbstractDistMatrix<Real>& z,
-  const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
+void Mehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
+  const MehrotraCtrl<Real>& ctrl );
 
 } // namespace direct
 } // namespace lp
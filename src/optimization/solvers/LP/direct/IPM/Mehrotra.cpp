@@ -673,6 +673,81 @@ struct DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>>
     }
 };
 
+// Gondzio's multiple centrality correctors: each corrector solves, using the
+// existing factorization of the KKT system, for a direction which pushes the
+// complementarity products at a trial point (with step lengths increased by
+// 'ctrl.gondzioStepIncrease') into the box
+//
+//   [gondzioMinRatio sigma mu, gondzioMaxRatio sigma mu],
+//
+// and the corrected direction is only accepted if it sufficiently increases
+// the step lengths.
+template<typename Real,class VectorType,class SolveType>
+void GondzioCorrectors
+( const DirectLPSolution<VectorType>& solution,
+        DirectLPResidual<VectorType>& residual,
+        DirectLPSolution<VectorType>& correction,
+        DirectLPSolution<VectorType>& gondzioCorrection,
+        Real sigma,
+        Real barrier,
+        Real& alphaPri,
+        Real& alphaDual,
+  const MehrotraCtrl<Real>& ctrl,
+  const SolveType& solveForDirection,
+        bool print )
+{
+    EL_DEBUG_CSE
+    const Real lowerBound = ctrl.gondzioMinRatio*sigma*barrier;
+    const Real upperBound = ctrl.gondzioMaxRatio*sigma*barrier;
+    for( Int corrector=0; corrector<ctrl.maxGondzioCorrectors; ++corrector )
+    {
+        const Real alphaMin = Min(alphaPri,alphaDual);
+        if( alphaMin == Real(1) )
+            break;
+        const Real alphaPriTrial =
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1));
+        const Real alphaDualTrial =
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1));
+
+        // r_mu := v - Proj_{[lowerBound,upperBound]}(v), where v is the
+        // complementarity product at the trial point
+        // ---------------------------------------------------------------
+        pos_orth::CentralityResidual
+        ( solution.x, correction.x, solution.z, correction.z,
+          alphaPriTrial, alphaDualTrial, lowerBound, upperBound,
+          residual.dualConic );
+        Zero( residual.primalEquality );
+        Zero( residual.dualEquality );
+        try { solveForDirection( residual, gondzioCorrection ); }
+        catch(...) { break; }
+        Axpy( Real(1), correction.x, gondzioCorrection.x );
+        Axpy( Real(1), correction.y, gondzioCorrection.y );
+        Axpy( Real(1), correction.z, gondzioCorrection.z );
+
+        Real alphaPriNew =
+          pos_orth::MaxStep
+          ( solution.x, gondzioCorrection.x, 1/ctrl.maxStepRatio );
+        Real alphaDualNew =
+          pos_orth::MaxStep
+          ( solution.z, gondzioCorrection.z, 1/ctrl.maxStepRatio );
+        alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+        alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPriNew = alphaDualNew = Min(alphaPriNew,alphaDualNew);
+        if( Min(alphaPriNew,alphaDualNew) <
+            alphaMin + ctrl.gondzioAcceptRatio*ctrl.gondzioStepIncrease )
+            break;
+
+        correction = gondzioCorrection;
+        alphaPri = alphaPriNew;
+        alphaDual = alphaDualNew;
+        if( print )
+            Output
+            ("Gondzio corrector ",corrector,": alphaPri = ",alphaPri,
+             ", alphaDual = ",alphaDual);
+    }
+}
+
 template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
@@ -698,7 +773,15 @@ void EquilibratedMehrotra
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
     DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>> solver;
-    DirectLPSolution<Matrix<Real>> affineCorrection, correction;
+    DirectLPSolution<Matrix<Real>> affineCorrection, correction,
+      gondzioCorrection;
+    auto solveForDirection =
+      [&]( const DirectLPResidual<Matrix<Real>>& rhs,
+                 DirectLPSolution<Matrix<Real>>& direction )
+      {
+          solver.SolveSystem
+          ( problem, permReg, rhs, solution, direction, ctrl.system );
+      };
     for( state.numIts=0; state.numIts<ctrl.maxIts; ++state.numIts )
     {
         // Ensure that x and z are in the cone
@@ -790,6 +873,10 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( solution, state.residual, correction, gondzioCorrection,
+          state.sigma, state.barrier, alphaPri, alphaDual, ctrl,
+          solveForDirection, ctrl.print && outputRoot );
         if( ctrl.print && outputRoot )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -939,14 +1026,54 @@ void EquilibratedMehrotra
         return true;
       };
 
-    DirectLPSolution<DistMatrix<Real>> affineCorrection, correction;
+    DirectLPSolution<DistMatrix<Real>> affineCorrection, correction,
+      gondzioCorrection;
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( gondzioCorrection, grid );
 
     DirectLPResidual<DistMatrix<Real>> residual, error;
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
 
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const DirectLPResidual<DistMatrix<Real>>& rhs,
+                 DirectLPSolution<DistMatrix<Real>>& direction )
+      {
+          if( ctrl.system == FULL_KKT )
+          {
+              KKTRHS
+              ( rhs.dualEquality, rhs.primalEquality, rhs.dualConic,
+                solution.z, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution( m, n, d, direction.x, direction.y, direction.z );
+          }
+          else if( ctrl.system == AUGMENTED_KKT )
+          {
+              AugmentedKKTRHS
+              ( solution.x, rhs.dualEquality, rhs.primalEquality,
+                rhs.dualConic, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandAugmentedSolution
+              ( solution.x, solution.z, rhs.dualConic, d,
+                direction.x, direction.y, direction.z );
+          }
+          else if( ctrl.system == NORMAL_KKT )
+          {
+              NormalKKTRHS
+              ( problem.A, gammaPerm, solution.x, solution.z,
+                rhs.dualEquality, rhs.primalEquality, rhs.dualConic,
+                direction.y );
+              ldl::SolveAfter( J, dSub, p, direction.y, false );
+              ExpandNormalSolution
+              ( problem.A, gammaPerm, solution.x, solution.z,
+                rhs.dualEquality, rhs.dualConic,
+                direction.x, direction.y, direction.z );
+          }
+      };
+
     DistMatrix<Real> prod(grid);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
@@ -1229,6 +1356,10 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( solution, residual, correction, gondzioCorrection, sigma, mu,
+          alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  correction.x, solution.x );
@@ -1356,16 +1487,37 @@ void Mehrotra
     Copy( solution.z, z );
 }
 
+// Move the complementarity products of a warm start into [beta mu, mu / beta],
+// where 'mu' is their (floored) average
+template<typename VectorType,typename Real>
+void CenterWarmStart
+( DirectLPSolution<VectorType>& solution,
+  Int degree,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.warmStartCentrality <= Real(0) )
+        return;
+    const Real mu =
+      Max( Dot(solution.x,solution.z) / degree, ctrl.warmStartMinBarrier );
+    pos_orth::CenterPair
+    ( solution.x, solution.z, mu, ctrl.warmStartCentrality );
+}
+
 template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
+        SparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     const Int m = problem.A.Height();
     const Int n = problem.A.Width();
     const Int degree = n;
+    Timer timer, iterTimer;
+    iterations.clear();
 
     // TODO(poulson): Move these into the control structure
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
@@ -1394,25 +1546,29 @@ void EquilibratedMehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    if( ctrl.system == AUGMENTED_KKT )
+    const bool warmStart = ctrl.primalInit && ctrl.dualInit;
+    bool& initAnalyzed =
+      ctrl.system == AUGMENTED_KKT ? analysis.analyzed : analysis.initAnalyzed;
+    SparseLDLFactorization<Real>& initLDLFact =
+      ctrl.system == AUGMENTED_KKT ?
+      analysis.factorization : analysis.initFactorization;
+    Initialize
+    ( problem, solution, initLDLFact,
+      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+      ctrl.solveCtrl, initAnalyzed );
+    if( warmStart )
     {
-        Initialize
-        ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        CenterWarmStart( solution, degree, ctrl );
     }
-    else
+    else if( !initAnalyzed )
     {
-        SparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( problem, solution, augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        initAnalyzed = true;
+        ++analysis.numAnalyses;
     }
+    SparseLDLFactorization<Real>& sparseLDLFact = analysis.factorization;
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1447,13 +1603,68 @@ void EquilibratedMehrotra
     Matrix<Real> d, w;
     Matrix<Real> dInner;
 
-    DirectLPSolution<Matrix<Real>> affineCorrection, correction;
+    DirectLPSolution<Matrix<Real>> affineCorrection, correction,
+      gondzioCorrection;
     DirectLPResidual<Matrix<Real>> residual, error;
 
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const DirectLPResidual<Matrix<Real>>& rhs,
+                 DirectLPSolution<Matrix<Real>>& direction )
+      {
+          if( ctrl.system == NORMAL_KKT )
+          {
+              NormalKKTRHS
+              ( problem.A, gammaPerm, solution.x, solution.z,
+                rhs.dualEquality, rhs.primalEquality, rhs.dualConic,
+                direction.y );
+              reg_ldl::RegularizedSolveAfter
+              ( J, regTmp, sparseLDLFact, direction.y,
+                ctrl.solveCtrl.relTol,
+                ctrl.solveCtrl.maxRefineIts,
+                ctrl.solveCtrl.progress,
+                ctrl.solveCtrl.time );
+              ExpandNormalSolution
+              ( problem.A, gammaPerm, solution.x, solution.z,
+                rhs.dualEquality, rhs.dualConic,
+                direction.x, direction.y, direction.z );
+              return;
+          }
+          if( ctrl.system == FULL_KKT )
+              KKTRHS
+              ( rhs.dualEquality, rhs.primalEquality, rhs.dualConic,
+                solution.z, d );
+          else
+              AugmentedKKTRHS
+              ( solution.x, rhs.dualEquality, rhs.primalEquality,
+                rhs.dualConic, d );
+          if( ctrl.resolveReg )
+              reg_ldl::SolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+          else
+              reg_ldl::RegularizedSolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                ctrl.solveCtrl.relTol,
+                ctrl.solveCtrl.maxRefineIts,
+                ctrl.solveCtrl.progress );
+          if( ctrl.system == FULL_KKT )
+              ExpandSolution
+              ( m, n, d, direction.x, direction.y, direction.z );
+          else
+              ExpandAugmentedSolution
+              ( solution.x, solution.z, rhs.dualConic, d,
+                direction.x, direction.y, direction.z );
+      };
+
     Matrix<Real> prod;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        iterTimer.Start();
+        iterations.emplace_back();
+        IPMIterationInfo<Real>& info = iterations.back();
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -1505,6 +1716,8 @@ void EquilibratedMehrotra
           pos_orth::ComplementRatio( solution.x, solution.z );
         mu = compRatio > ctrl.balanceTol ? muOld : Min(mu,muOld);
         muOld = mu;
+        info.barrier = mu;
+        info.relError = relError;
 
         if( ctrl.print )
         {
@@ -1545,6 +1758,7 @@ void EquilibratedMehrotra
         {
             // Construct the KKT system
             // ------------------------
+            timer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -1565,11 +1779,13 @@ void EquilibratedMehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
+            info.formTime = timer.Stop();
 
             // Solve for the direction
             // -----------------------
             try
             {
+                timer.Start();
                 if( wMaxNorm >= ctrl.ruizEquilTol )
                 {
                     if( ctrl.print )
@@ -1585,21 +1801,28 @@ void EquilibratedMehrotra
                 }
                 else
                     Ones( dInner, J.Height(), 1 );
+                info.formTime += timer.Stop();
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                if( !analysis.analyzed )
                 {
+                    timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    info.analysisTime = timer.Stop();
+                    analysis.analyzed = true;
+                    ++analysis.numAnalyses;
                 }
                 else
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
+                timer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = timer.Stop();
+
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1609,6 +1832,7 @@ void EquilibratedMehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1633,6 +1857,7 @@ void EquilibratedMehrotra
             // ------------------------
             // TODO(poulson): Apply updates to a matrix of explicit zeros
             // (with the correct sparsity pattern)
+            timer.Start();
             NormalKKT
             ( problem.A, gammaPerm, deltaPerm,
               solution.x, solution.z, J, false );
@@ -1640,31 +1865,40 @@ void EquilibratedMehrotra
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
               residual.dualConic, affineCorrection.y );
+            info.formTime = timer.Stop();
 
             // Solve for the direction
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( !analysis.analyzed )
                 {
+                    timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    info.analysisTime = timer.Stop();
+                    analysis.analyzed = true;
+                    ++analysis.numAnalyses;
                 }
                 else
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
+                timer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = timer.Stop();
 
                 // NOTE: regTmp should be all zeros; replace with unregularized
+                timer.Start();
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, sparseLDLFact, affineCorrection.y,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress,
                   ctrl.solveCtrl.time );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1746,7 +1980,6 @@ void EquilibratedMehrotra
         residual.primalEquality *= 1-sigma;
         residual.dualEquality *= 1-sigma;
         Shift( residual.dualConic, -sigma*mu );
-        // TODO(poulson): Gondzio's corrections
         if( ctrl.mehrotra )
         {
             // r_mu += dxAff o dzAff
@@ -1764,6 +1997,7 @@ void EquilibratedMehrotra
               residual.dualConic, solution.z, d );
             try
             {
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1773,6 +2007,7 @@ void EquilibratedMehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1791,6 +2026,7 @@ void EquilibratedMehrotra
               residual.dualConic, d );
             try
             {
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1800,6 +2036,7 @@ void EquilibratedMehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1822,12 +2059,14 @@ void EquilibratedMehrotra
             try
             {
                 // NOTE: regTmp should be all zeros; replace with unregularized
+                timer.Start();
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, sparseLDLFact, correction.y,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress,
                   ctrl.solveCtrl.time );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1854,8 +2093,18 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxGondzioCorrectors > 0 )
+        {
+            timer.Start();
+            GondzioCorrectors
+            ( solution, residual, correction, gondzioCorrection, sigma, mu,
+              alphaPri, alphaDual, ctrl, solveForDirection, ctrl.print );
+            info.solveTime += timer.Stop();
+        }
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        info.primalStep = alphaPri;
+        info.dualStep = alphaDual;
         Axpy( alphaPri,  correction.x, solution.x );
         Axpy( alphaDual, correction.y, solution.y );
         Axpy( alphaDual, correction.z, solution.z );
@@ -1867,7 +2116,12 @@ void EquilibratedMehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        info.totalTime = iterTimer.Stop();
     }
+    // The loop is exited via 'break' with the timer of the last iteration
+    // still running
+    if( !iterations.empty() )
+        iterations.back().totalTime = iterTimer.Partial();
     SetIndent( indent );
 }
 
@@ -1875,6 +2129,8 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
         DirectLPSolution<Matrix<Real>>& solution,
+        SparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
@@ -1886,12 +2142,14 @@ void Mehrotra
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, analysis, iterations,
+          ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, analysis, iterations, ctrl );
     }
     if( ctrl.print )
     {
@@ -1912,6 +2170,18 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseKKTAnalysis<Real> analysis;
+    vector<IPMIterationInfo<Real>> iterations;
+    Mehrotra( problem, solution, analysis, iterations, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -1943,6 +2213,8 @@ template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
@@ -1951,7 +2223,8 @@ void EquilibratedMehrotra
     const Int degree = n;
     const Grid& grid = problem.A.Grid();
     const int commRank = grid.Rank();
-    Timer timer;
+    Timer timer, iterTimer;
+    iterations.clear();
 
     // TODO(poulson): Move these into the control structure
     Real gammaPerm, deltaPerm, betaPerm, gammaTmp, deltaTmp, betaTmp;
@@ -1985,29 +2258,33 @@ void EquilibratedMehrotra
         }
     }
 
-    DistSparseLDLFactorization<Real> sparseLDLFact;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    const bool warmStart = ctrl.primalInit && ctrl.dualInit;
+    bool& initAnalyzed =
+      ctrl.system == AUGMENTED_KKT ? analysis.analyzed : analysis.initAnalyzed;
+    DistSparseLDLFactorization<Real>& initLDLFact =
+      ctrl.system == AUGMENTED_KKT ?
+      analysis.factorization : analysis.initFactorization;
+    Initialize
+    ( problem, solution, initLDLFact,
+      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+      ctrl.solveCtrl, initAnalyzed );
+    if( warmStart )
     {
-        Initialize
-        ( problem, solution, sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        CenterWarmStart( solution, degree, ctrl );
     }
-    else
+    else if( !initAnalyzed )
     {
-        DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( problem, solution, augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        initAnalyzed = true;
+        ++analysis.numAnalyses;
     }
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
+    DistSparseLDLFactorization<Real>& sparseLDLFact = analysis.factorization;
 
     DistMultiVec<Real> regTmp(grid);
     if( ctrl.system == FULL_KKT )
@@ -2041,22 +2318,77 @@ void EquilibratedMehrotra
     Real muOld = 0.1;
     Real relError = 1;
 
-    DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid);
     DistMultiVec<Real> dInner(grid);
 
-    DirectLPSolution<DistMultiVec<Real>> affineCorrection, correction;
+    DirectLPSolution<DistMultiVec<Real>> affineCorrection, correction,
+      gondzioCorrection;
     DirectLPResidual<DistMultiVec<Real>> residual, error;
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( gondzioCorrection, grid );
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
 
+    // Solve for a direction using the existing factorization of the KKT
+    // system (throwing upon failure)
+    auto solveForDirection =
+      [&]( const DirectLPResidual<DistMultiVec<Real>>& rhs,
+                 DirectLPSolution<DistMultiVec<Real>>& direction )
+      {
+          if( ctrl.system == NORMAL_KKT )
+          {
+              NormalKKTRHS
+              ( problem.A, gammaPerm, solution.x, solution.z,
+                rhs.dualEquality, rhs.primalEquality, rhs.dualConic,
+                direction.y );
+              reg_ldl::RegularizedSolveAfter
+              ( J, regTmp, sparseLDLFact, direction.y,
+                ctrl.solveCtrl.relTol,
+                ctrl.solveCtrl.maxRefineIts,
+                ctrl.solveCtrl.progress,
+                ctrl.solveCtrl.time );
+              ExpandNormalSolution
+              ( problem.A, gammaPerm, solution.x, solution.z,
+                rhs.dualEquality, rhs.dualConic,
+                direction.x, direction.y, direction.z );
+              return;
+          }
+          if( ctrl.system == FULL_KKT )
+              KKTRHS
+              ( rhs.dualEquality, rhs.primalEquality, rhs.dualConic,
+                solution.z, d );
+          else
+              AugmentedKKTRHS
+              ( solution.x, rhs.dualEquality, rhs.primalEquality,
+                rhs.dualConic, d );
+          if( ctrl.resolveReg )
+              reg_ldl::SolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+          else
+              reg_ldl::RegularizedSolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                ctrl.solveCtrl.relTol,
+                ctrl.solveCtrl.maxRefineIts,
+                ctrl.solveCtrl.progress );
+          if( ctrl.system == FULL_KKT )
+              ExpandSolution
+              ( m, n, d, direction.x, direction.y, direction.z );
+          else
+              ExpandAugmentedSolution
+              ( solution.x, solution.z, rhs.dualConic, d,
+                direction.x, direction.y, direction.z );
+      };
+
     DistMultiVec<Real> prod(grid);
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        iterTimer.Start();
+        iterations.emplace_back();
+        IPMIterationInfo<Real>& info = iterations.back();
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -2106,6 +2438,8 @@ void EquilibratedMehrotra
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
+        info.barrier = mu;
+        info.relError = relError;
         if( ctrl.print )
         {
             const Real xNrm2 = FrobeniusNorm( solution.x );
@@ -2145,6 +2479,7 @@ void EquilibratedMehrotra
         {
             // Assemble the KKT system
             // -----------------------
+            timer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -2165,29 +2500,30 @@ void EquilibratedMehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
+            if( !analysis.haveMultMeta )
             {
-                metaOrig = JOrig.InitializeMultMeta();
-                meta = J.InitializeMultMeta();
-                if( ctrl.print )
-                {
-                    const double imbalanceJ = J.Imbalance();
-                    if( commRank == 0 )
-                        Output("Imbalance factor of J: ",imbalanceJ);
-                }
+                analysis.multMetaOrig = JOrig.InitializeMultMeta();
+                analysis.multMeta = J.InitializeMultMeta();
+                analysis.haveMultMeta = true;
             }
             else
             {
-                JOrig.LockedDistGraph().multMeta = metaOrig;
-                J.LockedDistGraph().multMeta = meta;
+                JOrig.LockedDistGraph().multMeta = analysis.multMetaOrig;
+                J.LockedDistGraph().multMeta = analysis.multMeta;
+            }
+            info.formTime = timer.Stop();
+            if( numIts == 0 && ctrl.print )
+            {
+                const double imbalanceJ = J.Imbalance();
+                if( commRank == 0 )
+                    Output("Imbalance factor of J: ",imbalanceJ);
             }
 
             // Solve for the direction
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( wMaxNorm >= ctrl.ruizEquilTol )
                 {
                     if( ctrl.print && commRank == 0 )
@@ -2203,32 +2539,33 @@ void EquilibratedMehrotra
                 }
                 else
                     Ones( dInner, J.Height(), 1 );
+                const double equilTime = timer.Stop();
+                info.formTime += equilTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Equilibration: ",timer.Stop()," secs");
+                    Output("Equilibration: ",equilTime," secs");
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                if( !analysis.analyzed )
                 {
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
+                    timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    info.analysisTime = timer.Stop();
+                    analysis.analyzed = true;
+                    ++analysis.numAnalyses;
                     if( commRank == 0 && ctrl.time )
-                        Output("Analysis: ",timer.Stop()," secs");
+                        Output("Analysis: ",info.analysisTime," secs");
                 }
                 else
                     sparseLDLFact.ChangeNonzeroValues( J );
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = timer.Stop();
                 if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                    Output("LDL: ",info.factorTime," secs");
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -2238,8 +2575,10 @@ void EquilibratedMehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                const double affineTime = timer.Stop();
+                info.solveTime += affineTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                    Output("Affine: ",affineTime," secs");
             }
             catch(...)
             {
@@ -2264,6 +2603,7 @@ void EquilibratedMehrotra
             // Assemble the KKT system
             // -----------------------
             // TODO(poulson): Apply updates on top of explicit zeros
+            timer.Start();
             NormalKKT
             ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
               J, false );
@@ -2271,56 +2611,61 @@ void EquilibratedMehrotra
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
               residual.dualConic, affineCorrection.y );
-            if( numIts == 0 )
+            if( numIts == 0 && ctrl.print )
             {
-                if( ctrl.print )
-                {
-                    const double imbalanceJ = J.Imbalance();
-                    if( commRank == 0 )
-                        Output("Imbalance factor of J: ",imbalanceJ);
-                }
-                meta = J.InitializeMultMeta();
+                const double imbalanceJ = J.Imbalance();
+                if( commRank == 0 )
+                    Output("Imbalance factor of J: ",imbalanceJ);
+            }
+            if( !analysis.haveMultMeta )
+            {
+                analysis.multMeta = J.InitializeMultMeta();
+                analysis.haveMultMeta = true;
             }
             else
             {
-                J.LockedDistGraph().multMeta = meta;
+                J.LockedDistGraph().multMeta = analysis.multMeta;
             }
+            info.formTime = timer.Stop();
 
             // Solve for the direction
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( !analysis.analyzed )
                 {
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
+                    timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    info.analysisTime = timer.Stop();
+                    analysis.analyzed = true;
+                    ++analysis.numAnalyses;
                     if( commRank == 0 && ctrl.time )
-                        Output("Analysis: ",timer.Stop()," secs");
+                        Output("Analysis: ",info.analysisTime," secs");
                 }
                 else
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = timer.Stop();
                 if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                    Output("LDL: ",info.factorTime," secs");
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, sparseLDLFact, affineCorrection.y,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress,
                   ctrl.solveCtrl.time );
+                const double affineTime = timer.Stop();
+                info.solveTime += affineTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                    Output("Affine: ",affineTime," secs");
             }
             catch(...)
             {
@@ -2420,8 +2765,7 @@ void EquilibratedMehrotra
               residual.dualConic, solution.z, d );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -2431,8 +2775,10 @@ void EquilibratedMehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                const double correctorTime = timer.Stop();
+                info.solveTime += correctorTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                    Output("Corrector: ",correctorTime," secs");
             }
             catch(...)
             {
@@ -2451,8 +2797,7 @@ void EquilibratedMehrotra
               residual.dualConic, d );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -2462,8 +2807,10 @@ void EquilibratedMehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                const double correctorTime = timer.Stop();
+                info.solveTime += correctorTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                    Output("Corrector: ",correctorTime," secs");
             }
             catch(...)
             {
@@ -2485,16 +2832,17 @@ void EquilibratedMehrotra
               residual.dualConic, correction.y );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, sparseLDLFact, correction.y,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress,
                   ctrl.solveCtrl.time );
+                const double correctorTime = timer.Stop();
+                info.solveTime += correctorTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                    Output("Corrector: ",correctorTime," secs");
             }
             catch(...)
             {
@@ -2521,8 +2869,19 @@ void EquilibratedMehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        if( ctrl.maxGondzioCorrectors > 0 )
+        {
+            timer.Start();
+            GondzioCorrectors
+            ( solution, residual, correction, gondzioCorrection, sigma, mu,
+              alphaPri, alphaDual, ctrl, solveForDirection,
+              ctrl.print && commRank == 0 );
+            info.solveTime += timer.Stop();
+        }
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        info.primalStep = alphaPri;
+        info.dualStep = alphaDual;
         Axpy( alphaPri,  correction.x, solution.x );
         Axpy( alphaDual, correction.y, solution.y );
         Axpy( alphaDual, correction.z, solution.z );
@@ -2534,7 +2893,12 @@ void EquilibratedMehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        info.totalTime = iterTimer.Stop();
     }
+    // The loop is exited via 'break' with the timer of the last iteration
+    // still running
+    if( !iterations.empty() )
+        iterations.back().totalTime = iterTimer.Partial();
     SetIndent( indent );
 }
 
@@ -2542,6 +2906,8 @@ template<typename Real>
 void Mehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
+        DistSparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
@@ -2554,12 +2920,14 @@ void Mehrotra
         Equilibrate
         ( problem, solution,
           equilibratedProblem, equilibratedSolution, equilibration, ctrl );
-        EquilibratedMehrotra( equilibratedProblem, equilibratedSolution, ctrl );
+        EquilibratedMehrotra
+        ( equilibratedProblem, equilibratedSolution, analysis, iterations,
+          ctrl );
         UndoEquilibration( equilibratedSolution, equilibration, solution );
     }
     else
     {
-        EquilibratedMehrotra( problem, solution, ctrl );
+        EquilibratedMehrotra( problem, solution, analysis, iterations, ctrl );
     }
     if( ctrl.print )
     {
@@ -2581,6 +2949,18 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseKKTAnalysis<Real> analysis;
+    vector<IPMIterationInfo<Real>> iterations;
+    Mehrotra( problem, solution, analysis, iterations, ctrl );
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void Mehrotra
@@ -2642,6 +3022,12 @@ void Mehrotra
           DirectLPSolution<Matrix<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          DirectLPSolution<Matrix<Real>>& solution, \
+          SparseKKTAnalysis<Real>& analysis, \
+          vector<IPMIterationInfo<Real>>& iterations, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const SparseMatrix<Real>& A, \
     const Matrix<Real>& b, \
     const Matrix<Real>& c, \
@@ -2654,6 +3040,12 @@ void Mehrotra
           DirectLPSolution<DistMultiVec<Real>>& solution, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
+          DirectLPSolution<DistMultiVec<Real>>& solution, \
+          DistSparseKKTAnalysis<Real>& analysis, \
+          vector<IPMIterationInfo<Real>>& iterations, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
     const DistMultiVec<Real>& c, \
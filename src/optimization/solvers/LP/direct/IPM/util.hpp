@@ -31,14 +31,16 @@ void Initialize
         DirectLPSolution<Matrix<Real>>& solution,
         SparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
 template<typename Real>
 void Initialize
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
         DirectLPSolution<DistMultiVec<Real>>& solution,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
 
 // Full system
 // ===========
@@ -303,7 +303,8 @@ void Initialize
   bool primalInit,
   bool dualInit,
   bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int n = problem.A.Width();
@@ -312,7 +313,7 @@ void Initialize
     qp::direct::Initialize
     ( Q, problem.A, problem.b, problem.c, solution.x, solution.y, solution.z,
       sparseLDLFact,
-      primalInit, dualInit, standardShift, solveCtrl );
+      primalInit, dualInit, standardShift, solveCtrl, reuseAnalysis );
 }
 
 template<typename Real>
@@ -323,7 +324,8 @@ void Initialize
   bool primalInit,
   bool dualInit,
   bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int n = problem.A.Width();
@@ -332,7 +334,7 @@ void Initialize
     qp::direct::Initialize
     ( Q, problem.A, problem.b, problem.c, solution.x, solution.y, solution.z,
       sparseLDLFact,
-      primalInit, dualInit, standardShift, solveCtrl );
+      primalInit, dualInit, standardShift, solveCtrl, reuseAnalysis );
 }
 
 #define PROTO(Real) \
@@ -355,7 +357,8 @@ void Initialize
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl ); \
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis ); \
   template void Initialize \
   ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem, \
           DirectLPSolution<DistMultiVec<Real>>& solution, \
@@ -363,7 +366,8 @@ void Initialize
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl );
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
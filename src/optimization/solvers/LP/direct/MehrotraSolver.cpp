@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./IPM.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+template<typename Real>
+SparseMehrotraSolver<Real>::SparseMehrotraSolver()
+{ ctrl.system = AUGMENTED_KKT; }
+
+template<typename Real>
+SparseMehrotraSolver<Real>::SparseMehrotraSolver
+( const MehrotraCtrl<Real>& ctrlIn )
+: ctrl(ctrlIn)
+{ }
+
+template<typename Real>
+void SparseMehrotraSolver<Real>::Solve
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        DirectLPSolution<Matrix<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    const SparseMatrix<Real>& A = problem.A;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+
+    // The symbolic analysis can only be reused if neither the sparsity
+    // pattern of A nor the KKT formulation have changed
+    bool samePattern =
+      numSolves_ > 0 && ctrl.system == system_ &&
+      m == height_ && n == width_ && Int(sources_.size()) == numEntries;
+    for( Int e=0; e<numEntries && samePattern; ++e )
+        if( sourceBuf[e] != sources_[e] || targetBuf[e] != targets_[e] )
+            samePattern = false;
+    if( !samePattern )
+    {
+        analysis_.analyzed = false;
+        analysis_.initAnalyzed = false;
+        system_ = ctrl.system;
+        height_ = m;
+        width_ = n;
+        sources_.assign( sourceBuf, sourceBuf+numEntries );
+        targets_.assign( targetBuf, targetBuf+numEntries );
+    }
+
+    MehrotraCtrl<Real> solveCtrl( ctrl );
+    if( warmStart && numSolves_ > 0 &&
+        solution.x.Height() == n && solution.x.Width() == 1 &&
+        solution.y.Height() == m && solution.y.Width() == 1 &&
+        solution.z.Height() == n && solution.z.Width() == 1 )
+    {
+        solveCtrl.primalInit = true;
+        solveCtrl.dualInit = true;
+    }
+    Mehrotra( problem, solution, analysis_, iterations_, solveCtrl );
+    ++numSolves_;
+}
+
+template<typename Real>
+void SparseMehrotraSolver<Real>::Reset()
+{
+    EL_DEBUG_CSE
+    analysis_.analyzed = false;
+    analysis_.initAnalyzed = false;
+    analysis_.numAnalyses = 0;
+    sources_.clear();
+    targets_.clear();
+    numSolves_ = 0;
+    iterations_.clear();
+}
+
+template<typename Real>
+Int SparseMehrotraSolver<Real>::NumSolves() const
+{ return numSolves_; }
+
+template<typename Real>
+Int SparseMehrotraSolver<Real>::NumAnalyses() const
+{ return analysis_.numAnalyses; }
+
+template<typename Real>
+const vector<IPMIterationInfo<Real>>&
+SparseMehrotraSolver<Real>::Iterations() const
+{ return iterations_; }
+
+template<typename Real>
+DistSparseMehrotraSolver<Real>::DistSparseMehrotraSolver()
+{ ctrl.system = AUGMENTED_KKT; }
+
+template<typename Real>
+DistSparseMehrotraSolver<Real>::DistSparseMehrotraSolver
+( const MehrotraCtrl<Real>& ctrlIn )
+: ctrl(ctrlIn)
+{ }
+
+template<typename Real>
+void DistSparseMehrotraSolver<Real>::Solve
+( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        DirectLPSolution<DistMultiVec<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    const DistSparseMatrix<Real>& A = problem.A;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+
+    // The symbolic analysis can only be reused if neither the sparsity
+    // pattern of A nor the KKT formulation have changed on any process
+    int samePattern =
+      numSolves_ > 0 && ctrl.system == system_ &&
+      m == height_ && n == width_ && Int(sources_.size()) == numLocalEntries;
+    for( Int e=0; e<numLocalEntries && samePattern; ++e )
+        if( sourceBuf[e] != sources_[e] || targetBuf[e] != targets_[e] )
+            samePattern = 0;
+    samePattern = mpi::AllReduce( samePattern, mpi::MIN, A.Grid().Comm() );
+    if( !samePattern )
+    {
+        analysis_.analyzed = false;
+        analysis_.initAnalyzed = false;
+        analysis_.haveMultMeta = false;
+        system_ = ctrl.system;
+        height_ = m;
+        width_ = n;
+        sources_.assign( sourceBuf, sourceBuf+numLocalEntries );
+        targets_.assign( targetBuf, targetBuf+numLocalEntries );
+    }
+
+    MehrotraCtrl<Real> solveCtrl( ctrl );
+    if( warmStart && numSolves_ > 0 &&
+        solution.x.Height() == n && solution.x.Width() == 1 &&
+        solution.y.Height() == m && solution.y.Width() == 1 &&
+        solution.z.Height() == n && solution.z.Width() == 1 )
+    {
+        solveCtrl.primalInit = true;
+        solveCtrl.dualInit = true;
+    }
+    Mehrotra( problem, solution, analysis_, iterations_, solveCtrl );
+    ++numSolves_;
+}
+
+template<typename Real>
+void DistSparseMehrotraSolver<Real>::Reset()
+{
+    EL_DEBUG_CSE
+    analysis_.analyzed = false;
+    analysis_.initAnalyzed = false;
+    analysis_.haveMultMeta = false;
+    analysis_.numAnalyses = 0;
+    sources_.clear();
+    targets_.clear();
+    numSolves_ = 0;
+    iterations_.clear();
+}
+
+template<typename Real>
+Int DistSparseMehrotraSolver<Real>::NumSolves() const
+{ return numSolves_; }
+
+template<typename Real>
+Int DistSparseMehrotraSolver<Real>::NumAnalyses() const
+{ return analysis_.numAnalyses; }
+
+template<typename Real>
+const vector<IPMIterationInfo<Real>>&
+DistSparseMehrotraSolver<Real>::Iterations() const
+{ return iterations_; }
+
+#define PROTO(Real) \
+  template class SparseMehrotraSolver<Real>; \
+  template class DistSparseMehrotraSolver<Real>;
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
@@ -33,6 +33,94 @@ namespace affine {
 // scheme.
 //
 
+// Gondzio's multiple centrality correctors: each corrector solves, using the
+// existing factorization of the KKT system, for a direction which pushes the
+// complementarity products at a trial point (with step lengths increased by
+// 'ctrl.gondzioStepIncrease') into the box
+//
+//   [gondzioMinRatio sigma mu, gondzioMaxRatio sigma mu],
+//
+// and the corrected direction is only accepted if it sufficiently increases
+// the step lengths. The routine 'solveForDirection' should solve against the
+// current contents of the residuals (rb,rc,rh,rmu).
+template<typename Real,class VectorType,class SolveType>
+void GondzioCorrectors
+( const VectorType& s,
+  const VectorType& z,
+        VectorType& rb,
+        VectorType& rc,
+        VectorType& rh,
+        VectorType& rmu,
+        VectorType& dx,
+        VectorType& dy,
+        VectorType& dz,
+        VectorType& ds,
+        VectorType& dxGondzio,
+        VectorType& dyGondzio,
+        VectorType& dzGondzio,
+        VectorType& dsGondzio,
+        Real sigma,
+        Real mu,
+        Real& alphaPri,
+        Real& alphaDual,
+  const MehrotraCtrl<Real>& ctrl,
+  const SolveType& solveForDirection,
+        bool print )
+{
+    EL_DEBUG_CSE
+    const Real lowerBound = ctrl.gondzioMinRatio*sigma*mu;
+    const Real upperBound = ctrl.gondzioMaxRatio*sigma*mu;
+    for( Int corrector=0; corrector<ctrl.maxGondzioCorrectors; ++corrector )
+    {
+        const Real alphaMin = Min(alphaPri,alphaDual);
+        if( alphaMin == Real(1) )
+            break;
+        const Real alphaPriTrial =
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1));
+        const Real alphaDualTrial =
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1));
+
+        // r_mu := v - Proj_{[lowerBound,upperBound]}(v), where v is the
+        // complementarity product at the trial point
+        // ---------------------------------------------------------------
+        pos_orth::CentralityResidual
+        ( s, ds, z, dz, alphaPriTrial, alphaDualTrial,
+          lowerBound, upperBound, rmu );
+        Zero( rb );
+        Zero( rc );
+        Zero( rh );
+        try { solveForDirection( dxGondzio, dyGondzio, dzGondzio, dsGondzio ); }
+        catch(...) { break; }
+        Axpy( Real(1), dx, dxGondzio );
+        Axpy( Real(1), dy, dyGondzio );
+        Axpy( Real(1), dz, dzGondzio );
+        Axpy( Real(1), ds, dsGondzio );
+
+        Real alphaPriNew =
+          pos_orth::MaxStep( s, dsGondzio, 1/ctrl.maxStepRatio );
+        Real alphaDualNew =
+          pos_orth::MaxStep( z, dzGondzio, 1/ctrl.maxStepRatio );
+        alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+        alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPriNew = alphaDualNew = Min(alphaPriNew,alphaDualNew);
+        if( Min(alphaPriNew,alphaDualNew) <
+            alphaMin + ctrl.gondzioAcceptRatio*ctrl.gondzioStepIncrease )
+            break;
+
+        dx = dxGondzio;
+        dy = dyGondzio;
+        dz = dzGondzio;
+        ds = dsGondzio;
+        alphaPri = alphaPriNew;
+        alphaDual = alphaDualNew;
+        if( print )
+            Output
+            ("Gondzio corrector ",corrector,": alphaPri = ",alphaPri,
+             ", alphaDual = ",alphaDual);
+    }
+}
+
 template<typename Real>
 void Mehrotra
 ( const Matrix<Real>& QPre,
@@ -118,6 +206,21 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+    Matrix<Real> dxGondzio, dyGondzio, dzGondzio, dsGondzio;
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( Matrix<Real>& dxDir,
+           Matrix<Real>& dyDir,
+           Matrix<Real>& dzDir,
+           Matrix<Real>& dsDir )
+      {
+          KKTRHS( rc, rb, rh, rmu, z, d );
+          ldl::SolveAfter( J, dSub, p, d, false );
+          ExpandSolution( m, n, d, rmu, s, z, dxDir, dyDir, dzDir, dsDir );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -308,6 +411,12 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( s, z, rb, rc, rh, rmu,
+          dx, dy, dz, ds,
+          dxGondzio, dyGondzio, dzGondzio, dsGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print );
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -467,6 +576,24 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+    DistMatrix<Real> dxGondzio(grid), dyGondzio(grid), dzGondzio(grid),
+      dsGondzio(grid);
+    dsGondzio.AlignWith( s );
+    dzGondzio.AlignWith( s );
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( DistMatrix<Real>& dxDir,
+           DistMatrix<Real>& dyDir,
+           DistMatrix<Real>& dzDir,
+           DistMatrix<Real>& dsDir )
+      {
+          KKTRHS( rc, rb, rh, rmu, z, d );
+          ldl::SolveAfter( J, dSub, p, d, false );
+          ExpandSolution( m, n, d, rmu, s, z, dxDir, dyDir, dzDir, dsDir );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -685,6 +812,12 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( s, z, rb, rc, rh, rmu,
+          dx, dy, dz, ds,
+          dxGondzio, dyGondzio, dzGondzio, dsGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -819,6 +952,29 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+    Matrix<Real> dxGondzio, dyGondzio, dzGondzio, dsGondzio;
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( Matrix<Real>& dxDir,
+           Matrix<Real>& dyDir,
+           Matrix<Real>& dzDir,
+           Matrix<Real>& dsDir )
+      {
+          KKTRHS( rc, rb, rh, rmu, z, d );
+          if( ctrl.resolveReg )
+              reg_ldl::SolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+          else
+              reg_ldl::RegularizedSolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                ctrl.solveCtrl.relTol,
+                ctrl.solveCtrl.maxRefineIts,
+                ctrl.solveCtrl.progress );
+          ExpandSolution( m, n, d, rmu, s, z, dxDir, dyDir, dzDir, dsDir );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1070,6 +1226,12 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( s, z, rb, rc, rh, rmu,
+          dx, dy, dz, ds,
+          dxGondzio, dyGondzio, dzGondzio, dsGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print );
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -1237,6 +1399,30 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid);
+    DistMultiVec<Real> dxGondzio(grid), dyGondzio(grid), dzGondzio(grid),
+      dsGondzio(grid);
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( DistMultiVec<Real>& dxDir,
+           DistMultiVec<Real>& dyDir,
+           DistMultiVec<Real>& dzDir,
+           DistMultiVec<Real>& dsDir )
+      {
+          KKTRHS( rc, rb, rh, rmu, z, d );
+          if( ctrl.resolveReg )
+              reg_ldl::SolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+          else
+              reg_ldl::RegularizedSolveAfter
+              ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                ctrl.solveCtrl.relTol,
+                ctrl.solveCtrl.maxRefineIts,
+                ctrl.solveCtrl.progress );
+          ExpandSolution( m, n, d, rmu, s, z, dxDir, dyDir, dzDir, dsDir );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1515,6 +1701,12 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( s, z, rb, rc, rh, rmu,
+          dx, dy, dz, ds,
+          dxGondzio, dyGondzio, dzGondzio, dsGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -40,18 +40,25 @@ ADMM
     const Int n = Q.Height();
     const Int k = C.Width();
 
-    // Cache the factorization of Q + rho*I
-    Matrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
+    // Cache the factorization of Q + rho*I, which is only recomputed when the
+    // penalty parameter is adapted
+    Real rho = ctrl.rho;
+    Matrix<Real> LMod;
+    auto factor = [&]()
+      {
+          LMod = Q;
+          ShiftDiagonal( LMod, rho );
+          if( ctrl.inv )
+          {
+              HPDInverse( LOWER, LMod );
+          }
+          else
+          {
+              Cholesky( LOWER, LMod );
+              MakeTrapezoidal( LOWER, LMod );
+          }
+      };
+    factor();
 
     // Start the ADMM
     Int numIter=0;
@@ -66,7 +73,7 @@ ADMM
         // x := (Q+rho*I)^{-1} (rho(z-u)-q)
         X = Z;
         X -= U;
-        X *= ctrl.rho;
+        X *= rho;
         X -= C;
         if( ctrl.inv )
         {
@@ -101,12 +108,12 @@ ADMM
         // sNorm := |rho| || z - zOld ||_2
         T = Z;
         T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( T );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(U);
 
         if( ctrl.print )
         {
@@ -129,6 +136,16 @@ ADMM
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            U *= 1/scaling;
+            factor();
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -162,18 +179,25 @@ ADMM
     const Int n = Q.Height();
     const Int k = C.Width();
 
-    // Cache the factorization of Q + rho*I
-    DistMatrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
+    // Cache the factorization of Q + rho*I, which is only recomputed when the
+    // penalty parameter is adapted
+    Real rho = ctrl.rho;
+    DistMatrix<Real> LMod(grid);
+    auto factor = [&]()
+      {
+          LMod = Q;
+          ShiftDiagonal( LMod, rho );
+          if( ctrl.inv )
+          {
+              HPDInverse( LOWER, LMod );
+          }
+          else
+          {
+              Cholesky( LOWER, LMod );
+              MakeTrapezoidal( LOWER, LMod );
+          }
+      };
+    factor();
 
     // Start the ADMM
     Int numIter=0;
@@ -188,7 +212,7 @@ ADMM
         // x := (Q+rho*I)^{-1} (rho(z-u)-q)
         X = Z;
         X -= U;
-        X *= ctrl.rho;
+        X *= rho;
         X -= C;
         if( ctrl.inv )
         {
@@ -223,12 +247,12 @@ ADMM
         // sNorm := |rho| || z - zOld ||_2
         T = Z;
         T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( T );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(U);
 
         if( ctrl.print )
         {
@@ -252,6 +276,16 @@ ADMM
         }
         if( rNorm < epsPri && sNorm < epsDual )
             break;
+
+        // Balance the primal and dual residuals
+        const Real scaling =
+          ADMMPenaltyScaling( rNorm, sNorm, numIter, ctrl.penaltyCtrl );
+        if( scaling != Real(1) )
+        {
+            rho *= scaling;
+            U *= 1/scaling;
+            factor();
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
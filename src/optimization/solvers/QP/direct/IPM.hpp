@@ -53,6 +53,33 @@ void Mehrotra
         DistMultiVec<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// The following variants keep the symbolic analysis of the KKT system in
+// 'analysis' (see SparseMehrotraSolver) and record per-iteration statistics.
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        SparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
+  const MehrotraCtrl<Real>& ctrl );
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+        DistSparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
+  const MehrotraCtrl<Real>& ctrl );
+
 } // namespace direct
 } // namespace qp
 } // namespace El
@@ -32,6 +32,88 @@ namespace direct {
 // using a Mehrotra Predictor-Corrector scheme.
 //
 
+// Gondzio's multiple centrality correctors: each corrector solves, using the
+// existing factorization of the KKT system, for a direction which pushes the
+// complementarity products at a trial point (with step lengths increased by
+// 'ctrl.gondzioStepIncrease') into the box
+//
+//   [gondzioMinRatio sigma mu, gondzioMaxRatio sigma mu],
+//
+// and the corrected direction is only accepted if it sufficiently increases
+// the step lengths. The routine 'solveForDirection' should solve against the
+// current contents of the residuals (rb,rc,rmu).
+template<typename Real,class VectorType,class SolveType>
+void GondzioCorrectors
+( const VectorType& x,
+  const VectorType& z,
+        VectorType& rb,
+        VectorType& rc,
+        VectorType& rmu,
+        VectorType& dx,
+        VectorType& dy,
+        VectorType& dz,
+        VectorType& dxGondzio,
+        VectorType& dyGondzio,
+        VectorType& dzGondzio,
+        Real sigma,
+        Real mu,
+        Real& alphaPri,
+        Real& alphaDual,
+  const MehrotraCtrl<Real>& ctrl,
+  const SolveType& solveForDirection,
+        bool print )
+{
+    EL_DEBUG_CSE
+    const Real lowerBound = ctrl.gondzioMinRatio*sigma*mu;
+    const Real upperBound = ctrl.gondzioMaxRatio*sigma*mu;
+    for( Int corrector=0; corrector<ctrl.maxGondzioCorrectors; ++corrector )
+    {
+        const Real alphaMin = Min(alphaPri,alphaDual);
+        if( alphaMin == Real(1) )
+            break;
+        const Real alphaPriTrial =
+          Min(alphaPri+ctrl.gondzioStepIncrease,Real(1));
+        const Real alphaDualTrial =
+          Min(alphaDual+ctrl.gondzioStepIncrease,Real(1));
+
+        // r_mu := v - Proj_{[lowerBound,upperBound]}(v), where v is the
+        // complementarity product at the trial point
+        // ---------------------------------------------------------------
+        pos_orth::CentralityResidual
+        ( x, dx, z, dz, alphaPriTrial, alphaDualTrial,
+          lowerBound, upperBound, rmu );
+        Zero( rb );
+        Zero( rc );
+        try { solveForDirection( dxGondzio, dyGondzio, dzGondzio ); }
+        catch(...) { break; }
+        Axpy( Real(1), dx, dxGondzio );
+        Axpy( Real(1), dy, dyGondzio );
+        Axpy( Real(1), dz, dzGondzio );
+
+        Real alphaPriNew =
+          pos_orth::MaxStep( x, dxGondzio, 1/ctrl.maxStepRatio );
+        Real alphaDualNew =
+          pos_orth::MaxStep( z, dzGondzio, 1/ctrl.maxStepRatio );
+        alphaPriNew = Min(ctrl.maxStepRatio*alphaPriNew,Real(1));
+        alphaDualNew = Min(ctrl.maxStepRatio*alphaDualNew,Real(1));
+        if( ctrl.forceSameStep )
+            alphaPriNew = alphaDualNew = Min(alphaPriNew,alphaDualNew);
+        if( Min(alphaPriNew,alphaDualNew) <
+            alphaMin + ctrl.gondzioAcceptRatio*ctrl.gondzioStepIncrease )
+            break;
+
+        dx = dxGondzio;
+        dy = dyGondzio;
+        dz = dzGondzio;
+        alphaPri = alphaPriNew;
+        alphaDual = alphaDualNew;
+        if( print )
+            Output
+            ("Gondzio corrector ",corrector,": alphaPri = ",alphaPri,
+             ", alphaDual = ",alphaDual);
+    }
+}
+
 template<typename Real>
 void Mehrotra
 ( const Matrix<Real>& QPre,
@@ -103,6 +185,31 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Matrix<Real> dxGondzio, dyGondzio, dzGondzio;
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( Matrix<Real>& dxDir,
+           Matrix<Real>& dyDir,
+           Matrix<Real>& dzDir )
+      {
+          if( ctrl.system == FULL_KKT )
+          {
+              KKTRHS( rc, rb, rmu, z, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution( m, n, d, dxDir, dyDir, dzDir );
+          }
+          else if( ctrl.system == AUGMENTED_KKT )
+          {
+              AugmentedKKTRHS( x, rc, rb, rmu, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandAugmentedSolution( x, z, rmu, d, dxDir, dyDir, dzDir );
+          }
+          else
+              LogicError("Invalid KKT system choice");
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -349,6 +456,12 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( x, z, rb, rc, rmu,
+          dx, dy, dz,
+          dxGondzio, dyGondzio, dzGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print );
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -480,6 +593,33 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+    DistMatrix<Real> dxGondzio(grid), dyGondzio(grid), dzGondzio(grid);
+    dxGondzio.AlignWith( x );
+    dzGondzio.AlignWith( x );
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( DistMatrix<Real>& dxDir,
+           DistMatrix<Real>& dyDir,
+           DistMatrix<Real>& dzDir )
+      {
+          if( ctrl.system == FULL_KKT )
+          {
+              KKTRHS( rc, rb, rmu, z, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandSolution( m, n, d, dxDir, dyDir, dzDir );
+          }
+          else if( ctrl.system == AUGMENTED_KKT )
+          {
+              AugmentedKKTRHS( x, rc, rb, rmu, d );
+              ldl::SolveAfter( J, dSub, p, d, false );
+              ExpandAugmentedSolution( x, z, rmu, d, dxDir, dyDir, dzDir );
+          }
+          else
+              LogicError("Invalid KKT system choice");
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -728,6 +868,12 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( x, z, rb, rc, rmu,
+          dx, dy, dz,
+          dxGondzio, dyGondzio, dzGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
         Axpy( alphaPri,  dx, x );
@@ -752,6 +898,22 @@ void Mehrotra
     }
 }
 
+// Move the complementarity products of a warm start into [beta mu, mu / beta],
+// where 'mu' is their (floored) average
+template<typename VectorType,typename Real>
+void CenterWarmStart
+( VectorType& x,
+  VectorType& z,
+  Int degree,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.warmStartCentrality <= Real(0) )
+        return;
+    const Real mu = Max( Dot(x,z) / degree, ctrl.warmStartMinBarrier );
+    pos_orth::CenterPair( x, z, mu, ctrl.warmStartCentrality );
+}
+
 template<typename Real>
 void Mehrotra
 ( const SparseMatrix<Real>& QPre,
@@ -761,9 +923,13 @@ void Mehrotra
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
+        SparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    Timer timer, iterTimer;
+    iterations.clear();
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -812,28 +978,31 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    SparseLDLFactorization<Real> sparseLDLFact;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    // TODO(poulson): Add permanent regularization and cache J metadata
-    if( ctrl.system == AUGMENTED_KKT )
+    // TODO(poulson): Add permanent regularization
+    const bool warmStart = ctrl.primalInit && ctrl.dualInit;
+    bool& initAnalyzed =
+      ctrl.system == AUGMENTED_KKT ? analysis.analyzed : analysis.initAnalyzed;
+    SparseLDLFactorization<Real>& initLDLFact =
+      ctrl.system == AUGMENTED_KKT ?
+      analysis.factorization : analysis.initFactorization;
+    Initialize
+    ( Q, A, b, c, x, y, z,
+      initLDLFact,
+      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+      ctrl.solveCtrl, initAnalyzed );
+    if( warmStart )
     {
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        CenterWarmStart( x, z, degree, ctrl );
     }
-    else
+    else if( !initAnalyzed )
     {
-        SparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        initAnalyzed = true;
+        ++analysis.numAnalyses;
     }
+    SparseLDLFactorization<Real>& sparseLDLFact = analysis.factorization;
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -867,9 +1036,54 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+    Matrix<Real> dxGondzio, dyGondzio, dzGondzio;
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( Matrix<Real>& dxDir,
+           Matrix<Real>& dyDir,
+           Matrix<Real>& dzDir )
+      {
+          if( ctrl.system == FULL_KKT )
+          {
+              KKTRHS( rc, rb, rmu, z, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                    ctrl.solveCtrl.relTol,
+                    ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              ExpandSolution( m, n, d, dxDir, dyDir, dzDir );
+          }
+          else if( ctrl.system == AUGMENTED_KKT )
+          {
+              AugmentedKKTRHS( x, rc, rb, rmu, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                    ctrl.solveCtrl.relTol,
+                    ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              ExpandAugmentedSolution( x, z, rmu, d, dxDir, dyDir, dzDir );
+          }
+          else
+              LogicError("Invalid KKT system choice");
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        iterTimer.Start();
+        iterations.emplace_back();
+        IPMIterationInfo<Real>& info = iterations.back();
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -916,6 +1130,8 @@ void Mehrotra
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
+        info.barrier = mu;
+        info.relError = relError;
         if( ctrl.print )
         {
             const Real xNrm2 = Nrm2( x );
@@ -953,6 +1169,7 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            timer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -969,11 +1186,13 @@ void Mehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
+            info.formTime = timer.Stop();
 
             // Solve for the direction
             // -----------------------
             try
             {
+                timer.Start();
                 if( wMaxNorm >= ctrl.ruizEquilTol )
                     SymmetricRuizEquil
                     ( J, dInner, ctrl.ruizMaxIter, ctrl.print );
@@ -981,21 +1200,28 @@ void Mehrotra
                     SymmetricDiagonalEquil( J, dInner, ctrl.print );
                 else
                     Ones( dInner, J.Height(), 1 );
+                info.formTime += timer.Stop();
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit) ) )
+                if( !analysis.analyzed )
                 {
+                    timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    info.analysisTime = timer.Stop();
+                    analysis.analyzed = true;
+                    ++analysis.numAnalyses;
                 }
                 else
                 {
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
+                timer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = timer.Stop();
+
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1005,6 +1231,7 @@ void Mehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1099,6 +1326,7 @@ void Mehrotra
             // -----------------------
             try
             {
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1108,6 +1336,7 @@ void Mehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1128,6 +1357,7 @@ void Mehrotra
             // -----------------------
             try
             {
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1137,6 +1367,7 @@ void Mehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                info.solveTime += timer.Stop();
             }
             catch(...)
             {
@@ -1160,8 +1391,16 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( x, z, rb, rc, rmu,
+          dx, dy, dz,
+          dxGondzio, dyGondzio, dzGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print );
         if( ctrl.print )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        info.primalStep = alphaPri;
+        info.dualStep = alphaDual;
         Axpy( alphaPri,  dx, x );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
@@ -1173,7 +1412,12 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        info.totalTime = iterTimer.Stop();
     }
+    // The loop is exited via 'break' with the timer of the last iteration
+    // still running
+    if( !iterations.empty() )
+        iterations.back().totalTime = iterTimer.Partial();
     SetIndent( indent );
 
     if( ctrl.outerEquil )
@@ -1184,6 +1428,23 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseKKTAnalysis<Real> analysis;
+    vector<IPMIterationInfo<Real>> iterations;
+    Mehrotra( Q, A, b, c, x, y, z, analysis, iterations, ctrl );
+}
+
 template<typename Real>
 void Mehrotra
 ( const DistSparseMatrix<Real>& QPre,
@@ -1193,12 +1454,15 @@ void Mehrotra
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
+        DistSparseKKTAnalysis<Real>& analysis,
+        vector<IPMIterationInfo<Real>>& iterations,
   const MehrotraCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
-    Timer timer;
+    Timer timer, iterTimer;
+    iterations.clear();
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -1258,32 +1522,35 @@ void Mehrotra
         }
     }
 
-    DistSparseLDLFactorization<Real> sparseLDLFact;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    // TODO(poulson): Add permanent regularization and cache J metadata
+    // TODO(poulson): Add permanent regularization
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    const bool warmStart = ctrl.primalInit && ctrl.dualInit;
+    bool& initAnalyzed =
+      ctrl.system == AUGMENTED_KKT ? analysis.analyzed : analysis.initAnalyzed;
+    DistSparseLDLFactorization<Real>& initLDLFact =
+      ctrl.system == AUGMENTED_KKT ?
+      analysis.factorization : analysis.initFactorization;
+    Initialize
+    ( Q, A, b, c, x, y, z,
+      initLDLFact,
+      ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
+      ctrl.solveCtrl, initAnalyzed );
+    if( warmStart )
     {
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          sparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        CenterWarmStart( x, z, degree, ctrl );
     }
-    else
+    else if( !initAnalyzed )
     {
-        DistSparseLDLFactorization<Real> augmentedSparseLDLFact;
-        Initialize
-        ( Q, A, b, c, x, y, z,
-          augmentedSparseLDLFact,
-          ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
-          ctrl.solveCtrl );
+        initAnalyzed = true;
+        ++analysis.numAnalyses;
     }
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
+    DistSparseLDLFactorization<Real>& sparseLDLFact = analysis.factorization;
 
     DistMultiVec<Real> regTmp(grid);
     if( ctrl.system == FULL_KKT )
@@ -1312,7 +1579,6 @@ void Mehrotra
     }
     regTmp *= origTwoNormEst;
 
-    DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid),
                        rc(grid),    rb(grid),    rmu(grid),
@@ -1322,9 +1588,54 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
+    DistMultiVec<Real> dxGondzio(grid), dyGondzio(grid), dzGondzio(grid);
+
+    // Solve for a direction using the existing factorization of the KKT
+    // system and the current residuals (throwing upon failure)
+    auto solveForDirection =
+      [&]( DistMultiVec<Real>& dxDir,
+           DistMultiVec<Real>& dyDir,
+           DistMultiVec<Real>& dzDir )
+      {
+          if( ctrl.system == FULL_KKT )
+          {
+              KKTRHS( rc, rb, rmu, z, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                    ctrl.solveCtrl.relTol,
+                    ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              ExpandSolution( m, n, d, dxDir, dyDir, dzDir );
+          }
+          else if( ctrl.system == AUGMENTED_KKT )
+          {
+              AugmentedKKTRHS( x, rc, rb, rmu, d );
+              if( ctrl.resolveReg )
+                  reg_ldl::SolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
+              else
+                  reg_ldl::RegularizedSolveAfter
+                  ( JOrig, regTmp, dInner, sparseLDLFact, d,
+                    ctrl.solveCtrl.relTol,
+                    ctrl.solveCtrl.maxRefineIts,
+                    ctrl.solveCtrl.progress );
+              ExpandAugmentedSolution( x, z, rmu, d, dxDir, dyDir, dzDir );
+          }
+          else
+              LogicError("Invalid KKT system choice");
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        iterTimer.Start();
+        iterations.emplace_back();
+        IPMIterationInfo<Real>& info = iterations.back();
+
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -1369,6 +1680,8 @@ void Mehrotra
         // Now check the pieces
         // --------------------
         relError = Max(Max(objConv,rbConv),rcConv);
+        info.barrier = mu;
+        info.relError = relError;
         if( ctrl.print )
         {
             const Real xNrm2 = Nrm2( x );
@@ -1407,6 +1720,7 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            timer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -1422,29 +1736,30 @@ void Mehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
+            if( !analysis.haveMultMeta )
             {
-                if( ctrl.print )
-                {
-                    const double imbalanceJ = J.Imbalance();
-                    if( commRank == 0 )
-                        Output("Imbalance factor of J: ",imbalanceJ);
-                }
-                metaOrig = JOrig.InitializeMultMeta();
-                meta = J.InitializeMultMeta();
+                analysis.multMetaOrig = JOrig.InitializeMultMeta();
+                analysis.multMeta = J.InitializeMultMeta();
+                analysis.haveMultMeta = true;
             }
             else
             {
-                JOrig.LockedDistGraph().multMeta = metaOrig;
-                J.LockedDistGraph().multMeta = meta;
+                JOrig.LockedDistGraph().multMeta = analysis.multMetaOrig;
+                J.LockedDistGraph().multMeta = analysis.multMeta;
+            }
+            info.formTime = timer.Stop();
+            if( numIts == 0 && ctrl.print )
+            {
+                const double imbalanceJ = J.Imbalance();
+                if( commRank == 0 )
+                    Output("Imbalance factor of J: ",imbalanceJ);
             }
 
             // Solve for the direction
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( wMaxNorm >= ctrl.ruizEquilTol )
                     SymmetricRuizEquil
                     ( J, dInner, ctrl.ruizMaxIter, ctrl.print );
@@ -1452,32 +1767,33 @@ void Mehrotra
                     SymmetricDiagonalEquil( J, dInner, ctrl.print );
                 else
                     Ones( dInner, J.Height(), 1 );
+                const double equilTime = timer.Stop();
+                info.formTime += equilTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Equilibration: ",timer.Stop()," secs");
+                    Output("Equilibration: ",equilTime," secs");
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
-                     (ctrl.primalInit && ctrl.dualInit)) )
+                if( !analysis.analyzed )
                 {
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
+                    timer.Start();
                     const bool hermitian = true;
                     const BisectCtrl bisectCtrl;
                     sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    info.analysisTime = timer.Stop();
+                    analysis.analyzed = true;
+                    ++analysis.numAnalyses;
                     if( commRank == 0 && ctrl.time )
-                        Output("Analysis: ",timer.Stop()," secs");
+                        Output("Analysis: ",info.analysisTime," secs");
                 }
                 else
                     sparseLDLFact.ChangeNonzeroValues( J );
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = timer.Stop();
                 if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                    Output("LDL: ",info.factorTime," secs");
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1487,8 +1803,10 @@ void Mehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                const double affineTime = timer.Stop();
+                info.solveTime += affineTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                    Output("Affine: ",affineTime," secs");
             }
             catch(...)
             {
@@ -1584,8 +1902,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1595,8 +1912,10 @@ void Mehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                const double correctorTime = timer.Stop();
+                info.solveTime += correctorTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                    Output("Corrector: ",correctorTime," secs");
             }
             catch(...)
             {
@@ -1617,8 +1936,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                timer.Start();
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
@@ -1628,8 +1946,10 @@ void Mehrotra
                       ctrl.solveCtrl.relTol,
                       ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
+                const double correctorTime = timer.Stop();
+                info.solveTime += correctorTime;
                 if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                    Output("Corrector: ",correctorTime," secs");
             }
             catch(...)
             {
@@ -1653,8 +1973,16 @@ void Mehrotra
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
             alphaPri = alphaDual = Min(alphaPri,alphaDual);
+        GondzioCorrectors
+        ( x, z, rb, rc, rmu,
+          dx, dy, dz,
+          dxGondzio, dyGondzio, dzGondzio,
+          sigma, mu, alphaPri, alphaDual, ctrl, solveForDirection,
+          ctrl.print && commRank == 0 );
         if( ctrl.print && commRank == 0 )
             Output("alphaPri = ",alphaPri,", alphaDual = ",alphaDual);
+        info.primalStep = alphaPri;
+        info.dualStep = alphaDual;
         Axpy( alphaPri,  dx, x );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
@@ -1666,7 +1994,12 @@ void Mehrotra
                 RuntimeError
                 ("Could not achieve minimum tolerance of ",ctrl.minTol);
         }
+        info.totalTime = iterTimer.Stop();
     }
+    // The loop is exited via 'break' with the timer of the last iteration
+    // still running
+    if( !iterations.empty() )
+        iterations.back().totalTime = iterTimer.Partial();
     SetIndent( indent );
 
     if( ctrl.outerEquil )
@@ -1677,6 +2010,23 @@ void Mehrotra
     }
 }
 
+template<typename Real>
+void Mehrotra
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const MehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseKKTAnalysis<Real> analysis;
+    vector<IPMIterationInfo<Real>> iterations;
+    Mehrotra( Q, A, b, c, x, y, z, analysis, iterations, ctrl );
+}
+
 #define PROTO(Real) \
   template void Mehrotra \
   ( const Matrix<Real>& Q, \
@@ -1706,6 +2056,26 @@ void Mehrotra
           Matrix<Real>& z, \
     const MehrotraCtrl<Real>& ctrl ); \
   template void Mehrotra \
+  ( const SparseMatrix<Real>& Q, \
+    const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+    const Matrix<Real>& c, \
+          Matrix<Real>& x, \
+          Matrix<Real>& y, \
+          Matrix<Real>& z, \
+          SparseKKTAnalysis<Real>& analysis, \
+          vector<IPMIterationInfo<Real>>& iterations, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
+  ( const DistSparseMatrix<Real>& Q, \
+    const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+    const DistMultiVec<Real>& c, \
+          DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const MehrotraCtrl<Real>& ctrl ); \
+  template void Mehrotra \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
     const DistMultiVec<Real>& b, \
@@ -1713,6 +2083,8 @@ void Mehrotra
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
+          DistSparseKKTAnalysis<Real>& analysis, \
+          vector<IPMIterationInfo<Real>>& iterations, \
     const MehrotraCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
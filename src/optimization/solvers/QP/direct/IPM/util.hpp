@@ -45,7 +45,8 @@ void Initialize
         Matrix<Real>& z,
         SparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
 template<typename Real>
 void Initialize
 ( const DistSparseMatrix<Real>& Q,
@@ -57,7 +58,8 @@ void Initialize
         DistMultiVec<Real>& z,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl );
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis=false );
 
 // Full system
 // ===========
@@ -185,7 +185,7 @@ void AugmentedKKT
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
         const Int i = J.GlobalRow(iLoc);
-        if( i > n )
+        if( i >= n )
             ++numEntries;
     }
 
@@ -224,7 +224,7 @@ void AugmentedKKT
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
         const Int i = J.GlobalRow(iLoc);
-        if( i > n )
+        if( i >= n )
             J.QueueUpdate( i, i, -delta*delta );
     }
 
@@ -297,7 +297,8 @@ void Initialize
         Matrix<Real>& z,
         SparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -346,9 +347,16 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    if( reuseAnalysis )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+    }
+    else
+    {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    }
     sparseLDLFact.Factor( LDL_2D );
 
     // Compute the proposed step from the KKT system
@@ -437,7 +445,8 @@ void Initialize
         DistMultiVec<Real>& z,
         DistSparseLDLFactorization<Real>& sparseLDLFact,
   bool primalInit, bool dualInit, bool standardShift,
-  const RegSolveCtrl<Real>& solveCtrl )
+  const RegSolveCtrl<Real>& solveCtrl,
+  bool reuseAnalysis )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -488,9 +497,16 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    const bool hermitian = true;
-    const BisectCtrl bisectCtrl;
-    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    if( reuseAnalysis )
+    {
+        sparseLDLFact.ChangeNonzeroValues( J );
+    }
+    else
+    {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+    }
     sparseLDLFact.Factor( LDL_2D );
 
     // Compute the proposed step from the KKT system
@@ -597,7 +613,8 @@ void Initialize
           Matrix<Real>& z, \
           SparseLDLFactorization<Real>& sparseLDLFact, \
     bool primalInit, bool dualInit, bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl ); \
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis ); \
   template void Initialize \
   ( const DistSparseMatrix<Real>& Q, \
     const DistSparseMatrix<Real>& A, \
@@ -608,7 +625,8 @@ void Initialize
           DistMultiVec<Real>& z, \
           DistSparseLDLFactorization<Real>& sparseLDLFact, \
     bool primalInit, bool dualInit, bool standardShift, \
-    const RegSolveCtrl<Real>& solveCtrl );
+    const RegSolveCtrl<Real>& solveCtrl, \
+    bool reuseAnalysis );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./IPM.hpp"
+
+namespace El {
+namespace qp {
+namespace direct {
+
+// Return whether the (local) sparsity pattern described by the given source
+// and target buffers matches the stored pattern, and, if not, overwrite the
+// stored pattern
+bool UpdatePattern
+( Int numEntries,
+  const Int* sourceBuf,
+  const Int* targetBuf,
+  vector<Int>& sources,
+  vector<Int>& targets )
+{
+    bool samePattern = Int(sources.size()) == numEntries;
+    for( Int e=0; e<numEntries && samePattern; ++e )
+        if( sourceBuf[e] != sources[e] || targetBuf[e] != targets[e] )
+            samePattern = false;
+    if( !samePattern )
+    {
+        sources.assign( sourceBuf, sourceBuf+numEntries );
+        targets.assign( targetBuf, targetBuf+numEntries );
+    }
+    return samePattern;
+}
+
+template<typename Real>
+SparseMehrotraSolver<Real>::SparseMehrotraSolver()
+{ ctrl.system = AUGMENTED_KKT; }
+
+template<typename Real>
+SparseMehrotraSolver<Real>::SparseMehrotraSolver
+( const MehrotraCtrl<Real>& ctrlIn )
+: ctrl(ctrlIn)
+{ }
+
+template<typename Real>
+void SparseMehrotraSolver<Real>::Solve
+( const SparseMatrix<Real>& Q,
+  const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // The symbolic analysis can only be reused if neither the sparsity
+    // patterns of Q and A nor the KKT formulation have changed
+    const bool sameQPattern =
+      UpdatePattern
+      ( Q.NumEntries(), Q.LockedSourceBuffer(), Q.LockedTargetBuffer(),
+        QSources_, QTargets_ );
+    const bool sameAPattern =
+      UpdatePattern
+      ( A.NumEntries(), A.LockedSourceBuffer(), A.LockedTargetBuffer(),
+        ASources_, ATargets_ );
+    const bool samePattern =
+      numSolves_ > 0 && ctrl.system == system_ &&
+      m == height_ && n == width_ && sameQPattern && sameAPattern;
+    if( !samePattern )
+    {
+        analysis_.analyzed = false;
+        analysis_.initAnalyzed = false;
+        system_ = ctrl.system;
+        height_ = m;
+        width_ = n;
+    }
+
+    MehrotraCtrl<Real> solveCtrl( ctrl );
+    if( warmStart && numSolves_ > 0 &&
+        x.Height() == n && x.Width() == 1 &&
+        y.Height() == m && y.Width() == 1 &&
+        z.Height() == n && z.Width() == 1 )
+    {
+        solveCtrl.primalInit = true;
+        solveCtrl.dualInit = true;
+    }
+    Mehrotra( Q, A, b, c, x, y, z, analysis_, iterations_, solveCtrl );
+    ++numSolves_;
+}
+
+template<typename Real>
+void SparseMehrotraSolver<Real>::Reset()
+{
+    EL_DEBUG_CSE
+    analysis_.analyzed = false;
+    analysis_.initAnalyzed = false;
+    analysis_.numAnalyses = 0;
+    QSources_.clear();
+    QTargets_.clear();
+    ASources_.clear();
+    ATargets_.clear();
+    numSolves_ = 0;
+    iterations_.clear();
+}
+
+template<typename Real>
+Int SparseMehrotraSolver<Real>::NumSolves() const
+{ return numSolves_; }
+
+template<typename Real>
+Int SparseMehrotraSolver<Real>::NumAnalyses() const
+{ return analysis_.numAnalyses; }
+
+template<typename Real>
+const vector<IPMIterationInfo<Real>>&
+SparseMehrotraSolver<Real>::Iterations() const
+{ return iterations_; }
+
+template<typename Real>
+DistSparseMehrotraSolver<Real>::DistSparseMehrotraSolver()
+{ ctrl.system = AUGMENTED_KKT; }
+
+template<typename Real>
+DistSparseMehrotraSolver<Real>::DistSparseMehrotraSolver
+( const MehrotraCtrl<Real>& ctrlIn )
+: ctrl(ctrlIn)
+{ }
+
+template<typename Real>
+void DistSparseMehrotraSolver<Real>::Solve
+( const DistSparseMatrix<Real>& Q,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+  const DistMultiVec<Real>& c,
+        DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // The symbolic analysis can only be reused if neither the sparsity
+    // patterns of Q and A nor the KKT formulation have changed on any process
+    const bool sameQPattern =
+      UpdatePattern
+      ( Q.NumLocalEntries(), Q.LockedSourceBuffer(), Q.LockedTargetBuffer(),
+        QSources_, QTargets_ );
+    const bool sameAPattern =
+      UpdatePattern
+      ( A.NumLocalEntries(), A.LockedSourceBuffer(), A.LockedTargetBuffer(),
+        ASources_, ATargets_ );
+    int samePattern =
+      numSolves_ > 0 && ctrl.system == system_ &&
+      m == height_ && n == width_ && sameQPattern && sameAPattern;
+    samePattern = mpi::AllReduce( samePattern, mpi::MIN, A.Grid().Comm() );
+    if( !samePattern )
+    {
+        analysis_.analyzed = false;
+        analysis_.initAnalyzed = false;
+        analysis_.haveMultMeta = false;
+        system_ = ctrl.system;
+        height_ = m;
+        width_ = n;
+    }
+
+    MehrotraCtrl<Real> solveCtrl( ctrl );
+    if( warmStart && numSolves_ > 0 &&
+        x.Height() == n && x.Width() == 1 &&
+        y.Height() == m && y.Width() == 1 &&
+        z.Height() == n && z.Width() == 1 )
+    {
+        solveCtrl.primalInit = true;
+        solveCtrl.dualInit = true;
+    }
+    Mehrotra( Q, A, b, c, x, y, z, analysis_, iterations_, solveCtrl );
+    ++numSolves_;
+}
+
+template<typename Real>
+void DistSparseMehrotraSolver<Real>::Reset()
+{
+    EL_DEBUG_CSE
+    analysis_.analyzed = false;
+    analysis_.initAnalyzed = false;
+    analysis_.haveMultMeta = false;
+    analysis_.numAnalyses = 0;
+    QSources_.clear();
+    QTargets_.clear();
+    ASources_.clear();
+    ATargets_.clear();
+    numSolves_ = 0;
+    iterations_.clear();
+}
+
+template<typename Real>
+Int DistSparseMehrotraSolver<Real>::NumSolves() const
+{ return numSolves_; }
+
+template<typename Real>
+Int DistSparseMehrotraSolver<Real>::NumAnalyses() const
+{ return analysis_.numAnalyses; }
+
+template<typename Real>
+const vector<IPMIterationInfo<Real>>&
+DistSparseMehrotraSolver<Real>::Iterations() const
+{ return iterations_; }
+
+#define PROTO(Real) \
+  template class SparseMehrotraSolver<Real>; \
+  template class DistSparseMehrotraSolver<Real>;
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace qp
+} // namespace El
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CenterPair
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real mu,
+  Real beta )
+{
+    EL_DEBUG_CSE
+    const Real lowerProd = beta*mu;
+    const Real upperProd = mu/beta;
+    const Real lowerSqrt = Sqrt(lowerProd);
+    const Real upperSqrt = Sqrt(upperProd);
+    const Int height = s.Height();
+    for( Int i=0; i<height; ++i )
+    {
+        Real& si = s(i);
+        Real& zi = z(i);
+        si = Max(si,Real(0));
+        zi = Max(zi,Real(0));
+        const Real prod = si*zi;
+        if( prod < lowerProd )
+        {
+            if( si >= lowerSqrt && si >= zi )
+                zi = lowerProd / si;
+            else if( zi >= lowerSqrt )
+                si = lowerProd / zi;
+            else
+                si = zi = lowerSqrt;
+        }
+        else if( prod > upperProd )
+        {
+            if( si <= upperSqrt && si <= zi )
+                zi = upperProd / si;
+            else if( zi <= upperSqrt )
+                si = upperProd / zi;
+            else
+                si = zi = upperSqrt;
+        }
+    }
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CenterPair
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real mu,
+  Real beta )
+{
+    EL_DEBUG_CSE
+    CenterPair( s.Matrix(), z.Matrix(), mu, beta );
+}
+
+#define PROTO(Real) \
+  template void CenterPair \
+  ( Matrix<Real>& s, \
+    Matrix<Real>& z, \
+    Real mu, \
+    Real beta ); \
+  template void CenterPair \
+  ( DistMultiVec<Real>& s, \
+    DistMultiVec<Real>& z, \
+    Real mu, \
+    Real beta );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
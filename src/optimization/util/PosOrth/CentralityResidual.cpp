@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+namespace {
+
+template<typename Real>
+void CentralityResidualKernel
+( Int localHeight,
+  const Real* sBuf,
+  const Real* dsBuf,
+  const Real* zBuf,
+  const Real* dzBuf,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        Real* rBuf )
+{
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Real product =
+          (sBuf[iLoc]+alphaPri*dsBuf[iLoc])*(zBuf[iLoc]+alphaDual*dzBuf[iLoc]);
+        Real residual = 0;
+        if( product < lowerBound )
+            residual = product - lowerBound;
+        else if( product > upperBound )
+            residual = Min(product-upperBound,upperBound);
+        rBuf[iLoc] = residual;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityResidual
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        Matrix<Real>& r )
+{
+    EL_DEBUG_CSE
+    const Int height = s.Height();
+    r.Resize( height, 1 );
+    CentralityResidualKernel
+    ( height,
+      s.LockedBuffer(), ds.LockedBuffer(), z.LockedBuffer(), dz.LockedBuffer(),
+      alphaPri, alphaDual, lowerBound, upperBound, r.Buffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityResidual
+( const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& dsPre,
+  const AbstractDistMatrix<Real>& zPre,
+  const AbstractDistMatrix<Real>& dzPre,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        AbstractDistMatrix<Real>& rPre )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( sPre, dsPre, zPre, dzPre, rPre );
+    rPre.Resize( sPre.Height(), 1 );
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,VC,STAR>
+      rProx( rPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& r = rProx.Get();
+
+    CentralityResidualKernel
+    ( s.LocalHeight(),
+      s.LockedBuffer(), ds.LockedBuffer(), z.LockedBuffer(), dz.LockedBuffer(),
+      alphaPri, alphaDual, lowerBound, upperBound, r.Buffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityResidual
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+  Real alphaPri,
+  Real alphaDual,
+  Real lowerBound,
+  Real upperBound,
+        DistMultiVec<Real>& r )
+{
+    EL_DEBUG_CSE
+    r.Resize( s.Height(), 1 );
+    CentralityResidualKernel
+    ( s.LocalHeight(),
+      s.LockedMatrix().LockedBuffer(),
+      ds.LockedMatrix().LockedBuffer(),
+      z.LockedMatrix().LockedBuffer(),
+      dz.LockedMatrix().LockedBuffer(),
+      alphaPri, alphaDual, lowerBound, upperBound, r.Matrix().Buffer() );
+}
+
+#define PROTO(Real) \
+  template void CentralityResidual \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real lowerBound, \
+    Real upperBound, \
+          Matrix<Real>& r ); \
+  template void CentralityResidual \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& ds, \
+    const AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real lowerBound, \
+    Real upperBound, \
+          AbstractDistMatrix<Real>& r ); \
+  template void CentralityResidual \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+    Real alphaPri, \
+    Real alphaDual, \
+    Real lowerBound, \
+    Real upperBound, \
+          DistMultiVec<Real>& r );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
@@ -0,0 +1,223 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The BLAS-like routines for types without a vendor BLAS switch from their
+// unblocked algorithms to blocked ones above 64 x 64 triangles. Compare both
+// regimes against straightforward triple loops.
+
+template<typename T>
+void NaiveGemm
+( T alpha, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
+{
+    const Int m = A.Height();
+    const Int n = B.Width();
+    const Int k = A.Width();
+    Zeros( C, m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+                gamma += A(i,l)*B(l,j);
+            C(i,j) = alpha*gamma;
+        }
+}
+
+template<typename T>
+void ApplyOrientation
+( Orientation orientation, const Matrix<T>& A, Matrix<T>& AOp )
+{
+    if( orientation == NORMAL )
+        AOp = A;
+    else
+        Transpose( A, AOp, orientation == ADJOINT );
+}
+
+// A well-conditioned triangular matrix along with its explicit form
+template<typename T>
+void TriangularMatrix
+( UpperOrLower uplo, UnitOrNonUnit diag, Int n,
+  Matrix<T>& A, Matrix<T>& S )
+{
+    typedef Base<T> Real;
+    Uniform( A, n, n, T(0), Real(1)/Real(n) );
+    ShiftDiagonal( A, T(2) );
+    S = A;
+    MakeTrapezoidal( uplo, S );
+    if( diag == UNIT )
+        FillDiagonal( S, T(1) );
+}
+
+template<typename T>
+void CheckError
+( const string& name, Base<T> error, Base<T> scale, Int n )
+{
+    typedef Base<T> Real;
+    const Real relError = error / scale;
+    const Real tol = Real(10)*Real(n)*limits::Epsilon<Real>();
+    if( relError > tol )
+        LogicError
+        (name," had a relative error of ",relError," > ",tol," with ",
+         TypeName<T>());
+}
+
+template<typename T>
+void TestTriangular( Int n, Int k )
+{
+    typedef Base<T> Real;
+    const T alpha = T(3)/T(2);
+    Int numTests = 0;
+    for( auto side : {LEFT,RIGHT} )
+    for( auto uplo : {LOWER,UPPER} )
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    for( auto diag : {NON_UNIT,UNIT} )
+    {
+        const string suffix =
+          string(1,LeftOrRightToChar(side)) +
+          string(1,UpperOrLowerToChar(uplo)) +
+          string(1,OrientationToChar(orientation)) +
+          string(1,UnitOrNonUnitToChar(diag));
+        Matrix<T> A, S, SOp, B, X, Y, E;
+        TriangularMatrix( uplo, diag, n, A, S );
+        ApplyOrientation( orientation, S, SOp );
+        if( side == LEFT )
+            Uniform( B, n, k );
+        else
+            Uniform( B, k, n );
+        const Real SFrob = FrobeniusNorm( S );
+
+        // Compare X := alpha op(S) B (or alpha B op(S)) with Trmm
+        X = B;
+        Trmm( side, uplo, orientation, diag, alpha, A, X );
+        if( side == LEFT )
+            NaiveGemm( alpha, SOp, B, Y );
+        else
+            NaiveGemm( alpha, B, SOp, Y );
+        E = X;
+        E -= Y;
+        CheckError<T>
+        ("Trmm"+suffix, FrobeniusNorm(E), SFrob*FrobeniusNorm(B), n );
+
+        // Check that alpha op(S) X (or alpha X op(S)) recovers B after
+        // X := inv(op(S)) B (or B inv(op(S))) with Trsm
+        X = B;
+        Trsm( side, uplo, orientation, diag, T(1)/alpha, A, X );
+        if( side == LEFT )
+            NaiveGemm( alpha, SOp, X, Y );
+        else
+            NaiveGemm( alpha, X, SOp, Y );
+        E = Y;
+        E -= B;
+        CheckError<T>
+        ("Trsm"+suffix, FrobeniusNorm(E), SFrob*FrobeniusNorm(X), n );
+        numTests += 2;
+    }
+    Output(numTests," Trmm/Trsm variants passed for n=",n);
+}
+
+template<typename T>
+void TestRankK( Int n, Int k )
+{
+    const T alpha = T(3)/T(2);
+    const T beta = T(-1)/T(2);
+    for( auto uplo : {LOWER,UPPER} )
+    for( const bool conjugate : {false,true} )
+    for( const bool normal : {true,false} )
+    {
+        const Orientation orientation =
+          ( normal ? NORMAL : (conjugate ? ADJOINT : TRANSPOSE) );
+        const string name =
+          string(conjugate ? "Herk" : "Syrk") +
+          string(1,UpperOrLowerToChar(uplo)) +
+          string(1,OrientationToChar(orientation));
+        Matrix<T> A, AOp, AAdj, C, COrig, Y, E;
+        if( orientation == NORMAL )
+            Uniform( A, n, k );
+        else
+            Uniform( A, k, n );
+        Uniform( COrig, n, n );
+        if( conjugate )
+            MakeHermitian( uplo, COrig );
+        ApplyOrientation( orientation, A, AOp );
+        Transpose( AOp, AAdj, conjugate );
+
+        // Only the referenced triangle of C may be modified
+        C = COrig;
+        Syrk( uplo, orientation, alpha, A, beta, C, conjugate );
+        NaiveGemm( alpha, AOp, AAdj, Y );
+        Axpy( beta, COrig, Y );
+        MakeTrapezoidal( uplo, Y );
+        auto opposite = ( uplo == LOWER ? UPPER : LOWER );
+        const Int offset = ( uplo == LOWER ? 1 : -1 );
+        AxpyTrapezoid( opposite, T(1), COrig, Y, offset );
+        E = C;
+        E -= Y;
+        CheckError<T>
+        (name, FrobeniusNorm(E),
+         FrobeniusNorm(A)*FrobeniusNorm(A)+FrobeniusNorm(COrig), n );
+    }
+    Output("Syrk/Herk variants passed for n=",n);
+}
+
+template<typename T>
+void TestType( Int nSmall, Int nLarge, Int k )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    for( const Int n : {nSmall,nLarge} )
+    {
+        TestTriangular<T>( n, k );
+        TestRankK<T>( n, k );
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nSmall =
+          Input("--nSmall","size below the blocking crossover",40);
+        const Int nLarge =
+          Input("--nLarge","size above the blocking crossover",150);
+        const Int k = Input("--k","number of right-hand sides or rank",30);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            bool tested = false;
+#ifdef EL_HAVE_QD
+            TestType<DoubleDouble>( nSmall, nLarge, k );
+            TestType<QuadDouble>( nSmall, nLarge, k );
+            TestType<Complex<DoubleDouble>>( nSmall, nLarge, k );
+            tested = true;
+#endif
+#ifdef EL_HAVE_QUAD
+            TestType<Quad>( nSmall, nLarge, k );
+            TestType<Complex<Quad>>( nSmall, nLarge, k );
+            tested = true;
+#endif
+#ifdef EL_HAVE_MPC
+            TestType<BigFloat>( nSmall, nLarge, k );
+            tested = true;
+#endif
+            if( !tested )
+                Output("No extended-precision types are available");
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -85,6 +85,11 @@ void TestGemm
 
     Timer timer;
 
+    const GemmAlgorithm defaultAlg =
+      SelectGemmAlgorithm<T>( orientA, orientB, m, n, k, g );
+    OutputFromRoot
+    (g.Comm(),"GEMM_DEFAULT selects algorithm ",Int(defaultAlg));
+
     // Test the variant of Gemm that keeps A stationary
     C = COrig;
     OutputFromRoot(g.Comm(),"Stationary A algorithm:");
@@ -164,6 +169,27 @@ void TestGemm
             TestAssociativity
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
+
+        // Test the communication-avoiding variant which splits the
+        // summation dimension over layers of processes
+        OutputFromRoot(g.Comm(),"2.5D Algorithm:");
+        PushIndent();
+        C = COrig;
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( NORMAL, NORMAL, alpha, A, B, beta, C, GEMM_SUMMA_25D );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
     }
     PopIndent();
 }
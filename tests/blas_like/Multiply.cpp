@@ -41,8 +41,162 @@ void TestMultiply(Int m, Int n=1)
         Output("|| A B - G B ||_F = ",DFrob);
         RuntimeError("Sparse(I)*x != Graph(I)*x");
     }
-    else
-        Output("Test passed");
+
+    Zeros( D, m, n );
+    Multiply( TRANSPOSE, T(1), G, B, T(0), D );
+    Axpy( T(-1), C, D );
+    DFrob = FrobeniusNorm(D);
+    if( DFrob > limits::Epsilon<Real>() )
+    {
+        Output("|| A B - G^T B ||_F = ",DFrob);
+        RuntimeError("Sparse(I)*x != Graph(I)^T*x");
+    }
+    Output("Test passed");
+}
+
+#if defined(EL_HAVE_MKL) && \
+    (!defined(EL_USE_64BIT_INTS) || defined(EL_USE_64BIT_BLAS_INTS))
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void TimeMKLMultiply
+( Orientation orientation, const SparseMatrix<T>& A, const Matrix<T>& X,
+  Matrix<T>& Y, Int numRepeats )
+{
+    char matDescrA[6];
+    matDescrA[0] = 'G';
+    matDescrA[3] = 'C';
+    const Int* offsets = A.LockedOffsetBuffer();
+    Timer timer;
+    timer.Start();
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+        for( Int j=0; j<X.Width(); ++j )
+            mkl::csrmv
+            ( orientation, A.Height(), A.Width(), T(1), matDescrA,
+              A.LockedValueBuffer(), A.LockedTargetBuffer(),
+              offsets, offsets+1,
+              X.LockedBuffer(0,j), T(0), Y.Buffer(0,j) );
+    Output("  MKL csrmv: ",timer.Stop()/numRepeats," [sec]");
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void TimeMKLMultiply
+( Orientation orientation, const SparseMatrix<T>& A, const Matrix<T>& X,
+  Matrix<T>& Y, Int numRepeats )
+{ }
+#else
+template<typename T>
+void TimeMKLMultiply
+( Orientation orientation, const SparseMatrix<T>& A, const Matrix<T>& X,
+  Matrix<T>& Y, Int numRepeats )
+{ }
+#endif
+
+template<typename T>
+void BenchmarkMultiply( Int n, Int width, Int numRepeats )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    Output("Benchmarking with ",TypeName<T>()," and width ",width);
+    PushIndent();
+
+    SparseMatrix<T> A;
+    Laplacian( A, n, n );
+    const Int N = A.Height();
+    Matrix<T> X, Y, YTrans;
+    Gaussian( X, N, width );
+    Zeros( Y, N, width );
+    Zeros( YTrans, N, width );
+
+    Timer timer;
+    for( auto orientation : {NORMAL,TRANSPOSE} )
+    {
+        Matrix<T>& Z = ( orientation == NORMAL ? Y : YTrans );
+        timer.Start();
+        for( Int repeat=0; repeat<numRepeats; ++repeat )
+            Multiply( orientation, T(1), A, X, T(0), Z );
+        const double runTime = timer.Stop() / numRepeats;
+        const double gFlops = 2.*A.NumEntries()*width / (1.e9*runTime);
+        Output
+        (orientation==NORMAL ? "NORMAL: " : "TRANSPOSE: ",
+         runTime," [sec], ",gFlops," [GFlop/s]");
+        TimeMKLMultiply( orientation, A, X, Z, numRepeats );
+    }
+
+    // The Laplacian is symmetric
+    YTrans -= Y;
+    const Real relError = FrobeniusNorm(YTrans) / FrobeniusNorm(Y);
+    if( relError > 10*limits::Epsilon<Real>() )
+    {
+        Output("|| A X - A^T X ||_F / || A X ||_F = ",relError);
+        RuntimeError("Transposed sparse multiply was incorrect");
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestDistMultiply( Int n, Int width )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Grid& grid = Grid::Default();
+    OutputFromRoot(grid.Comm(),"Testing plans with ",TypeName<T>());
+
+    DistSparseMatrix<T> A(grid);
+    Laplacian( A, n, n );
+    const Int N = A.Height();
+    DistSparseMultPlan<T> plan;
+
+    DistMultiVec<T> X(grid), Y(grid), YPlan(grid);
+    Gaussian( X, N, width );
+    for( auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        // Apply the plan several times to ensure that its buffers are reusable
+        for( Int repeat=0; repeat<3; ++repeat )
+        {
+            Gaussian( Y, N, width );
+            YPlan = Y;
+            Multiply( orientation, T(2), A, X, T(-1), Y );
+            Multiply( orientation, T(2), A, X, T(-1), YPlan, plan );
+            YPlan -= Y;
+            const Real relError = FrobeniusNorm(YPlan) / FrobeniusNorm(Y);
+            if( relError > 10*limits::Epsilon<Real>() )
+            {
+                OutputFromRoot
+                (grid.Comm(),"|| Y - YPlan ||_F / || Y ||_F = ",relError);
+                RuntimeError("Planned multiply did not match");
+            }
+        }
+    }
+
+    // Rebuild A with the same number of entries in a different pattern. The
+    // plan must notice the change even after an unplanned multiply has
+    // reinitialized the metadata of A.
+    auto fillCirculant = [&]( Int shift )
+    {
+        Zeros( A, N, N );
+        const Int localHeight = A.LocalHeight();
+        A.Reserve( 3*localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            for( Int k=0; k<3; ++k )
+                A.QueueLocalUpdate( iLoc, Mod(i+k*shift,N), T(k+1) );
+        }
+        A.ProcessLocalQueues();
+    };
+    fillCirculant( 1 );
+    Multiply( NORMAL, T(1), A, X, T(0), YPlan, plan );
+    fillCirculant( 7 );
+    Multiply( NORMAL, T(1), A, X, T(0), Y );
+    Multiply( NORMAL, T(1), A, X, T(0), YPlan, plan );
+    YPlan -= Y;
+    const Real relError = FrobeniusNorm(YPlan) / FrobeniusNorm(Y);
+    if( relError > 10*limits::Epsilon<Real>() )
+    {
+        OutputFromRoot
+        (grid.Comm(),"|| Y - YPlan ||_F / || Y ||_F = ",relError);
+        RuntimeError("Planned multiply did not detect the new pattern");
+    }
+    OutputFromRoot(grid.Comm(),"Test passed");
 }
 
 void RunTests( Int m )
@@ -74,6 +228,13 @@ int main( int argc, char* argv[] )
     Environment env( argc, argv );
     try
     {
+        const Int benchmarkSize =
+          Input("--benchmarkSize","grid dimension for SpMV benchmark",200);
+        const Int numRepeats =
+          Input("--numRepeats","number of SpMV benchmark repeats",10);
+        ProcessInput();
+        PrintInputReport();
+
         Int m = 1;
         for( Int e=1; e<4; ++e )
         {    
@@ -81,6 +242,27 @@ int main( int argc, char* argv[] )
             Output("Testing with matrix height of ",m);
             RunTests(m);
         }
+
+        PushIndent();
+        for( Int width : {1,3} )
+        {
+            TestDistMultiply<float>( 20, width );
+            TestDistMultiply<Complex<float>>( 20, width );
+            TestDistMultiply<double>( 20, width );
+            TestDistMultiply<Complex<double>>( 20, width );
+        }
+        PopIndent();
+
+        if( mpi::Rank() == 0 )
+        {
+            for( Int width : {1,4} )
+            {
+                BenchmarkMultiply<float>( benchmarkSize, width, numRepeats );
+                BenchmarkMultiply<double>( benchmarkSize, width, numRepeats );
+                BenchmarkMultiply<Complex<double>>
+                ( benchmarkSize, width, numRepeats );
+            }
+        }
     }
     catch( exception& e ) { ReportException(e); }
     return 0;
@@ -157,6 +157,95 @@ void CheckAll( Int m, Int n, const Grid& grid, bool print )
     }
 }
 
+// Every process which takes part in the stream queues 'numReps' updates of
+// each entry, so that the result should be numReps*p(i+j) whether or not
+// duplicates are combined
+template<typename T,Dist U,Dist V>
+void CheckStreamingUpdates
+( Int m, Int n, const Grid& grid, const RemoteUpdateCtrl& ctrl, Int numReps,
+  bool print )
+{
+    mpi::Comm comm = grid.ViewingComm();
+    OutputFromRoot
+    (comm,
+     "Testing streamed updates of [",DistToString(U),",",DistToString(V),"]",
+     " in chunks of ",ctrl.chunkSize,
+     (ctrl.combineDuplicates ? " with combining" : ""),
+     (ctrl.includeViewers ? "" : " without viewers"));
+    DistMatrix<T,U,V> A(grid);
+    Zeros( A, m, n );
+
+    A.BeginStreamingUpdates( ctrl );
+    for( Int rep=0; rep<numReps; ++rep )
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                A.QueueUpdate( i, j, T(i+j) );
+    A.ProcessQueues();
+
+    const Int numContributors =
+      ( ctrl.includeViewers ? mpi::Size(comm) : grid.Size() );
+    Int myErrorFlag = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( A.GetLocal(iLoc,jLoc) != T(numReps*numContributors*(i+j)) )
+                myErrorFlag = 1;
+        }
+    }
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, mpi::SUM, comm );
+    if( summedErrorFlag == 0 )
+    {
+        OutputFromRoot(comm,"PASSED");
+    }
+    else
+    {
+        OutputFromRoot(comm,"FAILED");
+        if( print )
+            Print( A, "A" );
+        LogicError("Streamed update test failed");
+    }
+}
+
+// Redistribute between element-wise and block distributions, which goes
+// through the general-purpose redistribution, several times so that the
+// cached plans are reused
+template<typename T,Dist U,Dist V>
+void CheckRedistPlans( Int m, Int n, const Grid& grid, bool print )
+{
+    OutputFromRoot
+    (grid.Comm(),
+     "Testing cached redistributions to [",DistToString(U),",",
+     DistToString(V),",BLOCK]");
+    DistMatrix<T> A(grid), C(grid);
+    DistMatrix<T,U,V,BLOCK> B(grid,3,2);
+    Int myErrorFlag = 0;
+    for( Int rep=0; rep<3; ++rep )
+    {
+        Uniform( A, m, n );
+        Copy( A, B );
+        Copy( B, C );
+        C -= A;
+        if( MaxNorm(C) != Base<T>(0) )
+            myErrorFlag = 1;
+    }
+    if( myErrorFlag == 0 )
+    {
+        OutputFromRoot(grid.Comm(),"PASSED");
+    }
+    else
+    {
+        OutputFromRoot(grid.Comm(),"FAILED");
+        if( print )
+            Print( A, "A" );
+        if( print )
+            Print( B, "B" );
+        LogicError("Cached redistribution test failed");
+    }
+}
+
 template<typename T>
 void
 DistMatrixTest( Int m, Int n, const Grid& grid, bool print )
@@ -177,6 +266,55 @@ DistMatrixTest( Int m, Int n, const Grid& grid, bool print )
     CheckAll<T,STAR,VR  >( m, n, grid, print );
     CheckAll<T,VC,  STAR>( m, n, grid, print );
     CheckAll<T,VR,  STAR>( m, n, grid, print );
+
+    RemoteUpdateCtrl ctrl;
+    ctrl.chunkSize = 7;
+    ctrl.maxBuffered = 4*ctrl.chunkSize;
+    ctrl.combineDuplicates = false;
+    CheckStreamingUpdates<T,MC,  MR  >( m, n, grid, ctrl, 2, print );
+    ctrl.combineDuplicates = true;
+    CheckStreamingUpdates<T,MC,  MR  >( m, n, grid, ctrl, 2, print );
+    CheckStreamingUpdates<T,STAR,STAR>( m, n, grid, ctrl, 2, print );
+
+    // Send many full chunks to each destination before ProcessQueues, with
+    // chunks which are too large to be sent eagerly
+    ctrl.chunkSize = 1000;
+    ctrl.maxBuffered = 8*m*n;
+    ctrl.combineDuplicates = false;
+    CheckStreamingUpdates<T,MC,  MR  >( m, n, grid, ctrl, 8, print );
+    CheckStreamingUpdates<T,STAR,STAR>( m, n, grid, ctrl, 8, print );
+
+    // Stream over a grid which excludes the last process
+    const int commSize = grid.Size();
+    if( commSize > 1 )
+    {
+        mpi::Group group, subGroup;
+        mpi::CommGroup( grid.Comm(), group );
+        vector<int> subRanks(commSize-1);
+        for( int q=0; q<commSize-1; ++q )
+            subRanks[q] = q;
+        mpi::Incl( group, subRanks.size(), subRanks.data(), subGroup );
+        mpi::Free( group );
+        const Grid subGrid
+        ( grid.Comm(), subGroup, Grid::DefaultHeight(commSize-1) );
+        ctrl.chunkSize = 7;
+        ctrl.maxBuffered = 4*ctrl.chunkSize;
+        ctrl.includeViewers = false;
+        CheckStreamingUpdates<T,MC,MR>( m, n, subGrid, ctrl, 2, print );
+        ctrl.includeViewers = true;
+        CheckStreamingUpdates<T,MC,MR>( m, n, subGrid, ctrl, 2, print );
+    }
+
+    CheckRedistPlans<T,MC,  MR  >( m, n, grid, print );
+    CheckRedistPlans<T,VC,  STAR>( m, n, grid, print );
+    CheckRedistPlans<T,STAR,VR  >( m, n, grid, print );
+    CheckRedistPlans<T,STAR,STAR>( m, n, grid, print );
+
+    // A byte limit below the size of a single plan disables the reuse
+    const Int maxPlanBytes = RedistPlanCacheBytes();
+    SetRedistPlanCacheBytes( 1 );
+    CheckRedistPlans<T,MC,  MR  >( m, n, grid, print );
+    SetRedistPlanCacheBytes( maxPlanBytes );
 }
 
 int
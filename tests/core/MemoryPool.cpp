@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T> 
+void TestMemoryPool( Int m, Int n, Int numRepeats )
+{
+    Output("Testing with ",TypeName<T>());
+
+    EmptyMemoryPool();
+    ResetMemoryPoolHighWaterMark();
+    const MemoryPoolStats initialStats = GetMemoryPoolStats();
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+    {
+        Matrix<T> A( m, n );
+        if( size_t(A.Buffer()) % 64 != 0 )
+            LogicError("Matrix buffer was not 64-byte aligned");
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                A.Set( i, j, T(i+j*m) );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( A.Get(i,j) != T(i+j*m) )
+                    LogicError("Pooled buffer was corrupted");
+    }
+    const MemoryPoolStats stats = GetMemoryPoolStats();
+    if( stats.numBytesInUse != initialStats.numBytesInUse )
+        LogicError("Pool leaked ",stats.numBytesInUse," bytes");
+    if( stats.highWaterMark < m*n*sizeof(T) )
+        LogicError("High-water mark was too small");
+    if( stats.numCacheHits-initialStats.numCacheHits <
+        Unsigned(numRepeats-1) )
+        LogicError("Released buffers were not reused");
+
+    Output("passed");
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try 
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numRepeats = Input("--numRepeats","number of repeats",10);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMemoryPool<float>( m, n, numRepeats );
+            TestMemoryPool<Complex<float>>( m, n, numRepeats );
+
+            TestMemoryPool<double>( m, n, numRepeats );
+            TestMemoryPool<Complex<double>>( m, n, numRepeats );
+
+#ifdef EL_HAVE_QD
+            TestMemoryPool<DoubleDouble>( m, n, numRepeats );
+            TestMemoryPool<QuadDouble>( m, n, numRepeats );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestMemoryPool<Quad>( m, n, numRepeats );
+            TestMemoryPool<Complex<Quad>>( m, n, numRepeats );
+#endif
+
+#ifdef EL_HAVE_MPC
+            TestMemoryPool<BigInt>( m, n, numRepeats );
+            TestMemoryPool<BigFloat>( m, n, numRepeats );
+            TestMemoryPool<Complex<BigFloat>>( m, n, numRepeats );
+#endif
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
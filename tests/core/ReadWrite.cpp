@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Fill A with values which are exactly representable in the six significant
+// digits that the Matrix Market writer uses
+template<typename T>
+void FillExactly( AbstractDistMatrix<T>& A )
+{
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            A.SetLocal( iLoc, jLoc, T(i-2*j)/T(4) );
+        }
+    }
+}
+
+// Write A, read it back into B, and check that the two agree exactly
+template<typename T>
+void TestRoundTrip
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  FileFormat format, const string& basename )
+{
+    mpi::Comm comm = A.Grid().Comm();
+    OutputFromRoot
+    (comm,"Testing ",FileExtension(format)," files from ",
+     (A.Wrap() == ELEMENT ? "ELEMENT" : "BLOCK"),
+     " [",DistToString(A.ColDist()),",",DistToString(A.RowDist()),"] to ",
+     (B.Wrap() == ELEMENT ? "ELEMENT" : "BLOCK"),
+     " [",DistToString(B.ColDist()),",",DistToString(B.RowDist()),"]");
+    Write( A, basename, format );
+    const string filename = basename + "." + FileExtension(format);
+    Read( B, filename, format );
+    mpi::Barrier( comm );
+    if( mpi::Rank(comm) == 0 )
+        std::remove( filename.c_str() );
+
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        LogicError
+        ("Read a ",B.Height()," x ",B.Width()," matrix but wrote a ",
+         A.Height()," x ",A.Width()," matrix");
+    DistMatrix<T> diff(A.Grid()), ACopy(A.Grid());
+    Copy( B, diff );
+    Copy( A, ACopy );
+    diff -= ACopy;
+    if( FrobeniusNorm(diff) != Base<T>(0) )
+        LogicError("The matrix read back differed from the one written");
+}
+
+template<typename T>
+void TestDense( Int m, Int n, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing dense round trips with ",TypeName<T>());
+    PushIndent();
+    const string basename = "ReadWrite-test";
+    DistMatrix<T> A(grid);
+    DistMatrix<T,VC,STAR> A_VC_STAR(grid);
+    DistMatrix<T,MC,MR,BLOCK> ABlock(grid,3,2);
+    A.Resize( m, n );
+    A_VC_STAR.Resize( m, n );
+    ABlock.Resize( m, n );
+    FillExactly( A );
+    FillExactly( A_VC_STAR );
+    FillExactly( ABlock );
+
+    for( auto format : {BINARY,MATRIX_MARKET} )
+    {
+        DistMatrix<T> B(grid);
+        DistMatrix<T,MR,MC> B_MR_MC(grid);
+        DistMatrix<T,MC,MR,BLOCK> BBlock(grid,2,3);
+        TestRoundTrip( A, B, format, basename );
+        TestRoundTrip( A_VC_STAR, BBlock, format, basename );
+        TestRoundTrip( ABlock, B_MR_MC, format, basename );
+        TestRoundTrip( ABlock, BBlock, format, basename );
+    }
+    PopIndent();
+}
+
+// Read a coordinate-format file in parallel and compare it with the
+// tridiagonal matrix it describes
+void TestSparse( Int n, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing parallel sparse Matrix Market reads");
+    PushIndent();
+    const string filename = "ReadWrite-test.mtx";
+    const string badFilename = "ReadWrite-test-bad.mtx";
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        file << "%%MatrixMarket matrix coordinate real general\n"
+             << "% A tridiagonal matrix\n"
+             << n << " " << n << " " << 3*n-2 << "\n";
+        for( Int i=0; i<n; ++i )
+        {
+            file << i+1 << " " << i+1 << " " << i+1 << "\n";
+            if( i > 0 )
+                file << i+1 << " " << i << " -0.5\n";
+            if( i < n-1 )
+                file << i+1 << " " << i+2 << " -0.25\n";
+        }
+
+        // Corrupt the last line so that only the last process fails to parse
+        std::ofstream badFile( badFilename.c_str() );
+        badFile << "%%MatrixMarket matrix coordinate real general\n"
+                << n << " " << n << " " << n << "\n";
+        for( Int i=0; i<n-1; ++i )
+            badFile << i+1 << " " << i+1 << " 1\n";
+        badFile << n << " x 1\n";
+    }
+    mpi::Barrier( comm );
+
+    DistSparseMatrix<double> A(grid), AExpected(grid);
+    Read( A, filename, MATRIX_MARKET );
+    Zeros( AExpected, n, n );
+    const Int localHeight = AExpected.LocalHeight();
+    AExpected.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = AExpected.GlobalRow(iLoc);
+        AExpected.QueueLocalUpdate( iLoc, i, double(i+1) );
+        if( i > 0 )
+            AExpected.QueueLocalUpdate( iLoc, i-1, -0.5 );
+        if( i < n-1 )
+            AExpected.QueueLocalUpdate( iLoc, i+1, -0.25 );
+    }
+    AExpected.ProcessLocalQueues();
+    Axpy( -1., AExpected, A );
+    if( FrobeniusNorm(A) != 0. )
+        LogicError("The parallel sparse read was incorrect");
+
+    // Every process should report the parse error rather than wait on the
+    // processes which found it
+    Int caught = 0;
+    try { Read( A, badFilename, MATRIX_MARKET ); }
+    catch( std::exception& ) { caught = 1; }
+    const Int numCaught = mpi::AllReduce( caught, mpi::SUM, comm );
+    if( numCaught != mpi::Size(comm) )
+        LogicError
+        ("Only ",numCaught," of ",mpi::Size(comm)," processes threw");
+
+    mpi::Barrier( comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::remove( filename.c_str() );
+        std::remove( badFilename.c_str() );
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",23);
+        const Int n = Input("--n","width of matrix",17);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestDense<double>( m, n, grid );
+        TestDense<Complex<float>>( m, n, grid );
+        TestSparse( m, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -99,12 +99,32 @@ void TestCorrectness
 ( const DistMatrix<F>& A,
   const DistMatrix<F,STAR,STAR>& householderScalarsP,
   const DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  const BandReflectors<F>* bandReflectorsP,
+  const BandReflectors<F>* bandReflectorsQ,
         DistMatrix<F>& AOrig,
   bool print,
   bool display )
 {
     typedef Base<F> Real;
     const Grid& g = A.Grid();
+    auto applyQ =
+      [&]( LeftOrRight side, Orientation orientation, DistMatrix<F>& B )
+      {
+        if( bandReflectorsQ == nullptr )
+            bidiag::ApplyQ( side, orientation, A, householderScalarsQ, B );
+        else
+            bidiag::ApplyQ
+            ( side, orientation, A, householderScalarsQ, *bandReflectorsQ, B );
+      };
+    auto applyP =
+      [&]( LeftOrRight side, Orientation orientation, DistMatrix<F>& B )
+      {
+        if( bandReflectorsP == nullptr )
+            bidiag::ApplyP( side, orientation, A, householderScalarsP, B );
+        else
+            bidiag::ApplyP
+            ( side, orientation, A, householderScalarsP, *bandReflectorsP, B );
+      };
     const Int m = AOrig.Height();
     const Int n = AOrig.Width();
     const Real eps = limits::Epsilon<Real>();
@@ -132,8 +152,8 @@ void TestCorrectness
         DistMatrix<F> Q(g), P(g);
         Identity( Q, m, m );
         Identity( P, n, n );
-        bidiag::ApplyQ( LEFT,  NORMAL, A, householderScalarsQ, Q );
-        bidiag::ApplyP( RIGHT, NORMAL, A, householderScalarsP, P );
+        applyQ( LEFT, NORMAL, Q );
+        applyP( RIGHT, NORMAL, P );
         if( print )
         {
             Print( Q, "Q" );
@@ -147,8 +167,8 @@ void TestCorrectness
     }
 
     // Reverse the accumulated Householder transforms
-    bidiag::ApplyQ( LEFT,  ADJOINT, A, householderScalarsQ, AOrig );
-    bidiag::ApplyP( RIGHT, NORMAL,  A, householderScalarsP, AOrig );
+    applyQ( LEFT, ADJOINT, AOrig );
+    applyP( RIGHT, NORMAL, AOrig );
     if( print )
         Print( AOrig, "Manual bidiagonal" );
     if( display )
@@ -233,6 +253,7 @@ void TestBidiag
 ( const Grid& g,
   Int m,
   Int n,
+  const BidiagCtrl& ctrl,
   bool correctness,
   bool print,
   bool display )
@@ -254,7 +275,14 @@ void TestBidiag
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    BandReflectors<F> bandReflectorsP, bandReflectorsQ;
+    const bool twoStage = ( ctrl.approach == BIDIAG_TWO_STAGE );
+    if( twoStage )
+        bidiag::TwoStage
+        ( A, householderScalarsP, householderScalarsQ,
+          bandReflectorsP, bandReflectorsQ, ctrl );
+    else
+        Bidiag( A, householderScalarsP, householderScalarsQ );
     mpi::Barrier( g.Comm() );
     // TODO: Flop calculation
     OutputFromRoot(g.Comm(),"Time = ",timer.Stop()," seconds.");
@@ -272,7 +300,10 @@ void TestBidiag
     }
     if( correctness )
         TestCorrectness
-        ( A, householderScalarsP, householderScalarsQ, AOrig, print, display );
+        ( A, householderScalarsP, householderScalarsQ,
+          twoStage ? &bandReflectorsP : nullptr,
+          twoStage ? &bandReflectorsQ : nullptr,
+          AOrig, print, display );
     PopIndent();
 }
 
@@ -289,6 +320,10 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool twoStage =
+          Input("--twoStage","use the two-stage reduction?",false);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for default)",0);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -311,6 +346,10 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
+        BidiagCtrl ctrl;
+        ctrl.approach = ( twoStage ? BIDIAG_TWO_STAGE : BIDIAG_ONE_STAGE );
+        ctrl.bandwidth = bandwidth;
+
         if( sequential && mpi::Rank() == 0 )
         {
             TestBidiag<float>
@@ -350,38 +389,38 @@ main( int argc, char* argv[] )
         }
 
         TestBidiag<float>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<Complex<float>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
 
         TestBidiag<double>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<Complex<double>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
 
 #ifdef EL_HAVE_QD
         TestBidiag<DoubleDouble>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<QuadDouble>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<Complex<DoubleDouble>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<Complex<QuadDouble>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestBidiag<Quad>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<Complex<Quad>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestBidiag<BigFloat>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
         TestBidiag<Complex<BigFloat>>
-        ( g, m, n, correctness, print, display );
+        ( g, m, n, ctrl, correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -202,6 +202,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int lookAhead =
+          Input("--lookAhead","look-ahead depth (0 for none)",0);
         const bool pivot = Input("--pivot","use pivoting?",false);
         const bool correctness = Input
             ("--correctness","test correctness?",true);
@@ -229,6 +231,7 @@ main( int argc, char* argv[] )
         const Grid g( comm, gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
+        SetLookAheadDepth( lookAhead );
 
         ComplainIfDebug();
 
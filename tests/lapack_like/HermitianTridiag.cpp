@@ -90,12 +90,24 @@ void TestCorrectness
 ( UpperOrLower uplo,
   const DistMatrix<Field>& A,
   const DistMatrix<Field,STAR,STAR>& householderScalars,
+  const BandReflectors<Field>* bandReflectors,
         DistMatrix<Field>& AOrig,
   bool print,
   bool display )
 {
     typedef Base<Field> Real;
     const Grid& grid = A.Grid();
+    auto applyQ =
+      [&]( LeftOrRight side, Orientation orientation, DistMatrix<Field>& B )
+      {
+        if( bandReflectors == nullptr )
+            herm_tridiag::ApplyQ
+            ( side, uplo, orientation, A, householderScalars, B );
+        else
+            herm_tridiag::ApplyQ
+            ( side, uplo, orientation, A, householderScalars,
+              *bandReflectors, B );
+      };
     const Int m = AOrig.Height();
     const Real eps = limits::Epsilon<Real>();
     const Real oneNormA = HermitianOneNorm( uplo, AOrig );
@@ -121,8 +133,8 @@ void TestCorrectness
         Display( B, "Tridiagonal" );
 
     // Reverse the accumulated Householder transforms, ignoring symmetry
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    applyQ( LEFT, NORMAL, B );
+    applyQ( RIGHT, ADJOINT, B );
     if( print )
         Print( B, "Rotated tridiagonal" );
     if( display )
@@ -143,13 +155,13 @@ void TestCorrectness
 
     // Compute || I - Q Q^H ||
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    applyQ( RIGHT, ADJOINT, B );
     DistMatrix<Field> QHAdj( grid );
     Adjoint( B, QHAdj );
     MakeIdentity( B );
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, B );
+    applyQ( LEFT, NORMAL, B );
     QHAdj -= B;
-    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, householderScalars, B );
+    applyQ( RIGHT, ADJOINT, B );
     ShiftDiagonal( B, Field(-1) );
     const Real infOrthogError = InfinityNorm( B );
     const Real relOrthogError = infOrthogError / (eps*m);
@@ -219,7 +231,13 @@ void InnerTestHermitianTridiag
     OutputFromRoot(grid.Comm(),"Starting tridiagonalization...");
     mpi::Barrier( grid.Comm() );
     timer.Start();
-    HermitianTridiag( uplo, A, householderScalars, ctrl );
+    BandReflectors<Field> bandReflectors;
+    const bool twoStage = ( ctrl.approach == HERMITIAN_TRIDIAG_TWO_STAGE );
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bandReflectors, ctrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -238,7 +256,9 @@ void InnerTestHermitianTridiag
         ( householderScalars, "householderScalars after HermitianTridiag" );
     }
     if( correctness )
-        TestCorrectness( uplo, A, householderScalars, AOrig, print, display );
+        TestCorrectness
+        ( uplo, A, householderScalars,
+          twoStage ? &bandReflectors : nullptr, AOrig, print, display );
     A = ACopy;
 }
 
@@ -277,6 +297,7 @@ void TestHermitianTridiag
   Int m,
   Int nbLocal,
   bool avoidTrmv,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -289,6 +310,7 @@ void TestHermitianTridiag
     HermitianTridiagCtrl<Field> ctrl;
     ctrl.symvCtrl.bsize = nbLocal;
     ctrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
+    ctrl.bandwidth = bandwidth;
 
     Wigner( A, m );
     if( correctness )
@@ -314,6 +336,11 @@ void TestHermitianTridiag
     ctrl.order = COLUMN_MAJOR;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
+
+    OutputFromRoot(grid.Comm(),"Two-stage algorithm:");
+    ctrl.approach = HERMITIAN_TRIDIAG_TWO_STAGE;
+    InnerTestHermitianTridiag
+    ( uplo, A, householderScalars, ctrl, correctness, print, display );
     PopIndent();
 }
 
@@ -333,6 +360,8 @@ main( int argc, char* argv[] )
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv local Symv",true);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for default)",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -411,48 +440,59 @@ main( int argc, char* argv[] )
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, avoidTrmv, bandwidth,
+              correctness, print, display );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
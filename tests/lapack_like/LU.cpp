@@ -260,6 +260,8 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int lookAhead =
+          Input("--lookAhead","look-ahead depth (0 for none)",0);
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
@@ -284,6 +286,7 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
+        SetLookAheadDepth( lookAhead );
         ComplainIfDebug();
         if( pivot == 0 )
             OutputFromRoot(grid.Comm(),"Testing LU with no pivoting");
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field,class MatrixType>
+void CheckResidual
+( const MatrixType& A, const MatrixType& B, const MatrixType& X,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl, mpi::Comm comm )
+{
+    typedef Base<Field> Real;
+    MatrixType R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real relError = MaxNorm( R ) / MaxNorm( B );
+    OutputFromRoot(comm,"|| B - A X ||_max / || B ||_max = ",relError);
+    if( relError > Real(10)*ctrl.relTol )
+        LogicError("Relative residual was unacceptably large");
+}
+
+template<typename Field>
+void TestSequential( Int n, Int numRHS, bool useFGMRES, bool print )
+{
+    Output("Testing sequential with ",TypeName<Field>());
+    PushIndent();
+    MixedPrecisionCtrl<Base<Field>> ctrl;
+    ctrl.useFGMRES = useFGMRES;
+    ctrl.fallback = false;
+
+    Matrix<Field> A, B, X;
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(n) );
+    Uniform( B, n, numRHS );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+    X = B;
+    Timer timer;
+    timer.Start();
+    const Int numIts = MixedPrecisionLinearSolve( A, X, ctrl );
+    Output("LU: ",numIts," iterations in ",timer.Stop()," seconds");
+    if( print )
+        Print( X, "X" );
+    CheckResidual<Field>( A, B, X, ctrl, mpi::COMM_SELF );
+
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    X = B;
+    timer.Start();
+    const Int numHPDIts = MixedPrecisionHPDSolve( LOWER, A, X, ctrl );
+    Output("Cholesky: ",numHPDIts," iterations in ",timer.Stop()," seconds");
+    CheckResidual<Field>( A, B, X, ctrl, mpi::COMM_SELF );
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed( const Grid& g, Int n, Int numRHS, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing distributed with ",TypeName<Field>());
+    PushIndent();
+    MixedPrecisionCtrl<Base<Field>> ctrl;
+    ctrl.fallback = false;
+
+    DistMatrix<Field> A(g), B(g), X(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(n) );
+    Uniform( B, n, numRHS );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+    X = B;
+    Timer timer;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    const Int numIts = MixedPrecisionLinearSolve( A, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),"LU: ",numIts," iterations in ",timer.Stop()," seconds");
+    if( print )
+        Print( X, "X" );
+    CheckResidual<Field>( A, B, X, ctrl, g.Comm() );
+
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    X = B;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    const Int numHPDIts = MixedPrecisionHPDSolve( LOWER, A, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot
+    (g.Comm(),"Cholesky: ",numHPDIts," iterations in ",timer.Stop(),
+     " seconds");
+    CheckResidual<Field>( A, B, X, ctrl, g.Comm() );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",200);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool useFGMRES =
+          Input("--useFGMRES","use FGMRES for the sequential tests?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            TestSequential<double>( n, numRHS, useFGMRES, print );
+            TestSequential<Complex<double>>( n, numRHS, useFGMRES, print );
+#ifdef EL_HAVE_QD
+            TestSequential<DoubleDouble>( n, numRHS, useFGMRES, print );
+#endif
+        }
+
+        const Grid g( comm );
+        TestDistributed<double>( g, n, numRHS, print );
+        TestDistributed<Complex<double>>( g, n, numRHS, print );
+#ifdef EL_HAVE_QD
+        TestDistributed<DoubleDouble>( g, n, numRHS, print );
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
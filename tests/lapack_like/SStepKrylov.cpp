@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSStepKrylov
+( Int n1,
+  Int n2,
+  Int numRHS,
+  Int s,
+  Int numBlocks,
+  bool progress,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    // Form the (Hermitian positive-definite) 2D Helmholtz operator with a
+    // shift of -1, i.e., the negative of the Laplacian plus the identity,
+    // whose eigenvalues lie in (1,2 diagValue-1)
+    const Int n = n1*n2;
+    DistSparseMatrix<Field> A(grid);
+    Helmholtz( A, n1, n2, Field(-1) );
+    const Real diagValue =
+      2*Real(n1+1)*Real(n1+1) + 2*Real(n2+1)*Real(n2+1) + 1;
+
+    DistMultiVec<Field> B(grid), X(grid), R(grid);
+    Uniform( B, n, numRHS );
+    const Real BNorm = FrobeniusNorm( B );
+
+    DistSparseMultPlan<Field> multPlan;
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& Z,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, Z, beta, Y, multPlan );
+      };
+    // Use Jacobi preconditioning
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+          W *= Real(1)/diagValue;
+      };
+
+    SStepCtrl<Real> ctrl;
+    ctrl.s = s;
+    ctrl.numBlocks = numBlocks;
+    ctrl.maxIts = 10*n;
+    ctrl.progress = progress;
+
+    auto checkResidual =
+      [&]( const string& name, Int numIts, const SStepInfo& info,
+           double seconds )
+      {
+          R = B;
+          Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+          const Real relResid = FrobeniusNorm( R ) / BNorm;
+          OutputFromRoot
+          (comm,name,": ",numIts," iterations (",info.numBlockSteps,
+           " matrix-powers kernels and ",info.numArnoldiSteps,
+           " Arnoldi steps) in ",seconds," seconds, "
+           "|| B - A X ||_F / || B ||_F = ",relResid);
+          if( relResid > Real(10)*ctrl.relTol )
+              LogicError(name," residual was unacceptably large");
+          if( info.numBlockSteps == 0 )
+              LogicError(name," never ran a matrix-powers kernel");
+      };
+
+    Timer timer;
+    X = B;
+    mpi::Barrier( comm );
+    timer.Start();
+    SStepInfo GMRESInfo;
+    const Int numGMRESIts = SStepGMRES( applyA, precond, X, ctrl, GMRESInfo );
+    mpi::Barrier( comm );
+    checkResidual( "s-step GMRES", numGMRESIts, GMRESInfo, timer.Stop() );
+
+    X = B;
+    mpi::Barrier( comm );
+    timer.Start();
+    SStepInfo CGInfo;
+    const Int numCGIts = SStepCG( applyA, precond, X, ctrl, CGInfo );
+    mpi::Barrier( comm );
+    checkResidual( "s-step CG", numCGIts, CGInfo, timer.Stop() );
+
+    // The Ritz values must lie within the spectrum of A
+    DistMatrix<Real,STAR,STAR> T(grid);
+    DistMatrix<Real,STAR,STAR> w(grid);
+    SStepLanczos( A, T, 40, ctrl );
+    HermitianEig( LOWER, T, w );
+    const Real wMin = w.GetLocal(0,0);
+    const Real wMax = w.GetLocal(T.Height()-1,0);
+    OutputFromRoot
+    (comm,"s-step Lanczos Ritz values lie in [",wMin,",",wMax,"]");
+    const Real tol = Real(n)*diagValue*limits::Epsilon<Real>();
+    if( wMin < Real(1)-tol || wMax > 2*diagValue-1+tol )
+        LogicError("s-step Lanczos Ritz values were out of bounds");
+    PopIndent();
+}
+
+// With a basis as large as the matrix, the extreme Ritz values of s-step
+// Lanczos must match the extreme eigenvalues from the dense eigensolver
+template<typename Field>
+void TestSStepLanczos( Int n1, Int n2, Int s, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing s-step Lanczos on a ",n1," x ",n2," grid with ",
+     TypeName<Field>());
+    PushIndent();
+
+    const Int n = n1*n2;
+    DistSparseMatrix<Field> A(grid);
+    Helmholtz( A, n1, n2, Field(-1) );
+
+    DistMatrix<Field> ADense(grid);
+    Copy( A, ADense );
+    DistMatrix<Real,STAR,STAR> wDense(grid);
+    HermitianEig( LOWER, ADense, wDense );
+    const Real wDenseMin = wDense.GetLocal(0,0);
+    const Real wDenseMax = wDense.GetLocal(n-1,0);
+
+    SStepCtrl<Real> ctrl;
+    ctrl.s = s;
+    DistMatrix<Real,STAR,STAR> T(grid), w(grid);
+    SStepLanczos( A, T, n, ctrl );
+    HermitianEig( LOWER, T, w );
+    const Real wMin = w.GetLocal(0,0);
+    const Real wMax = w.GetLocal(T.Height()-1,0);
+    const Real minError = Abs(wMin-wDenseMin) / wDenseMax;
+    const Real maxError = Abs(wMax-wDenseMax) / wDenseMax;
+    OutputFromRoot
+    (comm,"|wMin-wDenseMin| / || A ||_2 = ",minError,
+     ", |wMax-wDenseMax| / || A ||_2 = ",maxError);
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    if( minError > tol || maxError > tol )
+        LogicError("s-step Lanczos extreme Ritz values were inaccurate");
+    PopIndent();
+}
+
+// The default regularized solve control runs at most four iterations with
+// four-step blocks and restarts every four iterations. The step size must be
+// reduced so that the Arnoldi steps which determine the shifts still leave
+// room for a matrix-powers kernel. Since the operator has four distinct
+// eigenvalues, GMRES converges in exactly four iterations.
+template<typename Field>
+void TestRegSolveDefaults( Int n, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing the regularized solve defaults with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Zeros( A, n, n );
+    A.Reserve( A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Field(1+(i%4)) );
+    }
+    A.ProcessLocalQueues();
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& Z,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, Z, beta, Y );
+      };
+    auto precond = []( DistMultiVec<Field>& W ) { };
+
+    // Translate the controls in the same manner as the regularized solve
+    RegSolveCtrl<Real> regCtrl;
+    SStepCtrl<Real> ctrl;
+    ctrl.s = regCtrl.sStep;
+    ctrl.numBlocks = Max(regCtrl.restart/regCtrl.sStep,Int(1));
+    ctrl.relTol = regCtrl.relTol;
+    ctrl.maxIts = regCtrl.maxIts;
+
+    DistMultiVec<Field> B(grid), X(grid);
+    Uniform( B, n, 2 );
+    X = B;
+    SStepInfo info;
+    const Int numIts = SStepGMRES( applyA, precond, X, ctrl, info );
+    OutputFromRoot
+    (comm,numIts," iterations with ",info.numBlockSteps,
+     " matrix-powers kernels and ",info.numArnoldiSteps," Arnoldi steps");
+    if( info.numBlockSteps == 0 )
+        LogicError("No matrix-powers kernel was run");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int s = Input("--s","step size",4);
+        const Int numBlocks =
+          Input("--numBlocks","number of blocks per restart",5);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestSStepKrylov<double>
+        ( n1, n2, numRHS, s, numBlocks, progress, grid );
+        TestSStepKrylov<Complex<double>>
+        ( n1, n2, numRHS, s, numBlocks, progress, grid );
+        TestSStepLanczos<double>( 7, 9, s, grid );
+        TestSStepLanczos<Complex<double>>( 7, 9, s, grid );
+        TestRegSolveDefaults<double>( n1*n2, grid );
+        TestRegSolveDefaults<Complex<double>>( n1*n2, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -38,6 +38,9 @@ void TestSparseDirect
   Int nbSolve,
   bool natural,
   bool unpack,
+  const string& scratchDir,
+  Int maxResidentMB,
+  const string& analysisFile,
   bool print,
   bool display,
   const BisectCtrl& ctrl,
@@ -98,6 +101,34 @@ void TestSparseDirect
     timer.Stop();
     OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
 
+    // Repeating the analysis should only hit the symbolic cache
+    OutputFromRoot(grid.Comm(),"Repeating analysis...");
+    const Int numCacheHits = ldl::NumSymbolicCacheHits();
+    timer.Start();
+    if( natural )
+        sparseLDLFact.Initialize3DGridGraph
+        ( n1, n2, n3, A, hermitian, ctrl );
+    else
+        sparseLDLFact.Initialize( A, hermitian, ctrl );
+    mpi::Barrier( grid.Comm() );
+    timer.Stop();
+    OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
+    if( ldl::NumSymbolicCacheHits() != numCacheHits+1 )
+        LogicError("Repeated analysis did not hit the symbolic cache");
+
+    if( !analysisFile.empty() )
+    {
+        OutputFromRoot
+        (grid.Comm(),"Saving and reloading the analysis from ",analysisFile,
+         "...");
+        timer.Start();
+        sparseLDLFact.Save( analysisFile );
+        sparseLDLFact.Load( analysisFile, A, hermitian, ctrl );
+        mpi::Barrier( grid.Comm() );
+        timer.Stop();
+        OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
+    }
+
     const Int rootSepSize = sparseLDLFact.NodeInfo().size;
     OutputFromRoot(grid.Comm(),rootSepSize," vertices in root separator\n");
     // TODO(poulson): Update the following for the new data structures
@@ -140,6 +171,10 @@ void TestSparseDirect
      "  max entries:   ",maxLocalEntriesBefore,"\n",Indent(),
      "  total entries: ",entriesBefore,"\n");
 
+    // Spill the local fronts to disk during the factorization and solve
+    if( !scratchDir.empty() )
+        sparseLDLFact.SetOutOfCore( scratchDir, size_t(maxResidentMB)<<20 );
+
     OutputFromRoot(grid.Comm(),"Running LDL^T and redistribution...");
     SetBlocksize( nbFact );
     mpi::Barrier( grid.Comm() );
@@ -193,6 +228,18 @@ void TestSparseDirect
     const double solveGFlops = mpi::AllReduce( localSolveGFlops, grid.Comm() );
     const double solveSpeed = solveGFlops / factTime;
     OutputFromRoot(grid.Comm(),solveTime," seconds (",solveSpeed," GFlop/s)");
+    if( sparseLDLFact.OutOfCore() )
+    {
+        const auto& store = sparseLDLFact.FrontStore();
+        const double MB = 1 << 20;
+        const double writtenMB =
+          mpi::AllReduce( store.NumBytesWritten()/MB, grid.Comm() );
+        const double readMB =
+          mpi::AllReduce( store.NumBytesRead()/MB, grid.Comm() );
+        OutputFromRoot
+        (grid.Comm(),"Wrote ",writtenMB," MB of fronts and read back ",readMB,
+         " MB");
+    }
 
     OutputFromRoot(grid.Comm(),"Checking error in computed solution...");
     Matrix<Real> XNorms, YNorms;
@@ -236,7 +283,15 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool nativeBisect =
+          Input("--nativeBisect","force the native graph bisection?",false);
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
+        const string scratchDir =
+          Input("--scratchDir","directory for out-of-core fronts",string(""));
+        const Int maxResidentMB =
+          Input("--maxResidentMB","max. MB of resident local fronts",64);
+        const string analysisFile =
+          Input("--analysisFile","file for saving the analysis",string(""));
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
 #ifdef EL_HAVE_MPC
@@ -249,34 +304,42 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        if( nativeBisect )
+            ctrl.method = BISECT_NATIVE;
         const El::Grid grid(comm);
 
         // TODO(poulson): Call complex variants as well
 
         TestSparseDirect<float>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, scratchDir, maxResidentMB, analysisFile,
+          print, display, ctrl, grid );
         TestSparseDirect<double>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, scratchDir, maxResidentMB, analysisFile,
+          print, display, ctrl, grid );
 #ifdef EL_HAVE_QD
         TestSparseDirect<DoubleDouble>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, scratchDir, maxResidentMB, analysisFile,
+          print, display, ctrl, grid );
         TestSparseDirect<QuadDouble>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, scratchDir, maxResidentMB, analysisFile,
+          print, display, ctrl, grid );
 #endif
 #ifdef EL_HAVE_QUAD
         TestSparseDirect<Quad>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, scratchDir, maxResidentMB, analysisFile,
+          print, display, ctrl, grid );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
         TestSparseDirect<BigFloat>
         ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+          natural, unpack, scratchDir, maxResidentMB, analysisFile,
+          print, display, ctrl, grid );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSpectrumSlice
+( Int n1,
+  Int n2,
+  double lowerFrac,
+  double upperFrac,
+  Int numSubcomms,
+  Int maxSliceSize,
+  bool progress,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    const Int n = n1*n2;
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2 );
+    A *= Field(-1);
+
+    // Compute the reference spectrum with the dense eigensolver
+    DistMatrix<Field> ADense(grid);
+    Copy( A, ADense );
+    DistMatrix<Real,STAR,STAR> wDense(grid);
+    HermitianEig( LOWER, ADense, wDense );
+    const Real wMin = wDense.GetLocal(0,0);
+    const Real wMax = wDense.GetLocal(n-1,0);
+    const Real lowerBound = wMin + Real(lowerFrac)*(wMax-wMin);
+    const Real upperBound = wMin + Real(upperFrac)*(wMax-wMin);
+    vector<Real> wExpected;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real lambda = wDense.GetLocal(i,0);
+        if( lambda >= lowerBound && lambda < upperBound )
+            wExpected.push_back( lambda );
+    }
+    const Int numExpected = wExpected.size();
+
+    SpectrumSliceCtrl<Real> ctrl;
+    ctrl.numSubcomms = numSubcomms;
+    ctrl.maxSliceSize = maxSliceSize;
+    ctrl.progress = progress;
+
+    Matrix<Real> w;
+    DistMultiVec<Field> Z(grid);
+    Timer timer;
+    mpi::Barrier( comm );
+    timer.Start();
+    HermitianEig( A, lowerBound, upperBound, w, Z, ctrl );
+    mpi::Barrier( comm );
+    OutputFromRoot
+    (comm,"Found ",w.Height()," eigenpairs in [",lowerBound,",",upperBound,
+     ") in ",timer.Stop()," seconds");
+    if( w.Height() != numExpected )
+        LogicError
+        ("Expected ",numExpected," eigenvalues but found ",w.Height());
+
+    const Real normA = wMax;
+    Real maxEigError = 0;
+    for( Int j=0; j<numExpected; ++j )
+        maxEigError = Max( maxEigError, Abs(w(j)-wExpected[j]) );
+    maxEigError /= normA;
+    OutputFromRoot(comm,"max_j |w(j)-wDense(j)| / || A ||_2 = ",maxEigError);
+
+    // Form A Z - Z Lambda
+    DistMultiVec<Field> R(grid);
+    Zeros( R, n, numExpected );
+    Multiply( NORMAL, Field(1), A, Z, Field(0), R );
+    auto& RLoc = R.Matrix();
+    const auto& ZLoc = Z.LockedMatrix();
+    for( Int j=0; j<numExpected; ++j )
+        for( Int iLoc=0; iLoc<R.LocalHeight(); ++iLoc )
+            RLoc(iLoc,j) -= w(j)*ZLoc(iLoc,j);
+    const Real residError = FrobeniusNorm( R ) / normA;
+    OutputFromRoot(comm,"|| A Z - Z Lambda ||_F / || A ||_2 = ",residError);
+
+    // Form Z^H Z - I
+    Matrix<Field> E;
+    Gemm( ADJOINT, NORMAL, Field(1), ZLoc, ZLoc, E );
+    mpi::AllReduce( E.Buffer(), numExpected*numExpected, comm );
+    ShiftDiagonal( E, Field(-1) );
+    const Real orthogError = FrobeniusNorm( E );
+    OutputFromRoot(comm,"|| Z^H Z - I ||_F = ",orthogError);
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    if( maxEigError > tol || residError > tol || orthogError > tol )
+        LogicError("Unacceptably large spectrum slicing errors");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const double lowerFrac =
+          Input("--lowerFrac","relative lower bound of interval",0.1);
+        const double upperFrac =
+          Input("--upperFrac","relative upper bound of interval",0.3);
+        const Int numSubcomms =
+          Input("--numSubcomms","number of subcommunicators (0 for one per "
+                "process)",0);
+        const Int maxSliceSize =
+          Input("--maxSliceSize","maximum number of eigenvalues per slice",20);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestSpectrumSlice<double>
+        ( n1, n2, lowerFrac, upperFrac, numSubcomms, maxSliceSize, progress,
+          grid );
+        TestSpectrumSlice<Complex<double>>
+        ( n1, n2, lowerFrac, upperFrac, numSubcomms, maxSliceSize, progress,
+          grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -59,12 +59,10 @@ void TestQR
 ( const Grid& g,
   Int m,
   Int n,
+  const qr::TSQRCtrl<Base<F>>& ctrl,
   bool correctness,
   bool print )
 {
-    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
-    PushIndent();
-
     DistMatrix<F,VC,STAR> A(g), AFact(g);
     DistMatrix<F,STAR,STAR> R(g);
 
@@ -78,7 +76,7 @@ void TestQR
     OutputFromRoot(g.Comm(),"Starting TSQR factorization...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    qr::ExplicitTS( AFact, R );
+    qr::ExplicitTS( AFact, R, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
@@ -92,10 +90,45 @@ void TestQR
     }
     if( correctness )
         TestCorrectness( AFact, R, A );
-    PopIndent();
     OutputFromRoot(g.Comm(),"");
 }
 
+template<typename F>
+void TestQR
+( const Grid& g,
+  Int m,
+  Int n,
+  bool correctness,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    const bool powerOfTwo = PowerOfTwo( g.Size() );
+
+    qr::TSQRCtrl<Base<F>> ctrl;
+    if( powerOfTwo )
+    {
+        OutputFromRoot(g.Comm(),"Binary tree:");
+        TestQR<F>( g, m, n, ctrl, correctness, print );
+    }
+
+    OutputFromRoot(g.Comm(),"Flat tree:");
+    ctrl.tree = qr::TSQR_FLAT_TREE;
+    TestQR<F>( g, m, n, ctrl, correctness, print );
+
+    if( powerOfTwo )
+    {
+        OutputFromRoot(g.Comm(),"Butterfly tree:");
+        ctrl.tree = qr::TSQR_BUTTERFLY_TREE;
+        TestQR<F>( g, m, n, ctrl, correctness, print );
+    }
+
+    OutputFromRoot(g.Comm(),"CholeskyQR:");
+    ctrl.alg = qr::TSQR_CHOLESKY;
+    TestQR<F>( g, m, n, ctrl, correctness, print );
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
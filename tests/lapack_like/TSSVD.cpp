@@ -77,6 +77,7 @@ void TestSVD
 ( const Grid& g,
   Int m,
   Int n,
+  const qr::TSQRCtrl<Base<F>>& ctrl,
   bool correctness,
   bool print )
 {
@@ -95,7 +96,7 @@ void TestSVD
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    svd::TSQR( A, U, s, V );
+    svd::TSQR( A, U, s, V, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     OutputFromRoot(g.Comm(),"Time = ",runTime," seconds");
@@ -134,15 +135,30 @@ main( int argc, char* argv[] )
         ComplainIfDebug();
         OutputFromRoot(g.Comm(),"Will test TSSVD");
 
+        qr::TSQRCtrl<float> ctrlFloat;
+        qr::TSQRCtrl<double> ctrlDouble;
         TestSVD<float>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrlFloat, correctness, print );
         TestSVD<Complex<float>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrlFloat, correctness, print );
 
         TestSVD<double>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrlDouble, correctness, print );
         TestSVD<Complex<double>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, ctrlDouble, correctness, print );
+
+        OutputFromRoot(g.Comm(),"Will test TSSVD using CholeskyQR");
+        ctrlFloat.alg = qr::TSQR_CHOLESKY;
+        ctrlDouble.alg = qr::TSQR_CHOLESKY;
+        TestSVD<float>
+        ( g, m, n, ctrlFloat, correctness, print );
+        TestSVD<Complex<float>>
+        ( g, m, n, ctrlFloat, correctness, print );
+
+        TestSVD<double>
+        ( g, m, n, ctrlDouble, correctness, print );
+        TestSVD<Complex<double>>
+        ( g, m, n, ctrlDouble, correctness, print );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The adaptive run should approximate the unique minimizer (as given by
+// 'XRef', which is either the fixed-penalty solution or that of a more
+// accurate solver), and residual balancing should not require more iterations
+// than the fixed penalty
+template<typename Real>
+void CheckAdaptation
+( const DistMatrix<Real>& XRef,
+  const DistMatrix<Real>& XAdapt,
+  Int fixedIts,
+  Int adaptIts,
+  Real tol,
+  bool checkIts )
+{
+    mpi::Comm comm = XRef.Grid().Comm();
+    OutputFromRoot
+    (comm,fixedIts," iterations with a fixed penalty and ",adaptIts,
+     " with an adaptive penalty");
+    const Real XNorm = FrobeniusNorm( XRef );
+    DistMatrix<Real> diff( XAdapt );
+    diff -= XRef;
+    const Real relDiff = FrobeniusNorm( diff ) / (1+XNorm);
+    OutputFromRoot(comm,"|| XAdapt - XRef ||_F / (1 + || XRef ||_F) = ",
+      relDiff);
+    if( relDiff > tol )
+        LogicError("The adaptive penalty yielded an inaccurate solution");
+    if( checkIts && adaptIts > fixedIts )
+        LogicError("The adaptive penalty required more iterations");
+}
+
+template<typename Real>
+void TestBoxQP
+( Int m, Int n, Int k, Real rho, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing box QP ADMM with rho=",rho," and ",TypeName<Real>());
+    PushIndent();
+
+    // Form the strictly convex objective (1/2) x' (A' A / m + I) x + c' x
+    DistMatrix<Real> A(grid), Q(grid), C(grid);
+    Gaussian( A, m, n );
+    Identity( Q, n, n );
+    Herk( LOWER, ADJOINT, Real(1)/Real(m), A, Real(1), Q );
+    MakeHermitian( LOWER, Q );
+    Gaussian( C, n, k );
+    const Real lb = -1, ub = 1;
+
+    ADMMCtrl<Real> ctrl;
+    ctrl.rho = rho;
+    ctrl.maxIter = 10000;
+    ctrl.print = print;
+
+    DistMatrix<Real> XFixed(grid), XAdapt(grid);
+    ctrl.penaltyCtrl.adapt = false;
+    const Int fixedIts = qp::box::ADMM( Q, C, lb, ub, XFixed, ctrl );
+    ctrl.penaltyCtrl.adapt = true;
+    const Int adaptIts = qp::box::ADMM( Q, C, lb, ub, XAdapt, ctrl );
+    CheckAdaptation( XFixed, XAdapt, fixedIts, adaptIts, Real(1e-2), false );
+
+    PopIndent();
+}
+
+template<typename Real>
+void TestDirectLP
+( Int m, Int n, Real rho, bool inv, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing direct LP ADMM with rho=",rho,", inv=",inv," and ",
+     TypeName<Real>());
+    PushIndent();
+
+    // min c' x s.t. A x = b, x >= 0, which is feasible by construction and
+    // bounded since c > 0
+    DistMatrix<Real> A(grid), b(grid), c(grid), x0(grid);
+    Gaussian( A, m, n );
+    Uniform( x0, n, 1, Real(1), Real(1) );
+    Zeros( b, m, 1 );
+    Gemv( NORMAL, Real(1), A, x0, Real(0), b );
+    Uniform( c, n, 1, Real(1), Real(1)/Real(2) );
+
+    // A badly-scaled fixed penalty often fails to converge at all, so the
+    // adaptive solution is compared against that of the IPM
+    DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>> problem;
+    DirectLPSolution<DistMatrix<Real>> solution;
+    ForceSimpleAlignments( problem, grid );
+    ForceSimpleAlignments( solution, grid );
+    problem.A = A;
+    problem.b = b;
+    problem.c = c;
+    LP( problem, solution );
+
+    ADMMCtrl<Real> ctrl;
+    ctrl.rho = rho;
+    ctrl.inv = inv;
+    ctrl.maxIter = 40000;
+    ctrl.absTol = Real(1e-7);
+    ctrl.relTol = Real(1e-5);
+    ctrl.print = print;
+
+    DistMatrix<Real> zFixed(grid), zAdapt(grid);
+    ctrl.penaltyCtrl.adapt = false;
+    const Int fixedIts = lp::direct::ADMM( A, b, c, zFixed, ctrl );
+    ctrl.penaltyCtrl.adapt = true;
+    const Int adaptIts = lp::direct::ADMM( A, b, c, zAdapt, ctrl );
+    if( adaptIts >= ctrl.maxIter )
+        LogicError("The adaptive penalty did not converge");
+    CheckAdaptation
+    ( solution.x, zAdapt, fixedIts, adaptIts, Real(1e-2), true );
+
+    PopIndent();
+}
+
+template<typename Real>
+void TestRPCA( Int m, Int n, Int rank, Real beta, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing RPCA ADMM with beta=",beta," and ",TypeName<Real>());
+    PushIndent();
+
+    // M = U V' / rank + S, where S has roughly five percent of its entries
+    // corrupted
+    DistMatrix<Real> U(grid), V(grid), M(grid);
+    Uniform( U, m, rank );
+    Uniform( V, n, rank );
+    Zeros( M, m, n );
+    Gemm( NORMAL, ADJOINT, Real(1)/Real(rank), U, V, Real(0), M );
+    for( Int jLoc=0; jLoc<M.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<M.LocalHeight(); ++iLoc )
+            if( SampleUniform<Real>() <= Real(0.05) )
+                M.UpdateLocal( iLoc, jLoc, SampleUniform<Real>(-1,1) );
+
+    RPCACtrl<Real> ctrl;
+    ctrl.useALM = false;
+    ctrl.beta = beta;
+    ctrl.maxIts = 5000;
+    ctrl.tol = Real(1e-7);
+    ctrl.progress = print;
+
+    DistMatrix<Real> LFixed(grid), SFixed(grid), LAdapt(grid), SAdapt(grid);
+    ctrl.penaltyCtrl.adapt = false;
+    const Int fixedIts = RPCA( M, LFixed, SFixed, ctrl );
+    ctrl.penaltyCtrl.adapt = true;
+    const Int adaptIts = RPCA( M, LAdapt, SAdapt, ctrl );
+    CheckAdaptation( LFixed, LAdapt, fixedIts, adaptIts, Real(1e-3), true );
+
+    PopIndent();
+}
+
+template<typename Real>
+void TestSparseInvCov
+( Int n, Int numSamples, Real lambda, Real rho, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing sparse inverse covariance ADMM with rho=",rho," and ",
+     TypeName<Real>());
+    PushIndent();
+
+    DistMatrix<Real> D(grid);
+    Gaussian( D, numSamples, n );
+
+    SparseInvCovCtrl<Real> ctrl;
+    ctrl.rho = rho;
+    ctrl.maxIter = 20000;
+    ctrl.absTol = Real(1e-8);
+    ctrl.relTol = Real(1e-6);
+    ctrl.progress = print;
+
+    DistMatrix<Real> ZFixed(grid), ZAdapt(grid);
+    ctrl.penaltyCtrl.adapt = false;
+    const Int fixedIts = SparseInvCov( D, lambda, ZFixed, ctrl );
+    ctrl.penaltyCtrl.adapt = true;
+    const Int adaptIts = SparseInvCov( D, lambda, ZAdapt, ctrl );
+    CheckAdaptation( ZFixed, ZAdapt, fixedIts, adaptIts, Real(1e-3), true );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",200);
+        const Int n = Input("--n","width of A",100);
+        const Int k = Input("--k","number of right-hand sides",4);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        // A well-scaled penalty and two badly-scaled ones
+        TestBoxQP<double>( m, n, k, 1., print, grid );
+        TestBoxQP<double>( m, n, k, 0.05, print, grid );
+        TestBoxQP<double>( m, n, k, 20., print, grid );
+
+        // Residual balancing should pay off for badly-scaled penalties (the
+        // best fixed penalties for these LPs are between 0.1 and 100)
+        for( const bool inv : {true,false} )
+        {
+            TestDirectLP<double>( n/2, n, 0.001, inv, print, grid );
+            TestDirectLP<double>( n/2, n, 10000., inv, print, grid );
+        }
+        TestRPCA<double>( m, n, 5, 0.01, print, grid );
+        TestRPCA<double>( m, n, 5, 100., print, grid );
+        TestSparseInvCov<double>( n/2, m, 0.1, 0.01, print, grid );
+        TestSparseInvCov<double>( n/2, m, 0.1, 100., print, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
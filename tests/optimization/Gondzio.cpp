@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form a primal and dual feasible problem in direct conic form with the
+// m x 2m matrix A = [I, B], where B is bidiagonal (with wraparound), and the
+// symmetric positive-definite tridiagonal matrix Q = tridiag(-1/2,2,-1/2)
+template<typename Real>
+void FeasibleProblem
+( Int m,
+  DistSparseMatrix<Real>& Q,
+  DistSparseMatrix<Real>& A,
+  DistMultiVec<Real>& b,
+  DistMultiVec<Real>& c )
+{
+    const Int n = 2*m;
+    const Grid& grid = A.Grid();
+
+    A.Resize( m, n );
+    A.Reserve( 3*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Real(1) );
+        A.QueueLocalUpdate( iLoc, m+i, SampleUniform(Real(0.5),Real(1.5)) );
+        A.QueueLocalUpdate
+        ( iLoc, m+Mod(i+1,m), SampleUniform(Real(-1),Real(1)) );
+    }
+    A.ProcessLocalQueues();
+
+    Q.Resize( n, n );
+    Q.Reserve( 3*Q.LocalHeight() );
+    for( Int iLoc=0; iLoc<Q.LocalHeight(); ++iLoc )
+    {
+        const Int i = Q.GlobalRow(iLoc);
+        Q.QueueLocalUpdate( iLoc, i, Real(2) );
+        if( i > 0 )
+            Q.QueueLocalUpdate( iLoc, i-1, Real(-1)/Real(2) );
+        if( i < n-1 )
+            Q.QueueLocalUpdate( iLoc, i+1, Real(-1)/Real(2) );
+    }
+    Q.ProcessLocalQueues();
+
+    DistMultiVec<Real> xFeas(grid), yFeas(grid), zFeas(grid);
+    Uniform( xFeas, n, 1, Real(1), Real(0.5) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(0.5) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+    c = zFeas;
+    Multiply( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+}
+
+template<typename Real>
+void SetIterationLimit
+( MehrotraCtrl<Real>& ctrl, Int maxIts, Int maxCorrectors )
+{
+    ctrl.maxIts = maxIts;
+    ctrl.minTol = ctrl.targetTol;
+    ctrl.maxGondzioCorrectors = maxCorrectors;
+}
+
+// Since the Mehrotra drivers throw unless they reach 'minTol' within 'maxIts'
+// iterations, and a run with a smaller iteration limit is a prefix of a run
+// with a larger one, bisecting over the limit with 'minTol' set to
+// 'targetTol' yields the number of iterations through the public interface
+template<typename SolveType>
+Int IterationLimit( const SolveType& converges, Int maxIts )
+{
+    if( !converges(maxIts) )
+        LogicError("Did not converge within ",maxIts," iterations");
+    Int lower=0, upper=maxIts;
+    while( lower < upper )
+    {
+        const Int mid = (lower+upper)/2;
+        if( converges(mid) )
+            upper = mid;
+        else
+            lower = mid+1;
+    }
+    return upper;
+}
+
+template<typename Real>
+void TestGondzio
+( Int m, bool sparse, bool quadratic, Int maxCorrectors, Int maxIts,
+  const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing ",(sparse ? "sparse " : "dense "),
+     (quadratic ? "QP" : "LP")," with ",TypeName<Real>());
+    PushIndent();
+
+    DistSparseMatrix<Real> Q(grid), A(grid);
+    DistMultiVec<Real> b(grid), c(grid);
+    FeasibleProblem( m, Q, A, b, c );
+
+    DistMatrix<Real> QDense(grid), ADense(grid), bDense(grid), cDense(grid);
+    Copy( Q, QDense );
+    Copy( A, ADense );
+    Copy( b, bDense );
+    Copy( c, cDense );
+
+    // Attempt a solve with the given iteration limit and number of
+    // correctors and return whether the target tolerance was reached
+    auto solve =
+      [&]( Int limit, Int numCorrectors, DistMatrix<Real>& x ) -> bool
+      {
+          // The drivers do not restore the indentation when they throw
+          const Int indent = IndentLevel();
+          try
+          {
+              if( sparse && quadratic )
+              {
+                  DistMultiVec<Real> xVec(grid), y(grid), z(grid);
+                  qp::direct::Ctrl<Real> ctrl;
+                  SetIterationLimit( ctrl.mehrotraCtrl, limit, numCorrectors );
+                  QP( Q, A, b, c, xVec, y, z, ctrl );
+                  Copy( xVec, x );
+              }
+              else if( sparse )
+              {
+                  DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+                    problem;
+                  DirectLPSolution<DistMultiVec<Real>> solution;
+                  ForceSimpleAlignments( problem, grid );
+                  ForceSimpleAlignments( solution, grid );
+                  Copy( A, problem.A );
+                  Copy( b, problem.b );
+                  Copy( c, problem.c );
+                  lp::direct::Ctrl<Real> ctrl(true);
+                  SetIterationLimit( ctrl.mehrotraCtrl, limit, numCorrectors );
+                  LP( problem, solution, ctrl );
+                  Copy( solution.x, x );
+              }
+              else if( quadratic )
+              {
+                  DistMatrix<Real> y(grid), z(grid);
+                  qp::direct::Ctrl<Real> ctrl;
+                  SetIterationLimit( ctrl.mehrotraCtrl, limit, numCorrectors );
+                  QP( QDense, ADense, bDense, cDense, x, y, z, ctrl );
+              }
+              else
+              {
+                  DirectLPProblem<DistMatrix<Real>,DistMatrix<Real>> problem;
+                  DirectLPSolution<DistMatrix<Real>> solution;
+                  ForceSimpleAlignments( problem, grid );
+                  ForceSimpleAlignments( solution, grid );
+                  problem.A = ADense;
+                  problem.b = bDense;
+                  problem.c = cDense;
+                  lp::direct::Ctrl<Real> ctrl(false);
+                  SetIterationLimit( ctrl.mehrotraCtrl, limit, numCorrectors );
+                  LP( problem, solution, ctrl );
+                  x = solution.x;
+              }
+          }
+          catch( std::exception& )
+          {
+              SetIndent( indent );
+              return false;
+          }
+          return true;
+      };
+    auto objective =
+      [&]( const DistMatrix<Real>& x ) -> Real
+      {
+          Real value = Dot( cDense, x );
+          if( quadratic )
+          {
+              DistMatrix<Real> Qx(grid);
+              Gemv( NORMAL, Real(1), QDense, x, Qx );
+              value += Dot( x, Qx ) / Real(2);
+          }
+          return value;
+      };
+
+    DistMatrix<Real> xPlain(grid), xGondzio(grid);
+    const Int plainIts =
+      IterationLimit
+      ( [&]( Int limit ) { return solve( limit, 0, xPlain ); }, maxIts );
+    const Int gondzioIts =
+      IterationLimit
+      ( [&]( Int limit ) { return solve( limit, maxCorrectors, xGondzio ); },
+        maxIts );
+    OutputFromRoot
+    (comm,plainIts," iterations without correctors and ",gondzioIts,
+     " with up to ",maxCorrectors," Gondzio correctors");
+    if( gondzioIts > plainIts )
+        LogicError("Gondzio's correctors required more iterations");
+
+    // Both solves should reach the same optimum to within the accuracy
+    // implied by the target tolerance
+    solve( plainIts, 0, xPlain );
+    solve( gondzioIts, maxCorrectors, xGondzio );
+    const Real plainObj = objective( xPlain );
+    const Real gondzioObj = objective( xGondzio );
+    const Real relGap = Abs(plainObj-gondzioObj) / (1+Abs(plainObj));
+    OutputFromRoot
+    (comm,"Objectives of ",plainObj," and ",gondzioObj,
+     " have a relative difference of ",relGap);
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+    if( relGap > tol )
+        LogicError("The objectives differed by more than ",tol);
+    if( quadratic )
+    {
+        // The objective is strictly convex, so the minimizer is unique
+        DistMatrix<Real> diff( xGondzio );
+        diff -= xPlain;
+        const Real relDiff = FrobeniusNorm( diff ) / (1+FrobeniusNorm(xPlain));
+        OutputFromRoot
+        (comm,"|| xGondzio - xPlain ||_2 / (1 + || xPlain ||_2) = ",relDiff);
+        if( relDiff > tol )
+            LogicError("The primal solutions differed by more than ",tol);
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of constraints",60);
+        const Int maxCorrectors =
+          Input("--maxCorrectors","maximum number of Gondzio correctors",2);
+        const Int maxIts = Input("--maxIts","maximum number of iterations",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        for( const bool sparse : {false,true} )
+            for( const bool quadratic : {false,true} )
+                TestGondzio<double>
+                ( m, sparse, quadratic, maxCorrectors, maxIts, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
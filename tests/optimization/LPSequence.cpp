@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form the m x 2m matrix A = [I, B], where B is bidiagonal (with wraparound)
+template<typename Real>
+void StaircaseMatrix( DistSparseMatrix<Real>& A, Int m )
+{
+    A.Resize( m, 2*m );
+    A.Reserve( 3*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Real(1) );
+        A.QueueLocalUpdate( iLoc, m+i, SampleUniform(Real(0.5),Real(1.5)) );
+        A.QueueLocalUpdate
+        ( iLoc, m+Mod(i+1,m), SampleUniform(Real(-1),Real(1)) );
+    }
+    A.ProcessLocalQueues();
+}
+
+// Form the symmetric positive-definite tridiagonal matrix tridiag(-1/2,2,-1/2)
+template<typename Real>
+void TridiagonalMatrix( DistSparseMatrix<Real>& Q, Int n )
+{
+    Q.Resize( n, n );
+    Q.Reserve( 3*Q.LocalHeight() );
+    for( Int iLoc=0; iLoc<Q.LocalHeight(); ++iLoc )
+    {
+        const Int i = Q.GlobalRow(iLoc);
+        Q.QueueLocalUpdate( iLoc, i, Real(2) );
+        if( i > 0 )
+            Q.QueueLocalUpdate( iLoc, i-1, Real(-1)/Real(2) );
+        if( i < n-1 )
+            Q.QueueLocalUpdate( iLoc, i+1, Real(-1)/Real(2) );
+    }
+    Q.ProcessLocalQueues();
+}
+
+// Solve a sequence of perturbed LPs (or, if 'quadratic' is true, QPs) with
+// both a warm-started and a cold-started persistent solver. The warm-started
+// re-solves should require fewer iterations than the cold ones while reaching
+// the same objective, and both solvers should reuse their symbolic analyses.
+template<typename Real>
+void TestSequence
+( Int m, Int numSolves, bool quadratic, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing ",(quadratic ? "QP" : "LP")," sequence with ",
+     TypeName<Real>());
+    PushIndent();
+
+    const Int n = 2*m;
+    DistSparseMatrix<Real> Q(grid), A(grid);
+    DistMultiVec<Real> b(grid), c(grid);
+    StaircaseMatrix( A, m );
+    if( quadratic )
+        TridiagonalMatrix( Q, n );
+    else
+        Zeros( Q, n, n );
+
+    // Build a primal and dual feasible problem
+    DistMultiVec<Real> xFeas(grid), yFeas(grid), zFeas(grid);
+    Uniform( xFeas, n, 1, Real(1), Real(0.5) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1, Real(1), Real(0.5) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+    c = zFeas;
+    Multiply( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+
+    lp::direct::DistSparseMehrotraSolver<Real> lpWarm, lpCold;
+    qp::direct::DistSparseMehrotraSolver<Real> qpWarm, qpCold;
+    lpWarm.ctrl.print = print;
+    lpCold.ctrl.print = print;
+    qpWarm.ctrl.print = print;
+    qpCold.ctrl.print = print;
+    lpCold.warmStart = false;
+    qpCold.warmStart = false;
+    const Real tol = lpWarm.ctrl.minTol;
+    const Real objTol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    // Solve the current problem with the given solver (returning the number
+    // of IPM iterations) and check the primal residual
+    auto solveWith =
+      [&]( bool warm, DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+           DistMultiVec<Real>& z ) -> Int
+      {
+          const vector<IPMIterationInfo<Real>>* iterations;
+          if( quadratic )
+          {
+              auto& solver = warm ? qpWarm : qpCold;
+              solver.Solve( Q, A, b, c, x, y, z );
+              iterations = &solver.Iterations();
+          }
+          else
+          {
+              auto& solver = warm ? lpWarm : lpCold;
+              DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+                problem;
+              DirectLPSolution<DistMultiVec<Real>> solution;
+              ForceSimpleAlignments( problem, grid );
+              ForceSimpleAlignments( solution, grid );
+              problem.A = A;
+              problem.b = b;
+              problem.c = c;
+              solution.x = x;
+              solution.y = y;
+              solution.z = z;
+              solver.Solve( problem, solution );
+              x = solution.x;
+              y = solution.y;
+              z = solution.z;
+              iterations = &solver.Iterations();
+          }
+          DistMultiVec<Real> r(b);
+          Multiply( NORMAL, Real(1), A, x, Real(-1), r );
+          const Real relResid = FrobeniusNorm( r ) / (1+FrobeniusNorm(b));
+          if( relResid > tol )
+              LogicError
+              ("|| A x - b ||_2 / (1 + || b ||_2) = ",relResid,
+               " was unacceptably large");
+          return Int(iterations->size());
+      };
+    auto objective =
+      [&]( const DistMultiVec<Real>& x ) -> Real
+      {
+          DistMultiVec<Real> Qx(grid);
+          Zeros( Qx, n, 1 );
+          Multiply( NORMAL, Real(1), Q, x, Real(0), Qx );
+          return Dot( c, x ) + Dot( x, Qx ) / Real(2);
+      };
+
+    DistMultiVec<Real> xWarm(grid), yWarm(grid), zWarm(grid),
+                       xCold(grid), yCold(grid), zCold(grid), perturb(grid);
+    for( Int solve=0; solve<numSolves; ++solve )
+    {
+        if( solve > 0 )
+        {
+            // Perturb the values of A, b, and c while keeping the sparsity
+            // pattern of A fixed
+            A *= Real(1) + Real(1)/Real(100*(solve+1));
+            Uniform( perturb, m, 1, Real(0), Real(0.001) );
+            b += perturb;
+            Uniform( perturb, n, 1, Real(0), Real(0.001) );
+            c += perturb;
+        }
+
+        Timer timer;
+        mpi::Barrier( comm );
+        timer.Start();
+        const Int warmIts =
+          solveWith( true, xWarm, yWarm, zWarm );
+        mpi::Barrier( comm );
+        const double warmTime = timer.Stop();
+        timer.Start();
+        const Int coldIts =
+          solveWith( false, xCold, yCold, zCold );
+        mpi::Barrier( comm );
+        const double coldTime = timer.Stop();
+        OutputFromRoot
+        (comm,"Solve ",solve,": ",warmIts," warm-started iterations in ",
+         warmTime," seconds and ",coldIts," cold-started iterations in ",
+         coldTime," seconds");
+
+        const Real warmObj = objective( xWarm );
+        const Real coldObj = objective( xCold );
+        const Real relGap = Abs(warmObj-coldObj) / (1+Abs(coldObj));
+        OutputFromRoot
+        (comm,"Objectives of ",warmObj," and ",coldObj,
+         " have a relative difference of ",relGap);
+        if( relGap > objTol )
+            LogicError("The objectives differed by more than ",objTol);
+        if( solve > 0 && warmIts >= coldIts )
+            LogicError
+            ("The warm start did not reduce the number of iterations");
+    }
+
+    // The symbolic analysis should have been reused by every solve after
+    // the first
+    const Int numAnalyses =
+      quadratic ? qpWarm.NumAnalyses() : lpWarm.NumAnalyses();
+    const Int numWarmSolves =
+      quadratic ? qpWarm.NumSolves() : lpWarm.NumSolves();
+    OutputFromRoot
+    (comm,numAnalyses," symbolic analyses for ",numWarmSolves,
+     " warm-started solves");
+    if( numAnalyses != 1 )
+        LogicError("The symbolic analysis was not reused");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of constraints",400);
+        const Int numSolves = Input("--numSolves","number of solves",4);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        for( const bool quadratic : {false,true} )
+            TestSequence<double>( m, numSolves, quadratic, print, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
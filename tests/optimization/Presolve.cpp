@@ -0,0 +1,362 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A deterministic sequence in [0,1) so that every process forms the same
+// problem
+template<typename Real>
+Real Pseudo( Int k )
+{ return Real((37*k+11) % 97) / Real(97); }
+
+// Form a primal and dual feasible sparse LP whose equality constraints
+// consist of m0 rows of the m0 x 2m0 matrix [I, B], where B is bidiagonal
+// (with wraparound), along with
+//
+//  - a singleton row which fixes a variable,
+//  - an empty row,
+//  - a duplicate (multiple) of one of the rows of [I, B], and
+//  - a row holding a column singleton whose nonnegativity is implied.
+//
+// In the affine form, the nonnegativity of every other variable is expressed
+// through singleton rows of G, and one more variable is fixed by a pair of
+// opposing inequalities.
+template<typename Real>
+void StructuredLP
+( Int m0, bool affine,
+  SparseMatrix<Real>& A, Matrix<Real>& b,
+  SparseMatrix<Real>& G, Matrix<Real>& h,
+  Matrix<Real>& c )
+{
+    if( m0 < 3 )
+        LogicError("StructuredLP requires at least three core rows");
+    const Int n0 = 2*m0;
+    const Int fixedCol = n0, freeCol = n0+1, boundCol = n0+2;
+    const Int singletonRow = m0, duplicateRow = m0+2, freeRow = m0+3;
+    const Int m = m0+4;
+    const Int n = n0+3;
+
+    Zeros( A, m, n );
+    A.Reserve( 3*m0+9 );
+    for( Int i=0; i<m0; ++i )
+    {
+        const Real beta = Real(1)/Real(2) + Pseudo<Real>(i);
+        const Real gamma = 2*Pseudo<Real>(i+m0) - 1;
+        A.QueueUpdate( i, i, Real(1) );
+        A.QueueUpdate( i, m0+i, beta );
+        A.QueueUpdate( i, m0+Mod(i+1,m0), gamma );
+        if( i == 1 )
+        {
+            A.QueueUpdate( duplicateRow, i, Real(2) );
+            A.QueueUpdate( duplicateRow, m0+i, 2*beta );
+            A.QueueUpdate( duplicateRow, m0+Mod(i+1,m0), 2*gamma );
+        }
+    }
+    A.QueueUpdate( 0, fixedCol, Real(1) );
+    A.QueueUpdate( 2, boundCol, Real(1) );
+    A.QueueUpdate( singletonRow, fixedCol, Real(2) );
+    A.QueueUpdate( freeRow, freeCol, Real(1) );
+    A.QueueUpdate( freeRow, m0, Real(-1) );
+    A.QueueUpdate( freeRow, m0+1, Real(-1) );
+    A.ProcessQueues();
+
+    // The free column singleton is implied to be at least one
+    Matrix<Real> xFeas, yFeas;
+    Zeros( xFeas, n, 1 );
+    for( Int j=0; j<n; ++j )
+        xFeas(j) = Real(1)/Real(2) + Pseudo<Real>(j);
+    xFeas(freeCol) = 1 + xFeas(m0) + xFeas(m0+1);
+    Zeros( yFeas, m, 1 );
+    for( Int i=0; i<m; ++i )
+        yFeas(i) = 2*Pseudo<Real>(i+1) - 1;
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+
+    if( affine )
+    {
+        const Int k = n+1;
+        Zeros( G, k, n );
+        Zeros( h, k, 1 );
+        G.Reserve( k );
+        Int row = 0;
+        for( Int j=0; j<n; ++j )
+            if( j != freeCol )
+                G.QueueUpdate( row++, j, Real(-1) );
+        G.QueueUpdate( row, boundCol, Real(1) );
+        h(row++) = xFeas(boundCol);
+        G.QueueUpdate( row, boundCol, Real(-1) );
+        h(row++) = -xFeas(boundCol);
+        G.ProcessQueues();
+
+        // c = -A^T y - G^T z for some z > 0
+        Matrix<Real> zFeas;
+        Zeros( zFeas, k, 1 );
+        for( Int i=0; i<k; ++i )
+            zFeas(i) = Real(1)/Real(2) + Pseudo<Real>(i+2);
+        Zeros( c, n, 1 );
+        Multiply( TRANSPOSE, Real(-1), A, yFeas, Real(0), c );
+        Multiply( TRANSPOSE, Real(-1), G, zFeas, Real(1), c );
+    }
+    else
+    {
+        // c = z - A^T y for some z > 0
+        Zeros( c, n, 1 );
+        for( Int j=0; j<n; ++j )
+            c(j) = Real(1)/Real(2) + Pseudo<Real>(j+2);
+        Multiply( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+    }
+}
+
+template<typename Real>
+void Distribute( const SparseMatrix<Real>& A, DistSparseMatrix<Real>& ADist )
+{
+    ADist.Resize( A.Height(), A.Width() );
+    const Int firstLocalRow = ADist.FirstLocalRow();
+    const Int localHeight = ADist.LocalHeight();
+    ADist.Reserve( A.NumEntries() );
+    for( Int e=0; e<A.NumEntries(); ++e )
+    {
+        const Int iLoc = A.Row(e) - firstLocalRow;
+        if( iLoc >= 0 && iLoc < localHeight )
+            ADist.QueueLocalUpdate( iLoc, A.Col(e), A.Value(e) );
+    }
+    ADist.ProcessLocalQueues();
+}
+
+template<typename Real>
+void Distribute( const Matrix<Real>& x, DistMultiVec<Real>& xDist )
+{
+    xDist.Resize( x.Height(), 1 );
+    for( Int iLoc=0; iLoc<xDist.LocalHeight(); ++iLoc )
+        xDist.SetLocal( iLoc, 0, x(xDist.GlobalRow(iLoc)) );
+}
+
+template<typename Real>
+Real MinEntry( const Matrix<Real>& x )
+{
+    Real minEntry = limits::Infinity<Real>();
+    for( Int i=0; i<x.Height(); ++i )
+        minEntry = Min( minEntry, x(i) );
+    return minEntry;
+}
+
+template<typename Real>
+Real MinEntry( const DistMultiVec<Real>& x )
+{
+    Real minLocal = MinEntry( x.LockedMatrix() );
+    return mpi::AllReduce( minLocal, mpi::MIN, x.Grid().Comm() );
+}
+
+template<typename Real>
+void CheckFeasibility
+( Real primalResid, Real dualResid, Real relGap, Real primalConeMin,
+  Real dualConeMin, Real tol, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"primal residual: ",primalResid,", dual residual: ",dualResid,
+     ", relative gap: ",relGap);
+    OutputFromRoot
+    (comm,"minimum primal cone entry: ",primalConeMin,
+     ", minimum dual cone entry: ",dualConeMin);
+    if( primalResid > tol )
+        LogicError("The postsolved solution was not primal feasible");
+    if( dualResid > tol )
+        LogicError("The postsolved solution was not dual feasible");
+    if( relGap > tol )
+        LogicError("The postsolved solution had a large duality gap");
+    if( primalConeMin < -tol || dualConeMin < -tol )
+        LogicError("The postsolved solution left the cone");
+}
+
+// Check || A x - b ||, || A^T y - z + c ||, and the duality gap, as well as
+// the nonnegativity of x and z
+template<typename Real,typename MatrixType,typename VectorType>
+void CheckSolution
+( const DirectLPProblem<MatrixType,VectorType>& problem,
+  const DirectLPSolution<VectorType>& solution,
+  Real tol, mpi::Comm comm )
+{
+    VectorType rPrimal( problem.b );
+    Multiply( NORMAL, Real(1), problem.A, solution.x, Real(-1), rPrimal );
+    const Real primalResid =
+      FrobeniusNorm( rPrimal ) / (1+FrobeniusNorm(problem.b));
+
+    VectorType rDual( problem.c );
+    Multiply( TRANSPOSE, Real(1), problem.A, solution.y, Real(1), rDual );
+    rDual -= solution.z;
+    const Real dualResid =
+      FrobeniusNorm( rDual ) / (1+FrobeniusNorm(problem.c));
+
+    const Real primalObj = Dot( problem.c, solution.x );
+    const Real dualObj = -Dot( problem.b, solution.y );
+    const Real relGap = Abs(primalObj-dualObj) / (1+Abs(primalObj));
+
+    CheckFeasibility
+    ( primalResid, dualResid, relGap,
+      MinEntry(solution.x), MinEntry(solution.z), tol, comm );
+}
+
+// Check || A x - b ||, || G x + s - h ||, || A^T y + G^T z + c ||, and the
+// duality gap, as well as the nonnegativity of s and z
+template<typename Real,typename MatrixType,typename VectorType>
+void CheckSolution
+( const AffineLPProblem<MatrixType,VectorType>& problem,
+  const AffineLPSolution<VectorType>& solution,
+  Real tol, mpi::Comm comm )
+{
+    VectorType rEquality( problem.b );
+    Multiply( NORMAL, Real(1), problem.A, solution.x, Real(-1), rEquality );
+    VectorType rCone( problem.h );
+    Multiply( NORMAL, Real(1), problem.G, solution.x, Real(-1), rCone );
+    rCone += solution.s;
+    const Real primalResid =
+      (FrobeniusNorm(rEquality) + FrobeniusNorm(rCone)) /
+      (1+FrobeniusNorm(problem.b)+FrobeniusNorm(problem.h));
+
+    VectorType rDual( problem.c );
+    Multiply( TRANSPOSE, Real(1), problem.A, solution.y, Real(1), rDual );
+    Multiply( TRANSPOSE, Real(1), problem.G, solution.z, Real(1), rDual );
+    const Real dualResid =
+      FrobeniusNorm( rDual ) / (1+FrobeniusNorm(problem.c));
+
+    const Real primalObj = Dot( problem.c, solution.x );
+    const Real dualObj =
+      -Dot( problem.b, solution.y ) - Dot( problem.h, solution.z );
+    const Real relGap = Abs(primalObj-dualObj) / (1+Abs(primalObj));
+
+    CheckFeasibility
+    ( primalResid, dualResid, relGap,
+      MinEntry(solution.s), MinEntry(solution.z), tol, comm );
+}
+
+// Solve the problem with and without presolve and compare the results
+template<typename Real,typename ProblemType,typename SolutionType,
+         typename CtrlType>
+void ComparePresolve
+( const ProblemType& problem, CtrlType& ctrl, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+
+    SolutionType solution, presolvedSolution;
+    ForceSimpleAlignments( solution, grid );
+    ForceSimpleAlignments( presolvedSolution, grid );
+    ctrl.mehrotraCtrl.print = print;
+    ctrl.presolveCtrl.print = print;
+
+    ctrl.presolve = false;
+    LP( problem, solution, ctrl );
+    ctrl.presolve = true;
+    LP( problem, presolvedSolution, ctrl );
+
+    const Real objective = Dot( problem.c, solution.x );
+    const Real presolvedObjective = Dot( problem.c, presolvedSolution.x );
+    const Real relDiff =
+      Abs(objective-presolvedObjective) / (1+Abs(objective));
+    OutputFromRoot
+    (comm,"Objective of ",objective," without presolve and ",
+     presolvedObjective," with presolve");
+    if( relDiff > tol )
+        LogicError
+        ("Presolve changed the objective by a relative amount of ",relDiff);
+    CheckSolution( problem, presolvedSolution, tol, comm );
+}
+
+template<typename Real>
+void TestPresolve( Int m0, bool print, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<Real>());
+    PushIndent();
+
+    for( const bool affine : {false,true} )
+    {
+        SparseMatrix<Real> A, G;
+        Matrix<Real> b, c, h;
+        StructuredLP( m0, affine, A, b, G, h, c );
+        if( affine )
+        {
+            OutputFromRoot(comm,"Sequential affine form:");
+            PushIndent();
+            AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> problem;
+            problem.A = A;
+            problem.G = G;
+            problem.b = b;
+            problem.c = c;
+            problem.h = h;
+            lp::affine::Ctrl<Real> ctrl;
+            ComparePresolve<Real,decltype(problem),
+              AffineLPSolution<Matrix<Real>>>( problem, ctrl, print, grid );
+            PopIndent();
+
+            OutputFromRoot(comm,"Distributed affine form:");
+            PushIndent();
+            AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+              distProblem;
+            ForceSimpleAlignments( distProblem, grid );
+            Distribute( A, distProblem.A );
+            Distribute( G, distProblem.G );
+            Distribute( b, distProblem.b );
+            Distribute( c, distProblem.c );
+            Distribute( h, distProblem.h );
+            ComparePresolve<Real,decltype(distProblem),
+              AffineLPSolution<DistMultiVec<Real>>>
+            ( distProblem, ctrl, print, grid );
+            PopIndent();
+        }
+        else
+        {
+            OutputFromRoot(comm,"Sequential direct form:");
+            PushIndent();
+            DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> problem;
+            problem.A = A;
+            problem.b = b;
+            problem.c = c;
+            lp::direct::Ctrl<Real> ctrl(true);
+            ComparePresolve<Real,decltype(problem),
+              DirectLPSolution<Matrix<Real>>>( problem, ctrl, print, grid );
+            PopIndent();
+
+            OutputFromRoot(comm,"Distributed direct form:");
+            PushIndent();
+            DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>
+              distProblem;
+            ForceSimpleAlignments( distProblem, grid );
+            Distribute( A, distProblem.A );
+            Distribute( b, distProblem.b );
+            Distribute( c, distProblem.c );
+            ComparePresolve<Real,decltype(distProblem),
+              DirectLPSolution<DistMultiVec<Real>>>
+            ( distProblem, ctrl, print, grid );
+            PopIndent();
+        }
+    }
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m0 = Input("--m0","number of rows of [I, B]",50);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestPresolve<double>( m0, print, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The same problem in the free MPS format (with a ranged equality row, an
+// empty row, and integrality markers) and in the CPLEX LP format
+const char* mpsString =
+"* A test problem\n"
+"NAME TESTLP\n"
+"OBJSENSE\n"
+"    MAX\n"
+"ROWS\n"
+" N COST\n"
+" L LIM1\n"
+" G LIM2\n"
+" E MYEQN\n"
+" E RNG\n"
+" L EMPTY\n"
+"COLUMNS\n"
+"    MARKER 'MARKER' 'INTORG'\n"
+"    X1 COST 1.0 LIM1 1.0\n"
+"    X1 LIM2 1.0 RNG 1.0\n"
+"    MARKER 'MARKER' 'INTEND'\n"
+"    X2 COST 2.0 LIM1 1.0\n"
+"    X2 MYEQN -1.0\n"
+"    X3 COST -1.0 MYEQN 1.0\n"
+"    X3 RNG 1.0\n"
+"RHS\n"
+"    RHS LIM1 4.0 LIM2 1.0\n"
+"    RHS MYEQN 7.0 RNG 2.0\n"
+"RANGES\n"
+"    RNG RNG 2.0\n"
+"BOUNDS\n"
+" UP BND X1 4.0\n"
+" LO BND X2 -1.0\n"
+" UP BND X2 1.0\n"
+" FR BND X3\n"
+"ENDATA\n";
+
+const char* lpString =
+"\\ The same test problem\n"
+"Maximize\n"
+" obj: X1 + 2 X2\n"
+"   - X3\n"
+"Subject To\n"
+" LIM1: X1 + X2 <= 4\n"
+" LIM2: X1 >= 1\n"
+" MYEQN: - X2 + X3 = 7\n"
+" RNG: 2 <= X1 + X3 <= 4\n"
+"Bounds\n"
+" X1 <= 4\n"
+" -1 <= X2 <= 1\n"
+" X3 free\n"
+"Generals\n"
+" X1\n"
+"End\n";
+
+template<typename Real>
+Real Difference
+( const AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem0,
+  const AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem1 )
+{
+    if( problem0.A.Height() != problem1.A.Height() ||
+        problem0.A.Width() != problem1.A.Width() ||
+        problem0.G.Height() != problem1.G.Height() )
+        LogicError("Problem dimensions differ");
+    Matrix<Real> diff;
+    Real maxDiff = 0;
+    diff = problem0.c; diff -= problem1.c;
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    diff = problem0.A; diff -= problem1.A;
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    diff = problem0.b; diff -= problem1.b;
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    diff = problem0.G; diff -= problem1.G;
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    diff = problem0.h; diff -= problem1.h;
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    return maxDiff;
+}
+
+template<typename Real>
+Real Difference
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem0,
+  const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem1 )
+{
+    if( problem0.A.Height() != problem1.A.Height() ||
+        problem0.A.Width() != problem1.A.Width() ||
+        problem0.G.Height() != problem1.G.Height() )
+        LogicError("Problem dimensions differ");
+    DistSparseMatrix<Real> diffMatrix(problem0.A.Grid());
+    DistMultiVec<Real> diff(problem0.A.Grid());
+    Real maxDiff = 0;
+    diff = problem0.c; Axpy( Real(-1), problem1.c, diff );
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    diffMatrix = problem0.A; Axpy( Real(-1), problem1.A, diffMatrix );
+    maxDiff = Max( maxDiff, FrobeniusNorm(diffMatrix) );
+    diff = problem0.b; Axpy( Real(-1), problem1.b, diff );
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    diffMatrix = problem0.G; Axpy( Real(-1), problem1.G, diffMatrix );
+    maxDiff = Max( maxDiff, FrobeniusNorm(diffMatrix) );
+    diff = problem0.h; Axpy( Real(-1), problem1.h, diff );
+    maxDiff = Max( maxDiff, MaxNorm(diff) );
+    return maxDiff;
+}
+
+void TestReadLP( const Grid& grid, bool print )
+{
+    mpi::Comm comm = grid.Comm();
+    const string mpsFile = "ReadLP-test.mps";
+    const string lpFile = "ReadLP-test.lp";
+    const string compressedFile = "ReadLP-test.mps.gz";
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ofstream mps( mpsFile.c_str() );
+        mps << mpsString;
+        std::ofstream lp( lpFile.c_str() );
+        lp << lpString;
+    }
+    mpi::Barrier( comm );
+
+    OutputFromRoot(comm,"Testing sequential readers");
+    AffineLPProblem<Matrix<double>,Matrix<double>> problem, lpProblem;
+    ReadMPS( problem, mpsFile, false, true, true, print );
+    ReadCPLEXLP( lpProblem, lpFile, false, print );
+    if( problem.A.Height() != 1 || problem.G.Height() != 8 ||
+        problem.A.Width() != 3 )
+        LogicError
+        ("Expected a 1 x 3 equality and 8 x 3 inequality matrix, but found ",
+         problem.A.Height()," x ",problem.A.Width()," and ",
+         problem.G.Height()," x ",problem.G.Width());
+    if( Difference( problem, lpProblem ) != 0. )
+        LogicError("The MPS and LP readers disagreed");
+
+    OutputFromRoot(comm,"Testing distributed readers");
+    AffineLPProblem<DistSparseMatrix<double>,DistMultiVec<double>>
+      distProblem, distLPProblem;
+    ForceSimpleAlignments( distProblem, grid );
+    ForceSimpleAlignments( distLPProblem, grid );
+    ReadMPS( distProblem, mpsFile, false, true, true, print );
+    ReadCPLEXLP( distLPProblem, lpFile, false, print );
+    if( Difference( distProblem, distLPProblem ) != 0. )
+        LogicError("The distributed MPS and LP readers disagreed");
+
+#ifdef EL_HAVE_ZLIB
+    OutputFromRoot(comm,"Testing a compressed MPS file");
+    if( mpi::Rank(comm) == 0 )
+        CompressMPS( mpsFile, compressedFile );
+    mpi::Barrier( comm );
+    AffineLPProblem<Matrix<double>,Matrix<double>> compressedProblem;
+    ReadMPS( compressedProblem, compressedFile, true, true, true, print );
+    if( Difference( problem, compressedProblem ) != 0. )
+        LogicError("The compressed and uncompressed MPS readers disagreed");
+#endif
+
+    mpi::Barrier( comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::remove( mpsFile.c_str() );
+        std::remove( lpFile.c_str() );
+        std::remove( compressedFile.c_str() );
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool print = Input("--print","print metadata?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestReadLP( grid, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}